@@ -1791,6 +1791,12 @@ class Query {
   bool get_is_unionall() const { return is_unionall; }
   int get_result_table_id() const { return result_table_id; }
   const std::list<int>& get_result_col_list() const { return result_col_list; }
+  const std::vector<std::vector<std::shared_ptr<TargetEntry>>>& get_values_lists() const {
+    return values_lists;
+  }
+  std::vector<std::vector<std::shared_ptr<TargetEntry>>>& get_values_lists() {
+    return values_lists;
+  }
   void set_result_col_list(const std::list<int>& col_list) { result_col_list = col_list; }
   void set_result_table_id(int id) { result_table_id = id; }
   void set_is_distinct(bool d) { is_distinct = d; }
@@ -1827,6 +1833,8 @@ class Query {
   int num_aggs;                    // number of aggregate functions in query
   int result_table_id;             // for INSERT statements only
   std::list<int> result_col_list;  // for INSERT statement only
+  std::vector<std::vector<std::shared_ptr<TargetEntry>>>
+      values_lists;  // rows of INSERT ... VALUES statement only
   int64_t limit;                   // row count for LIMIT clause.  0 means ALL
   int64_t offset;                  // offset in OFFSET clause.  0 means no offset.
 };
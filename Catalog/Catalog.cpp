@@ -61,6 +61,7 @@
 #include "DataMgr/ForeignStorage/AbstractFileStorageDataWrapper.h"
 #include "DataMgr/ForeignStorage/ForeignStorageInterface.h"
 #include "Fragmenter/Fragmenter.h"
+#include "Fragmenter/InsertWriteAheadLog.h"
 #include "Fragmenter/SortedOrderFragmenter.h"
 #include "LockMgr/LockMgr.h"
 #include "MigrationMgr/MigrationMgr.h"
@@ -290,6 +291,11 @@ void Catalog::updateTableDescriptorSchema() {
       string queryString("ALTER TABLE mapd_tables ADD is_system_table BOOLEAN DEFAULT 0");
       sqliteConnector_.query(queryString);
     }
+    if (std::find(cols.begin(), cols.end(), std::string("compaction_fill_percent")) ==
+        cols.end()) {
+      sqliteConnector_.query(
+          "ALTER TABLE mapd_tables ADD compaction_fill_percent INTEGER DEFAULT 0");
+    }
   } catch (std::exception& e) {
     sqliteConnector_.query("ROLLBACK TRANSACTION");
     throw;
@@ -680,6 +686,18 @@ void Catalog::updateCustomExpressionsSchema() {
   sqliteConnector_.query("END TRANSACTION");
 }
 
+void Catalog::updateColumnStatisticsSchema() {
+  cat_sqlite_lock sqlite_lock(getObjForLock());
+  sqliteConnector_.query("BEGIN TRANSACTION");
+  try {
+    sqliteConnector_.query(getColumnStatisticsSchema(true));
+  } catch (const std::exception& e) {
+    sqliteConnector_.query("ROLLBACK TRANSACTION");
+    throw;
+  }
+  sqliteConnector_.query("END TRANSACTION");
+}
+
 const std::string Catalog::getForeignServerSchema(bool if_not_exists) {
   return "CREATE TABLE " + (if_not_exists ? std::string{"IF NOT EXISTS "} : "") +
          "omnisci_foreign_servers(id integer primary key, name text unique, " +
@@ -702,6 +720,13 @@ const std::string Catalog::getCustomExpressionsSchema(bool if_not_exists) {
          "data_source_id integer, is_deleted boolean)";
 }
 
+const std::string Catalog::getColumnStatisticsSchema(bool if_not_exists) {
+  return "CREATE TABLE " + (if_not_exists ? std::string{"IF NOT EXISTS "} : "") +
+         "omnisci_column_statistics(table_id integer, column_id integer, " +
+         "row_count integer, null_count integer, ndv_sketch text, histogram text, " +
+         "primary key(table_id, column_id))";
+}
+
 void Catalog::recordOwnershipOfObjectsInObjectPermissions() {
   cat_sqlite_lock sqlite_lock(getObjForLock());
   sqliteConnector_.query("BEGIN TRANSACTION");
@@ -930,6 +955,7 @@ void Catalog::CheckAndExecuteMigrations() {
     updateFsiSchemas();
   }
   updateCustomExpressionsSchema();
+  updateColumnStatisticsSchema();
   updateDefaultColumnValues();
 }
 
@@ -991,8 +1017,8 @@ void Catalog::buildMaps() {
       "SELECT tableid, name, ncolumns, isview, fragments, frag_type, max_frag_rows, "
       "max_chunk_size, frag_page_size, "
       "max_rows, partitions, shard_column_id, shard, num_shards, key_metainfo, userid, "
-      "sort_column_id, storage_type, max_rollback_epochs, is_system_table "
-      "from mapd_tables");
+      "sort_column_id, storage_type, max_rollback_epochs, is_system_table, "
+      "compaction_fill_percent from mapd_tables");
   sqliteConnector_.query(tableQuery);
   numRows = sqliteConnector_.getNumRows();
   for (size_t r = 0; r < numRows; ++r) {
@@ -1038,6 +1064,7 @@ void Catalog::buildMaps() {
     }
     td->maxRollbackEpochs = sqliteConnector_.getData<int>(r, 18);
     td->is_system_table = sqliteConnector_.getData<bool>(r, 19);
+    td->compactionFillPercent = sqliteConnector_.getData<int>(r, 20);
     td->hasDeletedCol = false;
 
     tableDescriptorMap_[to_upper(td->tableName)] = td;
@@ -1184,6 +1211,7 @@ void Catalog::buildMaps() {
   }
 
   buildCustomExpressionsMap();
+  buildColumnStatisticsMap();
 }
 
 void Catalog::buildCustomExpressionsMap() {
@@ -1198,6 +1226,24 @@ void Catalog::buildCustomExpressionsMap() {
   }
 }
 
+void Catalog::buildColumnStatisticsMap() {
+  sqliteConnector_.query(
+      "SELECT table_id, column_id, row_count, null_count, ndv_sketch, histogram "
+      "FROM omnisci_column_statistics");
+  auto num_rows = sqliteConnector_.getNumRows();
+  std::lock_guard<std::mutex> lock(column_statistics_mutex_);
+  for (size_t row = 0; row < num_rows; row++) {
+    auto table_id = sqliteConnector_.getData<int>(row, 0);
+    auto column_id = sqliteConnector_.getData<int>(row, 1);
+    column_statistics_[table_id].emplace(
+        column_id,
+        ColumnStatistics::deserialize(sqliteConnector_.getData<int64_t>(row, 2),
+                                      sqliteConnector_.getData<int64_t>(row, 3),
+                                      sqliteConnector_.getData<string>(row, 4),
+                                      sqliteConnector_.getData<string>(row, 5)));
+  }
+}
+
 std::unique_ptr<CustomExpression> Catalog::getCustomExpressionFromConnector(size_t row) {
   auto id = sqliteConnector_.getData<int>(row, 0);
   auto name = sqliteConnector_.getData<string>(row, 1);
@@ -1292,6 +1338,11 @@ void Catalog::removeTableFromMap(const string& tableName,
 
   tableDescriptorMapById_.erase(tableDescIt);
   tableDescriptorMap_.erase(to_upper(tableName));
+  {
+    std::lock_guard<std::mutex> lock(column_statistics_mutex_);
+    column_statistics_.erase(tableId);
+    tables_with_unpersisted_statistics_.erase(tableId);
+  }
   td->fragmenter = nullptr;
 
   bool isTemp = td->persistenceLevel == Data_Namespace::MemoryLevel::CPU_LEVEL;
@@ -2321,7 +2372,7 @@ void Catalog::createTable(
   if (td.persistenceLevel == Data_Namespace::MemoryLevel::DISK_LEVEL) {
     try {
       sqliteConnector_.query_with_text_params(
-          R"(INSERT INTO mapd_tables (name, userid, ncolumns, isview, fragments, frag_type, max_frag_rows, max_chunk_size, frag_page_size, max_rows, partitions, shard_column_id, shard, num_shards, sort_column_id, storage_type, max_rollback_epochs, is_system_table, key_metainfo) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?))",
+          R"(INSERT INTO mapd_tables (name, userid, ncolumns, isview, fragments, frag_type, max_frag_rows, max_chunk_size, frag_page_size, max_rows, partitions, shard_column_id, shard, num_shards, sort_column_id, storage_type, max_rollback_epochs, is_system_table, compaction_fill_percent, key_metainfo) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?))",
           std::vector<std::string>{td.tableName,
                                    std::to_string(td.userId),
                                    std::to_string(td.nColumns),
@@ -2340,6 +2391,7 @@ void Catalog::createTable(
                                    td.storageType,
                                    std::to_string(td.maxRollbackEpochs),
                                    std::to_string(td.is_system_table),
+                                   std::to_string(td.compactionFillPercent),
                                    td.keyMetainfo});
 
       // now get the auto generated tableid
@@ -2953,6 +3005,8 @@ void Catalog::setTableEpoch(const int db_id, const int table_id, int new_epoch)
   file_mgr_params.epoch = new_epoch;
   file_mgr_params.max_rollback_epochs = td->maxRollbackEpochs;
 
+  // the logged rows newer than the epoch are dropped as well
+  Fragmenter_Namespace::InsertWriteAheadLog::instance().discardTable(*this, td->tableId);
   const auto physical_tables = getPhysicalTablesDescriptors(td, false);
   CHECK(!physical_tables.empty());
   for (const auto table : physical_tables) {
@@ -3148,6 +3202,10 @@ void Catalog::setTableEpochs(const int32_t db_id,
               << ", table id: " << table_epoch_info.table_id
               << ", back to epoch: " << table_epoch_info.table_epoch;
   }
+  // The rollback also drops the rows made durable by the insert write-ahead log
+  // since the last checkpoint.
+  Fragmenter_Namespace::InsertWriteAheadLog::instance().reinsertRolledBack(
+      *this, getLogicalTableId(td->tableId));
 }
 
 namespace {
@@ -3418,11 +3476,13 @@ void Catalog::createShardedTable(
 }
 
 void Catalog::truncateTable(const TableDescriptor* td) {
+  Fragmenter_Namespace::InsertWriteAheadLog::instance().discardTable(*this, td->tableId);
   // truncate all corresponding physical tables
   const auto physical_tables = getPhysicalTablesDescriptors(td);
   for (const auto table : physical_tables) {
     doTruncateTable(table);
   }
+  removeTableStatistics(td->tableId);
 }
 
 void Catalog::doTruncateTable(const TableDescriptor* td) {
@@ -3534,6 +3594,10 @@ void Catalog::dropTable(const TableDescriptor* td) {
     tables_to_drop.emplace_back(td);
   }
 
+  if (!td->isView) {
+    Fragmenter_Namespace::InsertWriteAheadLog::instance().discardTable(*this,
+                                                                       td->tableId);
+  }
   for (auto table : tables_to_drop) {
     eraseTablePhysicalData(table);
   }
@@ -3603,6 +3667,9 @@ void Catalog::executeDropTableSqliteQueries(const TableDescriptor* td) {
     sqliteConnector_.query_with_text_param(
         "DELETE FROM omnisci_foreign_tables WHERE table_id = ?", std::to_string(tableId));
   }
+  sqliteConnector_.query_with_text_param(
+      "DELETE FROM omnisci_column_statistics WHERE table_id = ?",
+      std::to_string(tableId));
 }
 
 void Catalog::renamePhysicalTable(const TableDescriptor* td, const string& newTableName) {
@@ -4283,6 +4350,11 @@ void Catalog::checkpoint(const int logicalTableId) const {
   }
 }
 
+void Catalog::checkpoint(const int logicalTableId) {
+  std::as_const(*this).checkpoint(logicalTableId);
+  persistTableStatistics(logicalTableId);
+}
+
 void Catalog::checkpointWithAutoRollback(const int logical_table_id) const {
   auto table_epochs = getTableEpochs(getDatabaseId(), logical_table_id);
   try {
@@ -4293,6 +4365,11 @@ void Catalog::checkpointWithAutoRollback(const int logical_table_id) const {
   }
 }
 
+void Catalog::checkpointWithAutoRollback(const int logical_table_id) {
+  std::as_const(*this).checkpointWithAutoRollback(logical_table_id);
+  persistTableStatistics(logical_table_id);
+}
+
 void Catalog::resetTableEpochFloor(const int logicalTableId) const {
   cat_read_lock read_lock(this);
   const auto td = getMetadataForTable(logicalTableId, false);
@@ -4613,6 +4690,10 @@ std::string Catalog::dumpSchema(const TableDescriptor* td) const {
     with_options.push_back("MAX_ROLLBACK_EPOCHS=" +
                            std::to_string(td->maxRollbackEpochs));
   }
+  if (td->compactionFillPercent > 0) {
+    with_options.push_back("COMPACTION_FILL_PERCENT=" +
+                           std::to_string(td->compactionFillPercent));
+  }
   os << ") WITH (" + boost::algorithm::join(with_options, ", ") + ");";
   return os.str();
 }
@@ -4770,6 +4851,10 @@ std::string Catalog::dumpCreateTable(const TableDescriptor* td,
     with_options.push_back("MAX_ROLLBACK_EPOCHS=" +
                            std::to_string(td->maxRollbackEpochs));
   }
+  if (!foreign_table && (dump_defaults || td->compactionFillPercent > 0)) {
+    with_options.push_back("COMPACTION_FILL_PERCENT=" +
+                           std::to_string(td->compactionFillPercent));
+  }
   if (!foreign_table && (dump_defaults || !td->hasDeletedCol)) {
     with_options.emplace_back(td->hasDeletedCol ? "VACUUM='DELAYED'"
                                                 : "VACUUM='IMMEDIATE'");
@@ -5148,6 +5233,121 @@ void Catalog::deleteCustomExpressions(const std::vector<int32_t>& custom_express
   sqliteConnector_.query("END TRANSACTION");
 }
 
+void Catalog::setTableStatistics(
+    const int logical_table_id,
+    const std::map<int, ColumnStatistics>& column_statistics) {
+  {
+    std::lock_guard<std::mutex> lock(column_statistics_mutex_);
+    column_statistics_[logical_table_id] = column_statistics;
+    tables_with_unpersisted_statistics_.insert(logical_table_id);
+  }
+  persistTableStatistics(logical_table_id);
+}
+
+std::optional<ColumnStatistics> Catalog::getColumnStatistics(const int logical_table_id,
+                                                             const int column_id) const {
+  std::lock_guard<std::mutex> lock(column_statistics_mutex_);
+  auto table_it = column_statistics_.find(logical_table_id);
+  if (table_it == column_statistics_.end()) {
+    return std::nullopt;
+  }
+  auto column_it = table_it->second.find(column_id);
+  if (column_it == table_it->second.end()) {
+    return std::nullopt;
+  }
+  return column_it->second;
+}
+
+void Catalog::updateTableStatistics(
+    const Fragmenter_Namespace::InsertData& insert_data) {
+  const auto logical_table_id = getLogicalTableId(insert_data.tableId);
+  {
+    std::lock_guard<std::mutex> lock(column_statistics_mutex_);
+    if (column_statistics_.find(logical_table_id) == column_statistics_.end()) {
+      return;
+    }
+  }
+  // Column descriptors are fetched ahead, the catalog lock must not be taken while
+  // holding the statistics mutex.
+  std::vector<const ColumnDescriptor*> cds;
+  for (const auto column_id : insert_data.columnIds) {
+    cds.push_back(getMetadataForColumn(insert_data.tableId, column_id));
+    CHECK(cds.back());
+  }
+  std::lock_guard<std::mutex> lock(column_statistics_mutex_);
+  auto table_it = column_statistics_.find(logical_table_id);
+  if (table_it == column_statistics_.end()) {
+    return;
+  }
+  for (size_t i = 0; i < insert_data.columnIds.size(); ++i) {
+    auto column_it = table_it->second.find(insert_data.columnIds[i]);
+    if (column_it == table_it->second.end()) {
+      continue;
+    }
+    column_it->second.addInsertData(cds[i]->columnType,
+                                    insert_data.data[i],
+                                    insert_data.numRows,
+                                    insert_data.is_default[i]);
+  }
+  tables_with_unpersisted_statistics_.insert(logical_table_id);
+}
+
+void Catalog::removeTableStatistics(const int logical_table_id) {
+  {
+    std::lock_guard<std::mutex> lock(column_statistics_mutex_);
+    if (!column_statistics_.erase(logical_table_id)) {
+      return;
+    }
+    tables_with_unpersisted_statistics_.erase(logical_table_id);
+  }
+  cat_sqlite_lock sqlite_lock(getObjForLock());
+  sqliteConnector_.query("BEGIN TRANSACTION");
+  try {
+    sqliteConnector_.query_with_text_param(
+        "DELETE FROM omnisci_column_statistics WHERE table_id = ?",
+        std::to_string(logical_table_id));
+  } catch (std::exception& e) {
+    sqliteConnector_.query("ROLLBACK TRANSACTION");
+    throw;
+  }
+  sqliteConnector_.query("END TRANSACTION");
+}
+
+void Catalog::persistTableStatistics(const int logical_table_id) {
+  std::map<int, ColumnStatistics> table_statistics;
+  {
+    std::lock_guard<std::mutex> lock(column_statistics_mutex_);
+    if (!tables_with_unpersisted_statistics_.erase(logical_table_id)) {
+      return;
+    }
+    auto table_it = column_statistics_.find(logical_table_id);
+    CHECK(table_it != column_statistics_.end());
+    table_statistics = table_it->second;
+  }
+  cat_sqlite_lock sqlite_lock(getObjForLock());
+  sqliteConnector_.query("BEGIN TRANSACTION");
+  try {
+    sqliteConnector_.query_with_text_param(
+        "DELETE FROM omnisci_column_statistics WHERE table_id = ?",
+        std::to_string(logical_table_id));
+    for (const auto& [column_id, column_statistics] : table_statistics) {
+      sqliteConnector_.query_with_text_params(
+          "INSERT INTO omnisci_column_statistics(table_id, column_id, row_count, "
+          "null_count, ndv_sketch, histogram) VALUES (?,?,?,?,?,?)",
+          std::vector<std::string>{std::to_string(logical_table_id),
+                                   std::to_string(column_id),
+                                   std::to_string(column_statistics.getRowCount()),
+                                   std::to_string(column_statistics.getNullCount()),
+                                   column_statistics.serializeSketch(),
+                                   column_statistics.serializeHistogram()});
+    }
+  } catch (std::exception& e) {
+    sqliteConnector_.query("ROLLBACK TRANSACTION");
+    throw;
+  }
+  sqliteConnector_.query("END TRANSACTION");
+}
+
 namespace {
 int32_t validate_and_get_user_id(const std::string& user_name) {
   UserMetadata user;
@@ -5416,6 +5616,8 @@ void Catalog::initializeSystemServers() {
                           foreign_storage::DataWrapperType::INTERNAL_MEMORY_STATS);
   createSystemTableServer(STORAGE_STATS_SERVER_NAME,
                           foreign_storage::DataWrapperType::INTERNAL_STORAGE_STATS);
+  createSystemTableServer(EXECUTOR_STATS_SERVER_NAME,
+                          foreign_storage::DataWrapperType::INTERNAL_EXECUTOR_STATS);
 }
 
 void Catalog::initializeSystemTables() {
@@ -5540,6 +5742,21 @@ void Catalog::initializeSystemTables() {
                        {"total_free_metadata_page_count", {kBIGINT}},
                        {"total_dictionary_data_file_size", {kBIGINT}}});
   }
+
+  if (!getMetadataForTable(QUERY_QUEUE_SUMMARY_SYS_TABLE_NAME, false)) {
+    createSystemTable(QUERY_QUEUE_SUMMARY_SYS_TABLE_NAME,
+                      EXECUTOR_STATS_SERVER_NAME,
+                      {{"node", {kTEXT}},
+                       {"priority", {kTEXT}},
+                       {"weight", {kINT}},
+                       {"queued_query_count", {kBIGINT}},
+                       {"running_query_count", {kBIGINT}},
+                       {"dispatched_query_count", {kBIGINT}},
+                       {"memory_deferred_query_count", {kBIGINT}},
+                       {"total_wait_time_ms", {kBIGINT}},
+                       {"max_wait_time_ms", {kBIGINT}},
+                       {"oldest_queued_wait_time_ms", {kBIGINT}}});
+  }
 }
 
 void Catalog::createSystemTableServer(const std::string& server_name,
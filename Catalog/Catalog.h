@@ -36,12 +36,14 @@
 #include <list>
 #include <map>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "Calcite/Calcite.h"
 #include "Catalog/ColumnDescriptor.h"
+#include "Catalog/ColumnStatistics.h"
 #include "Catalog/CustomExpression.h"
 #include "Catalog/DashboardDescriptor.h"
 #include "Catalog/DictDescriptor.h"
@@ -104,6 +106,7 @@ static constexpr const char* ROLE_ASSIGNMENTS_SYS_TABLE_NAME{"role_assignments"}
 static constexpr const char* MEMORY_SUMMARY_SYS_TABLE_NAME{"memory_summary"};
 static constexpr const char* MEMORY_DETAILS_SYS_TABLE_NAME{"memory_details"};
 static constexpr const char* STORAGE_DETAILS_SYS_TABLE_NAME{"storage_details"};
+static constexpr const char* QUERY_QUEUE_SUMMARY_SYS_TABLE_NAME{"query_queue_summary"};
 
 /**
  * @type Catalog
@@ -294,6 +297,9 @@ class Catalog final {
   int getLogicalTableId(const int physicalTableId) const;
   void checkpoint(const int logicalTableId) const;
   void checkpointWithAutoRollback(const int logical_table_id) const;
+  // Also persist the column statistics updated by inserts since the last checkpoint.
+  void checkpoint(const int logicalTableId);
+  void checkpointWithAutoRollback(const int logical_table_id);
   void resetTableEpochFloor(const int logicalTableId) const;
   std::string name() const { return getCurrentDB().dbName; }
   void eraseDbMetadata();
@@ -561,6 +567,51 @@ class Catalog final {
   void reassignOwners(const std::set<std::string>& old_owners,
                       const std::string& new_owner);
 
+  /**
+   * Gets the DDL statement used to create the column statistics table.
+   *
+   * @param if_not_exists - flag the indicates whether or not to include the "IF NOT
+   * EXISTS" phrase in the DDL statement.
+   * @return string containing DDL statement
+   */
+  static const std::string getColumnStatisticsSchema(bool if_not_exists = false);
+
+  /**
+   * Replaces the statistics of a table with the ones collected by ANALYZE TABLE.
+   *
+   * @param logical_table_id - id of the analyzed table
+   * @param column_statistics - statistics of the analyzed columns, by column id
+   */
+  void setTableStatistics(const int logical_table_id,
+                          const std::map<int, ColumnStatistics>& column_statistics);
+
+  /**
+   * Gets the statistics of a column of an analyzed table.
+   *
+   * @param logical_table_id - id of the table
+   * @param column_id - id of the column
+   * @return column statistics, empty if the column has not been analyzed
+   */
+  std::optional<ColumnStatistics> getColumnStatistics(const int logical_table_id,
+                                                      const int column_id) const;
+
+  /**
+   * Adds the rows of an insert into a physical table to the statistics of its logical
+   * table, if it has been analyzed. Histograms are only rebuilt by ANALYZE TABLE. The
+   * updated statistics are persisted on the next checkpoint of the table through a
+   * non-const catalog.
+   *
+   * @param insert_data - rows being inserted
+   */
+  void updateTableStatistics(const Fragmenter_Namespace::InsertData& insert_data);
+
+  /**
+   * Drops the statistics of a table, e.g. once it has been truncated.
+   *
+   * @param logical_table_id - id of the table
+   */
+  void removeTableStatistics(const int logical_table_id);
+
  protected:
   void CheckAndExecuteMigrations();
   void CheckAndExecuteMigrationsPostBuildMaps();
@@ -579,6 +630,7 @@ class Catalog final {
   void updateDefaultColumnValues();
   void updateFrontendViewsToDashboards();
   void updateCustomExpressionsSchema();
+  void updateColumnStatisticsSchema();
   void updateFsiSchemas();
   void recordOwnershipOfObjectsInObjectPermissions();
   void checkDateInDaysColumnMigration();
@@ -645,6 +697,11 @@ class Catalog final {
   ForeignServerMap foreignServerMap_;
   ForeignServerMapById foreignServerMapById_;
   CustomExpressionMapById custom_expr_map_by_id_;
+  // column statistics by logical table id and column id, guarded by their own mutex as
+  // they are updated by inserts
+  std::map<int, std::map<int, ColumnStatistics>> column_statistics_;
+  std::set<int> tables_with_unpersisted_statistics_;
+  mutable std::mutex column_statistics_mutex_;
 
   SqliteConnector sqliteConnector_;
   const DBMetadata currentDB_;
@@ -719,6 +776,9 @@ class Catalog final {
   void buildCustomExpressionsMap();
   std::unique_ptr<CustomExpression> getCustomExpressionFromConnector(size_t row);
 
+  void buildColumnStatisticsMap();
+  void persistTableStatistics(const int logical_table_id);
+
   void restoreOldOwners(
       const std::map<int32_t, std::vector<DBObject>>& old_owner_db_objects,
       int32_t new_owner_id);
@@ -741,9 +801,13 @@ class Catalog final {
   static constexpr const char* CATALOG_SERVER_NAME{"omnisci_catalog_server"};
   static constexpr const char* MEMORY_STATS_SERVER_NAME{"omnisci_memory_stats_server"};
   static constexpr const char* STORAGE_STATS_SERVER_NAME{"omnisci_storage_stats_server"};
-  static constexpr std::array<const char*, 3> INTERNAL_SERVERS{CATALOG_SERVER_NAME,
-                                                               MEMORY_STATS_SERVER_NAME,
-                                                               STORAGE_STATS_SERVER_NAME};
+  static constexpr const char* EXECUTOR_STATS_SERVER_NAME{
+      "omnisci_executor_stats_server"};
+  static constexpr std::array<const char*, 4> INTERNAL_SERVERS{
+      CATALOG_SERVER_NAME,
+      MEMORY_STATS_SERVER_NAME,
+      STORAGE_STATS_SERVER_NAME,
+      EXECUTOR_STATS_SERVER_NAME};
 
  public:
   mutable std::mutex sqliteMutex_;
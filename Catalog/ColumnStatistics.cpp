@@ -0,0 +1,295 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Catalog/ColumnStatistics.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#include <boost/algorithm/string.hpp>
+
+#include "Logger/Logger.h"
+#include "QueryEngine/HyperLogLog.h"
+#include "QueryEngine/HyperLogLogRank.h"
+#include "QueryEngine/MurmurHash.h"
+#include "Shared/InlineNullValues.h"
+#include "Shared/base64.h"
+
+namespace Catalog_Namespace {
+
+namespace {
+
+template <typename T>
+void add_integers(ColumnStatistics& stats,
+                  const int8_t* buf,
+                  const size_t num_rows,
+                  const size_t stride,
+                  const int64_t null_val) {
+  const auto vals = reinterpret_cast<const T*>(buf);
+  for (size_t i = 0; i < num_rows; ++i) {
+    const int64_t val = vals[i * stride];
+    if (val == null_val) {
+      stats.addNull();
+    } else {
+      stats.addInteger(val);
+    }
+  }
+}
+
+template <typename T>
+void add_floating_points(ColumnStatistics& stats,
+                         const int8_t* buf,
+                         const size_t num_rows,
+                         const size_t stride) {
+  const auto vals = reinterpret_cast<const T*>(buf);
+  for (size_t i = 0; i < num_rows; ++i) {
+    const T val = vals[i * stride];
+    if (val == inline_fp_null_value<T>()) {
+      stats.addNull();
+    } else {
+      stats.addFloatingPoint(val);
+    }
+  }
+}
+
+}  // namespace
+
+ColumnStatistics::ColumnStatistics()
+    : row_count_(0), null_count_(0), sketch_(size_t(1) << kSketchBits, 0) {}
+
+ColumnStatistics::ColumnStatistics(const int64_t row_count,
+                                   const int64_t null_count,
+                                   std::vector<int8_t> sketch,
+                                   std::vector<double> histogram)
+    : row_count_(row_count)
+    , null_count_(null_count)
+    , sketch_(std::move(sketch))
+    , histogram_(std::move(histogram)) {
+  CHECK_EQ(sketch_.size(), size_t(1) << kSketchBits);
+}
+
+bool ColumnStatistics::isSupported(const SQLTypeInfo& ti) {
+  return !ti.is_array() && !ti.is_geometry();
+}
+
+bool ColumnStatistics::hasHistogram(const SQLTypeInfo& ti) {
+  return ti.is_number() || ti.is_time() || ti.is_boolean();
+}
+
+void ColumnStatistics::addNull() {
+  ++row_count_;
+  ++null_count_;
+}
+
+void ColumnStatistics::addInteger(const int64_t val) {
+  addHash(MurmurHash64A(&val, sizeof(val), 0));
+}
+
+void ColumnStatistics::addFloatingPoint(const double val) {
+  // Hash the bit pattern, -0.0 and 0.0 are the same value
+  const double normalized = val == 0 ? 0 : val;
+  int64_t bits;
+  std::memcpy(&bits, &normalized, sizeof(bits));
+  addInteger(bits);
+}
+
+void ColumnStatistics::addString(const std::string_view val) {
+  addHash(MurmurHash64A(val.data(), val.size(), 0));
+}
+
+void ColumnStatistics::addHash(const uint64_t hash) {
+  ++row_count_;
+  const auto index = hash >> (64 - kSketchBits);
+  const auto rank = get_rank(hash << kSketchBits, 64 - kSketchBits);
+  sketch_[index] = std::max(sketch_[index], static_cast<int8_t>(rank));
+}
+
+void ColumnStatistics::addInsertData(const SQLTypeInfo& ti,
+                                     const DataBlockPtr& data,
+                                     const size_t num_rows,
+                                     const bool is_default) {
+  CHECK(isSupported(ti));
+  const size_t stride = is_default ? 0 : 1;
+  if (ti.is_string()) {
+    if (ti.get_compression() == kENCODING_NONE) {
+      CHECK(data.stringsPtr);
+      for (size_t i = 0; i < num_rows; ++i) {
+        addString((*data.stringsPtr)[i * stride]);
+      }
+      return;
+    }
+    CHECK_EQ(ti.get_compression(), kENCODING_DICT);
+    const auto null_val = inline_fixed_encoding_null_val(ti);
+    switch (ti.get_size()) {
+      case 1:
+        add_integers<uint8_t>(*this, data.numbersPtr, num_rows, stride, null_val);
+        break;
+      case 2:
+        add_integers<uint16_t>(*this, data.numbersPtr, num_rows, stride, null_val);
+        break;
+      case 4:
+        add_integers<int32_t>(*this, data.numbersPtr, num_rows, stride, null_val);
+        break;
+      default:
+        CHECK(false);
+    }
+    return;
+  }
+  if (ti.is_fp()) {
+    if (ti.get_type() == kFLOAT) {
+      add_floating_points<float>(*this, data.numbersPtr, num_rows, stride);
+    } else {
+      add_floating_points<double>(*this, data.numbersPtr, num_rows, stride);
+    }
+    return;
+  }
+  const auto logical_ti = get_logical_type_info(ti);
+  const auto null_val = inline_int_null_val(logical_ti);
+  switch (logical_ti.get_logical_size()) {
+    case 1:
+      add_integers<int8_t>(*this, data.numbersPtr, num_rows, stride, null_val);
+      break;
+    case 2:
+      add_integers<int16_t>(*this, data.numbersPtr, num_rows, stride, null_val);
+      break;
+    case 4:
+      add_integers<int32_t>(*this, data.numbersPtr, num_rows, stride, null_val);
+      break;
+    case 8:
+      add_integers<int64_t>(*this, data.numbersPtr, num_rows, stride, null_val);
+      break;
+    default:
+      CHECK(false);
+  }
+}
+
+void ColumnStatistics::setHistogram(std::vector<double>& sample) {
+  histogram_.clear();
+  if (sample.empty()) {
+    return;
+  }
+  std::sort(sample.begin(), sample.end());
+  // Bucket i covers the values between bounds i and i + 1, each holding roughly the same
+  // number of rows.
+  const auto last = sample.size() - 1;
+  for (size_t bucket = 0; bucket <= kHistogramBucketCount; ++bucket) {
+    histogram_.push_back(sample[bucket * last / kHistogramBucketCount]);
+  }
+}
+
+double ColumnStatistics::getNullFraction() const {
+  return row_count_ ? static_cast<double>(null_count_) / row_count_ : 0;
+}
+
+size_t ColumnStatistics::getDistinctCount() const {
+  const auto non_null_count = row_count_ - null_count_;
+  if (non_null_count <= 0) {
+    return 0;
+  }
+  const auto estimate = hll_size(sketch_.data(), kSketchBits);
+  return std::max(size_t(1), std::min(estimate, static_cast<size_t>(non_null_count)));
+}
+
+std::optional<double> ColumnStatistics::getSelectivity(const SQLOps op,
+                                                      const double val) const {
+  const auto non_null_fraction = 1 - getNullFraction();
+  const auto distinct_count = getDistinctCount();
+  if (!distinct_count) {
+    return 0;
+  }
+  const bool out_of_range =
+      !histogram_.empty() && (val < histogram_.front() || val > histogram_.back());
+  const auto eq_fraction = out_of_range ? 0 : 1. / distinct_count;
+  if (op == kEQ) {
+    return non_null_fraction * eq_fraction;
+  }
+  if (op == kNE) {
+    return non_null_fraction * (1 - eq_fraction);
+  }
+  if (histogram_.empty()) {
+    return std::nullopt;
+  }
+  // Fraction of the non-null values below `val`, interpolated within its bucket.
+  double below_fraction{1};
+  const auto it = std::lower_bound(histogram_.begin(), histogram_.end(), val);
+  if (it == histogram_.begin()) {
+    below_fraction = 0;
+  } else if (it != histogram_.end()) {
+    const auto bucket = it - histogram_.begin() - 1;
+    const auto lo = *(it - 1);
+    const auto hi = *it;
+    below_fraction = (bucket + (val - lo) / (hi - lo)) / kHistogramBucketCount;
+  }
+  double fraction{0};
+  switch (op) {
+    case kLT:
+      fraction = below_fraction;
+      break;
+    case kLE:
+      fraction = below_fraction + eq_fraction;
+      break;
+    case kGT:
+      fraction = 1 - below_fraction - eq_fraction;
+      break;
+    case kGE:
+      fraction = 1 - below_fraction;
+      break;
+    default:
+      return std::nullopt;
+  }
+  return non_null_fraction * std::min(std::max(fraction, 0.), 1.);
+}
+
+std::string ColumnStatistics::serializeSketch() const {
+  return shared::encode_base64(
+      std::string(reinterpret_cast<const char*>(sketch_.data()), sketch_.size()));
+}
+
+std::string ColumnStatistics::serializeHistogram() const {
+  std::ostringstream oss;
+  oss << std::setprecision(std::numeric_limits<double>::max_digits10);
+  for (size_t i = 0; i < histogram_.size(); ++i) {
+    if (i) {
+      oss << ",";
+    }
+    oss << histogram_[i];
+  }
+  return oss.str();
+}
+
+ColumnStatistics ColumnStatistics::deserialize(const int64_t row_count,
+                                               const int64_t null_count,
+                                               const std::string& sketch,
+                                               const std::string& histogram) {
+  const auto sketch_str = shared::decode_base64(sketch, false);
+  std::vector<int8_t> sketch_registers(sketch_str.begin(), sketch_str.end());
+  sketch_registers.resize(size_t(1) << kSketchBits, 0);
+  std::vector<double> histogram_bounds;
+  if (!histogram.empty()) {
+    std::vector<std::string> bounds;
+    boost::split(bounds, histogram, boost::is_any_of(","));
+    for (const auto& bound : bounds) {
+      histogram_bounds.push_back(std::stod(bound));
+    }
+  }
+  return ColumnStatistics(
+      row_count, null_count, std::move(sketch_registers), std::move(histogram_bounds));
+}
+
+}  // namespace Catalog_Namespace
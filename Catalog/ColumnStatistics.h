@@ -0,0 +1,100 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    ColumnStatistics.h
+ * @brief   Per-column statistics collected by ANALYZE TABLE: the row and null counts, a
+ *          HyperLogLog sketch of the distinct values and an equi-depth histogram.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Shared/sqldefs.h"
+#include "Shared/sqltypes.h"
+
+namespace Catalog_Namespace {
+
+class ColumnStatistics {
+ public:
+  static constexpr size_t kSketchBits{11};
+  static constexpr size_t kHistogramBucketCount{32};
+
+  ColumnStatistics();
+
+  ColumnStatistics(const int64_t row_count,
+                   const int64_t null_count,
+                   std::vector<int8_t> sketch,
+                   std::vector<double> histogram);
+
+  // Statistics are kept for scalar columns only.
+  static bool isSupported(const SQLTypeInfo& ti);
+
+  // Histograms are kept for columns with an order on their physical values.
+  static bool hasHistogram(const SQLTypeInfo& ti);
+
+  void addNull();
+  void addInteger(const int64_t val);
+  void addFloatingPoint(const double val);
+  void addString(const std::string_view val);
+
+  // Adds the rows of an insert data block of a column of type `ti`. Values of numeric
+  // columns are in their logical width, dictionary encoded strings are ids. Insert data
+  // doesn't tell null none encoded strings from empty ones, they all count as values.
+  void addInsertData(const SQLTypeInfo& ti,
+                     const DataBlockPtr& data,
+                     const size_t num_rows,
+                     const bool is_default);
+
+  // Builds the histogram bounds from a sample of the non-null values. Sorts `sample`.
+  // Inserts don't update the histogram, it is only rebuilt by ANALYZE TABLE.
+  void setHistogram(std::vector<double>& sample);
+
+  int64_t getRowCount() const { return row_count_; }
+  int64_t getNullCount() const { return null_count_; }
+  double getNullFraction() const;
+  size_t getDistinctCount() const;
+  const std::vector<double>& getHistogram() const { return histogram_; }
+
+  // Estimated fraction of the rows for which `column <op> val` holds, `val` being a
+  // physical value of the column. Equality is estimated from the distinct count, range
+  // comparisons from the histogram. Empty if the column has no histogram to estimate a
+  // range comparison from, or for operators other than comparisons.
+  std::optional<double> getSelectivity(const SQLOps op, const double val) const;
+
+  std::string serializeSketch() const;
+  std::string serializeHistogram() const;
+
+  static ColumnStatistics deserialize(const int64_t row_count,
+                                      const int64_t null_count,
+                                      const std::string& sketch,
+                                      const std::string& histogram);
+
+ private:
+  void addHash(const uint64_t hash);
+
+  int64_t row_count_;
+  int64_t null_count_;
+  std::vector<int8_t> sketch_;
+  std::vector<double> histogram_;
+};
+
+}  // namespace Catalog_Namespace
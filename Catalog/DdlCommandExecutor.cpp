@@ -378,6 +378,10 @@ ExecutionResult DdlCommandExecutor::execute() {
     auto optimize_table_stmt = Parser::OptimizeTableStmt(extractPayload(*ddl_data_));
     optimize_table_stmt.execute(*session_ptr_);
     return result;
+  } else if (ddl_command_ == "ANALYZE_TABLE") {
+    auto analyze_table_stmt = Parser::AnalyzeTableStmt(extractPayload(*ddl_data_));
+    analyze_table_stmt.execute(*session_ptr_);
+    return result;
   } else if (ddl_command_ == "SHOW_CREATE_TABLE") {
     auto show_create_table_stmt = Parser::ShowCreateTableStmt(extractPayload(*ddl_data_));
     show_create_table_stmt.execute(*session_ptr_);
@@ -533,15 +537,15 @@ DistributedExecutionDetails DdlCommandExecutor::getDistributedExecutionDetails()
       ddl_command_ == "ALTER_TABLE" || ddl_command_ == "CREATE_TABLE" ||
       ddl_command_ == "DROP_TABLE" || ddl_command_ == "TRUNCATE_TABLE" ||
       ddl_command_ == "DUMP_TABLE" || ddl_command_ == "RESTORE_TABLE" ||
-      ddl_command_ == "OPTIMIZE_TABLE" || ddl_command_ == "CREATE_VIEW" ||
-      ddl_command_ == "DROP_VIEW" || ddl_command_ == "CREATE_DB" ||
-      ddl_command_ == "DROP_DB" || ddl_command_ == "RENAME_DB" ||
-      ddl_command_ == "CREATE_USER" || ddl_command_ == "DROP_USER" ||
-      ddl_command_ == "ALTER_USER" || ddl_command_ == "RENAME_USER" ||
-      ddl_command_ == "CREATE_ROLE" || ddl_command_ == "DROP_ROLE" ||
-      ddl_command_ == "GRANT_ROLE" || ddl_command_ == "REVOKE_ROLE" ||
-      ddl_command_ == "REASSIGN_OWNED" || ddl_command_ == "CREATE_POLICY" ||
-      ddl_command_ == "DROP_POLICY") {
+      ddl_command_ == "OPTIMIZE_TABLE" || ddl_command_ == "ANALYZE_TABLE" ||
+      ddl_command_ == "CREATE_VIEW" || ddl_command_ == "DROP_VIEW" ||
+      ddl_command_ == "CREATE_DB" || ddl_command_ == "DROP_DB" ||
+      ddl_command_ == "RENAME_DB" || ddl_command_ == "CREATE_USER" ||
+      ddl_command_ == "DROP_USER" || ddl_command_ == "ALTER_USER" ||
+      ddl_command_ == "RENAME_USER" || ddl_command_ == "CREATE_ROLE" ||
+      ddl_command_ == "DROP_ROLE" || ddl_command_ == "GRANT_ROLE" ||
+      ddl_command_ == "REVOKE_ROLE" || ddl_command_ == "REASSIGN_OWNED" ||
+      ddl_command_ == "CREATE_POLICY" || ddl_command_ == "DROP_POLICY") {
     // group user/role/db commands
     execution_details.execution_location = ExecutionLocation::ALL_NODES;
     execution_details.aggregation_type = AggregationType::NONE;
@@ -86,6 +86,16 @@ class SessionInfo {
   void set_connection_info(const std::string& connection) {
     connection_info_ = connection;
   }
+  bool get_query_tracing() const { return query_tracing_; }
+  void set_query_tracing(const bool enable) { query_tracing_ = enable; }
+  std::string get_last_query_trace() const {
+    std::lock_guard<std::mutex> lock(last_query_trace_mutex_);
+    return last_query_trace_;
+  }
+  void set_last_query_trace(std::string trace) {
+    std::lock_guard<std::mutex> lock(last_query_trace_mutex_);
+    last_query_trace_ = std::move(trace);
+  }
 
  private:
   std::shared_ptr<Catalog> catalog_;
@@ -97,6 +107,9 @@ class SessionInfo {
   const std::string public_session_id_;
   std::string
       connection_info_;  // String containing connection protocol (tcp/http) and address
+  std::atomic<bool> query_tracing_{false};
+  mutable std::mutex last_query_trace_mutex_;
+  std::string last_query_trace_;  // Chrome trace JSON of the last traced query
   std::string public_session_id() const;
 };
 
@@ -1243,6 +1243,7 @@ void SysCatalog::createDatabase(const string& name, int owner) {
         "sort_column_id integer default 0, storage_type text default '', "
         "max_rollback_epochs integer default -1, "
         "is_system_table boolean default 0, "
+        "compaction_fill_percent integer default 0, "
         "num_shards integer, key_metainfo TEXT, version_num "
         "BIGINT DEFAULT 1) ");
     dbConn->query(
@@ -1283,6 +1284,7 @@ void SysCatalog::createDatabase(const string& name, int owner) {
       dbConn->query(Catalog::getForeignTableSchema());
     }
     dbConn->query(Catalog::getCustomExpressionsSchema());
+    dbConn->query(Catalog::getColumnStatisticsSchema());
   } catch (const std::exception&) {
     dbConn->query("ROLLBACK TRANSACTION");
     boost::filesystem::remove(basePath_ + "/mapd_catalogs/" + name);
@@ -76,6 +76,9 @@ struct TableDescriptor {
 
   int32_t maxRollbackEpochs;
   bool is_system_table;
+  // Fragments filled below this percentage of maxFragRows are merged by the background
+  // table compaction service, 0 leaves the table alone.
+  int32_t compactionFillPercent;
 
   // write mutex, only to be used inside catalog package
   std::shared_ptr<std::mutex> mutex_;
@@ -90,6 +93,7 @@ struct TableDescriptor {
       , hasDeletedCol(true)
       , maxRollbackEpochs(DEFAULT_MAX_ROLLBACK_EPOCHS)
       , is_system_table(false)
+      , compactionFillPercent(0)
       , mutex_(std::make_shared<std::mutex>()) {}
 
   virtual ~TableDescriptor() = default;
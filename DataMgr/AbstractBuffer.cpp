@@ -21,8 +21,45 @@ outside of the header file in order to prevent unnecessary re-compilation.
 
 #include "AbstractBuffer.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace Data_Namespace {
 
+namespace {
+
+// Beyond this many disjoint ranges, writing back the whole buffer is assumed to be
+// cheaper than tracking the ranges.
+constexpr size_t kMaxUpdatedRanges{1024};
+
+}  // namespace
+
+void AbstractBuffer::setUpdated(const size_t offset, const size_t num_bytes) {
+  if (!num_bytes) {
+    return;
+  }
+  is_dirty_ = true;
+  if (is_updated_ && updated_ranges_.empty()) {
+    return;  // the whole buffer is updated already
+  }
+  is_updated_ = true;
+  size_t begin = offset;
+  size_t end = offset + num_bytes;
+  auto it = updated_ranges_.upper_bound(begin);
+  if (it != updated_ranges_.begin() && std::prev(it)->second >= begin) {
+    --it;
+    begin = it->first;
+  }
+  while (it != updated_ranges_.end() && it->first <= end) {
+    end = std::max(end, it->second);
+    it = updated_ranges_.erase(it);
+  }
+  updated_ranges_.emplace(begin, end);
+  if (updated_ranges_.size() > kMaxUpdatedRanges) {
+    updated_ranges_.clear();
+  }
+}
+
 void AbstractBuffer::initEncoder(const SQLTypeInfo& tmp_sql_type) {
   sql_type_ = tmp_sql_type;
   encoder_.reset(Encoder::Create(this, sql_type_));
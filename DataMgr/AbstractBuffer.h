@@ -21,6 +21,7 @@
  */
 #pragma once
 
+#include <map>
 #include <memory>
 
 #ifdef BUFFER_MUTEX
@@ -107,9 +108,21 @@ class AbstractBuffer {
 
   inline void setDirty() { is_dirty_ = true; }
 
+  // Marks the whole buffer as updated in place.
   inline void setUpdated() {
     is_updated_ = true;
     is_dirty_ = true;
+    updated_ranges_.clear();
+  }
+
+  // Marks num_bytes at offset as updated in place, so that only the pages holding them
+  // have to be written back to the parent buffer.
+  void setUpdated(const size_t offset, const size_t num_bytes);
+
+  // Byte ranges [begin, end) updated in place since the buffer was last written back.
+  // Empty if the whole buffer has to be written back.
+  inline const std::map<size_t, size_t>& getUpdatedRanges() const {
+    return updated_ranges_;
   }
 
   inline void setAppended() {
@@ -122,6 +135,7 @@ class AbstractBuffer {
     is_appended_ = false;
     is_updated_ = false;
     is_dirty_ = false;
+    updated_ranges_.clear();
   }
 
   void initEncoder(const SQLTypeInfo& tmp_sql_type);
@@ -139,6 +153,7 @@ class AbstractBuffer {
   bool is_dirty_;
   bool is_appended_;
   bool is_updated_;
+  std::map<size_t, size_t> updated_ranges_;
 
 #ifdef BUFFER_MUTEX
   boost::shared_mutex read_write_mutex_;
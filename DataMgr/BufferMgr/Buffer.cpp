@@ -16,6 +16,7 @@
 
 #include "DataMgr/BufferMgr/Buffer.h"
 
+#include <algorithm>
 #include <cassert>
 #include <stdexcept>
 
@@ -101,7 +102,7 @@ void Buffer::write(int8_t* src,
   // update dirty flags for buffer and each affected page
   setDirty();
   if (offset < size_) {
-    setUpdated();
+    setUpdated(offset, std::min(num_bytes, size_ - offset));
   }
   if (offset + num_bytes > size_) {
     setAppended();
@@ -28,12 +28,38 @@
 #include "DataMgr/BufferMgr/Buffer.h"
 #include "DataMgr/ForeignStorage/ForeignStorageException.h"
 #include "Logger/Logger.h"
+#include "Shared/Metrics.h"
 #include "Shared/measure.h"
 
 using namespace std;
 
 namespace Buffer_Namespace {
 
+namespace {
+
+struct BufferPoolMetrics {
+  metrics::Counter& hits;
+  metrics::Counter& misses;
+
+  explicit BufferPoolMetrics(const std::string& labels)
+      : hits(metrics::Registry::instance().counter(
+            "omnisci_buffer_pool_hits_total",
+            "Chunk requests served from the buffer pool.",
+            labels))
+      , misses(metrics::Registry::instance().counter(
+            "omnisci_buffer_pool_misses_total",
+            "Chunk requests fetched into the buffer pool from the next memory level.",
+            labels)) {}
+};
+
+BufferPoolMetrics& get_buffer_pool_metrics(const MgrType mgr_type) {
+  static BufferPoolMetrics cpu_metrics("level=\"cpu\"");
+  static BufferPoolMetrics gpu_metrics("level=\"gpu\"");
+  return mgr_type == GPU_MGR ? gpu_metrics : cpu_metrics;
+}
+
+}  // namespace
+
 std::string BufferMgr::keyToString(const ChunkKey& key) {
   std::ostringstream oss;
 
@@ -725,6 +751,7 @@ void BufferMgr::checkpoint(const int db_id, const int tb_id) {
 /// Returns a pointer to the Buffer holding the chunk, if it exists; otherwise,
 /// throws a runtime_error.
 AbstractBuffer* BufferMgr::getBuffer(const ChunkKey& key, const size_t num_bytes) {
+  auto trace_scope = TRACE_SCOPE("BufferMgr::getBuffer");
   std::lock_guard<std::mutex> lock(global_mutex_);  // granular lock
 
   std::unique_lock<std::mutex> sized_segs_lock(sized_segs_mutex_);
@@ -732,7 +759,9 @@ AbstractBuffer* BufferMgr::getBuffer(const ChunkKey& key, const size_t num_bytes
   auto buffer_it = chunk_index_.find(key);
   bool found_buffer = buffer_it != chunk_index_.end();
   chunk_index_lock.unlock();
+  auto& buffer_pool_metrics = get_buffer_pool_metrics(getMgrType());
   if (found_buffer) {
+    buffer_pool_metrics.hits.add();
     CHECK(buffer_it->second->buffer);
     buffer_it->second->buffer->pin();
     sized_segs_lock.unlock();
@@ -745,6 +774,7 @@ AbstractBuffer* BufferMgr::getBuffer(const ChunkKey& key, const size_t num_bytes
     }
     return buffer_it->second->buffer;
   } else {  // If wasn't in pool then we need to fetch it
+    buffer_pool_metrics.misses.add();
     sized_segs_lock.unlock();
     // createChunk pins for us
     AbstractBuffer* buffer = createBuffer(key, page_size_, num_bytes);
@@ -767,6 +797,7 @@ AbstractBuffer* BufferMgr::getBuffer(const ChunkKey& key, const size_t num_bytes
 void BufferMgr::fetchBuffer(const ChunkKey& key,
                             AbstractBuffer* dest_buffer,
                             const size_t num_bytes) {
+  auto trace_scope = TRACE_SCOPE("BufferMgr::fetchBuffer");
   std::unique_lock<std::mutex> lock(global_mutex_);  // granular lock
   std::unique_lock<std::mutex> sized_segs_lock(sized_segs_mutex_);
   std::unique_lock<std::mutex> chunk_index_lock(chunk_index_mutex_);
@@ -818,9 +849,19 @@ AbstractBuffer* BufferMgr::putBuffer(const ChunkKey& key,
   size_t new_buffer_size = num_bytes == 0 ? src_buffer->size() : num_bytes;
   CHECK(!buffer->isDirty());
 
-  if (src_buffer->isUpdated()) {
-    //@todo use dirty flags to only flush pages of chunk that need to
-    // be flushed
+  const auto& updated_ranges = src_buffer->getUpdatedRanges();
+  if (src_buffer->isUpdated() && !updated_ranges.empty() &&
+      new_buffer_size == old_buffer_size) {
+    // only copy the values updated in place
+    for (const auto& [begin, end] : updated_ranges) {
+      CHECK_LE(end, new_buffer_size);
+      buffer->write((int8_t*)src_buffer->getMemoryPtr() + begin,
+                    end - begin,
+                    begin,
+                    src_buffer->getType(),
+                    src_buffer->getDeviceId());
+    }
+  } else if (src_buffer->isUpdated()) {
     buffer->write((int8_t*)src_buffer->getMemoryPtr(),
                   new_buffer_size,
                   0,
@@ -641,6 +641,17 @@ std::ostream& operator<<(std::ostream& os, const DataMgr::SystemMemoryUsage& mem
   return os;
 }
 
+size_t DataMgr::getAvailableCpuQueryMemory() const {
+  const auto free_memory = getSystemMemoryUsage().free;
+  const auto cpu_buffer_mgr = bufferMgrs_[MemoryLevel::CPU_LEVEL][0];
+  CHECK(cpu_buffer_mgr);
+  const auto max_pool_size = cpu_buffer_mgr->getMaxSize();
+  const auto allocated_pool_size = cpu_buffer_mgr->getAllocated();
+  const auto pool_headroom =
+      max_pool_size > allocated_pool_size ? max_pool_size - allocated_pool_size : 0;
+  return free_memory > pool_headroom ? free_memory - pool_headroom : 0;
+}
+
 PersistentStorageMgr* DataMgr::getPersistentStorageMgr() const {
   return dynamic_cast<PersistentStorageMgr*>(bufferMgrs_[MemoryLevel::DISK_LEVEL][0]);
 }
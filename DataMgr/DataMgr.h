@@ -241,6 +241,10 @@ class DataMgr {
   SystemMemoryUsage getSystemMemoryUsage() const;
   static size_t getTotalSystemMemory();
 
+  // Free CPU memory (in bytes) which is not reserved for growth of the CPU buffer pool,
+  // i.e. memory that query execution can allocate outside of the buffer pool.
+  size_t getAvailableCpuQueryMemory() const;
+
   PersistentStorageMgr* getPersistentStorageMgr() const;
   void resetPersistentStorage(const File_Namespace::DiskCacheConfig& cache_config,
                               const size_t num_reader_threads,
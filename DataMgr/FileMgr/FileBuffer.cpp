@@ -285,6 +285,7 @@ void FileBuffer::read(int8_t* const dst,
                       const size_t offset,
                       const MemoryLevel dstBufferType,
                       const int32_t deviceId) {
+  auto trace_scope = TRACE_SCOPE("FileBuffer::read");
   if (dstBufferType != CPU_LEVEL) {
     LOG(FATAL) << "Unsupported Buffer type";
   }
@@ -19,6 +19,7 @@
 #include "../../Shared/File.h"
 #include "FileMgr.h"
 #include "Page.h"
+#include "Shared/Metrics.h"
 
 #include <utility>
 using namespace std;
@@ -64,8 +65,12 @@ size_t FileInfo::write(const size_t offset, const size_t size, const int8_t* buf
 }
 
 size_t FileInfo::read(const size_t offset, const size_t size, int8_t* buf) {
+  static auto& bytes_read = metrics::Registry::instance().counter(
+      "omnisci_file_mgr_read_bytes_total", "Bytes read from data files.");
   std::lock_guard<std::mutex> lock(readWriteMutex_);
-  return File_Namespace::read(f, offset, size, buf);
+  const auto bytes = File_Namespace::read(f, offset, size, buf);
+  bytes_read.add(bytes);
+  return bytes;
 }
 
 void FileInfo::openExistingFile(std::vector<HeaderInfo>& headerVec) {
@@ -37,6 +37,7 @@
 
 #include "DataMgr/FileMgr/GlobalFileMgr.h"
 #include "Shared/File.h"
+#include "Shared/Metrics.h"
 #include "Shared/checked_alloc.h"
 #include "Shared/measure.h"
 
@@ -789,6 +790,11 @@ void FileMgr::fetchBuffer(const ChunkKey& key,
                           const size_t numBytes) {
   // reads chunk specified by ChunkKey into AbstractBuffer provided by
   // destBuffer
+  auto trace_scope = TRACE_SCOPE("FileMgr::fetchBuffer");
+  static auto& fetch_latency = metrics::Registry::instance().histogram(
+      "omnisci_file_mgr_fetch_latency_microseconds",
+      "Time to read a chunk from data files into a buffer.");
+  metrics::ScopedLatency fetch_latency_scope(fetch_latency);
   CHECK(!destBuffer->isDirty())
       << "Aborting attempt to fetch a chunk marked dirty. Chunk inconsistency for key: "
       << show_chunk(key);
@@ -828,13 +834,24 @@ FileBuffer* FileMgr::putBuffer(const ChunkKey& key,
     if (0 == numBytes && !chunk->isDirty()) {
       chunk->setSize(newChunkSize);
     }
-    //@todo use dirty flags to only flush pages of chunk that need to
-    // be flushed
-    chunk->write((int8_t*)srcBuffer->getMemoryPtr(),
-                 newChunkSize,
-                 0,
-                 srcBuffer->getType(),
-                 srcBuffer->getDeviceId());
+    const auto& updated_ranges = srcBuffer->getUpdatedRanges();
+    if (!updated_ranges.empty() && newChunkSize == oldChunkSize) {
+      // only rewrite the pages holding the values updated in place
+      for (const auto& [begin, end] : updated_ranges) {
+        CHECK_LE(end, newChunkSize);
+        chunk->write((int8_t*)srcBuffer->getMemoryPtr() + begin,
+                     end - begin,
+                     begin,
+                     srcBuffer->getType(),
+                     srcBuffer->getDeviceId());
+      }
+    } else {
+      chunk->write((int8_t*)srcBuffer->getMemoryPtr(),
+                   newChunkSize,
+                   0,
+                   srcBuffer->getType(),
+                   srcBuffer->getDeviceId());
+    }
   } else if (srcBuffer->isAppended()) {
     CHECK_LT(oldChunkSize, newChunkSize);
     chunk->append((int8_t*)srcBuffer->getMemoryPtr() + oldChunkSize,
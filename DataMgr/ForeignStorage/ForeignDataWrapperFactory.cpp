@@ -20,6 +20,7 @@
 #include "CsvDataWrapper.h"
 #include "ForeignDataWrapper.h"
 #include "InternalCatalogDataWrapper.h"
+#include "InternalExecutorStatsDataWrapper.h"
 #include "InternalMemoryStatsDataWrapper.h"
 #include "InternalStorageStatsDataWrapper.h"
 #ifdef ENABLE_IMPORT_PARQUET
@@ -178,6 +179,9 @@ std::unique_ptr<ForeignDataWrapper> ForeignDataWrapperFactory::create(
   } else if (data_wrapper_type == DataWrapperType::INTERNAL_STORAGE_STATS) {
     data_wrapper =
         std::make_unique<InternalStorageStatsDataWrapper>(db_id, foreign_table);
+  } else if (data_wrapper_type == DataWrapperType::INTERNAL_EXECUTOR_STATS) {
+    data_wrapper =
+        std::make_unique<InternalExecutorStatsDataWrapper>(db_id, foreign_table);
   } else {
     throw std::runtime_error("Unsupported data wrapper");
   }
@@ -222,6 +226,9 @@ const ForeignDataWrapper& ForeignDataWrapperFactory::createForValidation(
     } else if (data_wrapper_type == DataWrapperType::INTERNAL_STORAGE_STATS) {
       validation_data_wrappers_[data_wrapper_type_key] =
           std::make_unique<InternalStorageStatsDataWrapper>();
+    } else if (data_wrapper_type == DataWrapperType::INTERNAL_EXECUTOR_STATS) {
+      validation_data_wrappers_[data_wrapper_type_key] =
+          std::make_unique<InternalExecutorStatsDataWrapper>();
     } else {
       UNREACHABLE();
     }
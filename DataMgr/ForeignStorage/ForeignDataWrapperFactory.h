@@ -33,19 +33,23 @@ struct DataWrapperType {
   static constexpr char const* INTERNAL_CATALOG = "OMNISCI_INTERNAL_CATALOG";
   static constexpr char const* INTERNAL_MEMORY_STATS = "INTERNAL_OMNISCI_MEMORY_STATS";
   static constexpr char const* INTERNAL_STORAGE_STATS = "INTERNAL_OMNISCI_STORAGE_STATS";
+  static constexpr char const* INTERNAL_EXECUTOR_STATS =
+      "INTERNAL_OMNISCI_EXECUTOR_STATS";
 
-  static constexpr std::array<char const*, 3> INTERNAL_DATA_WRAPPERS{
+  static constexpr std::array<char const*, 4> INTERNAL_DATA_WRAPPERS{
       INTERNAL_CATALOG,
       INTERNAL_MEMORY_STATS,
-      INTERNAL_STORAGE_STATS};
+      INTERNAL_STORAGE_STATS,
+      INTERNAL_EXECUTOR_STATS};
 
-  static constexpr std::array<std::string_view, 6> supported_data_wrapper_types{
+  static constexpr std::array<std::string_view, 7> supported_data_wrapper_types{
       PARQUET,
       CSV,
       REGEX_PARSER,
       INTERNAL_CATALOG,
       INTERNAL_MEMORY_STATS,
-      INTERNAL_STORAGE_STATS};
+      INTERNAL_STORAGE_STATS,
+      INTERNAL_EXECUTOR_STATS};
 };
 
 class ForeignDataWrapperFactory {
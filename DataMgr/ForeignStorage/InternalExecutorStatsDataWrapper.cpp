@@ -0,0 +1,85 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "InternalExecutorStatsDataWrapper.h"
+
+#include "Catalog/Catalog.h"
+#include "ImportExport/Importer.h"
+
+namespace foreign_storage {
+InternalExecutorStatsDataWrapper::InternalExecutorStatsDataWrapper()
+    : InternalSystemDataWrapper() {}
+
+InternalExecutorStatsDataWrapper::InternalExecutorStatsDataWrapper(
+    const int db_id,
+    const ForeignTable* foreign_table)
+    : InternalSystemDataWrapper(db_id, foreign_table) {}
+
+namespace {
+void populate_import_buffers_for_query_queue_summary(
+    const std::vector<QueryDispatchQueue::PriorityStats>& query_queue_stats,
+    std::map<std::string, import_export::TypedImportBuffer*>& import_buffers) {
+  for (const auto& stats : query_queue_stats) {
+    if (import_buffers.find("node") != import_buffers.end()) {
+      import_buffers["node"]->addString("Server");
+    }
+    if (import_buffers.find("priority") != import_buffers.end()) {
+      import_buffers["priority"]->addString(QueryDispatchQueue::toString(stats.priority));
+    }
+    if (import_buffers.find("weight") != import_buffers.end()) {
+      import_buffers["weight"]->addInt(stats.weight);
+    }
+    if (import_buffers.find("queued_query_count") != import_buffers.end()) {
+      import_buffers["queued_query_count"]->addBigint(stats.queued_count);
+    }
+    if (import_buffers.find("running_query_count") != import_buffers.end()) {
+      import_buffers["running_query_count"]->addBigint(stats.running_count);
+    }
+    if (import_buffers.find("dispatched_query_count") != import_buffers.end()) {
+      import_buffers["dispatched_query_count"]->addBigint(stats.dispatched_count);
+    }
+    if (import_buffers.find("memory_deferred_query_count") != import_buffers.end()) {
+      import_buffers["memory_deferred_query_count"]->addBigint(
+          stats.memory_deferred_count);
+    }
+    if (import_buffers.find("total_wait_time_ms") != import_buffers.end()) {
+      import_buffers["total_wait_time_ms"]->addBigint(stats.total_wait_time_ms);
+    }
+    if (import_buffers.find("max_wait_time_ms") != import_buffers.end()) {
+      import_buffers["max_wait_time_ms"]->addBigint(stats.max_wait_time_ms);
+    }
+    if (import_buffers.find("oldest_queued_wait_time_ms") != import_buffers.end()) {
+      import_buffers["oldest_queued_wait_time_ms"]->addBigint(
+          stats.oldest_queued_wait_time_ms);
+    }
+  }
+}
+}  // namespace
+
+void InternalExecutorStatsDataWrapper::initializeObjectsForTable(
+    const std::string& table_name) {
+  CHECK_EQ(table_name, Catalog_Namespace::QUERY_QUEUE_SUMMARY_SYS_TABLE_NAME);
+  query_queue_stats_ = QueryDispatchQueue::getGlobalQueueStats();
+  row_count_ = query_queue_stats_.size();
+}
+
+void InternalExecutorStatsDataWrapper::populateChunkBuffersForTable(
+    const std::string& table_name,
+    std::map<std::string, import_export::TypedImportBuffer*>& import_buffers) {
+  CHECK_EQ(table_name, Catalog_Namespace::QUERY_QUEUE_SUMMARY_SYS_TABLE_NAME);
+  populate_import_buffers_for_query_queue_summary(query_queue_stats_, import_buffers);
+}
+}  // namespace foreign_storage
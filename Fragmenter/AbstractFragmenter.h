@@ -24,6 +24,7 @@
 #include "Fragmenter/Fragmenter.h"
 
 #include <boost/variant.hpp>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -204,6 +205,20 @@ class AbstractFragmenter {
       const Data_Namespace::MemoryLevel memory_level,
       UpdelRoll& updel_roll) = 0;
 
+  /**
+   * @brief Updates a fixed width column from a buffer holding the new value of each
+   * updated row, in the storage type of the column, without per row conversions.
+   */
+  virtual std::optional<ChunkUpdateStats> updateColumnFromBuffer(
+      const Catalog_Namespace::Catalog* catalog,
+      const TableDescriptor* td,
+      const ColumnDescriptor* cd,
+      const int fragment_id,
+      const std::vector<uint64_t>& frag_offsets,
+      const int8_t* rhs_buffer,
+      const Data_Namespace::MemoryLevel memory_level,
+      UpdelRoll& updel_roll) = 0;
+
   virtual void updateColumns(const Catalog_Namespace::Catalog* catalog,
                              const TableDescriptor* td,
                              const int fragmentId,
@@ -243,6 +258,30 @@ class AbstractFragmenter {
                            const Data_Namespace::MemoryLevel memoryLevel,
                            UpdelRoll& updelRoll) = 0;
 
+  /**
+   * @brief Appends the visible rows of the table again in the order of the Hilbert
+   * curve key of the centroids stored in the given geo location column and marks the
+   * original rows as deleted.
+   */
+  virtual void clusterRows(const Catalog_Namespace::Catalog* catalog,
+                           const TableDescriptor* td,
+                           const ColumnDescriptor* location_cd,
+                           const Data_Namespace::MemoryLevel memory_level,
+                           UpdelRoll& updel_roll) = 0;
+
+  /**
+   * @brief Appends the visible rows of the given fragments again, ordered by the given
+   * scalar column if any, and marks the original rows as deleted. Rows are appended to
+   * the last fragment first, so under-filled fragments end up merged into full ones
+   * once the originals are vacuumed.
+   */
+  virtual void mergeFragments(const Catalog_Namespace::Catalog* catalog,
+                              const TableDescriptor* td,
+                              const std::set<int>& fragment_ids,
+                              const ColumnDescriptor* sort_cd,
+                              const Data_Namespace::MemoryLevel memory_level,
+                              UpdelRoll& updel_roll) = 0;
+
   virtual const std::vector<uint64_t> getVacuumOffsets(
       const std::shared_ptr<Chunk_NS::Chunk>& chunk) = 0;
 
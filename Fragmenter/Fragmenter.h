@@ -89,6 +89,8 @@ class FragmentInfo {
       , physicalTableId(-1)
       , shard(-1)
       , resultSet(nullptr)
+      , resultSetEntryOffset(0)
+      , resultSetEntryCount(0)
       , numTuples(0)
       , synthesizedNumTuplesIsValid(false)
       , synthesizedMetadataIsValid(false) {}
@@ -131,6 +133,10 @@ class FragmentInfo {
   ChunkMetadataMap shadowChunkMetadataMap;
   mutable ResultSet* resultSet;
   mutable std::shared_ptr<std::mutex> resultSetMutex;
+  // Range of result set entries covered by a fragment of a temporary table which is
+  // split into batches. A zero count means the fragment covers the whole result set.
+  size_t resultSetEntryOffset;
+  size_t resultSetEntryCount;
 
  private:
   mutable size_t numTuples;
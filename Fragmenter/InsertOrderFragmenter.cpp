@@ -917,6 +917,7 @@ void InsertOrderFragmenter::insertDataImpl(InsertData& insert_data) {
   }
   numTuples_ += insert_data.numRows;
   dropFragmentsToSizeNoInsertLock(maxRows_);
+  catalog_->updateTableStatistics(insert_data);
 }
 
 FragmentInfo* InsertOrderFragmenter::createNewFragment(
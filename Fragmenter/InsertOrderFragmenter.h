@@ -135,6 +135,16 @@ class InsertOrderFragmenter : public AbstractFragmenter {
       const Data_Namespace::MemoryLevel memory_level,
       UpdelRoll& updel_roll) override;
 
+  std::optional<ChunkUpdateStats> updateColumnFromBuffer(
+      const Catalog_Namespace::Catalog* catalog,
+      const TableDescriptor* td,
+      const ColumnDescriptor* cd,
+      const int fragment_id,
+      const std::vector<uint64_t>& frag_offsets,
+      const int8_t* rhs_buffer,
+      const Data_Namespace::MemoryLevel memory_level,
+      UpdelRoll& updel_roll) override;
+
   void updateColumns(const Catalog_Namespace::Catalog* catalog,
                      const TableDescriptor* td,
                      const int fragmentId,
@@ -174,6 +184,19 @@ class InsertOrderFragmenter : public AbstractFragmenter {
                    const Data_Namespace::MemoryLevel memory_level,
                    UpdelRoll& updel_roll) override;
 
+  void clusterRows(const Catalog_Namespace::Catalog* catalog,
+                   const TableDescriptor* td,
+                   const ColumnDescriptor* location_cd,
+                   const Data_Namespace::MemoryLevel memory_level,
+                   UpdelRoll& updel_roll) override;
+
+  void mergeFragments(const Catalog_Namespace::Catalog* catalog,
+                      const TableDescriptor* td,
+                      const std::set<int>& fragment_ids,
+                      const ColumnDescriptor* sort_cd,
+                      const Data_Namespace::MemoryLevel memory_level,
+                      UpdelRoll& updel_roll) override;
+
   const std::vector<uint64_t> getVacuumOffsets(
       const std::shared_ptr<Chunk_NS::Chunk>& chunk) override;
 
@@ -238,6 +261,17 @@ class InsertOrderFragmenter : public AbstractFragmenter {
   void insertChunksImpl(const InsertChunks& insert_chunk);
   void addColumns(const InsertData& insertDataStruct);
 
+  // Appends the given (fragment index, offset) rows in the given order, filling up the
+  // last fragment first so that every later batch becomes a fragment of its own, and
+  // marks the original rows as deleted. The chunks are fetched one batch at a time.
+  void rewriteRows(const Catalog_Namespace::Catalog* catalog,
+                   const TableDescriptor* td,
+                   const std::vector<FragmentInfo*>& fragments,
+                   const std::vector<std::pair<size_t, uint64_t>>& rows,
+                   const std::vector<size_t>& order,
+                   const Data_Namespace::MemoryLevel memory_level,
+                   UpdelRoll& updel_roll);
+
   InsertOrderFragmenter(const InsertOrderFragmenter&);
   InsertOrderFragmenter& operator=(const InsertOrderFragmenter&);
   // FIX-ME:  Temporary lock; needs removing.
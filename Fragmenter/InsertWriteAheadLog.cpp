@@ -0,0 +1,692 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Fragmenter/InsertWriteAheadLog.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <stdexcept>
+
+#include <boost/crc.hpp>
+#include <boost/filesystem.hpp>
+
+#include "Catalog/Catalog.h"
+#include "Fragmenter/Fragmenter.h"
+#include "LockMgr/LockMgr.h"
+#include "Logger/Logger.h"
+#include "OSDependent/omnisci_fs.h"
+#include "Shared/checked_alloc.h"
+
+bool g_enable_insert_wal{false};
+size_t g_insert_wal_checkpoint_interval_ms{1000};
+
+namespace Fragmenter_Namespace {
+
+namespace {
+
+constexpr uint32_t kRecordMagic{0x4c415749};  // "IWAL"
+constexpr size_t kRecordHeaderSize{3 * sizeof(uint32_t)};
+const std::string kSegmentPrefix{"insert_wal."};
+
+enum class RecordType : uint8_t { Insert, DiscardTable };
+
+enum class LoggedColumnKind : uint8_t { Numbers, Strings, Arrays };
+
+// (database id, logical table id)
+using TableKey = std::pair<int32_t, int32_t>;
+// (segment id, offset in the segment) of a record
+using LogPosition = std::pair<int64_t, size_t>;
+
+LoggedColumnKind get_logged_column_kind(const SQLTypeInfo& ti) {
+  if (ti.is_array()) {
+    return LoggedColumnKind::Arrays;
+  }
+  if (ti.is_geometry() || (ti.is_string() && ti.get_compression() == kENCODING_NONE)) {
+    return LoggedColumnKind::Strings;
+  }
+  return LoggedColumnKind::Numbers;
+}
+
+// Width of a value in the numbers buffers passed to the fragmenter, which hold
+// dictionary ids at their encoded width and everything else at the logical width.
+size_t get_logged_value_size(const SQLTypeInfo& ti) {
+  return ti.is_string() ? ti.get_size() : ti.get_logical_size();
+}
+
+uint32_t compute_checksum(const char* data, const size_t size) {
+  boost::crc_32_type crc;
+  crc.process_bytes(data, size);
+  return crc.checksum();
+}
+
+class RecordWriter {
+ public:
+  template <typename T>
+  void put(const T value) {
+    buffer_.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  void putBytes(const void* bytes, const size_t size) {
+    put<uint64_t>(size);
+    if (size) {
+      buffer_.append(static_cast<const char*>(bytes), size);
+    }
+  }
+
+  std::string& buffer() { return buffer_; }
+
+ private:
+  std::string buffer_;
+};
+
+class RecordReader {
+ public:
+  RecordReader(const char* data, const size_t size) : data_(data), size_(size) {}
+
+  template <typename T>
+  T get() {
+    T value;
+    std::memcpy(&value, take(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  const char* take(const size_t size) {
+    if (size > size_ - offset_) {
+      throw std::runtime_error("Truncated insert log record");
+    }
+    const auto ptr = data_ + offset_;
+    offset_ += size;
+    return ptr;
+  }
+
+  size_t offset() const { return offset_; }
+
+ private:
+  const char* data_;
+  const size_t size_;
+  size_t offset_{0};
+};
+
+struct RecordInfo {
+  LogPosition position;
+  RecordType type;
+  int32_t db_id;
+  int32_t logical_table_id;
+};
+
+struct LoggedInsert {
+  int32_t epoch;
+  InsertData insert_data;
+  std::vector<std::unique_ptr<int8_t[]>> numbers;
+  std::vector<std::unique_ptr<std::vector<std::string>>> strings;
+  std::vector<std::unique_ptr<std::vector<ArrayDatum>>> arrays;
+};
+
+void start_record(RecordWriter& writer,
+                  const RecordType type,
+                  const int32_t db_id,
+                  const int32_t logical_table_id) {
+  writer.put<uint32_t>(kRecordMagic);
+  writer.put<uint32_t>(0);  // payload size
+  writer.put<uint32_t>(0);  // checksum
+  writer.put<uint8_t>(static_cast<uint8_t>(type));
+  writer.put<int32_t>(db_id);
+  writer.put<int32_t>(logical_table_id);
+}
+
+std::string finish_record(RecordWriter& writer) {
+  auto& record = writer.buffer();
+  const uint32_t payload_size = record.size() - kRecordHeaderSize;
+  const uint32_t checksum =
+      compute_checksum(record.data() + kRecordHeaderSize, payload_size);
+  std::memcpy(&record[sizeof(uint32_t)], &payload_size, sizeof(uint32_t));
+  std::memcpy(&record[2 * sizeof(uint32_t)], &checksum, sizeof(uint32_t));
+  return std::move(record);
+}
+
+std::string serialize_discard(const int32_t db_id, const int32_t logical_table_id) {
+  RecordWriter writer;
+  start_record(writer, RecordType::DiscardTable, db_id, logical_table_id);
+  return finish_record(writer);
+}
+
+std::string serialize_insert(const InsertData& insert_data,
+                             const Catalog_Namespace::Catalog& cat,
+                             const int physical_table_id) {
+  RecordWriter writer;
+  start_record(writer,
+               RecordType::Insert,
+               insert_data.databaseId,
+               cat.getLogicalTableId(physical_table_id));
+  const auto epoch =
+      cat.getDataMgr().getTableEpoch(insert_data.databaseId, physical_table_id) + 1;
+  writer.put<int32_t>(physical_table_id);
+  writer.put<int32_t>(epoch);
+  writer.put<uint64_t>(insert_data.numRows);
+  writer.put<uint32_t>(insert_data.columnIds.size());
+  CHECK_EQ(insert_data.columnIds.size(), insert_data.data.size());
+  for (size_t i = 0; i < insert_data.columnIds.size(); ++i) {
+    const auto cd = cat.getMetadataForColumn(physical_table_id, insert_data.columnIds[i]);
+    CHECK(cd);
+    const bool is_default =
+        i < insert_data.is_default.size() && insert_data.is_default[i];
+    const auto kind = get_logged_column_kind(cd->columnType);
+    writer.put<int32_t>(cd->columnId);
+    writer.put<uint8_t>(is_default);
+    writer.put<uint8_t>(static_cast<uint8_t>(kind));
+    const auto& data = insert_data.data[i];
+    switch (kind) {
+      case LoggedColumnKind::Numbers: {
+        const size_t row_count = is_default ? 1 : insert_data.numRows;
+        writer.putBytes(data.numbersPtr,
+                        row_count * get_logged_value_size(cd->columnType));
+        break;
+      }
+      case LoggedColumnKind::Strings: {
+        writer.put<uint64_t>(data.stringsPtr->size());
+        for (const auto& str : *data.stringsPtr) {
+          writer.putBytes(str.data(), str.size());
+        }
+        break;
+      }
+      case LoggedColumnKind::Arrays: {
+        writer.put<uint64_t>(data.arraysPtr->size());
+        for (const auto& arr : *data.arraysPtr) {
+          writer.put<uint8_t>(arr.is_null);
+          writer.putBytes(arr.pointer, arr.pointer ? arr.length : 0);
+        }
+        break;
+      }
+    }
+  }
+  return finish_record(writer);
+}
+
+void deserialize_insert(LoggedInsert& logged_insert,
+                        const RecordInfo& info,
+                        RecordReader& reader) {
+  auto& insert_data = logged_insert.insert_data;
+  insert_data.databaseId = info.db_id;
+  insert_data.tableId = reader.get<int32_t>();
+  logged_insert.epoch = reader.get<int32_t>();
+  insert_data.numRows = reader.get<uint64_t>();
+  const auto column_count = reader.get<uint32_t>();
+  for (uint32_t i = 0; i < column_count; ++i) {
+    insert_data.columnIds.push_back(reader.get<int32_t>());
+    insert_data.is_default.push_back(reader.get<uint8_t>());
+    const auto kind = static_cast<LoggedColumnKind>(reader.get<uint8_t>());
+    DataBlockPtr data;
+    switch (kind) {
+      case LoggedColumnKind::Numbers: {
+        const auto size = reader.get<uint64_t>();
+        const auto bytes = reader.take(size);
+        logged_insert.numbers.emplace_back(new int8_t[size]);
+        std::memcpy(logged_insert.numbers.back().get(), bytes, size);
+        data.numbersPtr = logged_insert.numbers.back().get();
+        break;
+      }
+      case LoggedColumnKind::Strings: {
+        logged_insert.strings.emplace_back(new std::vector<std::string>());
+        auto& strings = *logged_insert.strings.back();
+        strings.resize(reader.get<uint64_t>());
+        for (auto& str : strings) {
+          const auto size = reader.get<uint64_t>();
+          str.assign(reader.take(size), size);
+        }
+        data.stringsPtr = &strings;
+        break;
+      }
+      case LoggedColumnKind::Arrays: {
+        logged_insert.arrays.emplace_back(new std::vector<ArrayDatum>());
+        auto& arrays = *logged_insert.arrays.back();
+        const auto array_count = reader.get<uint64_t>();
+        for (uint64_t j = 0; j < array_count; ++j) {
+          const bool is_null = reader.get<uint8_t>();
+          const auto size = reader.get<uint64_t>();
+          if (!size) {
+            arrays.emplace_back(0, nullptr, is_null);
+            continue;
+          }
+          auto buf = reinterpret_cast<int8_t*>(checked_malloc(size));
+          std::memcpy(buf, reader.take(size), size);
+          arrays.emplace_back(size, buf, is_null);
+        }
+        data.arraysPtr = &arrays;
+        break;
+      }
+      default:
+        throw std::runtime_error("Unknown column kind in insert log record");
+    }
+    insert_data.data.push_back(data);
+  }
+}
+
+std::shared_ptr<Catalog_Namespace::Catalog> get_catalog(const int32_t db_id) {
+  auto& sys_catalog = Catalog_Namespace::SysCatalog::instance();
+  auto cat = sys_catalog.getCatalog(db_id);
+  if (!cat) {
+    Catalog_Namespace::DBMetadata db;
+    if (sys_catalog.getMetadataForDBById(db_id, db)) {
+      cat = sys_catalog.getCatalog(db, false);
+    }
+  }
+  return cat;
+}
+
+std::map<int64_t, std::string> get_segment_paths(const std::string& log_path) {
+  std::map<int64_t, std::string> segment_paths;
+  for (const auto& entry : boost::filesystem::directory_iterator(log_path)) {
+    const auto file_name = entry.path().filename().string();
+    if (file_name.compare(0, kSegmentPrefix.size(), kSegmentPrefix)) {
+      continue;
+    }
+    try {
+      segment_paths.emplace(std::stoll(file_name.substr(kSegmentPrefix.size())),
+                            entry.path().string());
+    } catch (const std::exception&) {
+      LOG(WARNING) << "Ignoring unexpected file " << entry.path() << " in insert log";
+    }
+  }
+  return segment_paths;
+}
+
+// Calls the handler with every intact record of the segments, in log order. Only the
+// tail of the last segment can be torn, by a crash during a write, so reading a
+// segment stops at its first invalid record.
+template <typename RecordHandler>
+void for_each_record(const std::map<int64_t, std::string>& segment_paths,
+                     const bool warn_on_invalid_record,
+                     RecordHandler handle_record) {
+  for (const auto& [segment_id, segment_path] : segment_paths) {
+    std::ifstream segment_file(segment_path, std::ios::binary);
+    const std::string segment((std::istreambuf_iterator<char>(segment_file)),
+                              std::istreambuf_iterator<char>());
+    RecordReader segment_reader(segment.data(), segment.size());
+    while (segment_reader.offset() < segment.size()) {
+      const auto record_offset = segment_reader.offset();
+      const char* payload{nullptr};
+      uint32_t payload_size{0};
+      try {
+        if (segment_reader.get<uint32_t>() != kRecordMagic) {
+          throw std::runtime_error("Invalid insert log record");
+        }
+        payload_size = segment_reader.get<uint32_t>();
+        const auto checksum = segment_reader.get<uint32_t>();
+        payload = segment_reader.take(payload_size);
+        if (compute_checksum(payload, payload_size) != checksum) {
+          throw std::runtime_error("Insert log record checksum mismatch");
+        }
+      } catch (const std::exception& e) {
+        if (warn_on_invalid_record) {
+          LOG(WARNING) << "Stopped reading insert write-ahead log segment "
+                       << segment_path << " at offset " << record_offset << ": "
+                       << e.what();
+        }
+        break;
+      }
+      RecordReader reader(payload, payload_size);
+      RecordInfo info;
+      info.position = {segment_id, record_offset};
+      info.type = static_cast<RecordType>(reader.get<uint8_t>());
+      info.db_id = reader.get<int32_t>();
+      info.logical_table_id = reader.get<int32_t>();
+      handle_record(info, reader);
+    }
+  }
+}
+
+// Returns the position of the last discard record of each table in the segments.
+std::map<TableKey, LogPosition> get_discard_positions(
+    const std::map<int64_t, std::string>& segment_paths) {
+  std::map<TableKey, LogPosition> discard_positions;
+  for_each_record(segment_paths, false, [&](const RecordInfo& info, RecordReader&) {
+    if (info.type == RecordType::DiscardTable) {
+      discard_positions[{info.db_id, info.logical_table_id}] = info.position;
+    }
+  });
+  return discard_positions;
+}
+
+bool is_discarded(const RecordInfo& info,
+                  const std::map<TableKey, LogPosition>& discard_positions) {
+  const auto it = discard_positions.find({info.db_id, info.logical_table_id});
+  return it != discard_positions.end() && info.position < it->second;
+}
+
+// Inserts the logged rows unless their table has checkpointed them already. Returns
+// whether they have been inserted.
+bool insert_logged_rows(const Catalog_Namespace::Catalog& cat,
+                        LoggedInsert& logged_insert) {
+  auto& insert_data = logged_insert.insert_data;
+  const auto td = cat.getMetadataForTable(insert_data.tableId);
+  if (!td) {
+    return false;
+  }
+  const auto checkpointed_epoch =
+      cat.getDataMgr().getTableEpoch(insert_data.databaseId, insert_data.tableId);
+  if (logged_insert.epoch <= static_cast<int32_t>(checkpointed_epoch)) {
+    return false;
+  }
+  const bool has_all_columns =
+      std::all_of(insert_data.columnIds.begin(),
+                  insert_data.columnIds.end(),
+                  [&](const int column_id) {
+                    return cat.getMetadataForColumn(td->tableId, column_id) != nullptr;
+                  });
+  if (!has_all_columns) {
+    LOG(ERROR) << "Skipping logged insert into table " << td->tableName
+               << " since its columns have changed";
+    return false;
+  }
+  td->fragmenter->insertDataNoCheckpoint(insert_data);
+  return true;
+}
+
+}  // namespace
+
+InsertWriteAheadLog& InsertWriteAheadLog::instance() {
+  static InsertWriteAheadLog insert_wal;
+  return insert_wal;
+}
+
+void InsertWriteAheadLog::start(const std::string& log_path) {
+  CHECK(!running_);
+  log_path_ = log_path;
+  boost::filesystem::create_directories(log_path_);
+  replay();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    openSegment();
+    running_ = true;
+  }
+  checkpoint_thread_ = std::thread([this] {
+    std::unique_lock<std::mutex> stop_lock(stop_mutex_);
+    while (!stop_requested_.wait_for(
+        stop_lock,
+        std::chrono::milliseconds(g_insert_wal_checkpoint_interval_ms),
+        [this] { return !isRunning(); })) {
+      stop_lock.unlock();
+      checkpoint();
+      stop_lock.lock();
+    }
+  });
+  LOG(INFO) << "Started insert write-ahead log in " << log_path_;
+}
+
+void InsertWriteAheadLog::stop() {
+  {
+    std::lock_guard<std::mutex> stop_lock(stop_mutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_) {
+      return;
+    }
+    running_ = false;
+  }
+  stop_requested_.notify_one();
+  checkpoint_thread_.join();
+  checkpoint();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (segment_) {
+    fclose(segment_);
+    segment_ = nullptr;
+  }
+}
+
+bool InsertWriteAheadLog::isRunning() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return running_;
+}
+
+void InsertWriteAheadLog::commit(const InsertData& insert_data,
+                                 const Catalog_Namespace::Catalog& cat,
+                                 const int physical_table_id) {
+  const auto record = serialize_insert(insert_data, cat, physical_table_id);
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (!running_) {
+    throw std::runtime_error("Insert write-ahead log is not running");
+  }
+  logged_tables_.emplace(insert_data.databaseId,
+                         cat.getLogicalTableId(physical_table_id));
+  appendRecord(record, lock);
+}
+
+void InsertWriteAheadLog::discardTable(const Catalog_Namespace::Catalog& cat,
+                                       const int logical_table_id) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (!running_ || !mayHoldRecords({cat.getDatabaseId(), logical_table_id})) {
+    return;
+  }
+  appendRecord(serialize_discard(cat.getDatabaseId(), logical_table_id), lock);
+}
+
+void InsertWriteAheadLog::reinsertRolledBack(const Catalog_Namespace::Catalog& cat,
+                                             const int logical_table_id) {
+  const TableKey table{cat.getDatabaseId(), logical_table_id};
+  std::map<int64_t, std::string> segment_paths;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_ || !mayHoldRecords(table)) {
+      return;
+    }
+    // The records of the table are durable already, since the table is locked for
+    // the rollback, and a concurrent checkpoint cannot remove them before it has
+    // checkpointed the table.
+    segment_paths = get_segment_paths(log_path_);
+  }
+  const auto discard_positions = get_discard_positions(segment_paths);
+  size_t reinserted_rows{0};
+  for_each_record(
+      segment_paths, false, [&](const RecordInfo& info, RecordReader& reader) {
+        if (info.type != RecordType::Insert ||
+            TableKey{info.db_id, info.logical_table_id} != table ||
+            is_discarded(info, discard_positions)) {
+          return;
+        }
+        LoggedInsert logged_insert;
+        deserialize_insert(logged_insert, info, reader);
+        if (insert_logged_rows(cat, logged_insert)) {
+          reinserted_rows += logged_insert.insert_data.numRows;
+        }
+      });
+  if (reinserted_rows) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      logged_tables_.insert(table);
+    }
+    LOG(INFO) << "Inserted " << reinserted_rows
+              << " rows from the insert write-ahead log again after rolling back table "
+              << logical_table_id;
+  }
+}
+
+bool InsertWriteAheadLog::mayHoldRecords(const TableKey& table) const {
+  // Records of tables which are not logged since the last checkpoint can only be in
+  // closed segments, which a failed or ongoing checkpoint has not removed yet.
+  return logged_tables_.count(table) || !closed_segments_.empty();
+}
+
+void InsertWriteAheadLog::appendRecord(const std::string& record,
+                                       std::unique_lock<std::mutex>& lock) {
+  const auto lsn = ++appended_lsn_;
+  pending_ += record;
+  // Group commit: whoever finds no flush in progress writes the records of all
+  // waiting inserts, the others wait for that flush or the next one.
+  while (durable_lsn_ < lsn && failed_lsn_ < lsn) {
+    if (flushing_) {
+      flushed_.wait(lock);
+    } else {
+      flushPending(lock);
+    }
+  }
+  if (durable_lsn_ < lsn) {
+    throw std::runtime_error("Failed to write the insert write-ahead log");
+  }
+}
+
+void InsertWriteAheadLog::flushPending(std::unique_lock<std::mutex>& lock) {
+  CHECK(!flushing_);
+  CHECK(segment_);
+  flushing_ = true;
+  std::string records;
+  records.swap(pending_);
+  const auto last_lsn = appended_lsn_;
+  const auto segment_size = segment_size_;
+  lock.unlock();
+  const auto fd = fileno(segment_);
+  bool success = fwrite(records.data(), 1, records.size(), segment_) == records.size();
+  success = success && fflush(segment_) == 0;
+  success = success && omnisci::fsync(fd) == 0;
+  if (!success) {
+    LOG(ERROR) << "Failed to write " << records.size()
+               << " bytes to the insert write-ahead log: " << strerror(errno);
+    // Drop the partial write so the records appended later can be replayed.
+    clearerr(segment_);
+    CHECK_EQ(omnisci::ftruncate(fd, segment_size), 0);
+    CHECK_EQ(fseek(segment_, segment_size, SEEK_SET), 0);
+  }
+  lock.lock();
+  flushing_ = false;
+  if (success) {
+    segment_size_ += records.size();
+    durable_lsn_ = last_lsn;
+  } else {
+    failed_lsn_ = last_lsn;
+  }
+  flushed_.notify_all();
+}
+
+void InsertWriteAheadLog::openSegment() {
+  ++segment_id_;
+  const auto segment_path = getSegmentPath(segment_id_);
+  segment_ = omnisci::fopen(segment_path.c_str(), "wb");
+  CHECK(segment_) << "Could not open insert write-ahead log segment " << segment_path;
+  segment_size_ = 0;
+}
+
+std::string InsertWriteAheadLog::getSegmentPath(const int64_t segment_id) const {
+  return (boost::filesystem::path(log_path_) /
+          (kSegmentPrefix + std::to_string(segment_id)))
+      .string();
+}
+
+void InsertWriteAheadLog::checkpoint() {
+  std::lock_guard<std::mutex> checkpoint_lock(checkpoint_mutex_);
+  std::vector<std::string> segments;
+  std::set<TableKey> tables;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (flushing_ || !pending_.empty()) {
+      if (flushing_) {
+        flushed_.wait(lock);
+      } else {
+        flushPending(lock);
+      }
+    }
+    if (logged_tables_.empty()) {
+      return;
+    }
+    fclose(segment_);
+    closed_segments_.push_back(getSegmentPath(segment_id_));
+    segment_ = nullptr;
+    if (running_) {
+      openSegment();
+    }
+    segments = closed_segments_;
+    tables.swap(logged_tables_);
+  }
+  std::set<TableKey> failed_tables;
+  for (const auto& table : tables) {
+    const auto [db_id, table_id] = table;
+    try {
+      auto cat = get_catalog(db_id);
+      if (!cat) {
+        continue;
+      }
+      const ChunkKey table_key{db_id, table_id};
+      const auto schema_lock =
+          lockmgr::TableSchemaLockMgr::getReadLockForTable(table_key);
+      const auto insert_data_lock =
+          lockmgr::InsertDataLockMgr::getWriteLockForTable(table_key);
+      if (!cat->getMetadataForTable(table_id, false)) {
+        continue;  // dropped since it was logged
+      }
+      cat->checkpoint(table_id);
+    } catch (const std::exception& e) {
+      LOG(WARNING) << "Checkpoint of table (" << db_id << "," << table_id
+                   << ") logged in the insert write-ahead log failed: " << e.what();
+      failed_tables.insert(table);
+    }
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!failed_tables.empty()) {
+    // Keep the segments until the next checkpoint of the tables succeeds.
+    logged_tables_.insert(failed_tables.begin(), failed_tables.end());
+    return;
+  }
+  for (const auto& segment : segments) {
+    boost::system::error_code ec;
+    boost::filesystem::remove(segment, ec);
+    if (ec) {
+      LOG(WARNING) << "Could not remove insert write-ahead log segment " << segment
+                   << ": " << ec.message();
+    }
+  }
+  closed_segments_.erase(closed_segments_.begin(),
+                         closed_segments_.begin() + segments.size());
+}
+
+void InsertWriteAheadLog::replay() {
+  const auto segment_paths = get_segment_paths(log_path_);
+  const auto discard_positions = get_discard_positions(segment_paths);
+  std::set<TableKey> replayed_tables;
+  size_t replayed_rows{0};
+  for (const auto& segment : segment_paths) {
+    segment_id_ = std::max(segment_id_, segment.first);
+  }
+  for_each_record(segment_paths, true, [&](const RecordInfo& info, RecordReader& reader) {
+    if (info.type != RecordType::Insert || is_discarded(info, discard_positions)) {
+      return;
+    }
+    auto cat = get_catalog(info.db_id);
+    if (!cat) {
+      return;
+    }
+    LoggedInsert logged_insert;
+    deserialize_insert(logged_insert, info, reader);
+    if (insert_logged_rows(*cat, logged_insert)) {
+      replayed_tables.emplace(info.db_id, info.logical_table_id);
+      replayed_rows += logged_insert.insert_data.numRows;
+    }
+  });
+  for (const auto& [db_id, table_id] : replayed_tables) {
+    get_catalog(db_id)->checkpoint(table_id);
+  }
+  for (const auto& segment : segment_paths) {
+    boost::filesystem::remove(segment.second);
+  }
+  if (replayed_rows) {
+    LOG(INFO) << "Replayed " << replayed_rows << " rows into " << replayed_tables.size()
+              << " tables from the insert write-ahead log";
+  }
+}
+
+}  // namespace Fragmenter_Namespace
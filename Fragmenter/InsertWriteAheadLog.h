@@ -0,0 +1,119 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    InsertWriteAheadLog.h
+ * @brief   Write-ahead log for small inserts into disk resident tables.
+ *
+ * Instead of checkpointing the table after every batch, the inserted rows are appended
+ * to a log which concurrent inserts share: the first waiting insert writes and syncs
+ * the records of all waiting inserts at once. A background thread checkpoints the
+ * logged tables periodically and drops the log segments covered by the checkpoint. On
+ * startup, the records newer than the last checkpointed epoch of their table are
+ * inserted again, and so are they when a table is rolled back to its checkpointed
+ * epochs. Truncating or dropping a table logs a record discarding its earlier records.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Catalog_Namespace {
+class Catalog;
+}  // namespace Catalog_Namespace
+
+namespace Fragmenter_Namespace {
+
+struct InsertData;
+
+class InsertWriteAheadLog {
+ public:
+  static InsertWriteAheadLog& instance();
+
+  // Replays the log found in the given directory and starts the checkpoint thread.
+  // Requires the system catalog to be initialized.
+  void start(const std::string& log_path);
+  // Checkpoints the logged tables and stops the checkpoint thread.
+  void stop();
+  bool isRunning();
+
+  // Appends the batch, which has been inserted into the given physical table already,
+  // to the log and returns once it is durable. Must be called with the insert data
+  // lock or the schema write lock of the table held.
+  void commit(const InsertData& insert_data,
+              const Catalog_Namespace::Catalog& cat,
+              const int physical_table_id);
+
+  // Logs that the records of the table logged so far no longer apply and returns once
+  // this is durable. Must be called before the data of the table is removed.
+  void discardTable(const Catalog_Namespace::Catalog& cat, const int logical_table_id);
+
+  // Inserts the logged rows of the table which are newer than its checkpointed epochs
+  // again. Called after the table has been rolled back, which drops them, with the
+  // insert data lock or the schema write lock of the table held.
+  void reinsertRolledBack(const Catalog_Namespace::Catalog& cat,
+                          const int logical_table_id);
+
+  // Checkpoints the tables logged so far and removes the log segments covered by the
+  // checkpoint.
+  void checkpoint();
+
+ private:
+  InsertWriteAheadLog() {}
+
+  void replay();
+  void openSegment();
+  std::string getSegmentPath(const int64_t segment_id) const;
+  // Whether the log segments may hold records of the table. Requires mutex_.
+  bool mayHoldRecords(const std::pair<int32_t, int32_t>& table) const;
+  // Appends the record and waits until it is durable. Requires mutex_.
+  void appendRecord(const std::string& record, std::unique_lock<std::mutex>& lock);
+  void flushPending(std::unique_lock<std::mutex>& lock);
+
+  std::mutex mutex_;
+  std::condition_variable flushed_;
+  std::string log_path_;
+  bool running_{false};
+
+  FILE* segment_{nullptr};
+  int64_t segment_id_{0};
+  size_t segment_size_{0};
+  std::vector<std::string> closed_segments_;
+  // (database id, logical table id) of the tables logged since the last checkpoint
+  std::set<std::pair<int32_t, int32_t>> logged_tables_;
+
+  std::string pending_;
+  bool flushing_{false};
+  uint64_t appended_lsn_{0};
+  uint64_t durable_lsn_{0};
+  uint64_t failed_lsn_{0};
+
+  // serializes checkpoints
+  std::mutex checkpoint_mutex_;
+  std::mutex stop_mutex_;
+  std::condition_variable stop_requested_;
+  std::thread checkpoint_thread_;
+};
+
+}  // namespace Fragmenter_Namespace
@@ -13,14 +13,60 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cmath>
 #include <cstring>
 #include <numeric>
+#include <tuple>
 
 #include "../Catalog/Catalog.h"
+#include "DataMgr/FixedLengthArrayNoneEncoder.h"
+#include "Geospatial/CompressionRuntime.h"
+#include "Geospatial/HilbertCurve.h"
 #include "SortedOrderFragmenter.h"
 
 namespace Fragmenter_Namespace {
 
+const ColumnDescriptor* get_geo_location_column(const Catalog_Namespace::Catalog& cat,
+                                                const ColumnDescriptor* geo_cd) {
+  CHECK(geo_cd->columnType.is_geometry());
+  const auto location_cd =
+      geo_cd->columnType.get_type() == kPOINT
+          ? cat.getMetadataForColumn(geo_cd->tableId, geo_cd->columnId + 1)
+          : cat.getMetadataForColumn(geo_cd->tableId, geo_cd->columnName + "_bounds");
+  CHECK(location_cd);
+  CHECK(location_cd->columnType.is_fixlen_array());
+  return location_cd;
+}
+
+std::pair<double, double> get_geo_location_centroid(const SQLTypeInfo& location_ti,
+                                                    const int8_t* value,
+                                                    const bool is_null) {
+  const std::pair<double, double> null_centroid{NAN, NAN};
+  if (is_null || !value) {
+    return null_centroid;
+  }
+  if (location_ti.get_subtype() == kTINYINT) {
+    // point coords
+    if (location_ti.is_null_point_coord_array(value, location_ti.get_size())) {
+      return null_centroid;
+    }
+    if (location_ti.get_size() == 2 * sizeof(int32_t)) {
+      const auto compressed = reinterpret_cast<const int32_t*>(value);
+      return {Geospatial::decompress_longitude_coord_geoint32(compressed[0]),
+              Geospatial::decompress_latitude_coord_geoint32(compressed[1])};
+    }
+    const auto coords = reinterpret_cast<const double*>(value);
+    return {coords[0], coords[1]};
+  }
+  // bounds, as xmin, ymin, xmax, ymax
+  CHECK_EQ(location_ti.get_subtype(), kDOUBLE);
+  if (FixedLengthArrayNoneEncoder::is_null(location_ti, const_cast<int8_t*>(value))) {
+    return null_centroid;
+  }
+  const auto bounds = reinterpret_cast<const double*>(value);
+  return {(bounds[0] + bounds[2]) / 2, (bounds[1] + bounds[3]) / 2};
+}
+
 template <typename T>
 void shuffleByIndexesImpl(const std::vector<size_t>& indexes, T* buffer) {
   std::vector<T> new_buffer;
@@ -196,6 +242,25 @@ void sortIndexes(const ColumnDescriptor* cd,
   }
 }
 
+// Sorts by the Hilbert curve key of the geometry centroids, which keeps the rows of a
+// fragment spatially close.
+void sortGeoIndexes(const ColumnDescriptor* location_cd,
+                    std::vector<size_t>& indexes,
+                    const DataBlockPtr& data) {
+  const auto& location_values = *data.arraysPtr;
+  std::vector<double> xs(location_values.size());
+  std::vector<double> ys(location_values.size());
+  for (size_t i = 0; i < location_values.size(); ++i) {
+    const auto& value = location_values[i];
+    std::tie(xs[i], ys[i]) = get_geo_location_centroid(
+        location_cd->columnType, value.pointer, value.is_null);
+  }
+  const auto keys = Geospatial::get_hilbert_keys(xs, ys);
+  std::stable_sort(indexes.begin(), indexes.end(), [&](const auto a, const auto b) {
+    return keys[a] < keys[b];
+  });
+}
+
 void SortedOrderFragmenter::sortData(InsertData& insertDataStruct) {
   // coming here table must have defined a sort_column for mini sort
   const auto table_desc = catalog_->getMetadataForTable(physicalTableId_);
@@ -204,9 +269,11 @@ void SortedOrderFragmenter::sortData(InsertData& insertDataStruct) {
   const auto logical_cd =
       catalog_->getMetadataForColumn(table_desc->tableId, table_desc->sortedColumnId);
   CHECK(logical_cd);
-  const auto physical_cd = catalog_->getMetadataForColumn(
-      table_desc->tableId,
-      table_desc->sortedColumnId + (logical_cd->columnType.is_geometry() ? 1 : 0));
+  const auto physical_cd =
+      logical_cd->columnType.is_geometry()
+          ? get_geo_location_column(*catalog_, logical_cd)
+          : catalog_->getMetadataForColumn(table_desc->tableId,
+                                           table_desc->sortedColumnId);
   const auto it = std::find(insertDataStruct.columnIds.begin(),
                             insertDataStruct.columnIds.end(),
                             physical_cd->columnId);
@@ -217,7 +284,11 @@ void SortedOrderFragmenter::sortData(InsertData& insertDataStruct) {
     std::vector<size_t> indexes(insertDataStruct.numRows);
     std::iota(indexes.begin(), indexes.end(), 0);
     CHECK_LT(static_cast<size_t>(dist), insertDataStruct.data.size());
-    sortIndexes(physical_cd, indexes, insertDataStruct.data[dist]);
+    if (logical_cd->columnType.is_geometry()) {
+      sortGeoIndexes(physical_cd, indexes, insertDataStruct.data[dist]);
+    } else {
+      sortIndexes(physical_cd, indexes, insertDataStruct.data[dist]);
+    }
     // shuffle rows of all columns
     for (size_t i = 0; i < insertDataStruct.columnIds.size(); ++i) {
       if (insertDataStruct.is_default[i]) {
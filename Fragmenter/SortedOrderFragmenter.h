@@ -19,6 +19,19 @@
 
 namespace Fragmenter_Namespace {
 
+// Returns the physical column holding the location of a geo column: the coords of a
+// point, the bounds of any other geometry.
+const ColumnDescriptor* get_geo_location_column(const Catalog_Namespace::Catalog& cat,
+                                                const ColumnDescriptor* geo_cd);
+
+// Returns the centroid of a value of the location column, NaN coordinates if null.
+std::pair<double, double> get_geo_location_centroid(const SQLTypeInfo& location_ti,
+                                                    const int8_t* value,
+                                                    const bool is_null);
+
+// Sorts each inserted batch by the sort column of the table. A geo sort column sorts the
+// rows by the Hilbert curve key of the geometry centroids, so that the bounds of the
+// fragments cut from the batch don't overlap.
 class SortedOrderFragmenter : public InsertOrderFragmenter {
  public:
   SortedOrderFragmenter(
@@ -14,8 +14,12 @@
  * limitations under the License.
  */
 #include <algorithm>
+#include <cstring>
+#include <limits>
 #include <mutex>
+#include <numeric>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include <boost/variant.hpp>
@@ -25,6 +29,8 @@
 #include "DataMgr/ArrayNoneEncoder.h"
 #include "DataMgr/FixedLengthArrayNoneEncoder.h"
 #include "Fragmenter/InsertOrderFragmenter.h"
+#include "Fragmenter/SortedOrderFragmenter.h"
+#include "Geospatial/HilbertCurve.h"
 #include "LockMgr/LockMgr.h"
 #include "QueryEngine/Execute.h"
 #include "Shared/DateConverters.h"
@@ -35,6 +41,7 @@
 extern bool g_enable_experimental_string_functions;
 
 bool g_enable_auto_metadata_update{true};
+bool g_enable_snapshot_reads{true};
 
 namespace Fragmenter_Namespace {
 
@@ -71,6 +78,25 @@ void InsertOrderFragmenter::updateColumn(const Catalog_Namespace::Catalog* catal
                updel_roll);
 }
 
+static std::shared_ptr<Chunk_NS::Chunk> get_chunk(
+    const Catalog_Namespace::Catalog* catalog,
+    const TableDescriptor* td,
+    const ColumnDescriptor* cd,
+    const FragmentInfo& fragment,
+    const Data_Namespace::MemoryLevel memory_level) {
+  auto chunk_meta_it = fragment.getChunkMetadataMapPhysical().find(cd->columnId);
+  CHECK(chunk_meta_it != fragment.getChunkMetadataMapPhysical().end());
+  ChunkKey chunk_key{
+      catalog->getCurrentDB().dbId, td->tableId, cd->columnId, fragment.fragmentId};
+  return Chunk_NS::Chunk::getChunk(cd,
+                                   &catalog->getDataMgr(),
+                                   chunk_key,
+                                   memory_level,
+                                   0,
+                                   chunk_meta_it->second->numBytes,
+                                   chunk_meta_it->second->numElements);
+}
+
 static int get_chunks(const Catalog_Namespace::Catalog* catalog,
                       const TableDescriptor* td,
                       const FragmentInfo& fragment,
@@ -80,18 +106,7 @@ static int get_chunks(const Catalog_Namespace::Catalog* catalog,
     if (const auto cd = catalog->getMetadataForColumn(td->tableId, cid)) {
       ++nc;
       if (!cd->isVirtualCol) {
-        auto chunk_meta_it = fragment.getChunkMetadataMapPhysical().find(cid);
-        CHECK(chunk_meta_it != fragment.getChunkMetadataMapPhysical().end());
-        ChunkKey chunk_key{
-            catalog->getCurrentDB().dbId, td->tableId, cid, fragment.fragmentId};
-        auto chunk = Chunk_NS::Chunk::getChunk(cd,
-                                               &catalog->getDataMgr(),
-                                               chunk_key,
-                                               memory_level,
-                                               0,
-                                               chunk_meta_it->second->numBytes,
-                                               chunk_meta_it->second->numElements);
-        chunks.push_back(chunk);
+        chunks.push_back(get_chunk(catalog, td, cd, fragment, memory_level));
       }
     }
   }
@@ -104,6 +119,9 @@ struct ChunkToInsertDataConverter {
 
   virtual void convertToColumnarFormat(size_t row, size_t indexInFragment) = 0;
 
+  // Reads the following rows from the chunk of the same column in another fragment.
+  virtual void setSourceChunk(const Chunk_NS::Chunk* chunk) = 0;
+
   virtual void addDataBlocksToInsertData(
       Fragmenter_Namespace::InsertData& insertData) = 0;
 };
@@ -127,6 +145,11 @@ struct ScalarChunkConverter : public ChunkToInsertDataConverter {
 
   ~ScalarChunkConverter() override {}
 
+  void setSourceChunk(const Chunk_NS::Chunk* chunk) override {
+    chunk_ = chunk;
+    data_buffer_addr_ = (BUFFER_DATA_TYPE*)chunk->getBuffer()->getMemoryPtr();
+  }
+
   void convertToColumnarFormat(size_t row, size_t indexInFragment) override {
     auto buffer_value = data_buffer_addr_[indexInFragment];
     auto insert_value = static_cast<INSERT_DATA_TYPE>(buffer_value);
@@ -158,6 +181,11 @@ struct FixedLenArrayChunkConverter : public ChunkToInsertDataConverter {
 
   ~FixedLenArrayChunkConverter() override {}
 
+  void setSourceChunk(const Chunk_NS::Chunk* chunk) override {
+    chunk_ = chunk;
+    data_buffer_addr_ = chunk->getBuffer()->getMemoryPtr();
+  }
+
   void convertToColumnarFormat(size_t row, size_t indexInFragment) override {
     auto src_value_ptr = data_buffer_addr_ + (indexInFragment * fixed_array_length_);
 
@@ -188,6 +216,13 @@ struct ArrayChunkConverter : public FixedLenArrayChunkConverter {
 
   ~ArrayChunkConverter() override {}
 
+  void setSourceChunk(const Chunk_NS::Chunk* chunk) override {
+    FixedLenArrayChunkConverter::setSourceChunk(chunk);
+    index_buffer_addr_ =
+        (StringOffsetT*)(chunk->getIndexBuf() ? chunk->getIndexBuf()->getMemoryPtr()
+                                              : nullptr);
+  }
+
   void convertToColumnarFormat(size_t row, size_t indexInFragment) override {
     auto startIndex = index_buffer_addr_[indexInFragment];
     auto endIndex = index_buffer_addr_[indexInFragment + 1];
@@ -217,6 +252,14 @@ struct StringChunkConverter : public ChunkToInsertDataConverter {
 
   ~StringChunkConverter() override {}
 
+  void setSourceChunk(const Chunk_NS::Chunk* chunk) override {
+    chunk_ = chunk;
+    data_buffer_addr_ = chunk->getBuffer()->getMemoryPtr();
+    index_buffer_addr_ =
+        (StringOffsetT*)(chunk->getIndexBuf() ? chunk->getIndexBuf()->getMemoryPtr()
+                                              : nullptr);
+  }
+
   void convertToColumnarFormat(size_t row, size_t indexInFragment) override {
     size_t src_value_size =
         index_buffer_addr_[indexInFragment + 1] - index_buffer_addr_[indexInFragment];
@@ -250,6 +293,11 @@ struct DateChunkConverter : public ChunkToInsertDataConverter {
 
   ~DateChunkConverter() override {}
 
+  void setSourceChunk(const Chunk_NS::Chunk* chunk) override {
+    chunk_ = chunk;
+    data_buffer_addr_ = (BUFFER_DATA_TYPE*)chunk->getBuffer()->getMemoryPtr();
+  }
+
   void convertToColumnarFormat(size_t row, size_t indexInFragment) override {
     auto buffer_value = data_buffer_addr_[indexInFragment];
     auto insert_value = static_cast<int64_t>(buffer_value);
@@ -264,6 +312,99 @@ struct DateChunkConverter : public ChunkToInsertDataConverter {
   }
 };
 
+// Copies the values of a column, which is not updated, to the rows appended by a varlen
+// update or by clustering.
+static std::unique_ptr<ChunkToInsertDataConverter> make_chunk_converter(
+    const size_t num_rows,
+    const Chunk_NS::Chunk* chunk) {
+  const auto chunk_cd = chunk->getColumnDesc();
+  if (chunk_cd->columnType.is_varlen() || chunk_cd->columnType.is_fixlen_array()) {
+    std::unique_ptr<ChunkToInsertDataConverter> converter;
+
+    if (chunk_cd->columnType.is_fixlen_array()) {
+      converter = std::make_unique<FixedLenArrayChunkConverter>(num_rows, chunk);
+    } else if (chunk_cd->columnType.is_string()) {
+      converter = std::make_unique<StringChunkConverter>(num_rows, chunk);
+    } else if (chunk_cd->columnType.is_geometry()) {
+      // the logical geo column is a string column
+      converter = std::make_unique<StringChunkConverter>(num_rows, chunk);
+    } else {
+      converter = std::make_unique<ArrayChunkConverter>(num_rows, chunk);
+    }
+    return converter;
+  } else if (chunk_cd->columnType.is_date_in_days()) {
+    /* Q: Why do we need this?
+       A: In variable length updates path we move the chunk content of column
+       without decoding. Since it again passes through DateDaysEncoder
+       the expected value should be in seconds, but here it will be in days.
+       Therefore, using DateChunkConverter chunk values are being scaled to
+       seconds which then ultimately encoded in days in DateDaysEncoder.
+    */
+    std::unique_ptr<ChunkToInsertDataConverter> converter;
+    const size_t physical_size = chunk_cd->columnType.get_size();
+    if (physical_size == 2) {
+      converter = std::make_unique<DateChunkConverter<int16_t>>(num_rows, chunk);
+    } else if (physical_size == 4) {
+      converter = std::make_unique<DateChunkConverter<int32_t>>(num_rows, chunk);
+    } else {
+      CHECK(false);
+    }
+    return converter;
+  } else {
+    std::unique_ptr<ChunkToInsertDataConverter> converter;
+    SQLTypeInfo logical_type = get_logical_type_info(chunk_cd->columnType);
+    int logical_size = logical_type.get_size();
+    int physical_size = chunk_cd->columnType.get_size();
+
+    if (logical_type.is_string()) {
+      // for dicts -> logical = physical
+      logical_size = physical_size;
+    }
+
+    if (8 == physical_size) {
+      converter = std::make_unique<ScalarChunkConverter<int64_t, int64_t>>(
+          num_rows, chunk);
+    } else if (4 == physical_size) {
+      if (8 == logical_size) {
+        converter = std::make_unique<ScalarChunkConverter<int32_t, int64_t>>(
+            num_rows, chunk);
+      } else {
+        converter = std::make_unique<ScalarChunkConverter<int32_t, int32_t>>(
+            num_rows, chunk);
+      }
+    } else if (2 == chunk_cd->columnType.get_size()) {
+      if (8 == logical_size) {
+        converter = std::make_unique<ScalarChunkConverter<int16_t, int64_t>>(
+            num_rows, chunk);
+      } else if (4 == logical_size) {
+        converter = std::make_unique<ScalarChunkConverter<int16_t, int32_t>>(
+            num_rows, chunk);
+      } else {
+        converter = std::make_unique<ScalarChunkConverter<int16_t, int16_t>>(
+            num_rows, chunk);
+      }
+    } else if (1 == chunk_cd->columnType.get_size()) {
+      if (8 == logical_size) {
+        converter = std::make_unique<ScalarChunkConverter<int8_t, int64_t>>(
+            num_rows, chunk);
+      } else if (4 == logical_size) {
+        converter = std::make_unique<ScalarChunkConverter<int8_t, int32_t>>(
+            num_rows, chunk);
+      } else if (2 == logical_size) {
+        converter = std::make_unique<ScalarChunkConverter<int8_t, int16_t>>(
+            num_rows, chunk);
+      } else {
+        converter = std::make_unique<ScalarChunkConverter<int8_t, int8_t>>(
+            num_rows, chunk);
+      }
+    } else {
+      CHECK(false);  // unknown
+    }
+
+    return converter;
+  }
+}
+
 void InsertOrderFragmenter::updateColumns(
     const Catalog_Namespace::Catalog* catalog,
     const TableDescriptor* td,
@@ -359,96 +500,7 @@ void InsertOrderFragmenter::updateColumns(
         }
       }
     } else {
-      if (chunk_cd->columnType.is_varlen() || chunk_cd->columnType.is_fixlen_array()) {
-        std::unique_ptr<ChunkToInsertDataConverter> converter;
-
-        if (chunk_cd->columnType.is_fixlen_array()) {
-          converter =
-              std::make_unique<FixedLenArrayChunkConverter>(num_rows, chunk.get());
-        } else if (chunk_cd->columnType.is_string()) {
-          converter = std::make_unique<StringChunkConverter>(num_rows, chunk.get());
-        } else if (chunk_cd->columnType.is_geometry()) {
-          // the logical geo column is a string column
-          converter = std::make_unique<StringChunkConverter>(num_rows, chunk.get());
-        } else {
-          converter = std::make_unique<ArrayChunkConverter>(num_rows, chunk.get());
-        }
-
-        chunkConverters.push_back(std::move(converter));
-
-      } else if (chunk_cd->columnType.is_date_in_days()) {
-        /* Q: Why do we need this?
-           A: In variable length updates path we move the chunk content of column
-           without decoding. Since it again passes through DateDaysEncoder
-           the expected value should be in seconds, but here it will be in days.
-           Therefore, using DateChunkConverter chunk values are being scaled to
-           seconds which then ultimately encoded in days in DateDaysEncoder.
-        */
-        std::unique_ptr<ChunkToInsertDataConverter> converter;
-        const size_t physical_size = chunk_cd->columnType.get_size();
-        if (physical_size == 2) {
-          converter =
-              std::make_unique<DateChunkConverter<int16_t>>(num_rows, chunk.get());
-        } else if (physical_size == 4) {
-          converter =
-              std::make_unique<DateChunkConverter<int32_t>>(num_rows, chunk.get());
-        } else {
-          CHECK(false);
-        }
-        chunkConverters.push_back(std::move(converter));
-      } else {
-        std::unique_ptr<ChunkToInsertDataConverter> converter;
-        SQLTypeInfo logical_type = get_logical_type_info(chunk_cd->columnType);
-        int logical_size = logical_type.get_size();
-        int physical_size = chunk_cd->columnType.get_size();
-
-        if (logical_type.is_string()) {
-          // for dicts -> logical = physical
-          logical_size = physical_size;
-        }
-
-        if (8 == physical_size) {
-          converter = std::make_unique<ScalarChunkConverter<int64_t, int64_t>>(
-              num_rows, chunk.get());
-        } else if (4 == physical_size) {
-          if (8 == logical_size) {
-            converter = std::make_unique<ScalarChunkConverter<int32_t, int64_t>>(
-                num_rows, chunk.get());
-          } else {
-            converter = std::make_unique<ScalarChunkConverter<int32_t, int32_t>>(
-                num_rows, chunk.get());
-          }
-        } else if (2 == chunk_cd->columnType.get_size()) {
-          if (8 == logical_size) {
-            converter = std::make_unique<ScalarChunkConverter<int16_t, int64_t>>(
-                num_rows, chunk.get());
-          } else if (4 == logical_size) {
-            converter = std::make_unique<ScalarChunkConverter<int16_t, int32_t>>(
-                num_rows, chunk.get());
-          } else {
-            converter = std::make_unique<ScalarChunkConverter<int16_t, int16_t>>(
-                num_rows, chunk.get());
-          }
-        } else if (1 == chunk_cd->columnType.get_size()) {
-          if (8 == logical_size) {
-            converter = std::make_unique<ScalarChunkConverter<int8_t, int64_t>>(
-                num_rows, chunk.get());
-          } else if (4 == logical_size) {
-            converter = std::make_unique<ScalarChunkConverter<int8_t, int32_t>>(
-                num_rows, chunk.get());
-          } else if (2 == logical_size) {
-            converter = std::make_unique<ScalarChunkConverter<int8_t, int16_t>>(
-                num_rows, chunk.get());
-          } else {
-            converter = std::make_unique<ScalarChunkConverter<int8_t, int8_t>>(
-                num_rows, chunk.get());
-          }
-        } else {
-          CHECK(false);  // unknown
-        }
-
-        chunkConverters.push_back(std::move(converter));
-      }
+      chunkConverters.push_back(make_chunk_converter(num_rows, chunk.get()));
     }
   }
 
@@ -567,6 +619,261 @@ void InsertOrderFragmenter::updateColumns(
   deletedChunk->getBuffer()->setUpdated();
 }
 
+void InsertOrderFragmenter::clusterRows(const Catalog_Namespace::Catalog* catalog,
+                                        const TableDescriptor* td,
+                                        const ColumnDescriptor* location_cd,
+                                        const Data_Namespace::MemoryLevel memory_level,
+                                        UpdelRoll& updel_roll) {
+  updel_roll.catalog = catalog;
+  updel_roll.logicalTableId = catalog->getLogicalTableId(td->tableId);
+  updel_roll.memoryLevel = memory_level;
+  updel_roll.table_descriptor = td;
+
+  const auto deleted_cd = catalog->getDeletedColumn(td);
+  CHECK(deleted_cd);
+  std::vector<FragmentInfo*> fragments;
+  for (const auto& fragment : fragmentInfoVec_) {
+    if (fragment->getPhysicalNumTuples() > 0) {
+      fragments.push_back(fragment.get());
+    }
+  }
+  if (fragments.empty()) {
+    return;
+  }
+
+  // collect the centroids of the visible rows, only fetching the location and deleted
+  // columns
+  std::vector<std::pair<size_t, uint64_t>> rows;
+  std::vector<double> xs;
+  std::vector<double> ys;
+  const auto location_size = location_cd->columnType.get_size();
+  for (size_t i = 0; i < fragments.size(); ++i) {
+    const auto deleted_chunk =
+        get_chunk(catalog, td, deleted_cd, *fragments[i], memory_level);
+    const auto location_chunk =
+        get_chunk(catalog, td, location_cd, *fragments[i], memory_level);
+    const auto deleted =
+        reinterpret_cast<const bool*>(deleted_chunk->getBuffer()->getMemoryPtr());
+    const auto locations = location_chunk->getBuffer()->getMemoryPtr();
+    for (size_t offset = 0; offset < fragments[i]->getPhysicalNumTuples(); ++offset) {
+      if (deleted[offset]) {
+        continue;
+      }
+      const auto [x, y] = get_geo_location_centroid(
+          location_cd->columnType, locations + offset * location_size, false);
+      xs.push_back(x);
+      ys.push_back(y);
+      rows.emplace_back(i, offset);
+    }
+  }
+  const auto keys = Geospatial::get_hilbert_keys(xs, ys);
+  std::vector<size_t> order(rows.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&keys](const auto a, const auto b) {
+    return keys[a] < keys[b];
+  });
+  rewriteRows(catalog, td, fragments, rows, order, memory_level, updel_roll);
+}
+
+namespace {
+
+// Maps the physical value at `offset` of a fixed length scalar column to a key which
+// orders like the value. Fixed encoded integers, days encoded dates and dictionary ids
+// order like their logical values, nulls are ordered by their sentinels.
+uint64_t get_sort_key(const SQLTypeInfo& ti, const int8_t* buf, const size_t offset) {
+  constexpr uint64_t sign_bit{uint64_t(1) << 63};
+  if (ti.is_fp()) {
+    const double val = ti.get_type() == kFLOAT
+                           ? reinterpret_cast<const float*>(buf)[offset]
+                           : reinterpret_cast<const double*>(buf)[offset];
+    uint64_t bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    return bits & sign_bit ? ~bits : bits | sign_bit;
+  }
+  const bool is_dict_id = ti.is_string();
+  int64_t val{0};
+  switch (ti.get_size()) {
+    case 1:
+      val = is_dict_id ? reinterpret_cast<const uint8_t*>(buf)[offset] : buf[offset];
+      break;
+    case 2:
+      val = is_dict_id ? reinterpret_cast<const uint16_t*>(buf)[offset]
+                       : reinterpret_cast<const int16_t*>(buf)[offset];
+      break;
+    case 4:
+      val = reinterpret_cast<const int32_t*>(buf)[offset];
+      break;
+    case 8:
+      val = reinterpret_cast<const int64_t*>(buf)[offset];
+      break;
+    default:
+      CHECK(false);
+  }
+  return static_cast<uint64_t>(val) ^ sign_bit;
+}
+
+}  // namespace
+
+void InsertOrderFragmenter::mergeFragments(const Catalog_Namespace::Catalog* catalog,
+                                           const TableDescriptor* td,
+                                           const std::set<int>& fragment_ids,
+                                           const ColumnDescriptor* sort_cd,
+                                           const Data_Namespace::MemoryLevel memory_level,
+                                           UpdelRoll& updel_roll) {
+  updel_roll.catalog = catalog;
+  updel_roll.logicalTableId = catalog->getLogicalTableId(td->tableId);
+  updel_roll.memoryLevel = memory_level;
+  updel_roll.table_descriptor = td;
+
+  const auto deleted_cd = catalog->getDeletedColumn(td);
+  CHECK(deleted_cd);
+  CHECK(!sort_cd || !sort_cd->columnType.is_varlen());
+  std::vector<FragmentInfo*> fragments;
+  for (const auto& fragment : fragmentInfoVec_) {
+    if (fragment->getPhysicalNumTuples() > 0 &&
+        fragment_ids.count(fragment->fragmentId)) {
+      fragments.push_back(fragment.get());
+    }
+  }
+  if (fragments.empty()) {
+    return;
+  }
+
+  // collect the visible rows, only fetching the sort and deleted columns
+  std::vector<std::pair<size_t, uint64_t>> rows;
+  std::vector<uint64_t> keys;
+  for (size_t i = 0; i < fragments.size(); ++i) {
+    const auto deleted_chunk =
+        get_chunk(catalog, td, deleted_cd, *fragments[i], memory_level);
+    const auto sort_chunk =
+        sort_cd ? get_chunk(catalog, td, sort_cd, *fragments[i], memory_level) : nullptr;
+    const auto deleted =
+        reinterpret_cast<const bool*>(deleted_chunk->getBuffer()->getMemoryPtr());
+    const int8_t* sort_values =
+        sort_chunk ? sort_chunk->getBuffer()->getMemoryPtr() : nullptr;
+    for (size_t offset = 0; offset < fragments[i]->getPhysicalNumTuples(); ++offset) {
+      if (deleted[offset]) {
+        continue;
+      }
+      if (sort_cd) {
+        keys.push_back(get_sort_key(sort_cd->columnType, sort_values, offset));
+      }
+      rows.emplace_back(i, offset);
+    }
+  }
+  std::vector<size_t> order(rows.size());
+  std::iota(order.begin(), order.end(), 0);
+  if (sort_cd) {
+    std::stable_sort(order.begin(), order.end(), [&keys](const auto a, const auto b) {
+      return keys[a] < keys[b];
+    });
+  }
+  rewriteRows(catalog, td, fragments, rows, order, memory_level, updel_roll);
+}
+
+void InsertOrderFragmenter::rewriteRows(
+    const Catalog_Namespace::Catalog* catalog,
+    const TableDescriptor* td,
+    const std::vector<FragmentInfo*>& fragments,
+    const std::vector<std::pair<size_t, uint64_t>>& rows,
+    const std::vector<size_t>& order,
+    const Data_Namespace::MemoryLevel memory_level,
+    UpdelRoll& updel_roll) {
+  std::vector<const ColumnDescriptor*> columns;
+  for (int cid = 1, nc = 0; nc < td->nColumns; ++cid) {
+    if (const auto cd = catalog->getMetadataForColumn(td->tableId, cid)) {
+      ++nc;
+      if (!cd->isVirtualCol && !cd->isDeletedCol) {
+        columns.push_back(cd);
+      }
+    }
+  }
+  const auto last_fragment_rows = fragmentInfoVec_.back()->getPhysicalNumTuples();
+  size_t batch_size = last_fragment_rows < maxFragmentRows_
+                          ? maxFragmentRows_ - last_fragment_rows
+                          : maxFragmentRows_;
+  for (size_t batch_start = 0; batch_start < order.size();) {
+    const auto num_rows = std::min(batch_size, order.size() - batch_start);
+    std::vector<bool> is_source_fragment(fragments.size(), false);
+    for (size_t row = 0; row < num_rows; ++row) {
+      is_source_fragment[rows[order[batch_start + row]].first] = true;
+    }
+    // Only the chunks of the fragments holding the rows of the batch are fetched, one
+    // column at a time. Array values are inserted straight from the source chunks,
+    // which stay pinned until the batch is inserted, other values are copied.
+    std::vector<std::unique_ptr<ChunkToInsertDataConverter>> converters;
+    std::vector<std::shared_ptr<Chunk_NS::Chunk>> array_chunks;
+    for (const auto cd : columns) {
+      std::vector<std::shared_ptr<Chunk_NS::Chunk>> source_chunks(fragments.size());
+      for (size_t i = 0; i < fragments.size(); ++i) {
+        if (is_source_fragment[i]) {
+          source_chunks[i] = get_chunk(catalog, td, cd, *fragments[i], memory_level);
+        }
+      }
+      std::unique_ptr<ChunkToInsertDataConverter> converter;
+      auto source_fragment = fragments.size();
+      for (size_t row = 0; row < num_rows; ++row) {
+        const auto& [fragment_idx, offset] = rows[order[batch_start + row]];
+        if (fragment_idx != source_fragment) {
+          const auto source_chunk = source_chunks[fragment_idx].get();
+          if (converter) {
+            converter->setSourceChunk(source_chunk);
+          } else {
+            converter = make_chunk_converter(num_rows, source_chunk);
+          }
+          source_fragment = fragment_idx;
+        }
+        converter->convertToColumnarFormat(row, offset);
+      }
+      CHECK(converter);
+      converters.push_back(std::move(converter));
+      if (cd->columnType.is_array()) {
+        for (auto& chunk : source_chunks) {
+          if (chunk) {
+            array_chunks.push_back(std::move(chunk));
+          }
+        }
+      }
+    }
+
+    Fragmenter_Namespace::InsertData insert_data;
+    insert_data.databaseId = catalog->getCurrentDB().dbId;
+    insert_data.tableId = td->tableId;
+    for (auto& converter : converters) {
+      converter->addDataBlocksToInsertData(insert_data);
+    }
+    insert_data.numRows = num_rows;
+    insert_data.is_default.resize(insert_data.columnIds.size(), false);
+    // skip the batch sort of a sorted fragmenter, which would undo the new order
+    InsertOrderFragmenter::insertDataNoCheckpoint(insert_data);
+
+    batch_start += num_rows;
+    batch_size = maxFragmentRows_;
+  }
+
+  // delete the original rows
+  const auto deleted_cd = catalog->getDeletedColumn(td);
+  CHECK(deleted_cd);
+  std::vector<std::vector<uint64_t>> frag_offsets(fragments.size());
+  for (const auto& [fragment_idx, offset] : rows) {
+    frag_offsets[fragment_idx].push_back(offset);
+  }
+  for (size_t i = 0; i < fragments.size(); ++i) {
+    if (frag_offsets[i].empty()) {
+      continue;
+    }
+    updateColumn(catalog,
+                 td,
+                 deleted_cd,
+                 fragments[i]->fragmentId,
+                 frag_offsets[i],
+                 ScalarTargetValue(int64_t{1}),
+                 SQLTypeInfo(kBOOLEAN, false),
+                 memory_level,
+                 updel_roll);
+  }
+}
+
 namespace {
 inline void update_metadata(SQLTypeInfo const& ti,
                             ChunkUpdateStats& update_stats,
@@ -672,13 +979,13 @@ std::optional<ChunkUpdateStats> InsertOrderFragmenter::updateColumn(
   std::vector<std::future<void>> threads;
 
   const auto segsz = (nrow + ncore - 1) / ncore;
-  auto dbuf = chunk->getBuffer();
-  auto dbuf_addr = dbuf->getMemoryPtr();
-  dbuf->setUpdated();
   updel_roll.addDirtyChunk(chunk, fragment.fragmentId);
+  // Only the pages holding the updated rows are written back on checkpoint.
+  auto dbuf_addr = updel_roll.stageChunkUpdate(
+      chunk, fragment.fragmentId, frag_offsets, get_element_size(cd->columnType));
   for (size_t rbegin = 0, c = 0; rbegin < nrow; ++c, rbegin += segsz) {
     threads.emplace_back(std::async(
-        std::launch::async, [=, &update_stats_per_thread, &frag_offsets, &rhs_values] {
+        std::launch::async, [=, &update_stats_per_thread, &rhs_values] {
           SQLTypeInfo lhs_type = cd->columnType;
 
           // !! not sure if this is a undocumented convention or a bug, but for a sharded
@@ -708,8 +1015,7 @@ std::optional<ChunkUpdateStats> InsertOrderFragmenter::updateColumn(
           }
 
           for (size_t r = rbegin; r < std::min(rbegin + segsz, nrow); r++) {
-            const auto roffs = frag_offsets[r];
-            auto data_ptr = dbuf_addr + roffs * get_element_size(lhs_type);
+            auto data_ptr = dbuf_addr + r * get_element_size(lhs_type);
             auto sv = &rhs_values[1 == n_rhs_values ? 0 : r];
             ScalarTargetValue sv2;
 
@@ -890,6 +1196,10 @@ std::optional<ChunkUpdateStats> InsertOrderFragmenter::updateColumn(
     }
   }
   wait_cleanup_threads(threads);
+  // the unconditional vacuum below reads the deleted rows from the chunk
+  const bool vacuum =
+      Fragmenter_Namespace::FragmentInfo::unconditionalVacuum_ && cd->isDeletedCol;
+  updel_roll.finishChunkUpdate(dbuf_addr, !g_enable_snapshot_reads || vacuum);
 
   // for unit test
   if (Fragmenter_Namespace::FragmentInfo::unconditionalVacuum_) {
@@ -918,6 +1228,193 @@ std::optional<ChunkUpdateStats> InsertOrderFragmenter::updateColumn(
   return update_stats;
 }
 
+namespace {
+template <typename T>
+T get_null_value() {
+  if constexpr (std::is_floating_point_v<T>) {
+    return inline_fp_null_value<T>();
+  } else {
+    return inline_int_null_value<T>();
+  }
+}
+
+// Stats of the values in [begin, end), in the type the chunk metadata is kept in.
+template <typename T, typename S>
+void get_values_stats(const T* values,
+                      const size_t begin,
+                      const size_t end,
+                      S& min_val,
+                      S& max_val,
+                      bool& has_null) {
+  const T null_val = get_null_value<T>();
+  T min{std::numeric_limits<T>::max()};
+  T max{std::numeric_limits<T>::lowest()};
+  size_t null_count{0};
+  // branch free so the loop is vectorized, nulls are excluded by replacing them with
+  // values which cannot change the min or max
+  for (size_t i = begin; i < end; ++i) {
+    const T v = values[i];
+    const bool is_null = v == null_val;
+    null_count += is_null;
+    min = std::min(min, is_null ? std::numeric_limits<T>::max() : v);
+    max = std::max(max, is_null ? std::numeric_limits<T>::lowest() : v);
+  }
+  has_null = has_null || null_count > 0;
+  if (null_count < end - begin) {
+    min_val = std::min(min_val, static_cast<S>(min));
+    max_val = std::max(max_val, static_cast<S>(max));
+  }
+}
+
+// Updates the staged values of the rows [begin, end) of the update, which are in the
+// same order as the new values.
+template <typename T>
+void update_values_from_buffer(int8_t* staged_values,
+                               const int8_t* rhs_buffer,
+                               const size_t begin,
+                               const size_t end,
+                               const ColumnDescriptor* cd,
+                               ChunkUpdateStats& update_stats) {
+  auto data = reinterpret_cast<T*>(staged_values);
+  const auto rhs_values = reinterpret_cast<const T*>(rhs_buffer);
+  // the stats of the old values are gathered before they are overwritten
+  if constexpr (std::is_floating_point_v<T>) {
+    get_values_stats(data,
+                     begin,
+                     end,
+                     update_stats.old_values_stats.min_double,
+                     update_stats.old_values_stats.max_double,
+                     update_stats.old_values_stats.has_null);
+  } else {
+    get_values_stats(data,
+                     begin,
+                     end,
+                     update_stats.old_values_stats.min_int64t,
+                     update_stats.old_values_stats.max_int64t,
+                     update_stats.old_values_stats.has_null);
+  }
+  std::memcpy(data + begin, rhs_values + begin, (end - begin) * sizeof(T));
+  if constexpr (std::is_floating_point_v<T>) {
+    get_values_stats(rhs_values,
+                     begin,
+                     end,
+                     update_stats.new_values_stats.min_double,
+                     update_stats.new_values_stats.max_double,
+                     update_stats.new_values_stats.has_null);
+  } else {
+    get_values_stats(rhs_values,
+                     begin,
+                     end,
+                     update_stats.new_values_stats.min_int64t,
+                     update_stats.new_values_stats.max_int64t,
+                     update_stats.new_values_stats.has_null);
+  }
+  if (cd->columnType.get_notnull() && update_stats.new_values_stats.has_null) {
+    throw std::runtime_error("NULL value on NOT NULL column '" + cd->columnName + "'");
+  }
+}
+}  // namespace
+
+std::optional<ChunkUpdateStats> InsertOrderFragmenter::updateColumnFromBuffer(
+    const Catalog_Namespace::Catalog* catalog,
+    const TableDescriptor* td,
+    const ColumnDescriptor* cd,
+    const int fragment_id,
+    const std::vector<uint64_t>& frag_offsets,
+    const int8_t* rhs_buffer,
+    const Data_Namespace::MemoryLevel memory_level,
+    UpdelRoll& updel_roll) {
+  const auto& lhs_type = cd->columnType;
+  CHECK(!lhs_type.is_varlen() && !lhs_type.is_string());
+  CHECK_EQ(lhs_type.get_compression(), kENCODING_NONE);
+  updel_roll.catalog = catalog;
+  updel_roll.logicalTableId = catalog->getLogicalTableId(td->tableId);
+  updel_roll.memoryLevel = memory_level;
+
+  const size_t ncore = cpu_threads();
+  const auto nrow = frag_offsets.size();
+  if (0 == nrow) {
+    return {};
+  }
+
+  auto fragment_ptr = getFragmentInfo(fragment_id);
+  auto& fragment = *fragment_ptr;
+  auto chunk_meta_it = fragment.getChunkMetadataMapPhysical().find(cd->columnId);
+  CHECK(chunk_meta_it != fragment.getChunkMetadataMapPhysical().end());
+  ChunkKey chunk_key{
+      catalog->getCurrentDB().dbId, td->tableId, cd->columnId, fragment.fragmentId};
+  auto chunk = Chunk_NS::Chunk::getChunk(cd,
+                                         &catalog->getDataMgr(),
+                                         chunk_key,
+                                         Data_Namespace::CPU_LEVEL,
+                                         0,
+                                         chunk_meta_it->second->numBytes,
+                                         chunk_meta_it->second->numElements);
+
+  updel_roll.addDirtyChunk(chunk, fragment.fragmentId);
+  auto dbuf_addr = updel_roll.stageChunkUpdate(
+      chunk, fragment.fragmentId, frag_offsets, get_element_size(lhs_type));
+
+  std::vector<ChunkUpdateStats> update_stats_per_thread(ncore);
+  std::vector<std::future<void>> threads;
+  const auto segsz = (nrow + ncore - 1) / ncore;
+  for (size_t rbegin = 0, c = 0; rbegin < nrow; ++c, rbegin += segsz) {
+    threads.emplace_back(std::async(
+        std::launch::async, [=, &update_stats_per_thread] {
+          const auto rend = std::min(rbegin + segsz, nrow);
+          auto& update_stats = update_stats_per_thread[c];
+          if (lhs_type.is_fp()) {
+            if (lhs_type.get_type() == kFLOAT) {
+              update_values_from_buffer<float>(
+                  dbuf_addr, rhs_buffer, rbegin, rend, cd, update_stats);
+            } else {
+              update_values_from_buffer<double>(
+                  dbuf_addr, rhs_buffer, rbegin, rend, cd, update_stats);
+            }
+            return;
+          }
+          switch (element_size) {
+            case 1:
+              update_values_from_buffer<int8_t>(
+                  dbuf_addr, rhs_buffer, rbegin, rend, cd, update_stats);
+              break;
+            case 2:
+              update_values_from_buffer<int16_t>(
+                  dbuf_addr, rhs_buffer, rbegin, rend, cd, update_stats);
+              break;
+            case 4:
+              update_values_from_buffer<int32_t>(
+                  dbuf_addr, rhs_buffer, rbegin, rend, cd, update_stats);
+              break;
+            case 8:
+              update_values_from_buffer<int64_t>(
+                  dbuf_addr, rhs_buffer, rbegin, rend, cd, update_stats);
+              break;
+            default:
+              UNREACHABLE() << "Unexpected element size " << element_size;
+          }
+        }));
+  }
+  wait_cleanup_threads(threads);
+  updel_roll.finishChunkUpdate(dbuf_addr, !g_enable_snapshot_reads);
+
+  ChunkUpdateStats update_stats;
+  for (size_t c = 0; c < ncore; ++c) {
+    update_metadata(update_stats.new_values_stats,
+                    update_stats_per_thread[c].new_values_stats);
+    update_metadata(update_stats.old_values_stats,
+                    update_stats_per_thread[c].old_values_stats);
+  }
+
+  CHECK_GT(fragment.shadowNumTuples, size_t(0));
+  updateColumnMetadata(
+      cd, fragment, chunk, update_stats.new_values_stats, lhs_type, updel_roll);
+  update_stats.updated_rows_count = nrow;
+  update_stats.fragment_rows_count = fragment.shadowNumTuples;
+  update_stats.chunk = chunk;
+  return update_stats;
+}
+
 void InsertOrderFragmenter::updateColumnMetadata(
     const ColumnDescriptor* cd,
     FragmentInfo& fragment,
@@ -1402,7 +1899,10 @@ bool UpdelRoll::commitUpdate() {
   const auto td = catalog->getMetadataForTable(logicalTableId);
   CHECK(td);
   ChunkKey chunk_key{catalog->getDatabaseId(), td->tableId};
+  // Queries reading the table keep running while the updated chunk data is staged, the
+  // write lock is only held to publish and checkpoint it.
   const auto table_lock = lockmgr::TableDataLockMgr::getWriteLockForTable(chunk_key);
+  publishStagedChunkData();
 
   // Checkpoint all shards. Otherwise, epochs can go out of sync.
   if (td->persistenceLevel == Data_Namespace::MemoryLevel::DISK_LEVEL) {
@@ -1421,13 +1921,18 @@ bool UpdelRoll::commitUpdate() {
   return true;
 }
 
-void UpdelRoll::stageUpdate() {
+void UpdelRoll::stageUpdate(const lockmgr::WriteLock& table_data_lock) {
   CHECK(catalog);
   auto db_id = catalog->getDatabaseId();
   CHECK(table_descriptor);
   auto table_id = table_descriptor->tableId;
   CHECK_EQ(memoryLevel, Data_Namespace::MemoryLevel::CPU_LEVEL);
   CHECK_EQ(table_descriptor->persistenceLevel, Data_Namespace::MemoryLevel::DISK_LEVEL);
+  // Staging is part of a vacuum or compaction of the table, which holds the lock for its
+  // whole duration, so the lock cannot be taken here as commitUpdate() does.
+  CHECK_EQ(table_data_lock.getMutex(),
+           lockmgr::TableDataLockMgr::instance().getTableMutex({db_id, logicalTableId}));
+  publishStagedChunkData();
   try {
     catalog->getDataMgr().checkpoint(db_id, table_id, memoryLevel);
   } catch (...) {
@@ -1461,6 +1966,7 @@ void UpdelRoll::cancelUpdate() {
   // TODO: needed?
   ChunkKey chunk_key{catalog->getDatabaseId(), logicalTableId};
   const auto table_lock = lockmgr::TableDataLockMgr::getWriteLockForTable(chunk_key);
+  staged_chunk_updates.clear();
   if (is_varlen_update) {
     int databaseId = catalog->getDatabaseId();
     auto table_epochs = catalog->getTableEpochs(databaseId, logicalTableId);
@@ -1490,6 +1996,107 @@ void UpdelRoll::addDirtyChunk(std::shared_ptr<Chunk_NS::Chunk> chunk,
   dirty_chunks[chunk_key] = chunk;
 }
 
+int8_t* UpdelRoll::stageChunkUpdate(std::shared_ptr<Chunk_NS::Chunk> chunk,
+                                    int32_t fragment_id,
+                                    const std::vector<uint64_t>& frag_offsets,
+                                    size_t element_size) {
+  auto buffer = chunk->getBuffer();
+  CHECK(buffer);
+  CHECK(catalog);
+  ChunkKey chunk_key{catalog->getDatabaseId(),
+                     chunk->getColumnDesc()->tableId,
+                     chunk->getColumnDesc()->columnId,
+                     fragment_id};
+  StagedChunkUpdate update{frag_offsets, element_size, {}};
+  // only the updated elements are staged, gathered from the chunk for their old values
+  update.values.resize(frag_offsets.size() * element_size);
+  const auto data = buffer->getMemoryPtr();
+  for (size_t i = 0; i < frag_offsets.size(); ++i) {
+    CHECK_LE((frag_offsets[i] + 1) * element_size, buffer->size());
+    std::memcpy(update.values.data() + i * element_size,
+                data + frag_offsets[i] * element_size,
+                element_size);
+  }
+  mapd_unique_lock<mapd_shared_mutex> lock(chunk_update_tracker_mutex);
+  auto& updates = staged_chunk_updates[chunk_key];
+  updates.push_back(std::move(update));
+  return updates.back().values.data();
+}
+
+void UpdelRoll::finishChunkUpdate(const int8_t* values, const bool publish_now) {
+  if (!publish_now) {
+    return;
+  }
+  mapd_unique_lock<mapd_shared_mutex> lock(chunk_update_tracker_mutex);
+  for (auto& [chunk_key, updates] : staged_chunk_updates) {
+    for (auto it = updates.begin(); it != updates.end(); ++it) {
+      if (it->values.data() == values) {
+        publishStagedChunkUpdate(chunk_key, *it);
+        updates.erase(it);
+        return;
+      }
+    }
+  }
+  CHECK(false);
+}
+
+void UpdelRoll::publishStagedChunkUpdate(const ChunkKey& chunk_key,
+                                         const StagedChunkUpdate& update) {
+  const auto chunk_it = dirty_chunks.find(chunk_key);
+  CHECK(chunk_it != dirty_chunks.end());
+  auto buffer = chunk_it->second->getBuffer();
+  CHECK(buffer);
+  const auto element_size = update.element_size;
+  auto data = buffer->getMemoryPtr();
+  for (size_t i = 0; i < update.frag_offsets.size(); ++i) {
+    std::memcpy(data + update.frag_offsets[i] * element_size,
+                update.values.data() + i * element_size,
+                element_size);
+  }
+  // The live buffer is only marked updated once the values are published, so that a
+  // checkpoint before then does not clear the marks. Consecutive rows are marked as one
+  // range.
+  std::vector<uint64_t> frag_offsets(update.frag_offsets);
+  std::sort(frag_offsets.begin(), frag_offsets.end());
+  for (size_t i = 0; i < frag_offsets.size();) {
+    size_t j = i + 1;
+    while (j < frag_offsets.size() && frag_offsets[j] <= frag_offsets[j - 1] + 1) {
+      ++j;
+    }
+    buffer->setUpdated(frag_offsets[i] * element_size,
+                       (frag_offsets[j - 1] - frag_offsets[i] + 1) * element_size);
+    i = j;
+  }
+}
+
+void UpdelRoll::publishStagedChunkData() {
+  mapd_unique_lock<mapd_shared_mutex> lock(chunk_update_tracker_mutex);
+  // Only the updated elements are copied, other changes made to the chunks since they
+  // were staged, such as rows deleted by a vacuum, are kept.
+  for (const auto& [chunk_key, updates] : staged_chunk_updates) {
+    const auto chunk_it = dirty_chunks.find(chunk_key);
+    CHECK(chunk_it != dirty_chunks.end());
+    auto buffer = chunk_it->second->getBuffer();
+    CHECK(buffer);
+    for (const auto& update : updates) {
+      for (const auto frag_offset : update.frag_offsets) {
+        if ((frag_offset + 1) * update.element_size > buffer->size()) {
+          staged_chunk_updates.clear();
+          throw std::runtime_error(
+              "Chunk " + show_chunk(chunk_key) +
+              " was truncated while it was being updated. Please retry the update.");
+        }
+      }
+    }
+  }
+  for (const auto& [chunk_key, updates] : staged_chunk_updates) {
+    for (const auto& update : updates) {
+      publishStagedChunkUpdate(chunk_key, update);
+    }
+  }
+  staged_chunk_updates.clear();
+}
+
 void UpdelRoll::initializeUnsetMetadata(
     const TableDescriptor* td,
     Fragmenter_Namespace::FragmentInfo& fragment_info) {
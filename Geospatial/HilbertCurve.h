@@ -0,0 +1,89 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    HilbertCurve.h
+ * @brief   Hilbert curve keys of geometry centroids, used to cluster geo tables so that
+ * the rows of a fragment are spatially close.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Geospatial {
+
+// Position of the cell (x, y) along the Hilbert curve filling a 2^32 x 2^32 grid.
+inline uint64_t hilbert_curve_index(uint32_t x, uint32_t y) {
+  uint64_t d{0};
+  for (uint64_t s = uint64_t(1) << 31; s > 0; s >>= 1) {
+    const uint32_t rx = (x & s) ? 1 : 0;
+    const uint32_t ry = (y & s) ? 1 : 0;
+    d += s * s * ((3 * rx) ^ ry);
+    // rotate the quadrant so the curve of the next level starts where this one ends
+    if (ry == 0) {
+      if (rx == 1) {
+        x = ~x;
+        y = ~y;
+      }
+      std::swap(x, y);
+    }
+  }
+  return d;
+}
+
+// Hilbert keys of the given centroids over their bounding box. Null centroids, passed
+// as NaN coordinates, get the largest key so they are clustered together at the end.
+inline std::vector<uint64_t> get_hilbert_keys(const std::vector<double>& xs,
+                                              const std::vector<double>& ys) {
+  double min_x{std::numeric_limits<double>::max()};
+  double min_y{std::numeric_limits<double>::max()};
+  double max_x{std::numeric_limits<double>::lowest()};
+  double max_y{std::numeric_limits<double>::lowest()};
+  for (size_t i = 0; i < xs.size(); ++i) {
+    if (std::isnan(xs[i]) || std::isnan(ys[i])) {
+      continue;
+    }
+    min_x = std::min(min_x, xs[i]);
+    max_x = std::max(max_x, xs[i]);
+    min_y = std::min(min_y, ys[i]);
+    max_y = std::max(max_y, ys[i]);
+  }
+  constexpr double max_cell = std::numeric_limits<uint32_t>::max();
+  const auto to_cell = [max_cell](const double v, const double min, const double max) {
+    if (!(max > min)) {
+      return uint32_t(0);
+    }
+    return static_cast<uint32_t>(std::min(max_cell, (v - min) / (max - min) * max_cell));
+  };
+  std::vector<uint64_t> keys(xs.size());
+  for (size_t i = 0; i < xs.size(); ++i) {
+    if (std::isnan(xs[i]) || std::isnan(ys[i])) {
+      keys[i] = std::numeric_limits<uint64_t>::max();
+      continue;
+    }
+    keys[i] = hilbert_curve_index(to_cell(xs[i], min_x, max_x),
+                                  to_cell(ys[i], min_y, max_y));
+  }
+  return keys;
+}
+
+}  // namespace Geospatial
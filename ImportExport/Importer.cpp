@@ -53,6 +53,7 @@
 #include "Archive/PosixFileArchive.h"
 #include "Archive/S3Archive.h"
 #include "ArrowImporter.h"
+#include "Fragmenter/InsertWriteAheadLog.h"
 #include "Geospatial/Compression.h"
 #include "Geospatial/GDAL.h"
 #include "Geospatial/Transforms.h"
@@ -64,6 +65,7 @@
 #include "QueryEngine/TypePunning.h"
 #include "RenderGroupAnalyzer.h"
 #include "Shared/DateTimeParser.h"
+#include "Shared/Metrics.h"
 #include "Shared/SqlTypesLayout.h"
 #include "Shared/file_path_util.h"
 #include "Shared/import_helpers.h"
@@ -546,6 +548,70 @@ void TypedImportBuffer::addDictEncodedString(const std::vector<std::string>& str
   }
 }
 
+namespace {
+template <typename T>
+void move_values(std::vector<T>* from, std::vector<T>* to) {
+  to->insert(to->end(),
+             std::make_move_iterator(from->begin()),
+             std::make_move_iterator(from->end()));
+  from->clear();
+}
+}  // namespace
+
+void TypedImportBuffer::append(TypedImportBuffer& other) {
+  CHECK_EQ(column_desc_->columnType.get_type(),
+           other.column_desc_->columnType.get_type());
+  switch (column_desc_->columnType.get_type()) {
+    case kBOOLEAN:
+      move_values(other.bool_buffer_, bool_buffer_);
+      break;
+    case kTINYINT:
+      move_values(other.tinyint_buffer_, tinyint_buffer_);
+      break;
+    case kSMALLINT:
+      move_values(other.smallint_buffer_, smallint_buffer_);
+      break;
+    case kINT:
+      move_values(other.int_buffer_, int_buffer_);
+      break;
+    case kBIGINT:
+    case kNUMERIC:
+    case kDECIMAL:
+    case kDATE:
+    case kTIME:
+    case kTIMESTAMP:
+      move_values(other.bigint_buffer_, bigint_buffer_);
+      break;
+    case kFLOAT:
+      move_values(other.float_buffer_, float_buffer_);
+      break;
+    case kDOUBLE:
+      move_values(other.double_buffer_, double_buffer_);
+      break;
+    case kTEXT:
+    case kVARCHAR:
+    case kCHAR:
+      // dictionary ids are only assigned when the buffer is loaded
+      move_values(other.string_buffer_, string_buffer_);
+      break;
+    case kARRAY:
+      if (IS_STRING(column_desc_->columnType.get_subtype())) {
+        move_values(other.string_array_buffer_, string_array_buffer_);
+      } else {
+        move_values(other.array_buffer_, array_buffer_);
+      }
+      break;
+    case kPOINT:
+    case kLINESTRING:
+    case kPOLYGON:
+    case kMULTIPOLYGON:
+      move_values(other.geo_string_buffer_, geo_string_buffer_);
+      break;
+    default:
+      CHECK(false);
+  }
+}
+
 void TypedImportBuffer::add_value(const ColumnDescriptor* cd,
                                   const std::string_view val,
                                   const bool is_null,
@@ -2996,6 +3062,13 @@ bool Loader::loadImpl(
     size_t row_count,
     bool checkpoint,
     const Catalog_Namespace::SessionInfo* session_info) {
+  static auto& rows_loaded = metrics::Registry::instance().counter(
+      "omnisci_import_rows_total", "Rows handed to the table loader by imports.");
+  static auto& load_latency = metrics::Registry::instance().histogram(
+      "omnisci_import_load_latency_microseconds",
+      "Time to load one batch of imported rows into a table.");
+  rows_loaded.add(row_count);
+  metrics::ScopedLatency load_latency_scope(load_latency);
   if (load_callback_) {
     auto data_blocks = TypedImportBuffer::get_data_block_pointers(import_buffers);
     return load_callback_(import_buffers, data_blocks, row_count);
@@ -3122,7 +3195,13 @@ bool Loader::loadToShard(
   success = true;
   {
     try {
-      if (checkpoint) {
+      auto& insert_wal = Fragmenter_Namespace::InsertWriteAheadLog::instance();
+      if (checkpoint && g_enable_insert_wal && !g_cluster && !isAddingColumns() &&
+          shard_table->persistenceLevel == Data_Namespace::MemoryLevel::DISK_LEVEL &&
+          insert_wal.isRunning()) {
+        shard_table->fragmenter->insertDataNoCheckpoint(ins_data);
+        insert_wal.commit(ins_data, catalog_, shard_table->tableId);
+      } else if (checkpoint) {
         shard_table->fragmenter->insertData(ins_data);
       } else {
         shard_table->fragmenter->insertDataNoCheckpoint(ins_data);
@@ -478,6 +478,9 @@ class TypedImportBuffer : boost::noncopyable {
     }
   }
 
+  // Moves the values of a buffer of the same column to the end of this buffer.
+  void append(TypedImportBuffer& other);
+
   size_t add_values(const ColumnDescriptor* cd, const TColumn& data);
 
   size_t add_arrow_values(const ColumnDescriptor* cd,
@@ -75,6 +75,8 @@ class TrackedRefLock {
   TrackedRefLock(const TrackedRefLock&) = delete;
   TrackedRefLock& operator=(const TrackedRefLock&) = delete;
 
+  const MutexTracker* getMutex() const { return mutex_; }
+
  private:
   MutexTracker* mutex_;
   LOCK lock_;
@@ -45,6 +45,7 @@ bool g_enable_debug_timer{false};
 #include <iostream>
 #include <mutex>
 #include <regex>
+#include <shared_mutex>
 
 #include "Shared/nvtx_helpers.h"
 
@@ -757,7 +758,7 @@ void logAndEraseDurationTree(std::string* json_str) {
 }
 
 DebugTimer::DebugTimer(Severity severity, char const* file, int line, char const* name)
-    : duration_(newDuration(severity, file, line, name)) {
+    : duration_(newDuration(severity, file, line, name)), trace_scope_(name) {
   nvtx_helpers::omnisci_range_push(nvtx_helpers::Category::kDebugTimer, name, file);
 }
 
@@ -767,6 +768,7 @@ DebugTimer::~DebugTimer() {
 }
 
 void DebugTimer::stop() {
+  trace_scope_.stop();
   if (duration_) {
     if (duration_->stop()) {
       logAndEraseDurationTree(nullptr);
@@ -776,6 +778,7 @@ void DebugTimer::stop() {
 }
 
 std::string DebugTimer::stopAndGetJson() {
+  trace_scope_.stop();
   std::string json_str;
   if (duration_) {
     if (duration_->stop()) {
@@ -817,6 +820,115 @@ ThreadId thread_id() {
   return g_thread_id;
 }
 
+// Query trace classes and functions.
+class QueryTrace {
+ public:
+  struct Event {
+    char const* name;
+    ThreadId thread_id;
+    int64_t start_us;
+    int64_t duration_us;
+  };
+
+  QueryTrace() : start_(Clock::now()) {}
+
+  int64_t now() const {
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start_)
+        .count();
+  }
+
+  void addEvent(Event const& event) {
+    std::lock_guard<std::mutex> lock_guard(mutex_);
+    events_.push_back(event);
+  }
+
+  std::string json() const {
+    rapidjson::Document doc(rapidjson::kObjectType);
+    auto& alloc = doc.GetAllocator();
+    rapidjson::Value trace_events(rapidjson::kArrayType);
+    {
+      std::lock_guard<std::mutex> lock_guard(mutex_);
+      for (auto const& event : events_) {
+        rapidjson::Value trace_event(rapidjson::kObjectType);
+        trace_event.AddMember("name", rapidjson::StringRef(event.name), alloc);
+        trace_event.AddMember("cat", "omnisci", alloc);
+        trace_event.AddMember("ph", "X", alloc);
+        trace_event.AddMember("ts", rapidjson::Value(event.start_us), alloc);
+        trace_event.AddMember("dur", rapidjson::Value(event.duration_us), alloc);
+        trace_event.AddMember("pid", 1, alloc);
+        trace_event.AddMember("tid", rapidjson::Value(event.thread_id), alloc);
+        trace_events.PushBack(trace_event, alloc);
+      }
+    }
+    doc.AddMember("traceEvents", trace_events, alloc);
+    doc.AddMember("displayTimeUnit", "ms", alloc);
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    doc.Accept(writer);
+    return buffer.GetString();
+  }
+
+ private:
+  Clock::time_point const start_;
+  mutable std::mutex mutex_;
+  std::vector<Event> events_;
+};
+
+// The number of active traces lets untraced queries skip the map lookup entirely.
+std::atomic<size_t> g_query_trace_count{0};
+std::shared_mutex g_query_traces_mutex;
+std::unordered_map<QueryId, std::shared_ptr<QueryTrace>> g_query_traces;
+
+void start_query_trace(QueryId const query_id) {
+  CHECK(query_id);
+  std::unique_lock<std::shared_mutex> write_lock(g_query_traces_mutex);
+  if (g_query_traces.emplace(query_id, std::make_shared<QueryTrace>()).second) {
+    ++g_query_trace_count;
+  }
+}
+
+std::string stop_query_trace(QueryId const query_id) {
+  if (g_query_trace_count.load(std::memory_order_relaxed) == 0) {
+    return {};
+  }
+  std::shared_ptr<QueryTrace> trace;
+  {
+    std::unique_lock<std::shared_mutex> write_lock(g_query_traces_mutex);
+    auto const itr = g_query_traces.find(query_id);
+    if (itr == g_query_traces.end()) {
+      return {};
+    }
+    trace = std::move(itr->second);
+    g_query_traces.erase(itr);
+    --g_query_trace_count;
+  }
+  // Scopes still open on other threads keep the trace alive, their events are dropped.
+  return trace->json();
+}
+
+std::shared_ptr<QueryTrace> current_query_trace() {
+  if (g_query_trace_count.load(std::memory_order_relaxed) == 0) {
+    return nullptr;
+  }
+  auto const id = query_id();
+  if (!id) {
+    return nullptr;
+  }
+  std::shared_lock<std::shared_mutex> read_lock(g_query_traces_mutex);
+  auto const itr = g_query_traces.find(id);
+  return itr == g_query_traces.end() ? nullptr : itr->second;
+}
+
+TraceScope::TraceScope(char const* name)
+    : trace_(current_query_trace()), name_(name), start_us_(trace_ ? trace_->now() : 0) {}
+
+void TraceScope::stop() {
+  if (trace_) {
+    trace_->addEvent({name_, g_thread_id, start_us_, trace_->now() - start_us_});
+    trace_.reset();
+  }
+}
+
 }  // namespace logger
 
 #endif  // #ifndef __CUDACC__
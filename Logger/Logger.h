@@ -42,12 +42,12 @@
 #include <boost/config.hpp>
 #include <boost/log/sources/record_ostream.hpp>
 
-#include <memory>
 #include <set>
 
 #endif
 
 #include <array>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <thread>
@@ -305,9 +305,28 @@ class NullLogger {
 #define VLOG(n) LOG(DEBUG##n)
 
 class Duration;
+class QueryTrace;
+
+using QueryId = uint64_t;
+
+// Records a complete event into the trace of the current thread's query, if that query
+// is being traced. Otherwise this costs one relaxed atomic load.
+class TraceScope {
+  std::shared_ptr<QueryTrace> trace_;
+  char const* name_;
+  int64_t start_us_;
+  TraceScope(TraceScope const&) = delete;
+  TraceScope& operator=(TraceScope const&) = delete;
+
+ public:
+  explicit TraceScope(char const* name);
+  ~TraceScope() { stop(); }
+  void stop();
+};
 
 class DebugTimer {
   Duration* duration_;
+  TraceScope trace_scope_;
   DebugTimer(DebugTimer const&) = delete;
   DebugTimer(DebugTimer&&) = delete;
   DebugTimer& operator=(DebugTimer const&) = delete;
@@ -321,9 +340,16 @@ class DebugTimer {
   std::string stopAndGetJson();
 };
 
-using QueryId = uint64_t;
 QueryId query_id();
 
+// Begins collecting TraceScope and DebugTimer events of the threads running query_id.
+void start_query_trace(QueryId const query_id);
+
+// Ends the trace of query_id and returns it in the Chrome trace event JSON format, which
+// can be loaded by chrome://tracing or Perfetto. Returns an empty string if query_id
+// was not being traced.
+std::string stop_query_trace(QueryId const query_id);
+
 // ~QidScopeGuard resets the thread_local g_query_id to 0 if the current value = id_.
 // In other words, only the QidScopeGuard instance which resulted from changing
 // g_query_id from zero to non-zero is responsible for resetting it back to zero when it
@@ -357,6 +383,9 @@ ThreadId thread_id();
 // Typical usage: auto timer = DEBUG_TIMER(__func__);
 #define DEBUG_TIMER(name) logger::DebugTimer(logger::INFO, __FILE__, __LINE__, name)
 
+// Typical usage: auto trace_scope = TRACE_SCOPE("BufferMgr::fetchBuffer");
+#define TRACE_SCOPE(name) logger::TraceScope(name)
+
 // This MUST NOT be called more than once per thread, otherwise a failed CHECK() occurs.
 // Best practice is to call it from the point where the new thread is spawned.
 // Beware of threads that are re-used.
@@ -49,6 +49,7 @@
 #include <boost/make_shared.hpp>
 #include <boost/program_options.hpp>
 
+#include <algorithm>
 #include <csignal>
 #include <cstdlib>
 #include <sstream>
@@ -60,10 +61,12 @@
 #endif
 #include "MapDRelease.h"
 #include "Shared/Compressor.h"
+#include "Shared/Metrics.h"
 #include "Shared/SystemParameters.h"
 #include "Shared/file_delete.h"
 #include "Shared/scope.h"
 #include "ThriftHandler/ForeignTableRefreshScheduler.h"
+#include "ThriftHandler/NonblockingServer.h"
 
 using namespace ::apache::thrift;
 using namespace ::apache::thrift::concurrency;
@@ -72,6 +75,7 @@ using namespace ::apache::thrift::server;
 using namespace ::apache::thrift::transport;
 
 extern bool g_enable_thrift_logs;
+extern bool g_enable_http_metrics;
 
 // Set g_running to false to trigger normal server shutdown.
 std::atomic<bool> g_running{true};
@@ -81,7 +85,7 @@ namespace {  // anonymous
 std::atomic<int> g_saw_signal{-1};
 
 std::shared_ptr<TThreadedServer> g_thrift_http_server;
-std::shared_ptr<TThreadedServer> g_thrift_tcp_server;
+std::shared_ptr<TServer> g_thrift_tcp_server;
 
 std::shared_ptr<DBHandler> g_warmup_handler;
 // global "g_warmup_handler" needed to avoid circular dependency
@@ -176,7 +180,7 @@ void register_signal_handlers() {
 
 }  // anonymous namespace
 
-void start_server(std::shared_ptr<TThreadedServer> server, const int port) {
+void start_server(std::shared_ptr<TServer> server, const int port) {
   try {
     server->serve();
     if (errno != 0) {
@@ -356,17 +360,77 @@ class UnboundedTBufferedTransportFactory : public TBufferedTransportFactory {
   }
 };
 
-class UnboundedTHttpServerTransportFactory : public THttpServerTransportFactory {
+}  // namespace
+#endif
+
+namespace {
+// HTTP transport which answers GET /metrics with the metrics registry in the Prometheus
+// text format and passes all other requests on to thrift.
+class MetricsTHttpServer : public THttpServer {
  public:
-  UnboundedTHttpServerTransportFactory() : THttpServerTransportFactory() {}
+  using THttpServer::THttpServer;
+
+ protected:
+  bool parseStatusLine(char* status) override {
+    if (g_enable_http_metrics && (boost::starts_with(status, "GET /metrics ") ||
+                                  boost::starts_with(status, "GET /metrics?"))) {
+      const auto body = metrics::Registry::instance().toPrometheusText();
+      std::ostringstream response;
+      response << "HTTP/1.1 200 OK\r\n"
+               << "Content-Type: text/plain; version=0.0.4\r\n"
+               << "Content-Length: " << body.size() << "\r\n"
+               << "Connection: close\r\n\r\n"
+               << body;
+      const auto response_str = response.str();
+      transport_->write(reinterpret_cast<const uint8_t*>(response_str.data()),
+                        static_cast<uint32_t>(response_str.size()));
+      transport_->flush();
+      // There is no thrift message to process, end the connection like a client would.
+      throw TTransportException(TTransportException::END_OF_FILE, "metrics served");
+    }
+    return THttpServer::parseStatusLine(status);
+  }
+};
 
+class MetricsTHttpServerTransportFactory : public THttpServerTransportFactory {
+ public:
   std::shared_ptr<TTransport> getTransport(
       std::shared_ptr<TTransport> transport) override {
-    return std::make_shared<THttpServer>(transport, shared::default_tconfig());
+#ifdef HAVE_THRIFT_MESSAGE_LIMIT
+    return std::make_shared<MetricsTHttpServer>(transport, shared::default_tconfig());
+#else
+    return std::make_shared<MetricsTHttpServer>(transport);
+#endif
   }
 };
 }  // namespace
+
+namespace {
+std::shared_ptr<TServer> create_binary_nonblocking_server(
+    std::shared_ptr<TProcessor> processor,
+    std::shared_ptr<TProtocolFactory> protocol_factory,
+    const CommandLineOptions& prog_config_opts) {
+#ifdef HAVE_THRIFT_NONBLOCKING_SERVER
+  const size_t num_workers = prog_config_opts.nonblocking_server_worker_threads
+                                 ? prog_config_opts.nonblocking_server_worker_threads
+                                 : std::max(std::thread::hardware_concurrency(), 1U);
+  auto server =
+      create_nonblocking_server(processor,
+                                protocol_factory,
+                                prog_config_opts.system_parameters.omnisci_server_port,
+                                prog_config_opts.nonblocking_server_io_threads,
+                                num_workers,
+                                prog_config_opts.nonblocking_server_max_pending_requests);
+  LOG(INFO) << " OmniSci server using nonblocking binary protocol server with "
+            << prog_config_opts.nonblocking_server_io_threads << " IO threads and "
+            << num_workers << " worker threads";
+  return server;
+#else
+  throw std::runtime_error(
+      "Nonblocking server is not supported by the Thrift library of this build.");
 #endif
+}
+}  // namespace
 
 int startMapdServer(CommandLineOptions& prog_config_opts, bool start_http_server = true) {
   // Prepare to launch the Thrift server.
@@ -542,7 +606,12 @@ int startMapdServer(CommandLineOptions& prog_config_opts, bool start_http_server
       std::make_shared<TBufferedTransportFactory>()};
 #endif
   std::shared_ptr<TProtocolFactory> tcp_pf{std::make_shared<TBinaryProtocolFactory>()};
-  g_thrift_tcp_server.reset(new TThreadedServer(processor, tcp_st, tcp_tf, tcp_pf));
+  if (prog_config_opts.enable_nonblocking_server) {
+    g_thrift_tcp_server =
+        create_binary_nonblocking_server(processor, tcp_pf, prog_config_opts);
+  } else {
+    g_thrift_tcp_server.reset(new TThreadedServer(processor, tcp_st, tcp_tf, tcp_pf));
+  }
   server_threads.insert(std::make_unique<std::thread>(
       start_server,
       g_thrift_tcp_server,
@@ -551,13 +620,8 @@ int startMapdServer(CommandLineOptions& prog_config_opts, bool start_http_server
   // Thrift HTTP server launch.
   if (start_http_server) {
     std::shared_ptr<TServerTransport> http_st = http_socket;
-#ifdef HAVE_THRIFT_MESSAGE_LIMIT
     std::shared_ptr<TTransportFactory> http_tf{
-        std::make_shared<UnboundedTHttpServerTransportFactory>()};
-#else
-    std::shared_ptr<TTransportFactory> http_tf{
-        std::make_shared<THttpServerTransportFactory>()};
-#endif
+        std::make_shared<MetricsTHttpServerTransportFactory>()};
     std::shared_ptr<TProtocolFactory> http_pf{std::make_shared<TJSONProtocolFactory>()};
     g_thrift_http_server.reset(new TThreadedServer(processor, http_st, http_tf, http_pf));
     server_threads.insert(std::make_unique<std::thread>(
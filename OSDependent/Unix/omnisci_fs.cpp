@@ -28,6 +28,16 @@ int get_page_size() {
   return getpagesize();
 }
 
+void discard_pages(void* addr, size_t length) {
+  const uintptr_t page_size = getpagesize();
+  const auto begin =
+      (reinterpret_cast<uintptr_t>(addr) + page_size - 1) / page_size * page_size;
+  const auto end = (reinterpret_cast<uintptr_t>(addr) + length) / page_size * page_size;
+  if (begin < end) {
+    madvise(reinterpret_cast<void*>(begin), end - begin, MADV_DONTNEED);
+  }
+}
+
 size_t file_size(const int fd) {
   struct stat buf;
   int err = fstat(fd, &buf);
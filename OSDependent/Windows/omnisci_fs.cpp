@@ -101,6 +101,16 @@ int get_page_size() {
   return 4096;  // TODO: reasonable guess for now
 }
 
+void discard_pages(void* addr, size_t length) {
+  const uintptr_t page_size = get_page_size();
+  const auto begin =
+      (reinterpret_cast<uintptr_t>(addr) + page_size - 1) / page_size * page_size;
+  const auto end = (reinterpret_cast<uintptr_t>(addr) + length) / page_size * page_size;
+  if (begin < end) {
+    DiscardVirtualMemory(reinterpret_cast<void*>(begin), end - begin);
+  }
+}
+
 int32_t ftruncate(const int32_t fd, int64_t length) {
   return _chsize_s(fd, length);
 }
@@ -44,5 +44,9 @@ int32_t pclose(::FILE* fh);
 
 int get_page_size();
 
+// Returns the physical memory backing the whole pages of [addr, addr + length) to the
+// OS, without unmapping them. Their content is lost.
+void discard_pages(void* addr, size_t length);
+
 int32_t ftruncate(const int32_t fd, int64_t length);
 }  // namespace omnisci
@@ -1750,11 +1750,15 @@ size_t InsertValuesStmt::determineLeafIndex(const Catalog_Namespace::Catalog& ca
     }
   }
 
-  if (indexOfShardColumn >= value_list_.size()) {
+  if (values_lists_.size() != 1) {
+    throw std::runtime_error("Cannot determine leaf for a multi-row insert.");
+  }
+  const auto& value_list = values_lists_.front()->get_value_list();
+  if (indexOfShardColumn >= value_list.size()) {
     throw std::runtime_error("No value defined for shard column.");
   }
 
-  auto& shardColumnValueExpr = *(std::next(value_list_.begin(), indexOfShardColumn));
+  auto& shardColumnValueExpr = *(std::next(value_list.begin(), indexOfShardColumn));
 
   Analyzer::Query query;
   auto e = shardColumnValueExpr->analyze(catalog, query);
@@ -1815,26 +1819,39 @@ size_t InsertValuesStmt::determineLeafIndex(const Catalog_Namespace::Catalog& ca
 void InsertValuesStmt::analyze(const Catalog_Namespace::Catalog& catalog,
                                Analyzer::Query& query) const {
   InsertStmt::analyze(catalog, query);
-  std::vector<std::shared_ptr<Analyzer::TargetEntry>>& tlist =
-      query.get_targetlist_nonconst();
   const auto tableId = query.get_result_table_id();
+  size_t num_values{0};
   if (!column_list_.empty()) {
-    if (value_list_.size() != column_list_.size()) {
-      throw std::runtime_error(
-          "Numbers of columns and values don't match for the "
-          "insert.");
-    }
+    num_values = column_list_.size();
   } else {
-    const std::list<const ColumnDescriptor*> non_phys_cols =
-        catalog.getAllColumnMetadataForTable(tableId, false, false, false);
-    if (non_phys_cols.size() != value_list_.size()) {
+    num_values =
+        catalog.getAllColumnMetadataForTable(tableId, false, false, false).size();
+  }
+  auto& values_lists = query.get_values_lists();
+  values_lists.reserve(values_lists_.size());
+  for (const auto& values_list : values_lists_) {
+    if (values_list->get_value_list().size() != num_values) {
+      if (!column_list_.empty()) {
+        throw std::runtime_error(
+            "Numbers of columns and values don't match for the "
+            "insert.");
+      }
       throw std::runtime_error(
           "Number of columns in table does not match the list of values given in the "
           "insert.");
     }
+    values_lists.emplace_back();
+    analyzeValuesList(catalog, query, *values_list, values_lists.back());
   }
+}
+
+void InsertValuesStmt::analyzeValuesList(
+    const Catalog_Namespace::Catalog& catalog,
+    Analyzer::Query& query,
+    const ValuesList& values_list,
+    std::vector<std::shared_ptr<Analyzer::TargetEntry>>& tlist) const {
   std::list<int>::const_iterator it = query.get_result_col_list().begin();
-  for (auto& v : value_list_) {
+  for (auto& v : values_list.get_value_list()) {
     auto e = v->analyze(catalog, query);
     const ColumnDescriptor* cd =
         catalog.getMetadataForColumn(query.get_result_table_id(), *it);
@@ -2330,6 +2347,18 @@ decltype(auto) get_max_rollback_epochs_def(TableDescriptor& td,
       p, assignment);
 }
 
+decltype(auto) get_compaction_fill_percent_def(
+    TableDescriptor& td,
+    const NameValueAssign* p,
+    const std::list<ColumnDescriptor>& columns) {
+  return get_property_value<IntLiteral>(p, [&td](const auto val) {
+    if (val < 0 || val > 100) {
+      throw std::runtime_error("COMPACTION_FILL_PERCENT must be between 0 and 100.");
+    }
+    td.compactionFillPercent = val;
+  });
+}
+
 static const std::map<const std::string, const TableDefFuncPtr> tableDefFuncMap = {
     {"fragment_size"s, get_frag_size_def},
     {"max_chunk_size"s, get_max_chunk_size_def},
@@ -2340,7 +2369,8 @@ static const std::map<const std::string, const TableDefFuncPtr> tableDefFuncMap
     {"vacuum"s, get_vacuum_def},
     {"sort_column"s, get_sort_column_def},
     {"storage_type"s, get_storage_type},
-    {"max_rollback_epochs", get_max_rollback_epochs_def}};
+    {"max_rollback_epochs", get_max_rollback_epochs_def},
+    {"compaction_fill_percent"s, get_compaction_fill_percent_def}};
 
 void get_table_definitions(TableDescriptor& td,
                            const std::unique_ptr<NameValueAssign>& p,
@@ -2351,7 +2381,8 @@ void get_table_definitions(TableDescriptor& td,
         "Invalid CREATE TABLE option " + *p->get_name() +
         ". Should be FRAGMENT_SIZE, MAX_CHUNK_SIZE, PAGE_SIZE, MAX_ROLLBACK_EPOCHS, "
         "MAX_ROWS, "
-        "PARTITIONS, SHARD_COUNT, VACUUM, SORT_COLUMN, STORAGE_TYPE.");
+        "PARTITIONS, SHARD_COUNT, VACUUM, SORT_COLUMN, STORAGE_TYPE, "
+        "COMPACTION_FILL_PERCENT.");
   }
   return it->second(td, p.get(), columns);
 }
@@ -2365,8 +2396,8 @@ void get_table_definitions_for_ctas(TableDescriptor& td,
         "Invalid CREATE TABLE AS option " + *p->get_name() +
         ". Should be FRAGMENT_SIZE, MAX_CHUNK_SIZE, PAGE_SIZE, MAX_ROLLBACK_EPOCHS, "
         "MAX_ROWS, "
-        "PARTITIONS, SHARD_COUNT, VACUUM, SORT_COLUMN, STORAGE_TYPE or "
-        "USE_SHARED_DICTIONARIES.");
+        "PARTITIONS, SHARD_COUNT, VACUUM, SORT_COLUMN, STORAGE_TYPE, "
+        "COMPACTION_FILL_PERCENT or USE_SHARED_DICTIONARIES.");
   }
   return it->second(td, p.get(), columns);
 }
@@ -4025,12 +4056,169 @@ void OptimizeTableStmt::execute(const Catalog_Namespace::SessionInfo& session) {
 
   auto executor = Executor::getExecutor(Executor::UNITARY_EXECUTOR_ID).get();
   const TableOptimizer optimizer(td, executor, catalog);
+  const auto cluster_column = getClusterColumn();
+  if (!cluster_column.empty()) {
+    optimizer.clusterRows(cluster_column);
+  }
   if (shouldVacuumDeletedRows()) {
     optimizer.vacuumDeletedRows();
   }
   optimizer.recomputeMetadata();
 }
 
+AnalyzeTableStmt::AnalyzeTableStmt(const rapidjson::Value& payload) {
+  CHECK(payload.HasMember("tableName"));
+  table_ = std::make_unique<std::string>(json_str(payload["tableName"]));
+}
+
+namespace {
+
+// Number of values the equi-depth histogram of a column is built from.
+constexpr size_t kHistogramSampleSize{1 << 16};
+
+struct ColumnStatisticsCollector {
+  const ColumnDescriptor* cd;
+  Catalog_Namespace::ColumnStatistics statistics;
+  std::vector<double> sample;
+  size_t non_null_count{0};
+
+  // Adds a value of the column as returned by a query with untranslated strings.
+  void add(const TargetValue& tv, std::mt19937_64& generator) {
+    const auto& ti = cd->columnType;
+    const auto scalar_tv = boost::get<ScalarTargetValue>(&tv);
+    CHECK(scalar_tv);
+    double val{0};
+    if (const auto ival = boost::get<int64_t>(scalar_tv)) {
+      if (ti.is_string()) {
+        CHECK_EQ(ti.get_compression(), kENCODING_DICT);
+        if (*ival == inline_int_null_value<int32_t>() ||
+            *ival == inline_fixed_encoding_null_val(ti)) {
+          statistics.addNull();
+          return;
+        }
+      } else if (*ival == inline_int_null_val(get_logical_type_info(ti))) {
+        statistics.addNull();
+        return;
+      }
+      statistics.addInteger(*ival);
+      val = *ival;
+    } else if (const auto dval = boost::get<double>(scalar_tv)) {
+      if (*dval == inline_fp_null_value<double>()) {
+        statistics.addNull();
+        return;
+      }
+      statistics.addFloatingPoint(*dval);
+      val = *dval;
+    } else if (const auto fval = boost::get<float>(scalar_tv)) {
+      if (*fval == inline_fp_null_value<float>()) {
+        statistics.addNull();
+        return;
+      }
+      statistics.addFloatingPoint(*fval);
+      val = *fval;
+    } else {
+      // none encoded strings, the empty string is a value like any other
+      const auto nullable_str = boost::get<NullableString>(scalar_tv);
+      CHECK(nullable_str);
+      const auto str = boost::get<std::string>(nullable_str);
+      if (!str) {
+        statistics.addNull();
+      } else {
+        statistics.addString(*str);
+      }
+      return;
+    }
+    if (!Catalog_Namespace::ColumnStatistics::hasHistogram(ti)) {
+      return;
+    }
+    // reservoir sampling of the values for the histogram
+    ++non_null_count;
+    if (sample.size() < kHistogramSampleSize) {
+      sample.push_back(val);
+    } else {
+      std::uniform_int_distribution<size_t> distribution(0, non_null_count - 1);
+      const auto idx = distribution(generator);
+      if (idx < kHistogramSampleSize) {
+        sample[idx] = val;
+      }
+    }
+  }
+};
+
+}  // namespace
+
+void AnalyzeTableStmt::execute(const Catalog_Namespace::SessionInfo& session) {
+  auto& catalog = session.getCatalog();
+  const auto td = catalog.getMetadataForTable(*table_, false);
+  if (!td || !user_can_access_table(session, td, AccessPrivileges::SELECT_FROM_TABLE)) {
+    throw std::runtime_error("Table " + *table_ + " does not exist.");
+  }
+  if (td->isView) {
+    throw std::runtime_error("ANALYZE TABLE command is not supported on views.");
+  }
+
+  std::vector<ColumnStatisticsCollector> collectors;
+  std::vector<std::string> column_names;
+  const auto cds = catalog.getAllColumnMetadataForTable(td->tableId, false, false, false);
+  for (const auto cd : cds) {
+    if (Catalog_Namespace::ColumnStatistics::isSupported(cd->columnType)) {
+      collectors.push_back({cd});
+      column_names.push_back(get_quoted_string(cd->columnName, '"', '"'));
+    }
+  }
+  if (collectors.empty()) {
+    throw std::runtime_error("Table " + *table_ + " has no columns to analyze.");
+  }
+  std::string select_query = "SELECT " + join(column_names, ", ") + " FROM " +
+                             get_quoted_string(td->tableName, '"', '"') + ";";
+
+  auto session_copy = session;
+  auto session_ptr = std::shared_ptr<Catalog_Namespace::SessionInfo>(
+      &session_copy, boost::null_deleter());
+  auto query_state = query_state::QueryState::create(session_ptr, select_query);
+  auto stdlog = STDLOG(query_state);
+  auto query_state_proxy = query_state->createQueryStateProxy();
+  LocalConnector local_connector;
+
+  const auto execute_read_lock = mapd_shared_lock<mapd_shared_mutex>(
+      *legacylockmgr::LockMgr<mapd_shared_mutex, bool>::getMutex(
+          legacylockmgr::ExecutorOuterLock, true));
+
+  // Scan one outer fragment at a time to bound the size of the intermediate results.
+  std::mt19937_64 generator(td->tableId);
+  const auto outer_frag_count =
+      local_connector.getOuterFragmentCount(query_state_proxy, select_query);
+  const size_t outer_frag_end = outer_frag_count == 0 ? 1 : outer_frag_count;
+  for (size_t outer_frag_idx = 0; outer_frag_idx < outer_frag_end; outer_frag_idx++) {
+    std::vector<size_t> allowed_outer_fragment_indices;
+    if (outer_frag_count) {
+      allowed_outer_fragment_indices.push_back(outer_frag_idx);
+    }
+    const auto query_results = local_connector.query(
+        query_state_proxy, select_query, allowed_outer_fragment_indices, false);
+    for (const auto& query_result : query_results) {
+      const auto& rows = query_result.rs;
+      CHECK_EQ(rows->colCount(), collectors.size());
+      while (true) {
+        const auto row = rows->getNextRow(false, false);
+        if (row.empty()) {
+          break;
+        }
+        for (size_t i = 0; i < collectors.size(); ++i) {
+          collectors[i].add(row[i], generator);
+        }
+      }
+    }
+  }
+
+  std::map<int, Catalog_Namespace::ColumnStatistics> table_statistics;
+  for (auto& collector : collectors) {
+    collector.statistics.setHistogram(collector.sample);
+    table_statistics.emplace(collector.cd->columnId, std::move(collector.statistics));
+  }
+  catalog.setTableStatistics(td->tableId, table_statistics);
+}
+
 bool repair_type(std::list<std::unique_ptr<NameValueAssign>>& options) {
   for (const auto& opt : options) {
     if (boost::iequals(*opt->get_name(), "REPAIR_TYPE")) {
@@ -6651,6 +6839,8 @@ std::unique_ptr<Parser::DDLStmt> create_ddl_from_calcite(const std::string& quer
     stmt = new Parser::RestoreTableStmt(payload);
   } else if (ddl_command == "OPTIMIZE_TABLE") {
     stmt = new Parser::OptimizeTableStmt(payload);
+  } else if (ddl_command == "ANALYZE_TABLE") {
+    stmt = new Parser::AnalyzeTableStmt(payload);
   } else if (ddl_command == "SHOW_CREATE_TABLE") {
     stmt = new Parser::ShowCreateTableStmt(payload);
   } else if (ddl_command == "COPY_TABLE") {
@@ -1254,6 +1254,20 @@ class OptimizeTableStmt : public DDLStmt {
     return false;
   }
 
+  // Returns the geo column given by the CLUSTER option, empty if the option isn't set.
+  std::string getClusterColumn() const {
+    for (const auto& e : options_) {
+      if (boost::iequals(*(e->get_name()), "CLUSTER")) {
+        const auto str_literal = dynamic_cast<const StringLiteral*>(e->get_value());
+        if (!str_literal) {
+          throw std::runtime_error("CLUSTER option must be a column name string.");
+        }
+        return *str_literal->get_stringval();
+      }
+    }
+    return "";
+  }
+
   void execute(const Catalog_Namespace::SessionInfo& session) override;
 
  private:
@@ -1261,6 +1275,18 @@ class OptimizeTableStmt : public DDLStmt {
   std::list<std::unique_ptr<NameValueAssign>> options_;
 };
 
+class AnalyzeTableStmt : public DDLStmt {
+ public:
+  AnalyzeTableStmt(const rapidjson::Value& payload);
+
+  const std::string getTableName() const { return *(table_.get()); }
+
+  void execute(const Catalog_Namespace::SessionInfo& session) override;
+
+ private:
+  std::unique_ptr<std::string> table_;
+};
+
 class ValidateStmt : public DDLStmt {
  public:
   ValidateStmt(std::string* type, std::list<NameValueAssign*>* with_opts);
@@ -2052,21 +2078,46 @@ class InsertStmt : public DMLStmt {
   std::list<std::unique_ptr<std::string>> column_list_;
 };
 
+/*
+ * @type ValuesList
+ * @brief a row of values in INSERT INTO ... VALUES
+ */
+class ValuesList : public Node {
+ public:
+  ValuesList(std::list<Expr*>* v) {
+    CHECK(v);
+    for (const auto e : *v) {
+      value_list_.emplace_back(e);
+    }
+    delete v;
+  }
+  const std::list<std::unique_ptr<Expr>>& get_value_list() const { return value_list_; }
+
+ private:
+  std::list<std::unique_ptr<Expr>> value_list_;
+};
+
 /*
  * @type InsertValuesStmt
- * @brief INSERT INTO ... VALUES ...
+ * @brief INSERT INTO ... VALUES (...), (...), ...
  */
 class InsertValuesStmt : public InsertStmt {
  public:
   InsertValuesStmt(std::string* t, std::list<std::string*>* c, std::list<Expr*>* v)
       : InsertStmt(t, c) {
+    values_lists_.emplace_back(new ValuesList(v));
+  }
+  InsertValuesStmt(std::string* t, std::list<std::string*>* c, std::list<ValuesList*>* v)
+      : InsertStmt(t, c) {
     CHECK(v);
     for (const auto e : *v) {
-      value_list_.emplace_back(e);
+      values_lists_.emplace_back(e);
     }
     delete v;
   }
-  const std::list<std::unique_ptr<Expr>>& get_value_list() const { return value_list_; }
+  const std::vector<std::unique_ptr<ValuesList>>& get_values_lists() const {
+    return values_lists_;
+  }
   void analyze(const Catalog_Namespace::Catalog& catalog,
                Analyzer::Query& query) const override;
 
@@ -2075,7 +2126,13 @@ class InsertValuesStmt : public InsertStmt {
   void execute(const Catalog_Namespace::SessionInfo& session);
 
  private:
-  std::list<std::unique_ptr<Expr>> value_list_;
+  void analyzeValuesList(
+      const Catalog_Namespace::Catalog& catalog,
+      Analyzer::Query& query,
+      const ValuesList& values_list,
+      std::vector<std::shared_ptr<Analyzer::TargetEntry>>& tlist) const;
+
+  std::vector<std::unique_ptr<ValuesList>> values_lists_;
 };
 
 /*
@@ -28,7 +28,8 @@
 
 using namespace std;
 
-const std::vector<std::string> ParserWrapper::ddl_cmd = {"ARCHIVE",
+const std::vector<std::string> ParserWrapper::ddl_cmd = {"ANALYZE",
+                                                         "ARCHIVE",
                                                          "ALTER",
                                                          "COPY",
                                                          "CREATE",
@@ -252,8 +253,8 @@ ParserWrapper::ParserWrapper(std::string query_string) {
         is_calcite_ddl_ = true;
         is_legacy_ddl_ = false;
         return;
-      } else if (ddl == "ARCHIVE" || ddl == "DUMP" || ddl == "OPTIMIZE" ||
-                 ddl == "RESTORE" || ddl == "TRUNCATE") {
+      } else if (ddl == "ANALYZE" || ddl == "ARCHIVE" || ddl == "DUMP" ||
+                 ddl == "OPTIMIZE" || ddl == "RESTORE" || ddl == "TRUNCATE") {
         if (ddl == "ARCHIVE" || ddl == "DUMP") {
           query_type_ = QueryType::SchemaRead;
         } else {
@@ -1066,11 +1066,11 @@ YY_Parser_CLASS::YY_Parser_CLASS(YY_Parser_CONSTRUCTOR_PARAM) YY_Parser_CONSTRUC
 
 /* #line 325 "/usr/local/mapd-deps/20210608/lib/bison.cc" */
 
-#define YYFINAL 512
+#define YYFINAL 517
 #define YYFLAG -32768
 #define YYNTBASE 168
 
-#define YYTRANSLATE(x) ((unsigned)(x) <= 408 ? yytranslate[x] : 258)
+#define YYTRANSLATE(x) ((unsigned)(x) <= 408 ? yytranslate[x] : 259)
 
 static const short yytranslate[] = {
     0,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
@@ -1101,114 +1101,115 @@ static const short yytranslate[] = {
 
 #if YY_Parser_DEBUG != 0
 static const short yyprhs[] = {
-    0,   0,    3,    7,    9,    11,   13,  15,  17,  19,  21,  23,  25,  29,  33,  37,
-    38,  40,   41,   51,   62,   65,   66,  71,  78,  87,  88,  90,  92,  96,  103, 111,
-    116, 118,  122,  126,  132,  134,  138, 140, 142, 146, 151, 154, 160, 161, 164, 168,
-    173, 176,  179,  182,  187,  190,  196, 201, 207, 215, 226, 232, 243, 248, 250, 254,
-    259, 260,  265,  266,  270,  271,  275, 277, 281, 285, 289, 290, 292, 294, 295, 298,
-    301, 303,  305,  307,  309,  311,  316, 325, 326, 328, 330, 332, 336, 340, 346, 347,
-    349, 352,  355,  356,  359,  363,  364, 369, 371, 375, 380, 382, 386, 394, 396, 398,
-    401, 403,  407,  409,  412,  415,  416, 420, 422, 426, 427, 430, 434, 438, 441, 445,
-    447, 449,  451,  453,  455,  457,  459, 461, 463, 467, 471, 478, 484, 490, 495, 501,
-    506, 507,  510,  515,  519,  524,  528, 535, 541, 543, 547, 552, 557, 559, 561, 563,
-    565, 567,  570,  574,  579,  585,  588, 589, 594, 603, 610, 615, 620, 625, 629, 633,
-    637, 641,  645,  652,  655,  658,  660, 662, 664, 668, 675, 677, 679, 681, 682, 684,
-    687, 691,  692,  694,  698,  700,  702, 707, 713, 719, 724, 726, 728, 732, 737, 739,
-    741, 743,  746,  750,  755,  757,  759, 763, 764, 766, 768, 770, 771, 773, 775, 777,
-    779, 781,  783,  787,  789,  791,  793, 797, 799, 801, 803, 807, 809, 812, 814, 816,
-    818, 820,  822,  824,  826,  828,  830, 832, 834, 836, 839, 842, 845, 848, 851, 854,
-    857, 860,  863,  866,  869,  872,  876, 878, 880, 882, 884, 886, 888, 890, 892, 896,
-    900, 902,  904,  906,  908,  910,  915, 917, 922, 929, 931, 936, 943, 945, 947, 949,
-    951, 953,  956,  958,  960,  962,  967, 969, 974, 976, 978, 982, 987, 989, 991, 993,
-    995, 1000, 1007, 1012, 1019, 1021, 1023};
+    0,   0,    3,    7,    9,    11,   13,   15,   17,  19,  21,  23,  25,  29,  33,  37,
+    38,  40,   41,   51,   62,   65,   66,   71,   78,  87,  88,  90,  92,  96,  103, 111,
+    116, 118,  122,  126,  132,  134,  138,  140,  142, 146, 151, 154, 160, 161, 164, 168,
+    173, 176,  179,  182,  187,  190,  196,  201,  207, 215, 226, 232, 243, 248, 250, 254,
+    259, 260,  265,  266,  270,  271,  275,  277,  281, 285, 289, 290, 292, 294, 295, 298,
+    301, 303,  305,  307,  309,  311,  316,  323,  327, 333, 334, 336, 338, 340, 344, 348,
+    354, 355,  357,  360,  363,  364,  367,  371,  372, 377, 379, 383, 388, 390, 394, 402,
+    404, 406,  409,  411,  415,  417,  420,  423,  424, 428, 430, 434, 435, 438, 442, 446,
+    449, 453,  455,  457,  459,  461,  463,  465,  467, 469, 471, 475, 479, 486, 492, 498,
+    503, 509,  514,  515,  518,  523,  527,  532,  536, 543, 549, 551, 555, 560, 565, 567,
+    569, 571,  573,  575,  578,  582,  587,  593,  596, 597, 602, 611, 618, 623, 628, 633,
+    637, 641,  645,  649,  653,  660,  663,  666,  668, 670, 672, 676, 683, 685, 687, 689,
+    690, 692,  695,  699,  700,  702,  706,  708,  710, 715, 721, 727, 732, 734, 736, 740,
+    745, 747,  749,  751,  754,  758,  763,  765,  767, 771, 772, 774, 776, 778, 779, 781,
+    783, 785,  787,  789,  791,  795,  797,  799,  801, 805, 807, 809, 811, 815, 817, 820,
+    822, 824,  826,  828,  830,  832,  834,  836,  838, 840, 842, 844, 847, 850, 853, 856,
+    859, 862,  865,  868,  871,  874,  877,  880,  884, 886, 888, 890, 892, 894, 896, 898,
+    900, 904,  908,  910,  912,  914,  916,  918,  923, 925, 930, 937, 939, 944, 951, 953,
+    955, 957,  959,  961,  964,  966,  968,  970,  975, 977, 982, 984, 986, 990, 995, 997,
+    999, 1001, 1003, 1008, 1015, 1020, 1027, 1029, 1031};
 
 static const short yyrhs[] = {
     169, 159, 0,   168, 169, 159, 0,   174, 0,   194, 0,   176, 0,   177, 0,   178, 0,
-    181, 0,   182, 0,   185, 0,   171, 0,   170, 160, 171, 0,   3,   15,  247, 0,   82,
-    14,  68,  0,   0,   119, 0,   0,   48,  173, 118, 172, 250, 161, 186, 162, 193, 0,
-    48,  48,  3,   118, 172, 250, 161, 186, 162, 193, 0,   82,  68,  0,   0,   64,  118,
-    175, 250, 0,   25,  118, 250, 132, 125, 250, 0,   25,  118, 250, 132, 44,  256, 125,
-    256, 0,   0,   44,  0,   188, 0,   180, 160, 188, 0,   25,  118, 250, 23,  179, 188,
-    0,   25,  118, 250, 23,  161, 180, 162, 0,   25,  118, 250, 183, 0,   184, 0,   183,
-    160, 184, 0,   64,  179, 256, 0,   25,  118, 250, 139, 171, 0,   187, 0,   186, 160,
-    187, 0,   188, 0,   191, 0,   256, 253, 189, 0,   256, 253, 190, 189, 0,   3,   3,
+    181, 0,   182, 0,   185, 0,   171, 0,   170, 160, 171, 0,   3,   15,  248, 0,   82,
+    14,  68,  0,   0,   119, 0,   0,   48,  173, 118, 172, 251, 161, 186, 162, 193, 0,
+    48,  48,  3,   118, 172, 251, 161, 186, 162, 193, 0,   82,  68,  0,   0,   64,  118,
+    175, 251, 0,   25,  118, 251, 132, 125, 251, 0,   25,  118, 251, 132, 44,  257, 125,
+    257, 0,   0,   44,  0,   188, 0,   180, 160, 188, 0,   25,  118, 251, 23,  179, 188,
+    0,   25,  118, 251, 23,  161, 180, 162, 0,   25,  118, 251, 183, 0,   184, 0,   183,
+    160, 184, 0,   64,  179, 257, 0,   25,  118, 251, 139, 171, 0,   187, 0,   186, 160,
+    187, 0,   188, 0,   191, 0,   257, 254, 189, 0,   257, 254, 190, 189, 0,   3,   3,
     0,   3,   3,   161, 10,  162, 0,   0,   14,  98,  0,   14,  98,  143, 0,   14,  98,
-    112, 3,   0,   58,  247, 0,   58,  98,  0,   58,  145, 0,   41,  161, 223, 162, 0,
-    131, 250, 0,   131, 250, 161, 256, 162, 0,   143, 161, 192, 162, 0,   112, 3,   161,
-    192, 162, 0,   74,  3,   161, 192, 162, 131, 250, 0,   74,  3,   161, 192, 162, 131,
-    250, 161, 192, 162, 0,   140, 3,   161, 256, 162, 0,   141, 61,  161, 256, 162, 131,
-    250, 161, 256, 162, 0,   41,  161, 223, 162, 0,   256, 0,   192, 160, 256, 0,   152,
-    161, 170, 162, 0,   0,   64,  148, 175, 250, 0,   0,   161, 192, 162, 0,   0,   107,
-    36,  197, 0,   198, 0,   197, 160, 198, 0,   10,  199, 200, 0,   251, 199, 200, 0,
+    112, 3,   0,   58,  248, 0,   58,  98,  0,   58,  145, 0,   41,  161, 224, 162, 0,
+    131, 251, 0,   131, 251, 161, 257, 162, 0,   143, 161, 192, 162, 0,   112, 3,   161,
+    192, 162, 0,   74,  3,   161, 192, 162, 131, 251, 0,   74,  3,   161, 192, 162, 131,
+    251, 161, 192, 162, 0,   140, 3,   161, 257, 162, 0,   141, 61,  161, 257, 162, 131,
+    251, 161, 257, 162, 0,   41,  161, 224, 162, 0,   257, 0,   192, 160, 257, 0,   152,
+    161, 170, 162, 0,   0,   64,  148, 175, 251, 0,   0,   161, 192, 162, 0,   0,   107,
+    36,  197, 0,   198, 0,   197, 160, 198, 0,   10,  199, 200, 0,   252, 199, 200, 0,
     0,   31,  0,   60,  0,   0,   98,  71,  0,   98,  90,  0,   201, 0,   202, 0,   203,
-    0,   211, 0,   207, 0,   59,  76,  250, 208, 0,   85,  87,  250, 195, 147, 161, 231,
-    162, 0,   0,   24,  0,   62,  0,   206, 0,   205, 160, 206, 0,   256, 15,  223, 0,
-    144, 250, 139, 205, 208, 0,   0,   219, 0,   93,  10,  0,   93,  24,  0,   0,   101,
-    10,  0,   101, 10,  3,   0,   0,   212, 196, 209, 210, 0,   213, 0,   212, 127, 213,
-    0,   212, 127, 24,  213, 0,   214, 0,   161, 212, 162, 0,   138, 204, 215, 216, 208,
-    220, 222, 0,   244, 0,   19,  0,   76,  217, 0,   218, 0,   217, 160, 218, 0,   250,
-    0,   250, 257, 0,   151, 223, 0,   0,   80,  36,  221, 0,   223, 0,   221, 160, 223,
-    0,   0,   81,  223, 0,   223, 12,  223, 0,   223, 13,  223, 0,   14,  223, 0,   161,
-    223, 162, 0,   224, 0,   225, 0,   226, 0,   227, 0,   229, 0,   230, 0,   232, 0,
-    235, 0,   242, 0,   242, 233, 242, 0,   242, 233, 236, 0,   242, 14,  33,  242, 13,
-    242, 0,   242, 33,  242, 13,  242, 0,   242, 14,  92,  245, 228, 0,   242, 92,  245,
-    228, 0,   242, 14,  83,  245, 228, 0,   242, 83,  245, 228, 0,   0,   3,   245, 0,
-    251, 88,  14,  98,  0,   251, 88,  98,  0,   242, 14,  84,  236, 0,   242, 84,  236,
-    0,   242, 14,  84,  161, 231, 162, 0,   242, 84,  161, 231, 162, 0,   245, 0,   231,
-    160, 245, 0,   242, 233, 234, 236, 0,   242, 233, 234, 242, 0,   15,  0,   16,  0,
-    27,  0,   24,  0,   117, 0,   68,  236, 0,   161, 214, 162, 0,   149, 223, 121, 223,
-    0,   237, 149, 223, 121, 223, 0,   66,  223, 0,   0,   37,  237, 238, 67,  0,   82,
-    161, 223, 160, 223, 160, 223, 162, 0,   82,  161, 223, 160, 223, 162, 0,   39,  161,
-    242, 162, 0,   91,  161, 242, 162, 0,   251, 163, 242, 164, 0,   242, 17,  242, 0,
-    242, 18,  242, 0,   242, 19,  242, 0,   242, 20,  242, 0,   242, 21,  242, 0,   95,
-    161, 242, 160, 242, 162, 0,   17,  242, 0,   18,  242, 0,   245, 0,   251, 0,   246,
-    0,   161, 242, 162, 0,   38,  161, 223, 30,  253, 162, 0,   239, 0,   240, 0,   241,
-    0,   0,   223, 0,   223, 3,   0,   223, 30,  3,   0,   0,   243, 0,   244, 160, 243,
-    0,   247, 0,   145, 0,   3,   161, 19,  162, 0,   3,   161, 62,  223, 162, 0,   3,
-    161, 24,  223, 162, 0,   3,   161, 223, 162, 0,   6,   0,   10,  0,   97,  161, 162,
-    0,   54,  161, 223, 162, 0,   11,  0,   72,  0,   63,  0,   253, 6,   0,   165, 249,
-    166, 0,   29,  163, 249, 164, 0,   98,  0,   247, 0,   248, 160, 247, 0,   0,   248,
-    0,   3,   0,   9,   0,   0,   250, 0,   3,   0,   5,   0,   4,   0,   9,   0,   0,
-    0,   0,   160, 0,   0,   3,   0,   4,   0,   0,   0,   0,   160, 0,   0,   0,   0,
-    0,   0,   0,   0,   0,   160, 0,   0,   24,  0,   24,  113, 0,   48,  0,   138, 0,
-    85,  0,   126, 0,   144, 0,   59,  0,   25,  0,   64,  0,   148, 0,   154, 0,   155,
-    0,   128, 0,   115, 128, 0,   25,  115, 0,   48,  115, 0,   48,  118, 0,   48,  148,
-    0,   138, 148, 0,   64,  148, 0,   64,  115, 0,   48,  156, 0,   154, 156, 0,   148,
-    156, 0,   59,  156, 0,   148, 157, 158, 0,   51,  0,   118, 0,   156, 0,   148, 0,
-    115, 0,   3,   0,   10,  0,   3,   0,   3,   167, 3,   0,   3,   167, 19,  0,   10,
-    0,   34,  0,   120, 0,   35,  0,   40,  0,   40,  161, 252, 162, 0,   99,  0,   99,
-    161, 252, 162, 0,   99,  161, 252, 160, 252, 162, 0,   56,  0,   56,  161, 252, 162,
-    0,   56,  161, 252, 160, 252, 162, 0,   86,  0,   124, 0,   116, 0,   72,  0,   130,
-    0,   63,  111, 0,   63,  0,   53,  0,   122, 0,   122, 161, 252, 162, 0,   123, 0,
-    123, 161, 252, 162, 0,   254, 0,   255, 0,   253, 163, 164, 0,   253, 163, 252, 164,
-    0,   109, 0,   94,  0,   110, 0,   96,  0,   77,  161, 254, 162, 0,   77,  161, 254,
-    160, 10,  162, 0,   78,  161, 254, 162, 0,   78,  161, 254, 160, 10,  162, 0,   3,
-    0,   9,   0,   3,   0};
+    0,   212, 0,   208, 0,   59,  76,  251, 209, 0,   85,  87,  251, 195, 147, 204, 0,
+    161, 232, 162, 0,   204, 160, 161, 232, 162, 0,   0,   24,  0,   62,  0,   207, 0,
+    206, 160, 207, 0,   257, 15,  224, 0,   144, 251, 139, 206, 209, 0,   0,   220, 0,
+    93,  10,  0,   93,  24,  0,   0,   101, 10,  0,   101, 10,  3,   0,   0,   213, 196,
+    210, 211, 0,   214, 0,   213, 127, 214, 0,   213, 127, 24,  214, 0,   215, 0,   161,
+    213, 162, 0,   138, 205, 216, 217, 209, 221, 223, 0,   245, 0,   19,  0,   76,  218,
+    0,   219, 0,   218, 160, 219, 0,   251, 0,   251, 258, 0,   151, 224, 0,   0,   80,
+    36,  222, 0,   224, 0,   222, 160, 224, 0,   0,   81,  224, 0,   224, 12,  224, 0,
+    224, 13,  224, 0,   14,  224, 0,   161, 224, 162, 0,   225, 0,   226, 0,   227, 0,
+    228, 0,   230, 0,   231, 0,   233, 0,   236, 0,   243, 0,   243, 234, 243, 0,   243,
+    234, 237, 0,   243, 14,  33,  243, 13,  243, 0,   243, 33,  243, 13,  243, 0,   243,
+    14,  92,  246, 229, 0,   243, 92,  246, 229, 0,   243, 14,  83,  246, 229, 0,   243,
+    83,  246, 229, 0,   0,   3,   246, 0,   252, 88,  14,  98,  0,   252, 88,  98,  0,
+    243, 14,  84,  237, 0,   243, 84,  237, 0,   243, 14,  84,  161, 232, 162, 0,   243,
+    84,  161, 232, 162, 0,   246, 0,   232, 160, 246, 0,   243, 234, 235, 237, 0,   243,
+    234, 235, 243, 0,   15,  0,   16,  0,   27,  0,   24,  0,   117, 0,   68,  237, 0,
+    161, 215, 162, 0,   149, 224, 121, 224, 0,   238, 149, 224, 121, 224, 0,   66,  224,
+    0,   0,   37,  238, 239, 67,  0,   82,  161, 224, 160, 224, 160, 224, 162, 0,   82,
+    161, 224, 160, 224, 162, 0,   39,  161, 243, 162, 0,   91,  161, 243, 162, 0,   252,
+    163, 243, 164, 0,   243, 17,  243, 0,   243, 18,  243, 0,   243, 19,  243, 0,   243,
+    20,  243, 0,   243, 21,  243, 0,   95,  161, 243, 160, 243, 162, 0,   17,  243, 0,
+    18,  243, 0,   246, 0,   252, 0,   247, 0,   161, 243, 162, 0,   38,  161, 224, 30,
+    254, 162, 0,   240, 0,   241, 0,   242, 0,   0,   224, 0,   224, 3,   0,   224, 30,
+    3,   0,   0,   244, 0,   245, 160, 244, 0,   248, 0,   145, 0,   3,   161, 19,  162,
+    0,   3,   161, 62,  224, 162, 0,   3,   161, 24,  224, 162, 0,   3,   161, 224, 162,
+    0,   6,   0,   10,  0,   97,  161, 162, 0,   54,  161, 224, 162, 0,   11,  0,   72,
+    0,   63,  0,   254, 6,   0,   165, 250, 166, 0,   29,  163, 250, 164, 0,   98,  0,
+    248, 0,   249, 160, 248, 0,   0,   249, 0,   3,   0,   9,   0,   0,   251, 0,   3,
+    0,   5,   0,   4,   0,   9,   0,   0,   0,   0,   160, 0,   0,   3,   0,   4,   0,
+    0,   0,   0,   160, 0,   0,   0,   0,   0,   0,   0,   0,   0,   160, 0,   0,   24,
+    0,   24,  113, 0,   48,  0,   138, 0,   85,  0,   126, 0,   144, 0,   59,  0,   25,
+    0,   64,  0,   148, 0,   154, 0,   155, 0,   128, 0,   115, 128, 0,   25,  115, 0,
+    48,  115, 0,   48,  118, 0,   48,  148, 0,   138, 148, 0,   64,  148, 0,   64,  115,
+    0,   48,  156, 0,   154, 156, 0,   148, 156, 0,   59,  156, 0,   148, 157, 158, 0,
+    51,  0,   118, 0,   156, 0,   148, 0,   115, 0,   3,   0,   10,  0,   3,   0,   3,
+    167, 3,   0,   3,   167, 19,  0,   10,  0,   34,  0,   120, 0,   35,  0,   40,  0,
+    40,  161, 253, 162, 0,   99,  0,   99,  161, 253, 162, 0,   99,  161, 253, 160, 253,
+    162, 0,   56,  0,   56,  161, 253, 162, 0,   56,  161, 253, 160, 253, 162, 0,   86,
+    0,   124, 0,   116, 0,   72,  0,   130, 0,   63,  111, 0,   63,  0,   53,  0,   122,
+    0,   122, 161, 253, 162, 0,   123, 0,   123, 161, 253, 162, 0,   255, 0,   256, 0,
+    254, 163, 164, 0,   254, 163, 253, 164, 0,   109, 0,   94,  0,   110, 0,   96,  0,
+    77,  161, 255, 162, 0,   77,  161, 255, 160, 10,  162, 0,   78,  161, 255, 162, 0,
+    78,  161, 255, 160, 10,  162, 0,   3,   0,   9,   0,   3,   0};
 
 #endif
 
 #if YY_Parser_DEBUG != 0
 static const short yyrline[] = {
-    0,   120, 122,  130,  132,  133,  134, 135, 136, 137, 138, 141, 146, 152, 155, 157,
-    160, 162, 165,  170,  176,  178,  181, 187, 194, 201, 202, 204, 206, 213, 218, 224,
-    228, 230, 233,  236,  243,  245,  252, 254, 257, 260, 264, 272, 279, 282, 284, 285,
-    291, 292, 293,  294,  295,  296,  299, 302, 308, 315, 321, 329, 336, 340, 342, 349,
-    352, 356, 363,  365,  368,  370,  373, 375, 382, 385, 389, 391, 392, 395, 397, 398,
-    403, 406, 412,  415,  417,  420,  425, 432, 434, 435, 438, 441, 448, 453, 458, 460,
-    463, 465, 466,  468,  470,  477,  483, 490, 492, 494, 498, 500, 503, 515, 517, 520,
-    524, 526, 533,  535,  538,  542,  544, 547, 549, 556, 558, 563, 566, 568, 570, 571,
-    574, 576, 577,  578,  579,  580,  581, 582, 585, 588, 595, 598, 602, 605, 607, 609,
-    613, 615, 627,  629,  632,  635,  647, 649, 653, 655, 662, 667, 673, 675, 678, 680,
-    681, 684, 688,  692,  697,  703,  705, 708, 712, 717, 724, 726, 731, 739, 741, 742,
-    743, 744, 745,  746,  747,  748,  749, 750, 751, 752, 754, 755, 756, 759, 761, 762,
-    763, 766, 768,  769,  776,  778,  791, 793, 794, 795, 798, 800, 801, 802, 803, 804,
-    805, 806, 807,  808,  809,  812,  814, 821, 823, 828, 838, 841, 843, 845, 846, 846,
-    846, 849, 851,  858,  859,  862,  864, 871, 872, 875, 877, 884, 886, 887, 888, 889,
-    890, 891, 892,  893,  894,  895,  896, 897, 898, 899, 900, 901, 902, 903, 904, 905,
-    906, 907, 908,  909,  910,  911,  914, 916, 917, 918, 919, 922, 924, 928, 930, 931,
-    935, 945, 947,  948,  949,  950,  951, 952, 953, 954, 955, 956, 957, 958, 959, 960,
-    962, 963, 964,  965,  966,  967,  968, 969, 970, 972, 973, 980, 990, 991, 992, 993,
-    996, 998, 1002, 1004, 1010, 1019, 1022};
+    0,   122, 124,  132,  133,  134,  135,  136,  137,  138,  139,  144,  148, 153, 157,
+    158, 162, 163,  168,  172,  178,  179,  184,  190,  197,  203,  203,  206, 208, 216,
+    220, 226, 230,  231,  235,  239,  245,  247,  254,  255,  260,  262,  267, 274, 280,
+    284, 285, 287,  292,  293,  294,  295,  296,  297,  302,  304,  311,  318, 323, 331,
+    338, 342, 344,  352,  354,  359,  365,  366,  370,  371,  375,  377,  385, 387, 391,
+    392, 393, 397,  398,  399,  405,  413,  416,  418,  419,  423,  428,  435, 437, 444,
+    445, 446, 451,  453,  461,  466,  470,  471,  475,  476,  477,  480,  482, 489, 496,
+    502, 504, 506,  510,  511,  516,  527,  528,  532,  536,  538,  545,  546, 550, 554,
+    555, 559, 561,  568,  569,  576,  578,  580,  581,  582,  586,  587,  588, 589, 590,
+    591, 592, 593,  598,  600,  608,  610,  615,  617,  619,  621,  625,  627, 639, 640,
+    645, 647, 659,  661,  665,  667,  675,  679,  685,  686,  691,  692,  693, 696, 700,
+    705, 709, 715,  716,  720,  724,  729,  736,  737,  743,  751,  752,  753, 754, 755,
+    756, 757, 758,  759,  760,  761,  762,  764,  765,  766,  767,  771,  772, 773, 774,
+    778, 779, 781,  788,  789,  803,  804,  805,  806,  810,  811,  812,  813, 814, 815,
+    816, 817, 818,  819,  820,  824,  826,  833,  835,  841,  849,  853,  855, 857, 857,
+    857, 858, 861,  863,  870,  871,  874,  876,  883,  884,  887,  889,  896, 897, 898,
+    899, 900, 901,  902,  903,  904,  905,  906,  907,  908,  909,  910,  911, 912, 913,
+    914, 915, 916,  917,  918,  919,  920,  921,  922,  926,  927,  928,  929, 930, 935,
+    935, 940, 941,  942,  947,  957,  958,  959,  960,  961,  962,  963,  964, 965, 966,
+    967, 968, 969,  970,  971,  973,  974,  975,  976,  977,  978,  979,  980, 981, 983,
+    985, 992, 1001, 1002, 1003, 1004, 1008, 1010, 1014, 1016, 1023, 1030, 1033};
 
 static const char* const yytname[] = {"$",
                                       "error",
@@ -1414,6 +1415,7 @@ static const char* const yytname[] = {"$",
                                       "manipulative_statement",
                                       "delete_statement",
                                       "insert_statement",
+                                      "values_list_commalist",
                                       "opt_all_distinct",
                                       "assignment_commalist",
                                       "assignment",
@@ -1477,332 +1479,332 @@ static const short yyr1[] = {
     184, 185, 186, 186, 187, 187, 188, 188, 189, 189, 189, 190, 190, 190, 190, 190, 190,
     190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 192, 192, 193, 193, 194, 195, 195,
     196, 196, 197, 197, 198, 198, 199, 199, 199, 200, 200, 200, 169, 201, 201, 201, 201,
-    202, 203, 204, 204, 204, 205, 205, 206, 207, 208, 208, 209, 209, 209, 210, 210, 210,
-    211, 212, 212, 212, 213, 213, 214, 215, 215, 216, 217, 217, 218, 218, 219, 220, 220,
-    221, 221, 222, 222, 223, 223, 223, 223, 223, 224, 224, 224, 224, 224, 224, 224, 224,
-    225, 225, 226, 226, 227, 227, 227, 227, 228, 228, 229, 229, 230, 230, 230, 230, 231,
-    231, 232, 232, 233, 233, 234, 234, 234, 235, 236, 237, 237, 238, 238, 239, 239, 239,
-    240, 240, 241, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
-    242, 242, 243, 243, 243, 243, 244, 244, 244, 245, 245, 246, 246, 246, 246, 247, 247,
-    247, 247, 247, 247, 247, 247, 247, 247, 247, 248, 248, 249, 249, 250, 250, -1,  -1,
+    202, 203, 204, 204, 205, 205, 205, 206, 206, 207, 208, 209, 209, 210, 210, 210, 211,
+    211, 211, 212, 213, 213, 213, 214, 214, 215, 216, 216, 217, 218, 218, 219, 219, 220,
+    221, 221, 222, 222, 223, 223, 224, 224, 224, 224, 224, 225, 225, 225, 225, 225, 225,
+    225, 225, 226, 226, 227, 227, 228, 228, 228, 228, 229, 229, 230, 230, 231, 231, 231,
+    231, 232, 232, 233, 233, 234, 234, 235, 235, 235, 236, 237, 238, 238, 239, 239, 240,
+    240, 240, 241, 241, 242, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+    243, 243, 243, 243, 244, 244, 244, 244, 245, 245, 245, 246, 246, 247, 247, 247, 247,
+    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 249, 249, 250, 250, 251, 251,
     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
-    -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  251, 251, 251,
-    252, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 254, 254, 254, 254, -1,  -1,
-    255, 255, 256, 256, 257};
+    -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  252,
+    252, 252, 253, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255,
+    -1,  -1,  256, 256, 257, 257, 258};
 
 static const short yyr2[] = {
-    0, 2, 3, 1, 1, 1,  1, 1,  1, 1, 1, 1, 3, 3, 3, 0, 1, 0, 9, 10, 2, 0, 4, 6, 8, 0,
-    1, 1, 3, 6, 7, 4,  1, 3,  3, 5, 1, 3, 1, 1, 3, 4, 2, 5, 0, 2,  3, 4, 2, 2, 2, 4,
-    2, 5, 4, 5, 7, 10, 5, 10, 4, 1, 3, 4, 0, 4, 0, 3, 0, 3, 1, 3,  3, 3, 0, 1, 1, 0,
-    2, 2, 1, 1, 1, 1,  1, 4,  8, 0, 1, 1, 1, 3, 3, 5, 0, 1, 2, 2,  0, 2, 3, 0, 4, 1,
-    3, 4, 1, 3, 7, 1,  1, 2,  1, 3, 1, 2, 2, 0, 3, 1, 3, 0, 2, 3,  3, 2, 3, 1, 1, 1,
-    1, 1, 1, 1, 1, 1,  3, 3,  6, 5, 5, 4, 5, 4, 0, 2, 4, 3, 4, 3,  6, 5, 1, 3, 4, 4,
-    1, 1, 1, 1, 1, 2,  3, 4,  5, 2, 0, 4, 8, 6, 4, 4, 4, 3, 3, 3,  3, 3, 6, 2, 2, 1,
-    1, 1, 3, 6, 1, 1,  1, 0,  1, 2, 3, 0, 1, 3, 1, 1, 4, 5, 5, 4,  1, 1, 3, 4, 1, 1,
-    1, 2, 3, 4, 1, 1,  3, 0,  1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 3, 1,  1, 1, 3, 1, 1, 1,
-    3, 1, 2, 1, 1, 1,  1, 1,  1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2,  2, 2, 2, 2, 2, 2,
-    2, 3, 1, 1, 1, 1,  1, 1,  1, 1, 3, 3, 1, 1, 1, 1, 1, 4, 1, 4,  6, 1, 4, 6, 1, 1,
-    1, 1, 1, 2, 1, 1,  1, 4,  1, 4, 1, 1, 3, 4, 1, 1, 1, 1, 4, 6,  4, 6, 1, 1, 1};
+    0, 2, 3, 1,  1, 1,  1, 1, 1, 1, 1, 1, 3, 3, 3, 0, 1, 0, 9, 10, 2, 0, 4, 6, 8, 0, 1,
+    1, 3, 6, 7,  4, 1,  3, 3, 5, 1, 3, 1, 1, 3, 4, 2, 5, 0, 2, 3,  4, 2, 2, 2, 4, 2, 5,
+    4, 5, 7, 10, 5, 10, 4, 1, 3, 4, 0, 4, 0, 3, 0, 3, 1, 3, 3, 3,  0, 1, 1, 0, 2, 2, 1,
+    1, 1, 1, 1,  4, 6,  3, 5, 0, 1, 1, 1, 3, 3, 5, 0, 1, 2, 2, 0,  2, 3, 0, 4, 1, 3, 4,
+    1, 3, 7, 1,  1, 2,  1, 3, 1, 2, 2, 0, 3, 1, 3, 0, 2, 3, 3, 2,  3, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 3,  3, 6,  5, 5, 4, 5, 4, 0, 2, 4, 3, 4, 3, 6, 5, 1,  3, 4, 4, 1, 1, 1, 1,
+    1, 2, 3, 4,  5, 2,  0, 4, 8, 6, 4, 4, 4, 3, 3, 3, 3, 3, 6, 2,  2, 1, 1, 1, 3, 6, 1,
+    1, 1, 0, 1,  2, 3,  0, 1, 3, 1, 1, 4, 5, 5, 4, 1, 1, 3, 4, 1,  1, 1, 2, 3, 4, 1, 1,
+    3, 0, 1, 1,  1, 0,  1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1,  3, 1, 2, 1, 1, 1, 1,
+    1, 1, 1, 1,  1, 1,  1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,  3, 1, 1, 1, 1, 1, 1,
+    1, 1, 3, 3,  1, 1,  1, 1, 1, 4, 1, 4, 6, 1, 4, 6, 1, 1, 1, 1,  1, 2, 1, 1, 1, 4, 1,
+    4, 1, 1, 3,  4, 1,  1, 1, 1, 4, 6, 4, 6, 1, 1, 1};
 
 static const short yydefact[] = {
-    0,   0,   17,  0,   0,   0,   87,  0,   0,   0,   0,   3,   5,   6,   7,   8,   9,
-    10,  4,   80,  81,  82,  84,  83,  68,  103, 106, 0,   0,   16,  0,   0,   21,  21,
-    0,   88,  89,  189, 217, 218, 0,   0,   0,   1,   0,   0,   98,  0,   0,   15,  94,
-    0,   0,   0,   66,  269, 202, 203, 206, 0,   0,   0,   110, 0,   273, 275, 0,   0,
-    0,   276, 291, 0,   281, 208, 0,   207, 0,   0,   284, 0,   301, 0,   303, 0,   212,
-    278, 300, 302, 286, 274, 292, 294, 285, 288, 197, 0,   215, 0,   190, 127, 128, 129,
-    130, 131, 132, 133, 134, 186, 187, 188, 135, 194, 109, 181, 183, 196, 182, 0,   296,
-    297, 0,   107, 2,   0,   0,   104, 0,   101, 25,  25,  0,   0,   31,  32,  15,  0,
-    0,   0,   85,  95,  20,  22,  65,  0,   0,   0,   0,   125, 0,   179, 182, 180, 215,
-    0,   166, 0,   0,   0,   0,   0,   289, 0,   161, 0,   0,   0,   0,   0,   0,   0,
-    0,   0,   135, 213, 216, 0,   0,   94,  191, 0,   0,   0,   0,   156, 157, 0,   0,
-    0,   0,   0,   0,   0,   0,   0,   0,   189, 0,   0,   209, 0,   308, 309, 94,  90,
-    0,   269, 74,  69,  70,  74,  105, 96,  97,  0,   102, 26,  0,   0,   0,   0,   0,
-    0,   35,  0,   0,   0,   0,   116, 0,   61,  0,   0,   0,   0,   0,   270, 271, 0,
-    0,   0,   0,   0,   0,   0,   0,   272, 0,   0,   0,   0,   0,   0,   0,   0,   204,
-    0,   0,   0,   126, 184, 0,   210, 111, 112, 114, 117, 123, 124, 192, 0,   0,   0,
-    0,   173, 174, 175, 176, 177, 0,   144, 0,   149, 144, 159, 158, 160, 0,   0,   137,
-    136, 195, 0,   147, 0,   298, 0,   0,   93,  0,   75,  76,  77,  0,   77,  99,  0,
-    27,  0,   29,  34,  0,   23,  0,   33,  0,   14,  0,   0,   67,  0,   198, 0,   0,
-    201, 211, 0,   165, 0,   167, 0,   170, 277, 205, 0,   282, 162, 0,   306, 0,   171,
-    0,   0,   279, 293, 295, 214, 0,   310, 115, 0,   121, 0,   144, 0,   148, 144, 0,
-    0,   143, 0,   152, 141, 154, 155, 146, 172, 299, 91,  92,  0,   72,  71,  73,  100,
-    0,   30,  290, 287, 44,  0,   13,  0,   0,   0,   0,   0,   0,   0,   0,   36,  38,
-    39,  62,  0,   200, 199, 163, 0,   0,   0,   0,   0,   0,   0,   113, 0,   0,   108,
-    0,   142, 0,   140, 139, 145, 0,   151, 78,  79,  28,  0,   0,   0,   0,   0,   40,
-    44,  24,  0,   0,   0,   0,   0,   0,   0,   0,   64,  86,  164, 185, 283, 307, 0,
-    169, 178, 280, 118, 119, 122, 138, 150, 153, 42,  45,  0,   49,  50,  48,  52,  41,
-    64,  0,   0,   0,   0,   0,   0,   37,  0,   18,  0,   0,   0,   0,   46,  0,   0,
-    19,  60,  0,   0,   0,   0,   54,  0,   168, 120, 0,   47,  51,  0,   0,   55,  58,
-    0,   0,   11,  43,  53,  0,   0,   0,   63,  56,  0,   12,  0,   0,   0,   0,   57,
-    59,  0,   0};
+    0,   0,   17,  0,   0,   0,   89,  0,   0,   0,   0,   3,   5,   6,   7,   8,   9,
+    10,  4,   80,  81,  82,  84,  83,  68,  105, 108, 0,   0,   16,  0,   0,   21,  21,
+    0,   90,  91,  191, 219, 220, 0,   0,   0,   1,   0,   0,   100, 0,   0,   15,  96,
+    0,   0,   0,   66,  271, 204, 205, 208, 0,   0,   0,   112, 0,   275, 277, 0,   0,
+    0,   278, 293, 0,   283, 210, 0,   209, 0,   0,   286, 0,   303, 0,   305, 0,   214,
+    280, 302, 304, 288, 276, 294, 296, 287, 290, 199, 0,   217, 0,   192, 129, 130, 131,
+    132, 133, 134, 135, 136, 188, 189, 190, 137, 196, 111, 183, 185, 198, 184, 0,   298,
+    299, 0,   109, 2,   0,   0,   106, 0,   103, 25,  25,  0,   0,   31,  32,  15,  0,
+    0,   0,   85,  97,  20,  22,  65,  0,   0,   0,   0,   127, 0,   181, 184, 182, 217,
+    0,   168, 0,   0,   0,   0,   0,   291, 0,   163, 0,   0,   0,   0,   0,   0,   0,
+    0,   0,   137, 215, 218, 0,   0,   96,  193, 0,   0,   0,   0,   158, 159, 0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   191, 0,   0,   211, 0,   310, 311, 96,  92,
+    0,   271, 74,  69,  70,  74,  107, 98,  99,  0,   104, 26,  0,   0,   0,   0,   0,
+    0,   35,  0,   0,   0,   0,   118, 0,   61,  0,   0,   0,   0,   0,   272, 273, 0,
+    0,   0,   0,   0,   0,   0,   0,   274, 0,   0,   0,   0,   0,   0,   0,   0,   206,
+    0,   0,   0,   128, 186, 0,   212, 113, 114, 116, 119, 125, 126, 194, 0,   0,   0,
+    0,   175, 176, 177, 178, 179, 0,   146, 0,   151, 146, 161, 160, 162, 0,   0,   139,
+    138, 197, 0,   149, 0,   300, 0,   0,   95,  0,   75,  76,  77,  0,   77,  101, 0,
+    27,  0,   29,  34,  0,   23,  0,   33,  0,   14,  0,   0,   67,  0,   86,  200, 0,
+    0,   203, 213, 0,   167, 0,   169, 0,   172, 279, 207, 0,   284, 164, 0,   308, 0,
+    173, 0,   0,   281, 295, 297, 216, 0,   312, 117, 0,   123, 0,   146, 0,   150, 146,
+    0,   0,   145, 0,   154, 143, 156, 157, 148, 174, 301, 93,  94,  0,   72,  71,  73,
+    102, 0,   30,  292, 289, 44,  0,   13,  0,   0,   0,   0,   0,   0,   0,   0,   36,
+    38,  39,  62,  0,   0,   202, 201, 165, 0,   0,   0,   0,   0,   0,   0,   115, 0,
+    0,   110, 0,   144, 0,   142, 141, 147, 0,   153, 78,  79,  28,  0,   0,   0,   0,
+    0,   40,  44,  24,  0,   0,   0,   0,   0,   0,   0,   0,   64,  87,  0,   166, 187,
+    285, 309, 0,   171, 180, 282, 120, 121, 124, 140, 152, 155, 42,  45,  0,   49,  50,
+    48,  52,  41,  64,  0,   0,   0,   0,   0,   0,   37,  0,   18,  0,   0,   0,   0,
+    0,   46,  0,   0,   19,  60,  0,   0,   0,   0,   54,  0,   88,  170, 122, 0,   47,
+    51,  0,   0,   55,  58,  0,   0,   11,  43,  53,  0,   0,   0,   63,  56,  0,   12,
+    0,   0,   0,   0,   57,  59,  0,   0};
 
 static const short yydefgoto[] = {
-    9,   10,  494, 222, 136, 30,  11,  52,  12,  13,  14,  217, 305, 15,  16,
-    132, 133, 17,  388, 389, 390, 424, 425, 391, 228, 468, 18,  144, 46,  207,
-    208, 301, 370, 19,  20,  21,  37,  202, 203, 22,  138, 127, 214, 23,  24,
-    25,  26,  97,  177, 262, 263, 139, 350, 445, 407, 98,  99,  100, 101, 102,
-    358, 103, 104, 359, 105, 194, 287, 106, 162, 154, 242, 107, 108, 109, 110,
-    111, 112, 113, 114, 115, 174, 175, 264, 116, 246, 117, 118, 119, 307, 348};
+    9,   10,  499, 222, 136, 30,  11,  52,  12,  13,  14,  217, 305, 15,  16,  132,
+    133, 17,  389, 390, 391, 426, 427, 392, 228, 471, 18,  144, 46,  207, 208, 301,
+    371, 19,  20,  21,  320, 37,  202, 203, 22,  138, 127, 214, 23,  24,  25,  26,
+    97,  177, 262, 263, 139, 351, 448, 409, 98,  99,  100, 101, 102, 359, 103, 104,
+    360, 105, 194, 287, 106, 162, 154, 242, 107, 108, 109, 110, 111, 112, 113, 114,
+    115, 174, 175, 264, 116, 246, 117, 118, 119, 307, 349};
 
 static const short yypact[] = {
-    301,    -92,    30,     52,     -37,    32,     11,     202,    43,     59,
-    -95,    -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
-    -32768, -32768, -32768, -32768, 115,    -32768, -32768, 202,    121,    -32768,
-    34,     202,    119,    119,    202,    -32768, -32768, 518,    -32768, -32768,
-    85,     -88,    135,    -32768, 213,    23,     215,    82,     219,    251,
-    169,    283,    202,    202,    198,    87,     -32768, -32768, -32768, 748,
-    942,    942,    -32768, 194,    -32768, -32768, 223,    203,    214,    227,
-    -32768, 237,    247,    2,      249,    -1,     250,    254,    -32768, 258,
-    -32768, 262,    -32768, 265,    -32768, 267,    -32768, -32768, -32768, -32768,
-    268,    270,    -32768, -32768, -32768, 748,    1351,   286,    73,     -32768,
+    246,    -66,    -30,    5,      -84,    -16,    53,     316,    -60,    40,
+    -40,    -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+    -32768, -32768, -32768, -32768, 11,     -32768, -32768, 316,    136,    -32768,
+    82,     316,    114,    114,    316,    -32768, -32768, 506,    -32768, -32768,
+    97,     -59,    87,     -32768, 222,    78,     194,    164,    173,    239,
+    172,    266,    316,    316,    134,    161,    -32768, -32768, -32768, 736,
+    930,    930,    -32768, 177,    -32768, -32768, 202,    191,    204,    208,
+    -32768, 234,    242,    17,     275,    10,     276,    277,    -32768, 278,
+    -32768, 279,    -32768, 280,    -32768, 281,    -32768, -32768, -32768, -32768,
+    282,    285,    -32768, -32768, -32768, 736,    1339,   290,    287,    -32768,
     -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
-    1437,   -32768, 208,    -32768, -32768, -32768, -67,    25,     -32768, -32768,
-    269,    -32768, -32768, 289,    43,     -32768, 199,    275,    -28,    340,
-    -32,    390,    244,    -32768, 251,    386,    202,    748,    -32768, -32768,
-    -32768, -32768, -32768, 269,    278,    403,    231,    -32768, 942,    -32768,
-    271,    -32768, 1351,   748,    -12,    748,    942,    420,    748,    420,
-    -32768, 295,    -32768, 197,    748,    942,    942,    273,    420,    420,
-    420,    28,     212,    -32768, 276,    280,    202,    169,    -32768, 748,
-    748,    441,    206,    -32768, -32768, 942,    942,    942,    942,    942,
-    942,    1195,   287,    1195,   633,    748,    -8,     942,    -32768, 0,
-    -32768, -32768, 137,    -32768, 432,    282,    60,     290,    -32768, 60,
-    -32768, -32768, -32768, 442,    -32768, -32768, 269,    269,    269,    269,
-    202,    436,    -32768, 389,    202,    387,    293,    333,    75,     -32768,
-    299,    296,    748,    748,    38,     -32768, -32768, 174,    300,    6,
-    748,    748,    394,    58,     240,    -32768, 305,    40,     143,    306,
-    151,    20,     245,    264,    -32768, 159,    307,    308,    -32768, -32768,
-    1351,   -32768, 303,    -32768, 469,    393,    461,    -32768, -32768, 942,
-    1195,   315,    1195,   281,    281,    -32768, -32768, -32768, 297,    474,
-    1117,   -32768, 474,    -32768, -32768, -32768, 845,    1039,   -32768, 323,
-    -32768, 380,    -32768, 122,    -32768, 316,    269,    -32768, 748,    -32768,
-    -32768, 381,    289,    381,    479,    172,    -32768, 1312,   -32768, -32768,
-    358,    -32768, 1351,   -32768, 325,    -32768, 238,    269,    -32768, 1195,
-    -32768, 44,     48,     -32768, -32768, 748,    333,    86,     -32768, 1312,
-    -32768, -32768, -32768, 420,    -32768, -32768, 477,    -32768, 748,    -32768,
-    942,    420,    -32768, -32768, -32768, -32768, 202,    -32768, -32768, 448,
-    407,    310,    474,    1117,   -32768, 474,    942,    1195,   -32768, 196,
-    -32768, -32768, -32768, 323,    -32768, -32768, -32768, -32768, 333,    4,
-    -32768, -32768, -32768, -32768, 269,    -32768, 379,    -32768, 14,     269,
-    -32768, 238,    332,    492,    493,    500,    443,    344,    201,    -32768,
-    -32768, -32768, -32768, 207,    -32768, -32768, 333,    748,    90,     345,
-    346,    36,     256,    347,    -32768, 748,    748,    -32768, 942,    -32768,
-    211,    -32768, 323,    -32768, 1195,   -32768, -32768, -32768, -32768, 503,
-    412,    350,    1273,   202,    -32768, 511,    -32768, 220,    748,    354,
-    355,    356,    357,    269,    238,    368,    -32768, 333,    -32768, -32768,
-    -32768, 748,    -32768, -32768, -32768, 362,    333,    333,    323,    -32768,
-    -32768, 369,    -54,    748,    -32768, -32768, -32768, 370,    -32768, 368,
-    50,     269,    269,    269,    269,    225,    -32768, 373,    -32768, 54,
-    748,    528,    536,    -32768, 56,     269,    -32768, -32768, 229,    232,
-    378,    382,    -32768, 390,    -32768, 333,    383,    -32768, -32768, 384,
-    410,    -32768, -32768, 411,    239,    -32768, -32768, -32768, 202,    202,
-    390,    -32768, 388,    398,    -32768, 269,    269,    243,    392,    -32768,
-    -32768, 543,    -32768};
+    1425,   -32768, 210,    -32768, -32768, -32768, -73,    27,     -32768, -32768,
+    330,    -32768, -32768, 267,    -60,    -32768, 235,    291,    -41,    338,
+    -27,    371,    228,    -32768, 239,    382,    316,    736,    -32768, -32768,
+    -32768, -32768, -32768, 330,    301,    391,    22,     -32768, 930,    -32768,
+    260,    -32768, 1339,   736,    -53,    736,    930,    439,    736,    439,
+    -32768, 312,    -32768, 170,    736,    930,    930,    289,    439,    439,
+    439,    -5,     205,    -32768, 292,    295,    316,    172,    -32768, 736,
+    736,    452,    209,    -32768, -32768, 930,    930,    930,    930,    930,
+    930,    1183,   297,    1183,   621,    736,    -4,     930,    -32768, 4,
+    -32768, -32768, 105,    -32768, 441,    293,    20,     302,    -32768, 20,
+    -32768, -32768, -32768, 447,    -32768, -32768, 330,    330,    330,    330,
+    316,    449,    -32768, 401,    316,    398,    306,    296,    -8,     -32768,
+    307,    308,    736,    736,    31,     -32768, -32768, 116,    310,    130,
+    736,    736,    404,    237,    214,    -32768, 313,    35,     144,    314,
+    175,    54,     255,    55,     -32768, 213,    317,    318,    -32768, -32768,
+    1339,   -32768, 321,    -32768, 469,    403,    465,    -32768, -32768, 930,
+    1183,   323,    1183,   343,    343,    -32768, -32768, -32768, 294,    488,
+    1105,   -32768, 488,    -32768, -32768, -32768, 833,    1027,   -32768, 340,
+    -32768, 394,    -32768, 93,     -32768, 329,    330,    -32768, 736,    -32768,
+    -32768, 396,    267,    396,    492,    217,    -32768, 1300,   -32768, -32768,
+    373,    -32768, 1339,   -32768, 341,    -32768, 186,    330,    -32768, 1183,
+    339,    -32768, 37,     41,     -32768, -32768, 736,    296,    132,    -32768,
+    1300,   -32768, -32768, -32768, 439,    -32768, -32768, 493,    -32768, 736,
+    -32768, 930,    439,    -32768, -32768, -32768, -32768, 316,    -32768, -32768,
+    468,    424,    325,    488,    1105,   -32768, 488,    930,    1183,   -32768,
+    218,    -32768, -32768, -32768, 340,    -32768, -32768, -32768, -32768, 296,
+    121,    -32768, -32768, -32768, -32768, 330,    -32768, 395,    -32768, 28,
+    330,    -32768, 186,    347,    507,    515,    516,    461,    365,    221,
+    -32768, -32768, -32768, -32768, 227,    366,    -32768, -32768, 296,    736,
+    185,    367,    368,    26,     265,    369,    -32768, 736,    736,    -32768,
+    930,    -32768, 231,    -32768, 340,    -32768, 1183,   -32768, -32768, -32768,
+    -32768, 525,    434,    372,    1261,   316,    -32768, 531,    -32768, 244,
+    736,    376,    377,    378,    381,    330,    186,    397,    -32768, 1183,
+    296,    -32768, -32768, -32768, 736,    -32768, -32768, -32768, 387,    296,
+    296,    340,    -32768, -32768, 389,    64,     736,    -32768, -32768, -32768,
+    390,    -32768, 397,    43,     330,    330,    330,    330,    251,    -32768,
+    392,    -32768, 252,    48,     736,    538,    551,    -32768, 50,     330,
+    -32768, -32768, 259,    262,    393,    399,    -32768, 371,    -32768, -32768,
+    296,    402,    -32768, -32768, 405,    426,    -32768, -32768, 427,    272,
+    -32768, -32768, -32768, 316,    316,    371,    -32768, 407,    409,    -32768,
+    330,    330,    273,    410,    -32768, -32768, 563,    -32768};
 
 static const short yypgoto[] = {
-    -32768, 541,    -32768, -264,   417,    -32768, -32768, 527,    -32768, -32768,
-    -32768, 433,    -32768, -32768, -32768, -32768, 338,    -32768, 182,    131,
-    -214,   141,    -32768, -32768, -218,   108,    -32768, -32768, -32768, -32768,
-    274,    360,    272,    -32768, -32768, -32768, -32768, -32768, 277,    -32768,
-    -94,    -32768, -32768, -32768, 562,    -23,    -154,   -32768, -32768, -32768,
-    233,    -32768, -32768, -32768, -32768, -58,    -32768, -32768, -32768, -32768,
-    -202,   -32768, -32768, -237,   -32768, -32768, -32768, -32768, -156,   -32768,
-    -32768, -32768, -32768, -32768, -18,    385,    -32768, -168,   -32768, -87,
-    -32768, 425,    -7,     -31,    -155,   -193,   415,    -32768, -109,   -32768};
-
-#define YYLAST 1529
+    -32768, 556,    -32768, -250,   432,    -32768, -32768, 540,    -32768, -32768,
+    -32768, 442,    -32768, -32768, -32768, -32768, 352,    -32768, 195,    140,
+    -205,   152,    -32768, -32768, -256,   118,    -32768, -32768, -32768, -32768,
+    283,    374,    284,    -32768, -32768, -32768, -32768, -32768, -32768, 286,
+    -32768, -86,    -32768, -32768, -32768, 573,    -19,    -156,   -32768, -32768,
+    -32768, 243,    -32768, -32768, -32768, -32768, -58,    -32768, -32768, -32768,
+    -32768, -200,   -32768, -32768, -262,   -32768, -32768, -32768, -32768, 49,
+    -32768, -32768, -32768, -32768, -32768, -25,    400,    -32768, -187,   -32768,
+    -94,    -32768, 437,    -7,     -39,    -140,   -126,   423,    -32768, -111,
+    -32768};
+
+#define YYLAST 1517
 
 static const short yytable[] = {
-    40,  147, 306,  308, 248, -287, 291, 249, -290, 173, 245, 204, 219, 255, 256, 257,
-    215, 419, 179,  180, 47,  196,  125, 279, 50,   282, 27,  54,  420, 150, 150, 198,
-    179, 180, 229,  35,  281, 171,  288, 45,  179,  180, 149, 151, 295, 141, 142, 124,
-    179, 180, 179,  180, 179, 180,  240, 421, 179,  180, 472, 511, 179, 180, 179, 180,
-    43,  173, 179,  180, 179, 180,  179, 180, 422,  36,  121, 416, 178, 172, 28,  227,
-    361, 32,  393,  265, 1,   179,  180, 234, 329,  473, 292, 299, 209, 220, 417, 239,
-    197, 243, 179,  180, 247, 210,  352, 181, 355,  128, 251, 2,   297, 309, 310, 33,
-    360, 160, 378,  354, 410, 150,  3,   34,  300,  266, 267, 4,   48,  150, 249, 325,
-    31,  226, 237,  362, 249, 216,  150, 150, 398,  241, 244, 185, 186, 187, 188, 189,
-    5,   423, 129,  252, 253, 29,   409, 360, 49,   411, 150, 150, 150, 150, 150, 150,
-    418, 6,   -287, 150, 294, -290, 150, 273, 274,  275, 276, 277, 278, 345, 321, 322,
-    289, 199, 399,  293, 338, 6,    326, 327, 8,    360, 403, 204, 199, 413, 258, 185,
-    186, 187, 188,  189, 441, 6,    442, 249, 323,  51,  332, 7,   8,   38,  394, 397,
-    392, 211, 395,  39,  477, 311,  130, 465, 484,  314, 488, 495, 8,   131, 44,  212,
-    120, 380, 182,  183, 184, 185,  186, 187, 188,  189, 235, 317, 504, 318, 150, 269,
-    368, 200, 45,   478, 479, 190,  450, 201, 145,  123, 236, 351, 438, 199, 146, 150,
-    150, 185, 186,  187, 188, 189,  185, 186, 187,  188, 189, 396, 237, 363, 426, 209,
-    200, 185, 186,  187, 188, 189,  201, 382, 401,  185, 186, 187, 188, 189, 365, 507,
-    137, 270, 271,  80,  205, 82,   122, 191, 192,  296, 272, 206, 187, 188, 189, 333,
-    193, 334, 86,   87,  126, 150,  356, 336, 383,  337, 185, 186, 187, 188, 189, 341,
-    137, 342, 402,  408, 229, 150,  1,   185, 186,  187, 188, 189, 374, 135, 375, 456,
-    259, 134, 412,  437, 185, 186,  187, 188, 189,  179, 180, 446, 447, 2,   384, 140,
-    229, 229, 480,  481, 414, 152,  415, 143, 3,    434, 176, 435, 155, 4,   489, 414,
-    195, 436, 460,  414, 153, 449,  259, 156, 213,  150, 385, 386, 434, 387, 459, 469,
-    215, 317, 5,    482, 157, 317,  448, 490, 317,  221, 491, 474, 229, 508, 158, 500,
-    225, 501, 330,  317, 223, 509,  55,  339, 159,  56,  161, 163, 485, 57,  58,  164,
-    457, 59,  443,  165, 60,  61,   231, 166, 340,  230, 167, 232, 168, 169, 245, 170,
-    63,  6,   197,  254, 260, 64,   65,  6,   66,   67,  68,  69,  268, 7,   261, 298,
-    280, 146, 302,  312, 304, 129,  316, 315, 70,   71,  320, 72,  319, 328, 8,   346,
-    324, 233, 73,   331, 335, 343,  344, 74,  347,  349, 180, 75,  353, 357, 364, 369,
-    366, 76,  373,  379, 405, 77,   381, 400, 406,  78,  160, 502, 503, 428, 79,  429,
-    430, 80,  81,   82,  83,  84,   85,  431, 432,  433, 451, 439, 440, 444, 452, 453,
-    86,  87,  419,  461, 462, 463,  464, 88,  467,  55,  470, 89,  56,  90,  91,  92,
-    57,  58,  471,  475, 59,  93,   483, 60,  61,   62,  486, 487, 492, 498, 499, 512,
-    493, 496, 497,  63,  94,  505,  42,  224, 64,   65,  510, 66,  67,  68,  69,  506,
-    53,  313, 218,  427, 95,  466,  458, 476, 96,   303, 41,  70,  71,  367, 72,  372,
-    371, 238, 250,  404, 290, 73,   0,   0,   0,    0,   74,  0,   0,   0,   75,  0,
-    0,   0,   0,    0,   76,  0,    0,   0,   77,   0,   0,   0,   78,  0,   0,   0,
-    0,   79,  0,    0,   80,  81,   82,  83,  84,   85,  0,   0,   0,   0,   0,   0,
-    0,   0,   0,    86,  87,  0,    0,   0,   0,    0,   88,  0,   55,  0,   89,  56,
-    90,  91,  92,   57,  58,  0,    0,   0,   93,   0,   60,  61,  0,   0,   0,   0,
-    0,   283, 0,    0,   284, 0,    63,  94,  0,    0,   0,   64,  65,  0,   66,  67,
-    68,  69,  0,    0,   0,   0,    0,   95,  0,    0,   0,   96,  0,   0,   70,  71,
-    0,   72,  0,    0,   0,   0,    0,   0,   73,   0,   0,   0,   0,   0,   0,   0,
-    0,   75,  0,    0,   0,   0,    0,   76,  0,    0,   0,   77,  0,   0,   0,   78,
-    0,   0,   0,    0,   79,  0,    0,   80,  81,   82,  83,  84,  85,  0,   0,   0,
-    0,   0,   0,    0,   0,   0,    86,  87,  0,    0,   0,   0,   0,   88,  285, 55,
-    0,   89,  56,   90,  91,  92,   57,  58,  0,    0,   59,  93,  0,   60,  61,  0,
-    0,   0,   0,    0,   0,   0,    0,   0,   0,    63,  94,  0,   0,   0,   64,  65,
-    0,   66,  67,   68,  69,  0,    0,   0,   0,    0,   286, 0,   0,   0,   96,  0,
-    0,   70,  71,   0,   72,  0,    0,   0,   0,    0,   0,   73,  0,   0,   0,   0,
-    74,  0,   0,    0,   75,  0,    0,   0,   0,    0,   76,  0,   0,   0,   77,  0,
-    0,   0,   78,   0,   0,   0,    0,   79,  0,    0,   80,  81,  82,  83,  84,  85,
-    55,  0,   0,    56,  0,   0,    0,   57,  58,   86,  87,  0,   0,   0,   60,  61,
-    88,  0,   0,    0,   89,  0,    90,  91,  92,   0,   63,  0,   0,   0,   93,  64,
-    65,  0,   66,   67,  68,  69,   0,   0,   0,    0,   0,   0,   0,   94,  0,   0,
-    0,   0,   70,   71,  0,   72,   0,   0,   0,    0,   0,   0,   73,  95,  0,   0,
-    0,   96,  0,    0,   0,   75,   0,   0,   0,    0,   0,   76,  0,   0,   0,   77,
-    0,   0,   0,    78,  0,   0,    0,   0,   79,   0,   0,   80,  81,  82,  83,  84,
-    85,  55,  0,    0,   56,  0,    0,   0,   57,   58,  86,  87,  0,   0,   0,   60,
-    61,  88,  0,    0,   0,   89,   0,   90,  91,   92,  0,   63,  0,   0,   0,   93,
-    64,  65,  0,    66,  67,  68,   69,  6,   0,    0,   0,   0,   0,   0,   94,  0,
-    0,   0,   0,    70,  71,  0,    72,  0,   0,    0,   0,   0,   0,   73,  148, 0,
-    0,   0,   96,   0,   0,   0,    75,  0,   0,    0,   0,   0,   76,  0,   0,   0,
-    77,  0,   0,    0,   78,  0,    0,   0,   0,    79,  0,   0,   80,  81,  82,  83,
-    84,  85,  55,   0,   0,   56,   0,   0,   0,    57,  58,  86,  87,  0,   0,   0,
-    60,  61,  88,   0,   0,   0,    89,  0,   90,   91,  92,  0,   63,  0,   0,   0,
-    93,  64,  65,   0,   66,  67,   68,  69,  0,    0,   0,   0,   0,   0,   0,   94,
-    0,   0,   0,    0,   70,  71,   0,   72,  0,    0,   0,   0,   0,   0,   73,  148,
-    0,   0,   0,    96,  0,   0,    0,   75,  0,    0,   0,   0,   0,   76,  0,   0,
-    0,   77,  0,    56,  0,   78,   0,   57,  58,   0,   79,  0,   0,   80,  81,  82,
-    83,  84,  85,   0,   0,   0,    0,   0,   0,    0,   63,  0,   86,  87,  0,   64,
-    65,  0,   0,    88,  0,   69,   0,   89,  0,    90,  91,  92,  0,   0,   0,   0,
-    0,   93,  70,   71,  0,   72,   0,   0,   0,    0,   0,   0,   73,  0,   0,   0,
-    94,  0,   0,    0,   0,   75,   0,   0,   0,    0,   0,   76,  0,   0,   0,   0,
-    286, 56,  0,    78,  96,  57,   58,  0,   0,    0,   0,   80,  0,   82,  83,  84,
-    85,  0,   0,    0,   0,   0,    0,   0,   63,   0,   86,  87,  0,   64,  65,  0,
-    0,   88,  0,    69,  0,   89,   0,   90,  91,   92,  0,   0,   0,   0,   0,   93,
-    70,  71,  0,    72,  0,   0,    0,   6,   0,    0,   73,  0,   0,   0,   94,  0,
-    0,   0,   0,    75,  0,   0,    0,   0,   0,    76,  0,   0,   0,   0,   0,   56,
-    0,   78,  96,   57,  58,  0,    0,   0,   0,    80,  0,   82,  83,  84,  85,  0,
-    0,   0,   0,    0,   0,   0,    63,  0,   86,   87,  0,   64,  65,  0,   0,   88,
-    0,   69,  0,    89,  0,   90,   91,  92,  0,    0,   0,   0,   0,   93,  70,  71,
-    0,   72,  0,    0,   0,   0,    0,   0,   73,   0,   0,   0,   94,  0,   0,   0,
-    0,   75,  64,   65,  0,   0,    0,   76,  69,   0,   0,   0,   0,   56,  0,   78,
-    96,  57,  58,   0,   0,   70,   0,   80,  72,   82,  83,  454, 85,  0,   0,   376,
-    0,   0,   0,    0,   63,  0,    86,  87,  377,  64,  65,  0,   0,   88,  76,  69,
-    0,   89,  0,    90,  91,  92,   78,  0,   0,    0,   0,   93,  70,  71,  80,  72,
-    82,  0,   0,    85,  0,   0,    73,  0,   0,    0,   455, 0,   0,   86,  87,  75,
-    0,   0,   0,    0,   88,  76,   0,   0,   89,   0,   90,  91,  92,  78,  96,  0,
-    0,   0,   93,   0,   0,   80,   0,   82,  83,   84,  85,  182, 183, 184, 185, 186,
-    187, 188, 189,  0,   86,  87,   0,   0,   0,    0,   0,   88,  0,   0,   190, 89,
-    0,   90,  91,   92,  0,   0,    0,   0,   0,    93,  0,   0,   0,   0,   0,   0,
-    0,   0,   0,    0,   0,   0,    0,   0,   0,    0,   0,   0,   0,   0,   0,   0,
-    0,   0,   0,    0,   0,   0,    0,   0,   0,    0,   0,   0,   96,  0,   0,   0,
-    191, 192, 0,    0,   0,   0,    0,   0,   0,    193};
+    40,   147, 173, 215, 279,  249, 282, 179,  180, 204, 291, 306, 308, 240,  245, 196,
+    -289, 219, 28,  248, 47,   150, 150, -292, 50,  235, 125, 54,  255, 256,  257, 421,
+    229,  198, 32,  149, 151,  171, 179, 180,  516, 236, 422, 179, 180, 141,  142, 179,
+    180,  179, 180, 299, 27,   179, 180, 179,  180, 394, 173, 295, 179, 180,  179, 180,
+    33,   1,   179, 180, 45,   423, 172, 34,   185, 186, 187, 188, 189, 35,   6,   227,
+    300,  31,  362, 353, 209,  356, 424, 234,  2,   29,  197, 265, 412, 361,  292, 239,
+    241,  243, 220, 3,   247,  8,   124, 121,  4,   210, 251, 309, 310, 150,  185, 186,
+    187,  188, 189, 36,  297,  150, 44,  43,   216, 266, 267, 237, 249, 5,    150, 150,
+    160,  226, 249, 244, 361,  185, 186, 187,  188, 189, 45,  48,  252, 253,  179, 180,
+    179,  180, 150, 150, 150,  150, 150, 150,  317, 411, 318, 150, 413, 258,  150, 425,
+    273,  274, 275, 276, 277,  278, 346, 361,  294, 289, 420, 415, 293, -289, 322, 323,
+    476,  472, 6,   468, -292, 379, 327, 328,  7,   204, 444, 128, 445, 200,  199, 199,
+    418,  324, 401, 201, 51,   333, 249, 396,  49,  8,   405, 397, 400, 481,  393, 477,
+    482,  483, 489, 419, 493,  311, 339, 341,  6,   314, 381, 182, 183, 184,  185, 186,
+    187,  188, 189, 383, 129,  453, 150, 185,  186, 187, 188, 189, 120, 500,  190, 8,
+    369,  281, 269, 288, 352,  211, 122, 150,  150, 179, 180, 326, 361, 399,  512, 509,
+    137,  366, 123, 212, 384,  237, 364, 209,  80,  296, 82,  330, 398, 428,  205, 1,
+    185,  186, 187, 188, 189,  206, 259, 86,   87,  403, 185, 186, 187, 188,  189, 126,
+    191,  192, 178, 134, 270,  271, 2,   143,  130, 193, 385, 179, 180, 272,  150, 131,
+    334,  3,   335, 357, 179,  180, 4,   185,  186, 187, 188, 189, 404, 181,  150, 38,
+    355,  135, 145, 137, 229,  39,  386, 387,  146, 388, 459, 5,   414, 200,  140, 337,
+    363,  338, 410, 201, 152,  440, 185, 186,  187, 188, 189, 441, 199, 449,  450, 153,
+    155,  229, 229, 484, 485,  185, 186, 187,  188, 189, 187, 188, 189, 156,  176, 259,
+    494,  157, 195, 150, 463,  342, 221, 343,  331, 375, 416, 376, 417, 436,  215, 437,
+    6,    451, 473, 416, 223,  438, 7,   416,  213, 452, 55,  158, 225, 56,   478, 229,
+    513,  57,  58,  159, 436,  59,  462, 8,    60,  61,  231, 317, 416, 486,  488, 232,
+    490,  340, 460, 317, 63,   495, 317, 197,  496, 64,  65,  446, 66,  67,   68,  69,
+    505,  317, 506, 514, 161,  163, 164, 165,  166, 167, 168, 169, 70,  71,   170, 72,
+    230,  245, 6,   254, 260,  233, 73,  268,  298, 304, 280, 74,  146, 261,  302, 75,
+    312,  129, 315, 316, 319,  76,  321, 329,  348, 77,  325, 332, 336, 78,   180, 344,
+    345,  347, 79,  350, 354,  80,  81,  82,   83,  84,  85,  358, 365, 367,  370, 374,
+    507,  508, 380, 395, 86,   87,  382, 402,  407, 408, 160, 88,  430, 55,   431, 89,
+    56,   90,  91,  92,  57,   58,  432, 433,  59,  93,  434, 60,  61,  62,   435, 439,
+    454,  442, 443, 447, 455,  456, 421, 63,   94,  464, 465, 466, 64,  65,   467, 66,
+    67,   68,  69,  474, 491,  470, 475, 479,  95,  487, 492, 497, 96,  503,  504, 70,
+    71,   498, 72,  517, 501,  42,  224, 502,  510, 73,  511, 218, 515, 53,   74,  313,
+    469,  429, 75,  461, 480,  41,  368, 303,  76,  372, 250, 373, 77,  238,  406, 0,
+    78,   0,   0,   290, 0,    79,  0,   0,    80,  81,  82,  83,  84,  85,   0,   0,
+    0,    0,   0,   0,   0,    0,   0,   86,   87,  0,   0,   0,   0,   0,    88,  0,
+    55,   0,   89,  56,  90,   91,  92,  57,   58,  0,   0,   0,   93,  0,    60,  61,
+    0,    0,   0,   0,   0,    283, 0,   0,    284, 0,   63,  94,  0,   0,    0,   64,
+    65,   0,   66,  67,  68,   69,  0,   0,    0,   0,   0,   95,  0,   0,    0,   96,
+    0,    0,   70,  71,  0,    72,  0,   0,    0,   0,   0,   0,   73,  0,    0,   0,
+    0,    0,   0,   0,   0,    75,  0,   0,    0,   0,   0,   76,  0,   0,    0,   77,
+    0,    0,   0,   78,  0,    0,   0,   0,    79,  0,   0,   80,  81,  82,   83,  84,
+    85,   0,   0,   0,   0,    0,   0,   0,    0,   0,   86,  87,  0,   0,    0,   0,
+    0,    88,  285, 55,  0,    89,  56,  90,   91,  92,  57,  58,  0,   0,    59,  93,
+    0,    60,  61,  0,   0,    0,   0,   0,    0,   0,   0,   0,   0,   63,   94,  0,
+    0,    0,   64,  65,  0,    66,  67,  68,   69,  0,   0,   0,   0,   0,    286, 0,
+    0,    0,   96,  0,   0,    70,  71,  0,    72,  0,   0,   0,   0,   0,    0,   73,
+    0,    0,   0,   0,   74,   0,   0,   0,    75,  0,   0,   0,   0,   0,    76,  0,
+    0,    0,   77,  0,   0,    0,   78,  0,    0,   0,   0,   79,  0,   0,    80,  81,
+    82,   83,  84,  85,  55,   0,   0,   56,   0,   0,   0,   57,  58,  86,   87,  0,
+    0,    0,   60,  61,  88,   0,   0,   0,    89,  0,   90,  91,  92,  0,    63,  0,
+    0,    0,   93,  64,  65,   0,   66,  67,   68,  69,  0,   0,   0,   0,    0,   0,
+    0,    94,  0,   0,   0,    0,   70,  71,   0,   72,  0,   0,   0,   0,    0,   0,
+    73,   95,  0,   0,   0,    96,  0,   0,    0,   75,  0,   0,   0,   0,    0,   76,
+    0,    0,   0,   77,  0,    0,   0,   78,   0,   0,   0,   0,   79,  0,    0,   80,
+    81,   82,  83,  84,  85,   55,  0,   0,    56,  0,   0,   0,   57,  58,   86,  87,
+    0,    0,   0,   60,  61,   88,  0,   0,    0,   89,  0,   90,  91,  92,   0,   63,
+    0,    0,   0,   93,  64,   65,  0,   66,   67,  68,  69,  6,   0,   0,    0,   0,
+    0,    0,   94,  0,   0,    0,   0,   70,   71,  0,   72,  0,   0,   0,    0,   0,
+    0,    73,  148, 0,   0,    0,   96,  0,    0,   0,   75,  0,   0,   0,    0,   0,
+    76,   0,   0,   0,   77,   0,   0,   0,    78,  0,   0,   0,   0,   79,   0,   0,
+    80,   81,  82,  83,  84,   85,  55,  0,    0,   56,  0,   0,   0,   57,   58,  86,
+    87,   0,   0,   0,   60,   61,  88,  0,    0,   0,   89,  0,   90,  91,   92,  0,
+    63,   0,   0,   0,   93,   64,  65,  0,    66,  67,  68,  69,  0,   0,    0,   0,
+    0,    0,   0,   94,  0,    0,   0,   0,    70,  71,  0,   72,  0,   0,    0,   0,
+    0,    0,   73,  148, 0,    0,   0,   96,   0,   0,   0,   75,  0,   0,    0,   0,
+    0,    76,  0,   0,   0,    77,  0,   56,   0,   78,  0,   57,  58,  0,    79,  0,
+    0,    80,  81,  82,  83,   84,  85,  0,    0,   0,   0,   0,   0,   0,    63,  0,
+    86,   87,  0,   64,  65,   0,   0,   88,   0,   69,  0,   89,  0,   90,   91,  92,
+    0,    0,   0,   0,   0,    93,  70,  71,   0,   72,  0,   0,   0,   0,    0,   0,
+    73,   0,   0,   0,   94,   0,   0,   0,    0,   75,  0,   0,   0,   0,    0,   76,
+    0,    0,   0,   0,   286,  56,  0,   78,   96,  57,  58,  0,   0,   0,    0,   80,
+    0,    82,  83,  84,  85,   0,   0,   0,    0,   0,   0,   0,   63,  0,    86,  87,
+    0,    64,  65,  0,   0,    88,  0,   69,   0,   89,  0,   90,  91,  92,   0,   0,
+    0,    0,   0,   93,  70,   71,  0,   72,   0,   0,   0,   6,   0,   0,    73,  0,
+    0,    0,   94,  0,   0,    0,   0,   75,   0,   0,   0,   0,   0,   76,   0,   0,
+    0,    0,   0,   56,  0,    78,  96,  57,   58,  0,   0,   0,   0,   80,   0,   82,
+    83,   84,  85,  0,   0,    0,   0,   0,    0,   0,   63,  0,   86,  87,   0,   64,
+    65,   0,   0,   88,  0,    69,  0,   89,   0,   90,  91,  92,  0,   0,    0,   0,
+    0,    93,  70,  71,  0,    72,  0,   0,    0,   0,   0,   0,   73,  0,    0,   0,
+    94,   0,   0,   0,   0,    75,  64,  65,   0,   0,   0,   76,  69,  0,    0,   0,
+    0,    56,  0,   78,  96,   57,  58,  0,    0,   70,  0,   80,  72,  82,   83,  457,
+    85,   0,   0,   377, 0,    0,   0,   0,    63,  0,   86,  87,  378, 64,   65,  0,
+    0,    88,  76,  69,  0,    89,  0,   90,   91,  92,  78,  0,   0,   0,    0,   93,
+    70,   71,  80,  72,  82,   0,   0,   85,   0,   0,   73,  0,   0,   0,    458, 0,
+    0,    86,  87,  75,  0,    0,   0,   0,    88,  76,  0,   0,   89,  0,    90,  91,
+    92,   78,  96,  0,   0,    0,   93,  0,    0,   80,  0,   82,  83,  84,   85,  182,
+    183,  184, 185, 186, 187,  188, 189, 0,    86,  87,  0,   0,   0,   0,    0,   88,
+    0,    0,   190, 89,  0,    90,  91,  92,   0,   0,   0,   0,   0,   93,   0,   0,
+    0,    0,   0,   0,   0,    0,   0,   0,    0,   0,   0,   0,   0,   0,    0,   0,
+    0,    0,   0,   0,   0,    0,   0,   0,    0,   0,   0,   0,   0,   0,    0,   0,
+    96,   0,   0,   0,   191,  192, 0,   0,    0,   0,   0,   0,   0,   193};
 
 static const short yycheck[] = {
-    7,   59,  216, 217, 159, 6,   14,  161, 6,   96,  10,  120, 44,  168, 169, 170, 44,
-    3,   12,  13,  27,  88,  45,  191, 31,  193, 118, 34,  14,  60,  61,  6,   12,  13,
-    143, 24,  192, 95,  194, 127, 12,  13,  60,  61,  199, 52,  53,  24,  12,  13,  12,
-    13,  12,  13,  66,  41,  12,  13,  112, 0,   12,  13,  12,  13,  159, 152, 12,  13,
-    12,  13,  12,  13,  58,  62,  162, 71,  3,   95,  48,  137, 282, 118, 319, 177, 25,
-    12,  13,  145, 30,  143, 98,  31,  123, 125, 90,  153, 163, 155, 12,  13,  158, 124,
-    270, 30,  272, 23,  164, 48,  202, 218, 219, 148, 280, 111, 307, 271, 353, 148, 59,
-    87,  60,  179, 180, 64,  3,   156, 280, 121, 76,  136, 148, 287, 286, 161, 165, 166,
-    329, 149, 156, 17,  18,  19,  20,  21,  85,  131, 64,  165, 166, 119, 352, 319, 118,
-    355, 185, 186, 187, 188, 189, 190, 374, 138, 163, 194, 164, 163, 197, 185, 186, 187,
-    188, 189, 190, 260, 232, 233, 194, 163, 333, 197, 160, 138, 240, 241, 161, 353, 341,
-    296, 163, 357, 162, 17,  18,  19,  20,  21,  160, 138, 162, 353, 162, 82,  162, 144,
-    161, 3,   162, 121, 317, 10,  162, 9,   162, 220, 132, 433, 162, 224, 162, 483, 161,
-    139, 107, 24,  139, 312, 14,  15,  16,  17,  18,  19,  20,  21,  3,   160, 500, 162,
-    269, 33,  298, 3,   127, 461, 462, 33,  414, 9,   161, 36,  19,  269, 162, 163, 167,
-    286, 287, 17,  18,  19,  20,  21,  17,  18,  19,  20,  21,  325, 286, 287, 379, 302,
-    3,   17,  18,  19,  20,  21,  9,   41,  338, 17,  18,  19,  20,  21,  164, 505, 151,
-    83,  84,  94,  3,   96,  159, 83,  84,  160, 92,  10,  19,  20,  21,  160, 92,  162,
-    109, 110, 93,  340, 13,  160, 74,  162, 17,  18,  19,  20,  21,  160, 151, 162, 340,
-    13,  433, 356, 25,  17,  18,  19,  20,  21,  160, 82,  162, 422, 162, 118, 356, 397,
-    17,  18,  19,  20,  21,  12,  13,  405, 406, 48,  112, 68,  461, 462, 463, 464, 160,
-    163, 162, 161, 59,  160, 76,  162, 161, 64,  475, 160, 160, 162, 428, 160, 149, 162,
-    162, 161, 101, 408, 140, 141, 160, 143, 162, 441, 44,  160, 85,  162, 161, 160, 408,
-    162, 160, 3,   162, 453, 505, 506, 161, 160, 14,  162, 162, 160, 160, 162, 3,   162,
-    161, 6,   161, 161, 470, 10,  11,  161, 423, 14,  162, 161, 17,  18,  19,  161, 160,
-    147, 161, 24,  161, 161, 10,  161, 29,  138, 163, 162, 160, 34,  35,  138, 37,  38,
-    39,  40,  3,   144, 166, 15,  161, 167, 160, 15,  10,  64,  161, 68,  53,  54,  162,
-    56,  161, 67,  161, 160, 164, 62,  63,  162, 162, 162, 162, 68,  3,   80,  13,  72,
-    161, 3,   98,  98,  164, 78,  3,   125, 36,  82,  161, 10,  81,  86,  111, 498, 499,
-    161, 91,  3,   3,   94,  95,  96,  97,  98,  99,  3,   61,  161, 3,   162, 162, 162,
-    98,  161, 109, 110, 3,   161, 161, 161, 161, 116, 152, 3,   160, 120, 6,   122, 123,
-    124, 10,  11,  161, 161, 14,  130, 161, 17,  18,  19,  10,  3,   162, 131, 131, 0,
-    162, 162, 162, 29,  145, 161, 9,   134, 34,  35,  162, 37,  38,  39,  40,  161, 33,
-    223, 129, 381, 161, 434, 425, 459, 165, 209, 8,   53,  54,  296, 56,  303, 302, 152,
-    163, 346, 195, 63,  -1,  -1,  -1,  -1,  68,  -1,  -1,  -1,  72,  -1,  -1,  -1,  -1,
-    -1,  78,  -1,  -1,  -1,  82,  -1,  -1,  -1,  86,  -1,  -1,  -1,  -1,  91,  -1,  -1,
-    94,  95,  96,  97,  98,  99,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  109, 110,
-    -1,  -1,  -1,  -1,  -1,  116, -1,  3,   -1,  120, 6,   122, 123, 124, 10,  11,  -1,
-    -1,  -1,  130, -1,  17,  18,  -1,  -1,  -1,  -1,  -1,  24,  -1,  -1,  27,  -1,  29,
-    145, -1,  -1,  -1,  34,  35,  -1,  37,  38,  39,  40,  -1,  -1,  -1,  -1,  -1,  161,
-    -1,  -1,  -1,  165, -1,  -1,  53,  54,  -1,  56,  -1,  -1,  -1,  -1,  -1,  -1,  63,
-    -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  72,  -1,  -1,  -1,  -1,  -1,  78,  -1,  -1,
-    -1,  82,  -1,  -1,  -1,  86,  -1,  -1,  -1,  -1,  91,  -1,  -1,  94,  95,  96,  97,
-    98,  99,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  109, 110, -1,  -1,  -1,  -1,
-    -1,  116, 117, 3,   -1,  120, 6,   122, 123, 124, 10,  11,  -1,  -1,  14,  130, -1,
-    17,  18,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  29,  145, -1,  -1,  -1,
-    34,  35,  -1,  37,  38,  39,  40,  -1,  -1,  -1,  -1,  -1,  161, -1,  -1,  -1,  165,
-    -1,  -1,  53,  54,  -1,  56,  -1,  -1,  -1,  -1,  -1,  -1,  63,  -1,  -1,  -1,  -1,
-    68,  -1,  -1,  -1,  72,  -1,  -1,  -1,  -1,  -1,  78,  -1,  -1,  -1,  82,  -1,  -1,
+    7,   59,  96,  44,  191, 161, 193, 12,  13,  120, 14,  216, 217, 66,  10,  88,  6,
+    44,  48,  159, 27,  60,  61,  6,   31,  3,   45,  34,  168, 169, 170, 3,   143, 6,
+    118, 60,  61,  95,  12,  13,  0,   19,  14,  12,  13,  52,  53,  12,  13,  12,  13,
+    31,  118, 12,  13,  12,  13,  319, 152, 199, 12,  13,  12,  13,  148, 25,  12,  13,
+    127, 41,  95,  87,  17,  18,  19,  20,  21,  24,  138, 137, 60,  76,  282, 270, 123,
+    272, 58,  145, 48,  119, 163, 177, 354, 280, 98,  153, 149, 155, 125, 59,  158, 161,
+    24,  162, 64,  124, 164, 218, 219, 148, 17,  18,  19,  20,  21,  62,  202, 156, 107,
+    159, 161, 179, 180, 148, 280, 85,  165, 166, 111, 136, 286, 156, 319, 17,  18,  19,
+    20,  21,  127, 3,   165, 166, 12,  13,  12,  13,  185, 186, 187, 188, 189, 190, 160,
+    353, 162, 194, 356, 162, 197, 131, 185, 186, 187, 188, 189, 190, 260, 354, 164, 194,
+    375, 358, 197, 163, 232, 233, 112, 439, 138, 435, 163, 307, 240, 241, 144, 296, 160,
+    23,  162, 3,   163, 163, 71,  162, 334, 9,   82,  162, 354, 162, 118, 161, 342, 162,
+    330, 162, 317, 143, 464, 465, 162, 90,  162, 220, 160, 160, 138, 224, 312, 14,  15,
+    16,  17,  18,  19,  20,  21,  41,  64,  416, 269, 17,  18,  19,  20,  21,  139, 487,
+    33,  161, 298, 192, 33,  194, 269, 10,  159, 286, 287, 12,  13,  121, 439, 121, 510,
+    505, 151, 164, 36,  24,  74,  286, 287, 302, 94,  160, 96,  30,  326, 380, 3,   25,
+    17,  18,  19,  20,  21,  10,  162, 109, 110, 339, 17,  18,  19,  20,  21,  93,  83,
+    84,  3,   118, 83,  84,  48,  161, 132, 92,  112, 12,  13,  92,  341, 139, 160, 59,
+    162, 13,  12,  13,  64,  17,  18,  19,  20,  21,  341, 30,  357, 3,   271, 82,  161,
+    151, 435, 9,   140, 141, 167, 143, 424, 85,  357, 3,   68,  160, 287, 162, 13,  9,
+    163, 399, 17,  18,  19,  20,  21,  162, 163, 407, 408, 149, 161, 464, 465, 466, 467,
+    17,  18,  19,  20,  21,  19,  20,  21,  161, 76,  162, 479, 161, 160, 410, 430, 160,
+    3,   162, 162, 160, 160, 162, 162, 160, 44,  162, 138, 410, 444, 160, 160, 162, 144,
+    160, 101, 162, 3,   161, 14,  6,   456, 510, 511, 10,  11,  161, 160, 14,  162, 161,
+    17,  18,  19,  160, 160, 162, 162, 24,  474, 162, 425, 160, 29,  162, 160, 163, 162,
+    34,  35,  162, 37,  38,  39,  40,  160, 160, 162, 162, 161, 161, 161, 161, 161, 161,
+    161, 161, 53,  54,  161, 56,  147, 10,  138, 162, 160, 62,  63,  3,   15,  10,  161,
+    68,  167, 166, 160, 72,  15,  64,  68,  161, 161, 78,  162, 67,  3,   82,  164, 162,
+    162, 86,  13,  162, 162, 160, 91,  80,  161, 94,  95,  96,  97,  98,  99,  3,   98,
+    164, 98,  3,   503, 504, 125, 160, 109, 110, 161, 10,  36,  81,  111, 116, 161, 3,
+    3,   120, 6,   122, 123, 124, 10,  11,  3,   3,   14,  130, 61,  17,  18,  19,  161,
+    161, 3,   162, 162, 162, 98,  161, 3,   29,  145, 161, 161, 161, 34,  35,  161, 37,
+    38,  39,  40,  160, 10,  152, 161, 161, 161, 161, 3,   162, 165, 131, 131, 53,  54,
+    162, 56,  0,   162, 9,   134, 162, 161, 63,  161, 129, 162, 33,  68,  223, 436, 382,
+    72,  427, 462, 8,   296, 209, 78,  302, 163, 303, 82,  152, 347, -1,  86,  -1,  -1,
+    195, -1,  91,  -1,  -1,  94,  95,  96,  97,  98,  99,  -1,  -1,  -1,  -1,  -1,  -1,
+    -1,  -1,  -1,  109, 110, -1,  -1,  -1,  -1,  -1,  116, -1,  3,   -1,  120, 6,   122,
+    123, 124, 10,  11,  -1,  -1,  -1,  130, -1,  17,  18,  -1,  -1,  -1,  -1,  -1,  24,
+    -1,  -1,  27,  -1,  29,  145, -1,  -1,  -1,  34,  35,  -1,  37,  38,  39,  40,  -1,
+    -1,  -1,  -1,  -1,  161, -1,  -1,  -1,  165, -1,  -1,  53,  54,  -1,  56,  -1,  -1,
+    -1,  -1,  -1,  -1,  63,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  72,  -1,  -1,  -1,
+    -1,  -1,  78,  -1,  -1,  -1,  82,  -1,  -1,  -1,  86,  -1,  -1,  -1,  -1,  91,  -1,
+    -1,  94,  95,  96,  97,  98,  99,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  109,
+    110, -1,  -1,  -1,  -1,  -1,  116, 117, 3,   -1,  120, 6,   122, 123, 124, 10,  11,
+    -1,  -1,  14,  130, -1,  17,  18,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    29,  145, -1,  -1,  -1,  34,  35,  -1,  37,  38,  39,  40,  -1,  -1,  -1,  -1,  -1,
+    161, -1,  -1,  -1,  165, -1,  -1,  53,  54,  -1,  56,  -1,  -1,  -1,  -1,  -1,  -1,
+    63,  -1,  -1,  -1,  -1,  68,  -1,  -1,  -1,  72,  -1,  -1,  -1,  -1,  -1,  78,  -1,
+    -1,  -1,  82,  -1,  -1,  -1,  86,  -1,  -1,  -1,  -1,  91,  -1,  -1,  94,  95,  96,
+    97,  98,  99,  3,   -1,  -1,  6,   -1,  -1,  -1,  10,  11,  109, 110, -1,  -1,  -1,
+    17,  18,  116, -1,  -1,  -1,  120, -1,  122, 123, 124, -1,  29,  -1,  -1,  -1,  130,
+    34,  35,  -1,  37,  38,  39,  40,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  145, -1,  -1,
+    -1,  -1,  53,  54,  -1,  56,  -1,  -1,  -1,  -1,  -1,  -1,  63,  161, -1,  -1,  -1,
+    165, -1,  -1,  -1,  72,  -1,  -1,  -1,  -1,  -1,  78,  -1,  -1,  -1,  82,  -1,  -1,
     -1,  86,  -1,  -1,  -1,  -1,  91,  -1,  -1,  94,  95,  96,  97,  98,  99,  3,   -1,
     -1,  6,   -1,  -1,  -1,  10,  11,  109, 110, -1,  -1,  -1,  17,  18,  116, -1,  -1,
     -1,  120, -1,  122, 123, 124, -1,  29,  -1,  -1,  -1,  130, 34,  35,  -1,  37,  38,
-    39,  40,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  145, -1,  -1,  -1,  -1,  53,  54,  -1,
+    39,  40,  138, -1,  -1,  -1,  -1,  -1,  -1,  145, -1,  -1,  -1,  -1,  53,  54,  -1,
     56,  -1,  -1,  -1,  -1,  -1,  -1,  63,  161, -1,  -1,  -1,  165, -1,  -1,  -1,  72,
     -1,  -1,  -1,  -1,  -1,  78,  -1,  -1,  -1,  82,  -1,  -1,  -1,  86,  -1,  -1,  -1,
     -1,  91,  -1,  -1,  94,  95,  96,  97,  98,  99,  3,   -1,  -1,  6,   -1,  -1,  -1,
     10,  11,  109, 110, -1,  -1,  -1,  17,  18,  116, -1,  -1,  -1,  120, -1,  122, 123,
-    124, -1,  29,  -1,  -1,  -1,  130, 34,  35,  -1,  37,  38,  39,  40,  138, -1,  -1,
+    124, -1,  29,  -1,  -1,  -1,  130, 34,  35,  -1,  37,  38,  39,  40,  -1,  -1,  -1,
     -1,  -1,  -1,  -1,  145, -1,  -1,  -1,  -1,  53,  54,  -1,  56,  -1,  -1,  -1,  -1,
     -1,  -1,  63,  161, -1,  -1,  -1,  165, -1,  -1,  -1,  72,  -1,  -1,  -1,  -1,  -1,
-    78,  -1,  -1,  -1,  82,  -1,  -1,  -1,  86,  -1,  -1,  -1,  -1,  91,  -1,  -1,  94,
-    95,  96,  97,  98,  99,  3,   -1,  -1,  6,   -1,  -1,  -1,  10,  11,  109, 110, -1,
-    -1,  -1,  17,  18,  116, -1,  -1,  -1,  120, -1,  122, 123, 124, -1,  29,  -1,  -1,
-    -1,  130, 34,  35,  -1,  37,  38,  39,  40,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  145,
-    -1,  -1,  -1,  -1,  53,  54,  -1,  56,  -1,  -1,  -1,  -1,  -1,  -1,  63,  161, -1,
-    -1,  -1,  165, -1,  -1,  -1,  72,  -1,  -1,  -1,  -1,  -1,  78,  -1,  -1,  -1,  82,
-    -1,  6,   -1,  86,  -1,  10,  11,  -1,  91,  -1,  -1,  94,  95,  96,  97,  98,  99,
-    -1,  -1,  -1,  -1,  -1,  -1,  -1,  29,  -1,  109, 110, -1,  34,  35,  -1,  -1,  116,
-    -1,  40,  -1,  120, -1,  122, 123, 124, -1,  -1,  -1,  -1,  -1,  130, 53,  54,  -1,
-    56,  -1,  -1,  -1,  -1,  -1,  -1,  63,  -1,  -1,  -1,  145, -1,  -1,  -1,  -1,  72,
-    -1,  -1,  -1,  -1,  -1,  78,  -1,  -1,  -1,  -1,  161, 6,   -1,  86,  165, 10,  11,
-    -1,  -1,  -1,  -1,  94,  -1,  96,  97,  98,  99,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
-    29,  -1,  109, 110, -1,  34,  35,  -1,  -1,  116, -1,  40,  -1,  120, -1,  122, 123,
-    124, -1,  -1,  -1,  -1,  -1,  130, 53,  54,  -1,  56,  -1,  -1,  -1,  138, -1,  -1,
-    63,  -1,  -1,  -1,  145, -1,  -1,  -1,  -1,  72,  -1,  -1,  -1,  -1,  -1,  78,  -1,
-    -1,  -1,  -1,  -1,  6,   -1,  86,  165, 10,  11,  -1,  -1,  -1,  -1,  94,  -1,  96,
-    97,  98,  99,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  29,  -1,  109, 110, -1,  34,  35,
-    -1,  -1,  116, -1,  40,  -1,  120, -1,  122, 123, 124, -1,  -1,  -1,  -1,  -1,  130,
-    53,  54,  -1,  56,  -1,  -1,  -1,  -1,  -1,  -1,  63,  -1,  -1,  -1,  145, -1,  -1,
-    -1,  -1,  72,  34,  35,  -1,  -1,  -1,  78,  40,  -1,  -1,  -1,  -1,  6,   -1,  86,
-    165, 10,  11,  -1,  -1,  53,  -1,  94,  56,  96,  97,  98,  99,  -1,  -1,  63,  -1,
-    -1,  -1,  -1,  29,  -1,  109, 110, 72,  34,  35,  -1,  -1,  116, 78,  40,  -1,  120,
-    -1,  122, 123, 124, 86,  -1,  -1,  -1,  -1,  130, 53,  54,  94,  56,  96,  -1,  -1,
-    99,  -1,  -1,  63,  -1,  -1,  -1,  145, -1,  -1,  109, 110, 72,  -1,  -1,  -1,  -1,
-    116, 78,  -1,  -1,  120, -1,  122, 123, 124, 86,  165, -1,  -1,  -1,  130, -1,  -1,
-    94,  -1,  96,  97,  98,  99,  14,  15,  16,  17,  18,  19,  20,  21,  -1,  109, 110,
-    -1,  -1,  -1,  -1,  -1,  116, -1,  -1,  33,  120, -1,  122, 123, 124, -1,  -1,  -1,
-    -1,  -1,  130, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    78,  -1,  -1,  -1,  82,  -1,  6,   -1,  86,  -1,  10,  11,  -1,  91,  -1,  -1,  94,
+    95,  96,  97,  98,  99,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  29,  -1,  109, 110, -1,
+    34,  35,  -1,  -1,  116, -1,  40,  -1,  120, -1,  122, 123, 124, -1,  -1,  -1,  -1,
+    -1,  130, 53,  54,  -1,  56,  -1,  -1,  -1,  -1,  -1,  -1,  63,  -1,  -1,  -1,  145,
+    -1,  -1,  -1,  -1,  72,  -1,  -1,  -1,  -1,  -1,  78,  -1,  -1,  -1,  -1,  161, 6,
+    -1,  86,  165, 10,  11,  -1,  -1,  -1,  -1,  94,  -1,  96,  97,  98,  99,  -1,  -1,
+    -1,  -1,  -1,  -1,  -1,  29,  -1,  109, 110, -1,  34,  35,  -1,  -1,  116, -1,  40,
+    -1,  120, -1,  122, 123, 124, -1,  -1,  -1,  -1,  -1,  130, 53,  54,  -1,  56,  -1,
+    -1,  -1,  138, -1,  -1,  63,  -1,  -1,  -1,  145, -1,  -1,  -1,  -1,  72,  -1,  -1,
+    -1,  -1,  -1,  78,  -1,  -1,  -1,  -1,  -1,  6,   -1,  86,  165, 10,  11,  -1,  -1,
+    -1,  -1,  94,  -1,  96,  97,  98,  99,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  29,  -1,
+    109, 110, -1,  34,  35,  -1,  -1,  116, -1,  40,  -1,  120, -1,  122, 123, 124, -1,
+    -1,  -1,  -1,  -1,  130, 53,  54,  -1,  56,  -1,  -1,  -1,  -1,  -1,  -1,  63,  -1,
+    -1,  -1,  145, -1,  -1,  -1,  -1,  72,  34,  35,  -1,  -1,  -1,  78,  40,  -1,  -1,
+    -1,  -1,  6,   -1,  86,  165, 10,  11,  -1,  -1,  53,  -1,  94,  56,  96,  97,  98,
+    99,  -1,  -1,  63,  -1,  -1,  -1,  -1,  29,  -1,  109, 110, 72,  34,  35,  -1,  -1,
+    116, 78,  40,  -1,  120, -1,  122, 123, 124, 86,  -1,  -1,  -1,  -1,  130, 53,  54,
+    94,  56,  96,  -1,  -1,  99,  -1,  -1,  63,  -1,  -1,  -1,  145, -1,  -1,  109, 110,
+    72,  -1,  -1,  -1,  -1,  116, 78,  -1,  -1,  120, -1,  122, 123, 124, 86,  165, -1,
+    -1,  -1,  130, -1,  -1,  94,  -1,  96,  97,  98,  99,  14,  15,  16,  17,  18,  19,
+    20,  21,  -1,  109, 110, -1,  -1,  -1,  -1,  -1,  116, -1,  -1,  33,  120, -1,  122,
+    123, 124, -1,  -1,  -1,  -1,  -1,  130, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
-    -1,  -1,  -1,  165, -1,  -1,  -1,  83,  84,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  92};
+    -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  165, -1,  -1,  -1,  83,  84,  -1,  -1,  -1,
+    -1,  -1,  -1,  -1,  92};
 
 #line 325 "/usr/local/mapd-deps/20210608/lib/bison.cc"
 /* fattrs + tables */
@@ -2836,40 +2838,58 @@ YY_Parser_PARSE_PARAM_DEF
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new InsertValuesStmt(
-              (yyvsp[-5].stringval)->release(),
-              (yyvsp[-4].slistval)->release(),
-              reinterpret_cast<std::list<Expr*>*>((yyvsp[-1].listval)->release())));
+              (yyvsp[-3].stringval)->release(),
+              (yyvsp[-2].slistval)->release(),
+              reinterpret_cast<std::list<ValuesList*>*>((yyvsp[0].listval)->release())));
       ;
       break;
     }
     case 87: {
-      yyval.boolval = false;
+      yyval.listval = TrackedListPtr<Node>::make(
+          lexer.parsed_node_list_tokens_,
+          1,
+          TrackedPtr<Node>::make(
+              lexer.parsed_node_tokens_,
+              new ValuesList(
+                  reinterpret_cast<std::list<Expr*>*>((yyvsp[-1].listval)->release()))));
       ;
       break;
     }
     case 88: {
-      yyval.boolval = false;
+      yyval.listval = yyvsp[-4].listval;
+      yyval.listval->push_back(new ValuesList(
+          reinterpret_cast<std::list<Expr*>*>((yyvsp[-1].listval)->release())));
       ;
       break;
     }
     case 89: {
-      yyval.boolval = true;
+      yyval.boolval = false;
       ;
       break;
     }
     case 90: {
+      yyval.boolval = false;
+      ;
+      break;
+    }
+    case 91: {
+      yyval.boolval = true;
+      ;
+      break;
+    }
+    case 92: {
       yyval.listval =
           TrackedListPtr<Node>::make(lexer.parsed_node_list_tokens_, 1, yyvsp[0].nodeval);
       ;
       break;
     }
-    case 91: {
+    case 93: {
       yyval.listval = yyvsp[-2].listval;
       yyval.listval->push_back(yyvsp[0].nodeval);
       ;
       break;
     }
-    case 92: {
+    case 94: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new Assignment((yyvsp[-2].stringval)->release(),
@@ -2877,7 +2897,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 93: {
+    case 95: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new UpdateStmt(
@@ -2887,39 +2907,39 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 94: {
+    case 96: {
       yyval.nodeval = TrackedPtr<Node>::makeEmpty();
       ;
       break;
     }
-    case 95: {
+    case 97: {
       yyval.nodeval = yyvsp[0].nodeval;
       ;
       break;
     }
-    case 96: {
+    case 98: {
       yyval.intval = yyvsp[0].intval;
       if (yyval.intval <= 0)
         throw std::runtime_error("LIMIT must be positive.");
       ;
       break;
     }
-    case 97: {
+    case 99: {
       yyval.intval = 0; /* 0 means ALL */
       ;
       break;
     }
-    case 98: {
+    case 100: {
       yyval.intval = 0; /* 0 means ALL */
       ;
       break;
     }
-    case 99: {
+    case 101: {
       yyval.intval = yyvsp[0].intval;
       ;
       break;
     }
-    case 100: {
+    case 102: {
       if (!boost::iequals(*(yyvsp[0].stringval)->get(), "row") &&
           !boost::iequals(*(yyvsp[0].stringval)->get(), "rows"))
         throw std::runtime_error("Invalid word in OFFSET clause " +
@@ -2929,12 +2949,12 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 101: {
+    case 103: {
       yyval.intval = 0;
       ;
       break;
     }
-    case 102: {
+    case 104: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new SelectStmt(
@@ -2945,12 +2965,12 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 103: {
+    case 105: {
       yyval.nodeval = yyvsp[0].nodeval;
       ;
       break;
     }
-    case 104: {
+    case 106: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new UnionQuery(false,
@@ -2959,7 +2979,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 105: {
+    case 107: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new UnionQuery(true,
@@ -2968,17 +2988,17 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 106: {
+    case 108: {
       yyval.nodeval = yyvsp[0].nodeval;
       ;
       break;
     }
-    case 107: {
+    case 109: {
       yyval.nodeval = yyvsp[-1].nodeval;
       ;
       break;
     }
-    case 108: {
+    case 110: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new QuerySpec(
@@ -2991,40 +3011,40 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 109: {
+    case 111: {
       yyval.listval = yyvsp[0].listval;
       ;
       break;
     }
-    case 110: {
+    case 112: {
       yyval.listval = TrackedListPtr<Node>::makeEmpty(); /* nullptr means SELECT * */
       ;
       break;
     }
-    case 111: {
+    case 113: {
       yyval.listval = yyvsp[0].listval;
       ;
       break;
     }
-    case 112: {
+    case 114: {
       yyval.listval =
           TrackedListPtr<Node>::make(lexer.parsed_node_list_tokens_, 1, yyvsp[0].nodeval);
       ;
       break;
     }
-    case 113: {
+    case 115: {
       yyval.listval = yyvsp[-2].listval;
       yyval.listval->push_back(yyvsp[0].nodeval);
       ;
       break;
     }
-    case 114: {
+    case 116: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_, new TableRef((yyvsp[0].stringval)->release()));
       ;
       break;
     }
-    case 115: {
+    case 117: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_,
                                  new TableRef((yyvsp[-1].stringval)->release(),
@@ -3032,44 +3052,44 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 116: {
+    case 118: {
       yyval.nodeval = yyvsp[0].nodeval;
       ;
       break;
     }
-    case 117: {
+    case 119: {
       yyval.listval = TrackedListPtr<Node>::makeEmpty();
       ;
       break;
     }
-    case 118: {
+    case 120: {
       yyval.listval = yyvsp[0].listval;
       ;
       break;
     }
-    case 119: {
+    case 121: {
       yyval.listval =
           TrackedListPtr<Node>::make(lexer.parsed_node_list_tokens_, 1, yyvsp[0].nodeval);
       ;
       break;
     }
-    case 120: {
+    case 122: {
       yyval.listval = yyvsp[-2].listval;
       yyval.listval->push_back(yyvsp[0].nodeval);
       ;
       break;
     }
-    case 121: {
+    case 123: {
       yyval.nodeval = TrackedPtr<Node>::makeEmpty();
       ;
       break;
     }
-    case 122: {
+    case 124: {
       yyval.nodeval = yyvsp[0].nodeval;
       ;
       break;
     }
-    case 123: {
+    case 125: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new OperExpr(kOR,
@@ -3078,7 +3098,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 124: {
+    case 126: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new OperExpr(kAND,
@@ -3087,7 +3107,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 125: {
+    case 127: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new OperExpr(
@@ -3095,18 +3115,8 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 126: {
-      yyval.nodeval = yyvsp[-1].nodeval;
-      ;
-      break;
-    }
-    case 127: {
-      yyval.nodeval = yyvsp[0].nodeval;
-      ;
-      break;
-    }
     case 128: {
-      yyval.nodeval = yyvsp[0].nodeval;
+      yyval.nodeval = yyvsp[-1].nodeval;
       ;
       break;
     }
@@ -3146,6 +3156,16 @@ YY_Parser_PARSE_PARAM_DEF
       break;
     }
     case 136: {
+      yyval.nodeval = yyvsp[0].nodeval;
+      ;
+      break;
+    }
+    case 137: {
+      yyval.nodeval = yyvsp[0].nodeval;
+      ;
+      break;
+    }
+    case 138: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new OperExpr(yyvsp[-1].opval,
@@ -3154,7 +3174,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 137: {
+    case 139: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new OperExpr(yyvsp[-1].opval,
@@ -3165,7 +3185,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 138: {
+    case 140: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new BetweenExpr(true,
@@ -3175,7 +3195,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 139: {
+    case 141: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new BetweenExpr(false,
@@ -3185,7 +3205,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 140: {
+    case 142: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new LikeExpr(true,
@@ -3196,7 +3216,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 141: {
+    case 143: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new LikeExpr(false,
@@ -3207,7 +3227,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 142: {
+    case 144: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new LikeExpr(true,
@@ -3218,7 +3238,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 143: {
+    case 145: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new LikeExpr(false,
@@ -3229,12 +3249,12 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 144: {
+    case 146: {
       yyval.nodeval = TrackedPtr<Node>::makeEmpty();
       ;
       break;
     }
-    case 145: {
+    case 147: {
       std::string escape_tok = *(yyvsp[-1].stringval)->get();
       std::transform(escape_tok.begin(), escape_tok.end(), escape_tok.begin(), ::tolower);
       if (escape_tok != "escape") {
@@ -3245,21 +3265,21 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 146: {
+    case 148: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new IsNullExpr(true, dynamic_cast<Expr*>((yyvsp[-3].nodeval)->release())));
       ;
       break;
     }
-    case 147: {
+    case 149: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new IsNullExpr(false, dynamic_cast<Expr*>((yyvsp[-2].nodeval)->release())));
       ;
       break;
     }
-    case 148: {
+    case 150: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new InSubquery(true,
@@ -3268,7 +3288,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 149: {
+    case 151: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new InSubquery(false,
@@ -3277,7 +3297,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 150: {
+    case 152: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new InValues(
@@ -3287,7 +3307,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 151: {
+    case 153: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new InValues(
@@ -3297,19 +3317,19 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 152: {
+    case 154: {
       yyval.listval =
           TrackedListPtr<Node>::make(lexer.parsed_node_list_tokens_, 1, yyvsp[0].nodeval);
       ;
       break;
     }
-    case 153: {
+    case 155: {
       yyval.listval = yyvsp[-2].listval;
       yyval.listval->push_back(yyvsp[0].nodeval);
       ;
       break;
     }
-    case 154: {
+    case 156: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new OperExpr(yyvsp[-2].opval,
@@ -3319,7 +3339,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 155: {
+    case 157: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new OperExpr(yyvsp[-2].opval,
@@ -3329,31 +3349,31 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 156: {
+    case 158: {
       yyval.opval = yyvsp[0].opval;
       ;
       break;
     }
-    case 157: {
+    case 159: {
       yyval.opval = yyvsp[0].opval;
       ;
       break;
     }
-    case 161: {
+    case 163: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new ExistsExpr(dynamic_cast<QuerySpec*>((yyvsp[0].nodeval)->release())));
       ;
       break;
     }
-    case 162: {
+    case 164: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new SubqueryExpr(dynamic_cast<QuerySpec*>((yyvsp[-1].nodeval)->release())));
       ;
       break;
     }
-    case 163: {
+    case 165: {
       yyval.listval = TrackedListPtr<Node>::make(
           lexer.parsed_node_list_tokens_,
           1,
@@ -3362,7 +3382,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 164: {
+    case 166: {
       yyval.listval = yyvsp[-4].listval;
       yyval.listval->push_back(
           new ExprPair(dynamic_cast<Expr*>((yyvsp[-2].nodeval)->release()),
@@ -3370,17 +3390,17 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 165: {
+    case 167: {
       yyval.nodeval = yyvsp[0].nodeval;
       ;
       break;
     }
-    case 166: {
+    case 168: {
       yyval.nodeval = TrackedPtr<Node>::makeEmpty();
       ;
       break;
     }
-    case 167: {
+    case 169: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new CaseExpr(
@@ -3389,7 +3409,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 168: {
+    case 170: {
       std::list<ExprPair*>* when_then_list = new std::list<ExprPair*>(
           1,
           new ExprPair(dynamic_cast<Expr*>((yyvsp[-5].nodeval)->release()),
@@ -3401,7 +3421,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 169: {
+    case 171: {
       std::list<ExprPair*>* when_then_list = new std::list<ExprPair*>(
           1,
           new ExprPair(dynamic_cast<Expr*>((yyvsp[-3].nodeval)->release()),
@@ -3411,21 +3431,21 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 170: {
+    case 172: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new CharLengthExpr(dynamic_cast<Expr*>((yyvsp[-1].nodeval)->release()), true));
       ;
       break;
     }
-    case 171: {
+    case 173: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new CharLengthExpr(dynamic_cast<Expr*>((yyvsp[-1].nodeval)->release()), false));
       ;
       break;
     }
-    case 172: {
+    case 174: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new OperExpr(kARRAY_AT,
@@ -3434,7 +3454,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 173: {
+    case 175: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new OperExpr(kPLUS,
@@ -3443,7 +3463,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 174: {
+    case 176: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new OperExpr(kMINUS,
@@ -3452,7 +3472,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 175: {
+    case 177: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new OperExpr(kMULTIPLY,
@@ -3461,7 +3481,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 176: {
+    case 178: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new OperExpr(kDIVIDE,
@@ -3470,7 +3490,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 177: {
+    case 179: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new OperExpr(kMODULO,
@@ -3479,7 +3499,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 178: {
+    case 180: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new OperExpr(kMODULO,
@@ -3488,12 +3508,12 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 179: {
+    case 181: {
       yyval.nodeval = yyvsp[0].nodeval;
       ;
       break;
     }
-    case 180: {
+    case 182: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new OperExpr(
@@ -3501,27 +3521,27 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 181: {
+    case 183: {
       yyval.nodeval = yyvsp[0].nodeval;
       ;
       break;
     }
-    case 182: {
+    case 184: {
       yyval.nodeval = yyvsp[0].nodeval;
       ;
       break;
     }
-    case 183: {
+    case 185: {
       yyval.nodeval = yyvsp[0].nodeval;
       ;
       break;
     }
-    case 184: {
+    case 186: {
       yyval.nodeval = yyvsp[-1].nodeval;
       ;
       break;
     }
-    case 185: {
+    case 187: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new CastExpr(dynamic_cast<Expr*>((yyvsp[-3].nodeval)->release()),
@@ -3529,34 +3549,34 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 186: {
+    case 188: {
       yyval.nodeval = yyvsp[0].nodeval;
       ;
       break;
     }
-    case 187: {
+    case 189: {
       yyval.nodeval = yyvsp[0].nodeval;
       ;
       break;
     }
-    case 188: {
+    case 190: {
       yyval.nodeval = yyvsp[0].nodeval;
       ;
       break;
     }
-    case 189: {
+    case 191: {
       throw std::runtime_error("Empty select entry");
       ;
       break;
     }
-    case 190: {
+    case 192: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new SelectEntry(dynamic_cast<Expr*>((yyvsp[0].nodeval)->release()), nullptr));
       ;
       break;
     }
-    case 191: {
+    case 193: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new SelectEntry(dynamic_cast<Expr*>((yyvsp[-1].nodeval)->release()),
@@ -3564,7 +3584,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 192: {
+    case 194: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new SelectEntry(dynamic_cast<Expr*>((yyvsp[-2].nodeval)->release()),
@@ -3572,41 +3592,41 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 193: {
+    case 195: {
       throw std::runtime_error("Empty select entry list");
       ;
       break;
     }
-    case 194: {
+    case 196: {
       yyval.listval =
           TrackedListPtr<Node>::make(lexer.parsed_node_list_tokens_, 1, yyvsp[0].nodeval);
       ;
       break;
     }
-    case 195: {
+    case 197: {
       yyval.listval = yyvsp[-2].listval;
       yyval.listval->push_back(yyvsp[0].nodeval);
       ;
       break;
     }
-    case 196: {
+    case 198: {
       yyval.nodeval = yyvsp[0].nodeval;
       ;
       break;
     }
-    case 197: {
+    case 199: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new UserLiteral());
       ;
       break;
     }
-    case 198: {
+    case 200: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_, new FunctionRef((yyvsp[-3].stringval)->release()));
       ;
       break;
     }
-    case 199: {
+    case 201: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new FunctionRef((yyvsp[-4].stringval)->release(),
@@ -3615,7 +3635,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 200: {
+    case 202: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new FunctionRef((yyvsp[-4].stringval)->release(),
@@ -3623,7 +3643,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 201: {
+    case 203: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new FunctionRef((yyvsp[-3].stringval)->release(),
@@ -3631,50 +3651,50 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 202: {
+    case 204: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_, new StringLiteral((yyvsp[0].stringval)->release()));
       ;
       break;
     }
-    case 203: {
+    case 205: {
       yyval.nodeval = TrackedPtr<Node>::make(lexer.parsed_node_tokens_,
                                              new IntLiteral(yyvsp[0].intval));
       ;
       break;
     }
-    case 204: {
+    case 206: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new TimestampLiteral());
       ;
       break;
     }
-    case 205: {
+    case 207: {
       delete dynamic_cast<Expr*>((yyvsp[-1].nodeval)->release());
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new TimestampLiteral());
       ;
       break;
     }
-    case 206: {
+    case 208: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_, new FixedPtLiteral((yyvsp[0].stringval)->release()));
       ;
       break;
     }
-    case 207: {
+    case 209: {
       yyval.nodeval = TrackedPtr<Node>::make(lexer.parsed_node_tokens_,
                                              new FloatLiteral(yyvsp[0].floatval));
       ;
       break;
     }
-    case 208: {
+    case 210: {
       yyval.nodeval = TrackedPtr<Node>::make(lexer.parsed_node_tokens_,
                                              new DoubleLiteral(yyvsp[0].doubleval));
       ;
       break;
     }
-    case 209: {
+    case 211: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new CastExpr(new StringLiteral((yyvsp[0].stringval)->release()),
@@ -3682,7 +3702,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 210: {
+    case 212: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new ArrayLiteral(
@@ -3690,7 +3710,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 211: {
+    case 213: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new ArrayLiteral(
@@ -3698,30 +3718,30 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 212: {
+    case 214: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new NullLiteral());
       ;
       break;
     }
-    case 213: {
+    case 215: {
       yyval.listval =
           TrackedListPtr<Node>::make(lexer.parsed_node_list_tokens_, 1, yyvsp[0].nodeval);
       ;
       break;
     }
-    case 214: {
+    case 216: {
       yyval.listval = yyvsp[-2].listval;
       yyval.listval->push_back(yyvsp[0].nodeval);
       ;
       break;
     }
-    case 215: {
+    case 217: {
       yyval.listval = TrackedListPtr<Node>::make(lexer.parsed_node_list_tokens_, 0);
       ;
       break;
     }
-    case 217: {
+    case 219: {
       const auto uc_col_name =
           boost::to_upper_copy<std::string>(*(yyvsp[0].stringval)->get());
       if (reserved_keywords.find(uc_col_name) != reserved_keywords.end()) {
@@ -3732,241 +3752,241 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 218: {
+    case 220: {
       yyval.stringval = yyvsp[0].stringval;
       ;
       break;
     }
-    case 219: {
+    case 221: {
       yyval.nodeval = TrackedPtr<Node>::makeEmpty();
       ;
       break;
     }
-    case 225: {
+    case 227: {
       yyval.slistval = TrackedListPtr<std::string>::make(
           lexer.parsed_str_list_tokens_, 1, yyvsp[0].stringval);
       ;
       break;
     }
-    case 226: {
+    case 228: {
       yyval.slistval = yyvsp[-2].slistval;
       yyval.slistval->push_back(yyvsp[0].stringval);
       ;
       break;
     }
-    case 229: {
+    case 231: {
       yyval.slistval = TrackedListPtr<std::string>::make(
           lexer.parsed_str_list_tokens_, 1, yyvsp[0].stringval);
       ;
       break;
     }
-    case 230: {
+    case 232: {
       yyval.slistval = yyvsp[-2].slistval;
       yyval.slistval->push_back(yyvsp[0].stringval);
       ;
       break;
     }
-    case 233: {
+    case 235: {
       yyval.slistval = TrackedListPtr<std::string>::make(
           lexer.parsed_str_list_tokens_, 1, yyvsp[0].stringval);
       ;
       break;
     }
-    case 234: {
+    case 236: {
       yyval.slistval = yyvsp[-2].slistval;
       yyval.slistval->push_back(yyvsp[0].stringval);
       ;
       break;
     }
-    case 235: {
+    case 237: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "ALL");
       ;
       break;
     }
-    case 236: {
+    case 238: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "ALL");
       ;
       break;
     }
-    case 237: {
+    case 239: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "CREATE");
       ;
       break;
     }
-    case 238: {
+    case 240: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "SELECT");
       ;
       break;
     }
-    case 239: {
+    case 241: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "INSERT");
       ;
       break;
     }
-    case 240: {
+    case 242: {
       yyval.stringval =
           TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "TRUNCATE");
       ;
       break;
     }
-    case 241: {
+    case 243: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "UPDATE");
       ;
       break;
     }
-    case 242: {
+    case 244: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "DELETE");
       ;
       break;
     }
-    case 243: {
+    case 245: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "ALTER");
       ;
       break;
     }
-    case 244: {
+    case 246: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "DROP");
       ;
       break;
     }
-    case 245: {
+    case 247: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "VIEW");
       ;
       break;
     }
-    case 246: {
+    case 248: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "EDIT");
       ;
       break;
     }
-    case 247: {
+    case 249: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "ACCESS");
       ;
       break;
     }
-    case 248: {
+    case 250: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "USAGE");
       ;
       break;
     }
-    case 249: {
+    case 251: {
       yyval.stringval =
           TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "SERVER USAGE");
       ;
       break;
     }
-    case 250: {
+    case 252: {
       yyval.stringval =
           TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "ALTER SERVER");
       ;
       break;
     }
-    case 251: {
+    case 253: {
       yyval.stringval =
           TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "CREATE SERVER");
       ;
       break;
     }
-    case 252: {
+    case 254: {
       yyval.stringval =
           TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "CREATE TABLE");
       ;
       break;
     }
-    case 253: {
+    case 255: {
       yyval.stringval =
           TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "CREATE VIEW");
       ;
       break;
     }
-    case 254: {
+    case 256: {
       yyval.stringval =
           TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "SELECT VIEW");
       ;
       break;
     }
-    case 255: {
+    case 257: {
       yyval.stringval =
           TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "DROP VIEW");
       ;
       break;
     }
-    case 256: {
+    case 258: {
       yyval.stringval =
           TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "DROP SERVER");
       ;
       break;
     }
-    case 257: {
+    case 259: {
       yyval.stringval =
           TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "CREATE DASHBOARD");
       ;
       break;
     }
-    case 258: {
+    case 260: {
       yyval.stringval =
           TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "EDIT DASHBOARD");
       ;
       break;
     }
-    case 259: {
+    case 261: {
       yyval.stringval =
           TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "VIEW DASHBOARD");
       ;
       break;
     }
-    case 260: {
+    case 262: {
       yyval.stringval =
           TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "DELETE DASHBOARD");
       ;
       break;
     }
-    case 261: {
+    case 263: {
       yyval.stringval =
           TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "VIEW SQL EDITOR");
       ;
       break;
     }
-    case 262: {
+    case 264: {
       yyval.stringval =
           TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "DATABASE");
       ;
       break;
     }
-    case 263: {
+    case 265: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "TABLE");
       ;
       break;
     }
-    case 264: {
+    case 266: {
       yyval.stringval =
           TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "DASHBOARD");
       ;
       break;
     }
-    case 265: {
+    case 267: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "VIEW");
       ;
       break;
     }
-    case 266: {
+    case 268: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_, "SERVER");
       ;
       break;
     }
-    case 268: {
+    case 270: {
       yyval.stringval = TrackedPtr<std::string>::make(lexer.parsed_str_tokens_,
                                                       std::to_string(yyvsp[0].intval));
       ;
       break;
     }
-    case 269: {
+    case 271: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_, new ColumnRef((yyvsp[0].stringval)->release()));
       ;
       break;
     }
-    case 270: {
+    case 272: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_,
                                  new ColumnRef((yyvsp[-2].stringval)->release(),
@@ -3974,161 +3994,161 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 271: {
+    case 273: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new ColumnRef((yyvsp[-2].stringval)->release(), nullptr));
       ;
       break;
     }
-    case 272: {
+    case 274: {
       if (yyvsp[0].intval < 0)
         throw std::runtime_error("No negative number in type definition.");
       yyval.intval = yyvsp[0].intval;
       ;
       break;
     }
-    case 273: {
+    case 275: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new SQLType(kBIGINT));
       ;
       break;
     }
-    case 274: {
+    case 276: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new SQLType(kTEXT));
       ;
       break;
     }
-    case 275: {
+    case 277: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new SQLType(kBOOLEAN));
       ;
       break;
     }
-    case 276: {
+    case 278: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new SQLType(kCHAR));
       ;
       break;
     }
-    case 277: {
+    case 279: {
       yyval.nodeval = TrackedPtr<Node>::make(lexer.parsed_node_tokens_,
                                              new SQLType(kCHAR, yyvsp[-1].intval));
       ;
       break;
     }
-    case 278: {
+    case 280: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new SQLType(kNUMERIC));
       ;
       break;
     }
-    case 279: {
+    case 281: {
       yyval.nodeval = TrackedPtr<Node>::make(lexer.parsed_node_tokens_,
                                              new SQLType(kNUMERIC, yyvsp[-1].intval));
       ;
       break;
     }
-    case 280: {
+    case 282: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new SQLType(kNUMERIC, yyvsp[-3].intval, yyvsp[-1].intval, false));
       ;
       break;
     }
-    case 281: {
+    case 283: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new SQLType(kDECIMAL));
       ;
       break;
     }
-    case 282: {
+    case 284: {
       yyval.nodeval = TrackedPtr<Node>::make(lexer.parsed_node_tokens_,
                                              new SQLType(kDECIMAL, yyvsp[-1].intval));
       ;
       break;
     }
-    case 283: {
+    case 285: {
       yyval.nodeval = TrackedPtr<Node>::make(
           lexer.parsed_node_tokens_,
           new SQLType(kDECIMAL, yyvsp[-3].intval, yyvsp[-1].intval, false));
       ;
       break;
     }
-    case 284: {
+    case 286: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new SQLType(kINT));
       ;
       break;
     }
-    case 285: {
+    case 287: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new SQLType(kTINYINT));
       ;
       break;
     }
-    case 286: {
+    case 288: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new SQLType(kSMALLINT));
       ;
       break;
     }
-    case 287: {
+    case 289: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new SQLType(kFLOAT));
       ;
       break;
     }
-    case 288: {
+    case 290: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new SQLType(kFLOAT));
       ;
       break;
     }
-    case 289: {
+    case 291: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new SQLType(kDOUBLE));
       ;
       break;
     }
-    case 290: {
+    case 292: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new SQLType(kDOUBLE));
       ;
       break;
     }
-    case 291: {
+    case 293: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new SQLType(kDATE));
       ;
       break;
     }
-    case 292: {
+    case 294: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new SQLType(kTIME));
       ;
       break;
     }
-    case 293: {
+    case 295: {
       yyval.nodeval = TrackedPtr<Node>::make(lexer.parsed_node_tokens_,
                                              new SQLType(kTIME, yyvsp[-1].intval));
       ;
       break;
     }
-    case 294: {
+    case 296: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new SQLType(kTIMESTAMP));
       ;
       break;
     }
-    case 295: {
+    case 297: {
       yyval.nodeval = TrackedPtr<Node>::make(lexer.parsed_node_tokens_,
                                              new SQLType(kTIMESTAMP, yyvsp[-1].intval));
       ;
       break;
     }
-    case 296: {
+    case 298: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_,
                                  new SQLType(static_cast<SQLTypes>(yyvsp[0].intval),
@@ -4138,12 +4158,12 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 297: {
+    case 299: {
       yyval.nodeval = yyvsp[0].nodeval;
       ;
       break;
     }
-    case 298: {
+    case 300: {
       yyval.nodeval = yyvsp[-2].nodeval;
       if (dynamic_cast<SQLType*>((yyval.nodeval)->get())->get_is_array())
         throw std::runtime_error("array of array not supported.");
@@ -4151,7 +4171,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 299: {
+    case 301: {
       yyval.nodeval = yyvsp[-3].nodeval;
       if (dynamic_cast<SQLType*>((yyval.nodeval)->get())->get_is_array())
         throw std::runtime_error("array of array not supported.");
@@ -4160,27 +4180,27 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 300: {
+    case 302: {
       yyval.intval = kPOINT;
       ;
       break;
     }
-    case 301: {
+    case 303: {
       yyval.intval = kLINESTRING;
       ;
       break;
     }
-    case 302: {
+    case 304: {
       yyval.intval = kPOLYGON;
       ;
       break;
     }
-    case 303: {
+    case 305: {
       yyval.intval = kMULTIPOLYGON;
       ;
       break;
     }
-    case 304: {
+    case 306: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_,
                                  new SQLType(static_cast<SQLTypes>(yyvsp[-1].intval),
@@ -4190,7 +4210,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 305: {
+    case 307: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_,
                                  new SQLType(static_cast<SQLTypes>(yyvsp[-3].intval),
@@ -4200,7 +4220,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 306: {
+    case 308: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_,
                                  new SQLType(static_cast<SQLTypes>(yyvsp[-1].intval),
@@ -4210,7 +4230,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 307: {
+    case 309: {
       yyval.nodeval =
           TrackedPtr<Node>::make(lexer.parsed_node_tokens_,
                                  new SQLType(static_cast<SQLTypes>(yyvsp[-3].intval),
@@ -4220,7 +4240,7 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 308: {
+    case 310: {
       const auto uc_col_name =
           boost::to_upper_copy<std::string>(*(yyvsp[0].stringval)->get());
       if (reserved_keywords.find(uc_col_name) != reserved_keywords.end()) {
@@ -4231,12 +4251,12 @@ YY_Parser_PARSE_PARAM_DEF
       ;
       break;
     }
-    case 309: {
+    case 311: {
       yyval.stringval = yyvsp[0].stringval;
       ;
       break;
     }
-    case 310: {
+    case 312: {
       yyval.stringval = yyvsp[0].stringval;
       ;
       break;
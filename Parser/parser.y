@@ -424,12 +424,22 @@ delete_statement:
 	;
 
 insert_statement:
-		INSERT INTO table opt_column_commalist VALUES '(' atom_commalist ')'
+		INSERT INTO table opt_column_commalist VALUES values_list_commalist
 		{
-			$<nodeval>$ = TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new InsertValuesStmt(($<stringval>3)->release(), ($<slistval>4)->release(), reinterpret_cast<std::list<Expr*>*>(($<listval>7)->release())));
+			$<nodeval>$ = TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new InsertValuesStmt(($<stringval>3)->release(), ($<slistval>4)->release(), reinterpret_cast<std::list<ValuesList*>*>(($<listval>6)->release())));
 		}
 	;
 
+values_list_commalist:
+		'(' atom_commalist ')'
+	{ $<listval>$ = TrackedListPtr<Node>::make(lexer.parsed_node_list_tokens_, 1, TrackedPtr<Node>::make(lexer.parsed_node_tokens_, new ValuesList(reinterpret_cast<std::list<Expr*>*>(($<listval>2)->release())))); }
+	|	values_list_commalist ',' '(' atom_commalist ')'
+	{
+		$<listval>$ = $<listval>1;
+		$<listval>$->push_back(new ValuesList(reinterpret_cast<std::list<Expr*>*>(($<listval>4)->release())));
+	}
+	;
+
 opt_all_distinct:
 		/* empty */ { $<boolval>$ = false; }
 	|	ALL { $<boolval>$ = false; }
@@ -177,28 +177,10 @@ using null_type_t = typename null_type<TYPE>::type;
 
 template <typename C_TYPE,
           typename ARROW_TYPE = typename arrow::CTypeTraits<C_TYPE>::ArrowType>
-void convert_column(ResultSetPtr result,
-                    size_t col,
-                    size_t entry_count,
-                    std::shared_ptr<arrow::Array>& out) {
-  CHECK(sizeof(C_TYPE) == result->getColType(col).get_size());
-
-  std::shared_ptr<arrow::Buffer> values;
+void make_numeric_array(const std::shared_ptr<arrow::Buffer>& values,
+                        const size_t entry_count,
+                        std::shared_ptr<arrow::Array>& out) {
   std::shared_ptr<arrow::Buffer> is_valid;
-  const int64_t buf_size = entry_count * sizeof(C_TYPE);
-  if (result->isZeroCopyColumnarConversionPossible(col)) {
-    values.reset(new ResultSetBuffer(
-        reinterpret_cast<const uint8_t*>(result->getColumnarBuffer(col)),
-        buf_size,
-        result));
-  } else {
-    auto res = arrow::AllocateBuffer(buf_size);
-    CHECK(res.ok());
-    values = std::move(res).ValueOrDie();
-    result->copyColumnIntoBuffer(
-        col, reinterpret_cast<int8_t*>(values->mutable_data()), buf_size);
-  }
-
   int64_t null_count = 0;
   auto res = arrow::AllocateBuffer((entry_count + 7) / 8);
   CHECK(res.ok());
@@ -264,6 +246,76 @@ void convert_column(ResultSetPtr result,
   }
 }
 
+template <typename C_TYPE>
+void convert_column(ResultSetPtr result,
+                    size_t col,
+                    size_t entry_count,
+                    std::shared_ptr<arrow::Array>& out) {
+  CHECK(sizeof(C_TYPE) == result->getColType(col).get_size());
+
+  std::shared_ptr<arrow::Buffer> values;
+  const int64_t buf_size = entry_count * sizeof(C_TYPE);
+  if (result->isZeroCopyColumnarConversionPossible(col)) {
+    values.reset(new ResultSetBuffer(
+        reinterpret_cast<const uint8_t*>(result->getColumnarBuffer(col)),
+        buf_size,
+        result));
+  } else {
+    auto res = arrow::AllocateBuffer(buf_size);
+    CHECK(res.ok());
+    values = std::move(res).ValueOrDie();
+    result->copyColumnIntoBuffer(
+        col, reinterpret_cast<int8_t*>(values->mutable_data()), buf_size);
+  }
+
+  make_numeric_array<C_TYPE>(values, entry_count, out);
+}
+
+// Builds the array of a lazily fetched column from the chunk buffers it was fetched
+// from. If the selected rows are consecutive in a single chunk, the array references
+// the chunk memory, otherwise the runs of selected rows are compacted into a new buffer.
+// Returns false if some rows are not backed by a chunk.
+template <typename C_TYPE>
+bool convert_lazy_column(ResultSetPtr result,
+                         size_t col,
+                         size_t entry_count,
+                         std::shared_ptr<arrow::Array>& out) {
+  CHECK(sizeof(C_TYPE) == result->getColType(col).get_size());
+
+  const auto runs = result->getLazyColumnRuns(col, entry_count);
+  if (!runs) {
+    return false;
+  }
+  size_t row_count = 0;
+  for (const auto& run : *runs) {
+    row_count += run.row_count;
+  }
+
+  std::shared_ptr<arrow::Buffer> values;
+  const int64_t buf_size = row_count * sizeof(C_TYPE);
+  if (runs->size() == 1) {
+    const auto& run = runs->front();
+    values.reset(new ResultSetBuffer(
+        reinterpret_cast<const uint8_t*>(run.col_buffer) + run.start_row * sizeof(C_TYPE),
+        buf_size,
+        result));
+  } else {
+    auto trace_scope = TRACE_SCOPE("convert_lazy_column copy runs");
+    auto res = arrow::AllocateBuffer(buf_size);
+    CHECK(res.ok());
+    values = std::move(res).ValueOrDie();
+    auto dest = values->mutable_data();
+    for (const auto& run : *runs) {
+      const auto run_size = run.row_count * sizeof(C_TYPE);
+      memcpy(dest, run.col_buffer + run.start_row * sizeof(C_TYPE), run_size);
+      dest += run_size;
+    }
+  }
+
+  make_numeric_array<C_TYPE>(values, row_count, out);
+  return true;
+}
+
 #ifndef _MSC_VER
 std::pair<key_t, void*> get_shm(size_t shmsz) {
   if (!shmsz) {
@@ -797,6 +849,56 @@ std::shared_ptr<arrow::RecordBatch> ArrowResultSetConverter::getArrowBatch(
   std::vector<std::shared_ptr<ValueArray>> column_values(col_count, nullptr);
   std::vector<std::shared_ptr<std::vector<bool>>> null_bitmaps(col_count, nullptr);
   const bool multithreaded = entry_count > 10000 && !results_->isTruncated();
+
+  // Lazily fetched columns of plain projections are built from the chunks they were
+  // fetched from rather than decoded row by row.
+  std::vector<bool> chunk_cols(col_count, false);
+  if (results_->getQueryDescriptionType() == QueryDescriptionType::Projection &&
+      results_->isPermutationBufferEmpty() && results_->areAnyColumnsLazyFetched()) {
+    auto timer = DEBUG_TIMER("lazy column converter");
+    const auto& lazy_fetch_info = results_->getLazyFetchInfo();
+    auto convert_lazy_col = [&](const size_t col) -> bool {
+      switch (builders[col].physical_type) {
+        case kTINYINT:
+          return convert_lazy_column<int8_t>(
+              results_, col, entry_count, result_columns[col]);
+        case kSMALLINT:
+          return convert_lazy_column<int16_t>(
+              results_, col, entry_count, result_columns[col]);
+        case kINT:
+          return convert_lazy_column<int32_t>(
+              results_, col, entry_count, result_columns[col]);
+        case kBIGINT:
+          return convert_lazy_column<int64_t>(
+              results_, col, entry_count, result_columns[col]);
+        case kFLOAT:
+          return convert_lazy_column<float>(
+              results_, col, entry_count, result_columns[col]);
+        case kDOUBLE:
+          return convert_lazy_column<double>(
+              results_, col, entry_count, result_columns[col]);
+        default:
+          return false;
+      }
+    };
+    std::vector<std::future<bool>> child_threads(col_count);
+    for (size_t i = 0; i < col_count; ++i) {
+      if (lazy_fetch_info[i].is_lazily_fetched &&
+          lazy_fetch_info[i].type.get_compression() == kENCODING_NONE) {
+        child_threads[i] =
+            std::async(multithreaded ? std::launch::async : std::launch::deferred,
+                       convert_lazy_col,
+                       i);
+      }
+    }
+    for (size_t i = 0; i < col_count; ++i) {
+      if (child_threads[i].valid() && child_threads[i].get()) {
+        chunk_cols[i] = true;
+        row_count = result_columns[i]->length();
+      }
+    }
+  }
+
   // Don't believe we ever output directly from a table function, but this
   // might be possible with a future query plan optimization
   bool use_columnar_converter = results_->isDirectColumnarConversionPossible() &&
@@ -871,7 +973,23 @@ std::shared_ptr<arrow::RecordBatch> ArrowResultSetConverter::getArrowBatch(
     }
     row_count = entry_count;
   }
-  if (!use_columnar_converter || !non_lazy_cols.empty()) {
+
+  // The row converter fills the columns no other converter took care of.
+  std::vector<bool> converted_cols(col_count,
+                                   use_columnar_converter && non_lazy_cols.empty());
+  for (size_t i = 0; i < col_count; ++i) {
+    if (chunk_cols[i] || (!non_lazy_cols.empty() && non_lazy_cols[i])) {
+      converted_cols[i] = true;
+    }
+  }
+  const bool use_row_converter =
+      std::find(converted_cols.begin(), converted_cols.end(), false) !=
+      converted_cols.end();
+  if (std::find(converted_cols.begin(), converted_cols.end(), true) ==
+      converted_cols.end()) {
+    converted_cols.clear();
+  }
+  if (use_row_converter) {
     auto timer = DEBUG_TIMER("row converter");
     row_count = 0;
     if (multithreaded) {
@@ -889,7 +1007,7 @@ std::shared_ptr<arrow::RecordBatch> ArrowResultSetConverter::getArrowBatch(
                                            fetch,
                                            std::ref(column_value_segs[i]),
                                            std::ref(null_bitmap_segs[i]),
-                                           non_lazy_cols,
+                                           converted_cols,
                                            start_entry,
                                            end_entry));
       }
@@ -899,7 +1017,7 @@ std::shared_ptr<arrow::RecordBatch> ArrowResultSetConverter::getArrowBatch(
       {
         auto timer = DEBUG_TIMER("append rows to arrow");
         for (int i = 0; i < schema->num_fields(); ++i) {
-          if (!non_lazy_cols.empty() && non_lazy_cols[i]) {
+          if (!converted_cols.empty() && converted_cols[i]) {
             continue;
           }
 
@@ -913,11 +1031,11 @@ std::shared_ptr<arrow::RecordBatch> ArrowResultSetConverter::getArrowBatch(
       }
     } else {
       row_count =
-          fetch(column_values, null_bitmaps, non_lazy_cols, size_t(0), entry_count);
+          fetch(column_values, null_bitmaps, converted_cols, size_t(0), entry_count);
       {
         auto timer = DEBUG_TIMER("append rows to arrow single thread");
         for (int i = 0; i < schema->num_fields(); ++i) {
-          if (!non_lazy_cols.empty() && non_lazy_cols[i]) {
+          if (!converted_cols.empty() && converted_cols[i]) {
             continue;
           }
 
@@ -929,7 +1047,7 @@ std::shared_ptr<arrow::RecordBatch> ArrowResultSetConverter::getArrowBatch(
     {
       auto timer = DEBUG_TIMER("finish builders");
       for (size_t i = 0; i < col_count; ++i) {
-        if (!non_lazy_cols.empty() && non_lazy_cols[i]) {
+        if (!converted_cols.empty() && converted_cols[i]) {
           continue;
         }
 
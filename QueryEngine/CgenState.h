@@ -28,6 +28,8 @@
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/Transforms/Utils/ValueMapper.h>
 
+#include <cstring>
+
 struct ArrayLoadCodegen {
   llvm::Value* buffer;
   llvm::Value* size;
@@ -206,6 +208,15 @@ struct CgenState {
 
   const std::unordered_map<int, LiteralValues>& getLiterals() const { return literals_; }
 
+  // Adds an array of 64-bit values to the hoisted literals. Returns the offset of its
+  // slot, which holds the offset and length in bytes of the array in the literal buffer.
+  size_t getOrAddInt64ArrayLiteral(const std::vector<int64_t>& values,
+                                   const int device_id) {
+    std::vector<int8_t> bytes(values.size() * sizeof(int64_t));
+    std::memcpy(bytes.data(), values.data(), bytes.size());
+    return getOrAddLiteral(std::make_pair(bytes, 64), device_id);
+  }
+
   llvm::Value* addStringConstant(const std::string& str) {
     llvm::Value* str_lv = ir_builder_.CreateGlobalString(
         str, "str_const_" + std::to_string(std::hash<std::string>()(str)));
@@ -447,6 +447,9 @@ class CodeGenerator {
 
   llvm::Value* resolveGroupedColumnReference(const Analyzer::ColumnVar*);
 
+  std::vector<llvm::Value*> groupedColumnValues(const Analyzer::ColumnVar*,
+                                                llvm::Value* grouped_col_lv);
+
   llvm::Value* colByteStream(const Analyzer::ColumnVar* col_var,
                              const bool fetch_column,
                              const bool hoist_literals);
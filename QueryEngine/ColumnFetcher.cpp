@@ -350,6 +350,7 @@ const int8_t* ColumnFetcher::getAllTableColumnFragments(
 
 const int8_t* ColumnFetcher::getResultSetColumn(
     const InputColDescriptor* col_desc,
+    const Fragmenter_Namespace::FragmentInfo& fragment,
     const Data_Namespace::MemoryLevel memory_level,
     const int device_id,
     DeviceAllocator* device_allocator,
@@ -359,6 +360,7 @@ const int8_t* ColumnFetcher::getResultSetColumn(
   return getResultSetColumn(get_temporary_table(executor_->temporary_tables_, table_id),
                             table_id,
                             col_desc->getColId(),
+                            fragment,
                             memory_level,
                             device_id,
                             device_allocator,
@@ -1104,10 +1106,21 @@ const int8_t* ColumnFetcher::getResultSetColumn(
     const ResultSetPtr& buffer,
     const int table_id,
     const int col_id,
+    const Fragmenter_Namespace::FragmentInfo& fragment,
     const Data_Namespace::MemoryLevel memory_level,
     const int device_id,
     DeviceAllocator* device_allocator,
     const size_t thread_idx) const {
+  if (fragment.resultSetEntryCount) {
+    return getResultSetBatchColumn(buffer,
+                                   table_id,
+                                   col_id,
+                                   fragment,
+                                   memory_level,
+                                   device_id,
+                                   device_allocator,
+                                   thread_idx);
+  }
   const ColumnarResults* result{nullptr};
   {
     std::lock_guard<std::mutex> columnar_conversion_guard(columnar_fetch_mutex_);
@@ -1134,3 +1147,50 @@ const int8_t* ColumnFetcher::getResultSetColumn(
   return transferColumnIfNeeded(
       result, col_id, executor_->getDataMgr(), memory_level, device_id, device_allocator);
 }
+
+const int8_t* ColumnFetcher::getResultSetBatchColumn(
+    const ResultSetPtr& buffer,
+    const int table_id,
+    const int col_id,
+    const Fragmenter_Namespace::FragmentInfo& fragment,
+    const Data_Namespace::MemoryLevel memory_level,
+    const int device_id,
+    DeviceAllocator* device_allocator,
+    const size_t thread_idx) const {
+  CHECK(buffer);
+  const auto frag_id = fragment.fragmentId;
+  std::shared_ptr<const ColumnarResults> result;
+  {
+    std::lock_guard<std::mutex> columnar_conversion_guard(columnar_fetch_mutex_);
+    const auto& frag_id_to_result = columnarized_table_cache_[table_id];
+    const auto it = frag_id_to_result.find(frag_id);
+    if (it != frag_id_to_result.end()) {
+      result = it->second;
+    }
+  }
+  if (!result) {
+    // Batches are columnarized outside of the fetch mutex, so the kernels of a step
+    // convert their own ranges concurrently.
+    std::vector<SQLTypeInfo> col_types;
+    for (size_t i = 0; i < buffer->colCount(); ++i) {
+      col_types.push_back(get_logical_type_info(buffer->getColType(i)));
+    }
+    result = std::make_shared<const ColumnarResults>(
+        executor_->row_set_mem_owner_,
+        *buffer,
+        fragment.resultSetEntryOffset,
+        fragment.resultSetEntryOffset + fragment.resultSetEntryCount,
+        col_types,
+        executor_->executor_id_,
+        thread_idx);
+    std::lock_guard<std::mutex> columnar_conversion_guard(columnar_fetch_mutex_);
+    result = columnarized_table_cache_[table_id].emplace(frag_id, result).first->second;
+  }
+  CHECK_GE(col_id, 0);
+  return transferColumnIfNeeded(result.get(),
+                                col_id,
+                                executor_->getDataMgr(),
+                                memory_level,
+                                device_id,
+                                device_allocator);
+}
@@ -96,6 +96,7 @@ class ColumnFetcher {
       const size_t thread_idx) const;
 
   const int8_t* getResultSetColumn(const InputColDescriptor* col_desc,
+                                   const Fragmenter_Namespace::FragmentInfo& fragment,
                                    const Data_Namespace::MemoryLevel memory_level,
                                    const int device_id,
                                    DeviceAllocator* device_allocator,
@@ -172,11 +173,22 @@ class ColumnFetcher {
   const int8_t* getResultSetColumn(const ResultSetPtr& buffer,
                                    const int table_id,
                                    const int col_id,
+                                   const Fragmenter_Namespace::FragmentInfo& fragment,
                                    const Data_Namespace::MemoryLevel memory_level,
                                    const int device_id,
                                    DeviceAllocator* device_allocator,
                                    const size_t thread_idx) const;
 
+  const int8_t* getResultSetBatchColumn(
+      const ResultSetPtr& buffer,
+      const int table_id,
+      const int col_id,
+      const Fragmenter_Namespace::FragmentInfo& fragment,
+      const Data_Namespace::MemoryLevel memory_level,
+      const int device_id,
+      DeviceAllocator* device_allocator,
+      const size_t thread_idx) const;
+
   Executor* executor_;
   mutable std::mutex columnar_fetch_mutex_;
   mutable std::mutex varlen_chunk_fetch_mutex_;
@@ -152,7 +152,7 @@ std::vector<llvm::Value*> CodeGenerator::codegenColVar(const Analyzer::ColumnVar
   }
   const auto grouped_col_lv = resolveGroupedColumnReference(col_var);
   if (grouped_col_lv) {
-    return {grouped_col_lv};
+    return groupedColumnValues(col_var, grouped_col_lv);
   }
   const int local_col_id = plan_state_->getLocalColumnId(col_var, fetch_column);
   const auto window_func_context =
@@ -429,7 +429,7 @@ std::vector<llvm::Value*> CodeGenerator::codegenOuterJoinNullPlaceholder(
   AUTOMATIC_IR_METADATA(cgen_state_);
   const auto grouped_col_lv = resolveGroupedColumnReference(col_var);
   if (grouped_col_lv) {
-    return {grouped_col_lv};
+    return groupedColumnValues(col_var, grouped_col_lv);
   }
   const auto outer_join_args_bb = llvm::BasicBlock::Create(
       cgen_state_->context_, "outer_join_args", cgen_state_->current_func_);
@@ -495,6 +495,20 @@ llvm::Value* CodeGenerator::resolveGroupedColumnReference(
   return nullptr;
 }
 
+// Expands the cached value of a grouped column. None encoded strings are cached as their
+// packed pointer and length, which is unpacked the same way as for a fetched column.
+std::vector<llvm::Value*> CodeGenerator::groupedColumnValues(
+    const Analyzer::ColumnVar* col_var,
+    llvm::Value* grouped_col_lv) {
+  const auto& col_ti = col_var->get_type_info();
+  if (col_ti.is_string() && col_ti.get_compression() == kENCODING_NONE) {
+    return {grouped_col_lv,
+            cgen_state_->emitCall("extract_str_ptr", {grouped_col_lv}),
+            cgen_state_->emitCall("extract_str_len", {grouped_col_lv})};
+  }
+  return {grouped_col_lv};
+}
+
 // returns the byte stream argument and the position for the given column
 llvm::Value* CodeGenerator::colByteStream(const Analyzer::ColumnVar* col_var,
                                           const bool fetch_column,
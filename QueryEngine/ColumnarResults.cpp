@@ -22,6 +22,7 @@
 #include "Shared/likely.h"
 #include "Shared/thread_count.h"
 
+#include <algorithm>
 #include <atomic>
 #include <future>
 #include <numeric>
@@ -87,6 +88,105 @@ ColumnarResults::ColumnarResults(std::shared_ptr<RowSetMemoryOwner> row_set_mem_
   }
 }
 
+ColumnarResults::ColumnarResults(std::shared_ptr<RowSetMemoryOwner> row_set_mem_owner,
+                                 const ResultSet& rows,
+                                 const size_t entry_begin,
+                                 const size_t entry_end,
+                                 const std::vector<SQLTypeInfo>& target_types,
+                                 const size_t executor_id,
+                                 const size_t thread_idx)
+    : column_buffers_(target_types.size())
+    , num_rows_(0)
+    , target_types_(target_types)
+    , parallel_conversion_(false)
+    , direct_columnar_conversion_(rows.isDirectColumnarConversionPossible())
+    , thread_idx_(thread_idx) {
+  auto timer = DEBUG_TIMER(__func__);
+  CHECK_LE(entry_begin, entry_end);
+  CHECK_LE(entry_end, rows.entryCount());
+  CHECK(rows.isPermutationBufferEmpty());
+  executor_ = Executor::getExecutor(executor_id);
+  CHECK(executor_);
+  const auto num_columns = target_types.size();
+  for (size_t i = entry_begin; i < entry_end; ++i) {
+    if (!rows.isRowAtEmpty(i)) {
+      ++num_rows_;
+    }
+  }
+  // Columns stored contiguously in the result set are used in place, as long as the
+  // range has no empty entries. Targets set in `targets_to_skip` aren't decoded through
+  // the result set iterator.
+  const bool is_dense_range = num_rows_ == entry_end - entry_begin;
+  std::vector<bool> targets_to_skip(num_columns, false);
+  for (size_t i = 0; i < num_columns; ++i) {
+    const bool is_varlen = target_types[i].is_array() ||
+                           (target_types[i].is_string() &&
+                            target_types[i].get_compression() == kENCODING_NONE) ||
+                           target_types[i].is_geometry();
+    if (is_varlen) {
+      throw ColumnarConversionNotSupported();
+    }
+    if (is_dense_range && rows.isZeroCopyColumnarConversionPossible(i)) {
+      column_buffers_[i] = const_cast<int8_t*>(rows.getColumnarBuffer(i)) +
+                           entry_begin * target_types[i].get_size();
+      targets_to_skip[i] = true;
+    } else {
+      column_buffers_[i] = row_set_mem_owner->allocate(
+          num_rows_ * target_types[i].get_size(), thread_idx_);
+    }
+  }
+
+  // Single slot targets of group by results are read directly from the storage.
+  const bool is_direct_group_by =
+      isDirectColumnarConversionPossible() &&
+      (rows.getQueryDescriptionType() == QueryDescriptionType::GroupByPerfectHash ||
+       rows.getQueryDescriptionType() == QueryDescriptionType::GroupByBaselineHash);
+  std::vector<size_t> slot_idx_per_target_idx;
+  std::vector<bool> direct_targets;
+  std::vector<WriteFunction> write_functions;
+  std::vector<ReadFunction> read_functions;
+  if (is_direct_group_by) {
+    slot_idx_per_target_idx = rows.getSlotIndicesForTargetIndices();
+    direct_targets = std::get<0>(rows.getSupportedSingleSlotTargetBitmap());
+    std::tie(write_functions, read_functions) =
+        initAllConversionFunctions(rows, slot_idx_per_target_idx, direct_targets);
+    targets_to_skip = direct_targets;
+  }
+  const bool has_iterated_targets =
+      std::find(targets_to_skip.begin(), targets_to_skip.end(), false) !=
+      targets_to_skip.end();
+  if (!has_iterated_targets && !is_direct_group_by) {
+    return;
+  }
+
+  size_t row_idx = 0;
+  for (size_t i = entry_begin; i < entry_end; ++i) {
+    if (rows.isRowAtEmpty(i)) {
+      continue;
+    }
+    if (has_iterated_targets) {
+      const auto crt_row = rows.getRowAtNoTranslations(i, targets_to_skip);
+      for (size_t col_idx = 0; col_idx < num_columns; ++col_idx) {
+        if (!targets_to_skip[col_idx]) {
+          writeBackCell(crt_row[col_idx], row_idx, col_idx);
+        }
+      }
+    }
+    for (size_t col_idx = 0; col_idx < direct_targets.size(); ++col_idx) {
+      if (direct_targets[col_idx]) {
+        write_functions[col_idx](rows,
+                                 i,
+                                 row_idx,
+                                 col_idx,
+                                 slot_idx_per_target_idx[col_idx],
+                                 read_functions[col_idx]);
+      }
+    }
+    ++row_idx;
+  }
+  CHECK_EQ(row_idx, num_rows_);
+}
+
 ColumnarResults::ColumnarResults(std::shared_ptr<RowSetMemoryOwner> row_set_mem_owner,
                                  const int8_t* one_col_buffer,
                                  const size_t num_rows,
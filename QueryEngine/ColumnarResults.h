@@ -68,6 +68,16 @@ class ColumnarResults {
                   const size_t thread_idx,
                   const bool is_parallel_execution_enforced = false);
 
+  // Columnarizes the rows in the result set entries [entry_begin, entry_end), the range
+  // of one fragment of a temporary table split into batches.
+  ColumnarResults(const std::shared_ptr<RowSetMemoryOwner> row_set_mem_owner,
+                  const ResultSet& rows,
+                  const size_t entry_begin,
+                  const size_t entry_end,
+                  const std::vector<SQLTypeInfo>& target_types,
+                  const size_t executor_id,
+                  const size_t thread_idx);
+
   ColumnarResults(const std::shared_ptr<RowSetMemoryOwner> row_set_mem_owner,
                   const int8_t* one_col_buffer,
                   const size_t num_rows,
@@ -18,6 +18,7 @@
 
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
 #include <llvm/ExecutionEngine/JITEventListener.h>
+#include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
 
 #include <memory>
@@ -63,6 +64,13 @@ class CpuCompilationContext : public CompilationContext {
   CpuCompilationContext(ExecutionEngineWrapper&& execution_engine)
       : execution_engine_(std::move(execution_engine)) {}
 
+  // For code compiled from a module of its own LLVM context, which has to outlive the
+  // execution engine.
+  CpuCompilationContext(std::unique_ptr<llvm::LLVMContext> llvm_context,
+                        ExecutionEngineWrapper&& execution_engine)
+      : llvm_context_(std::move(llvm_context))
+      , execution_engine_(std::move(execution_engine)) {}
+
   void setFunctionPointer(llvm::Function* function) {
     func_ = execution_engine_->getPointerToFunction(function);
     CHECK(func_);
@@ -81,5 +89,6 @@ class CpuCompilationContext : public CompilationContext {
 
  private:
   void* func_{nullptr};
+  std::unique_ptr<llvm::LLVMContext> llvm_context_;
   ExecutionEngineWrapper execution_engine_;
 };
@@ -21,7 +21,9 @@
 
 enum class ExecutorDeviceType { CPU, GPU };
 
-enum class ExecutorOptLevel { Default, ReductionJIT };
+// LightJIT skips the IR optimizations and compiles for a fast first run, see
+// g_enable_tiered_compilation.
+enum class ExecutorOptLevel { Default, ReductionJIT, LightJIT };
 
 enum class ExecutorExplainType { Default, Optimized };
 
@@ -207,6 +207,14 @@ inline std::vector<int8_t> get_col_byte_widths(const T& col_expr_list) {
       }
       const auto agg_info = get_target_info(col_expr, g_bigint_count);
       const auto chosen_type = get_compact_type(agg_info);
+      if constexpr (std::is_same<T, std::list<std::shared_ptr<Analyzer::Expr>>>::value) {
+        // none encoded string group by keys are replaced by their string key arena key
+        if (chosen_type.is_string() && chosen_type.get_compression() == kENCODING_NONE) {
+          col_widths.push_back(sizeof(int64_t));
+          ++col_expr_idx;
+          continue;
+        }
+      }
       if ((chosen_type.is_string() && chosen_type.get_compression() == kENCODING_NONE) ||
           chosen_type.is_array()) {
         col_widths.push_back(sizeof(int64_t));
@@ -483,6 +491,7 @@ QueryMemoryDescriptor::QueryMemoryDescriptor(
     , is_table_function_(false)
     , use_streaming_top_n_(use_streaming_top_n)
     , force_4byte_float_(false)
+    , paged_perfect_hash_(false)
     , col_slot_context_(col_slot_context) {
   CHECK(!(query_desc_type_ == QueryDescriptionType::TableFunction));
   col_slot_context_.setAllUnsetSlotsPaddedSize(8);
@@ -558,7 +567,8 @@ QueryMemoryDescriptor::QueryMemoryDescriptor()
     , must_use_baseline_sort_(false)
     , is_table_function_(false)
     , use_streaming_top_n_(false)
-    , force_4byte_float_(false) {}
+    , force_4byte_float_(false)
+    , paged_perfect_hash_(false) {}
 
 QueryMemoryDescriptor::QueryMemoryDescriptor(const Executor* executor,
                                              const size_t entry_count,
@@ -582,7 +592,8 @@ QueryMemoryDescriptor::QueryMemoryDescriptor(const Executor* executor,
     , must_use_baseline_sort_(false)
     , is_table_function_(is_table_function)
     , use_streaming_top_n_(false)
-    , force_4byte_float_(false) {}
+    , force_4byte_float_(false)
+    , paged_perfect_hash_(false) {}
 
 QueryMemoryDescriptor::QueryMemoryDescriptor(const QueryDescriptionType query_desc_type,
                                              const int64_t min_val,
@@ -608,7 +619,8 @@ QueryMemoryDescriptor::QueryMemoryDescriptor(const QueryDescriptionType query_de
     , must_use_baseline_sort_(false)
     , is_table_function_(false)
     , use_streaming_top_n_(false)
-    , force_4byte_float_(false) {}
+    , force_4byte_float_(false)
+    , paged_perfect_hash_(false) {}
 
 bool QueryMemoryDescriptor::operator==(const QueryMemoryDescriptor& other) const {
   // Note that this method does not check ptr reference members (e.g. executor_) or
@@ -628,6 +640,9 @@ bool QueryMemoryDescriptor::operator==(const QueryMemoryDescriptor& other) const
   if (force_4byte_float_ != other.force_4byte_float_) {
     return false;
   }
+  if (paged_perfect_hash_ != other.paged_perfect_hash_) {
+    return false;
+  }
   if (group_col_widths_ != other.group_col_widths_) {
     return false;
   }
@@ -1010,9 +1025,23 @@ size_t QueryMemoryDescriptor::getBufferSizeBytes(
     const size_t n = ra_exe_unit.sort_info.offset + ra_exe_unit.sort_info.limit;
     return streaming_top_n::get_heap_size(getRowSize(), n, thread_count);
   }
+  if (paged_perfect_hash_) {
+    CHECK(device_type == ExecutorDeviceType::CPU);
+    return getBufferSizeBytes(device_type, entry_count_) + getPagedBufferTrailerBytes();
+  }
   return getBufferSizeBytes(device_type, entry_count_);
 }
 
+size_t QueryMemoryDescriptor::getPageCount() const {
+  constexpr size_t page_entry_count{size_t(1) << PAGED_GROUP_BY_PAGE_BITS};
+  return (entry_count_ + page_entry_count - 1) / page_entry_count;
+}
+
+size_t QueryMemoryDescriptor::getPagedBufferTrailerBytes() const {
+  CHECK(paged_perfect_hash_);
+  return getRowSize() + align_to_int64(getPageCount());
+}
+
 /**
  * Returns total amount of output buffer memory for each device (CPU/GPU)
  *
@@ -1239,6 +1268,7 @@ std::string QueryMemoryDescriptor::toString() const {
   str += "\tRender Output: " + ::toString(render_output_) + "\n";
   str += "\tUse Baseline Sort: " + ::toString(must_use_baseline_sort_) + "\n";
   str += "\tIs Table Function: " + ::toString(is_table_function_) + "\n";
+  str += "\tPaged Perfect Hash: " + ::toString(paged_perfect_hash_) + "\n";
   return str;
 }
 
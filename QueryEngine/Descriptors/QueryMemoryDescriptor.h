@@ -279,6 +279,14 @@ class QueryMemoryDescriptor {
   bool forceFourByteFloat() const { return force_4byte_float_; }
   void setForceFourByteFloat(const bool val) { force_4byte_float_ = val; }
 
+  // Row-wise perfect hash buffers initialized page by page on first touch, see
+  // init_group_by_buffer_page in RuntimeFunctions.cpp for the layout.
+  bool usesPagedPerfectHash() const { return paged_perfect_hash_; }
+  void setPagedPerfectHash(const bool val) { paged_perfect_hash_ = val; }
+  size_t getPageCount() const;
+  // The template row and the page flags which follow the entries of a paged buffer.
+  size_t getPagedBufferTrailerBytes() const;
+
   // Getters derived from state
   size_t getGroupbyColCount() const { return group_col_widths_.size(); }
   size_t getKeyCount() const { return keyless_hash_ ? 0 : getGroupbyColCount(); }
@@ -379,6 +387,7 @@ class QueryMemoryDescriptor {
   bool use_streaming_top_n_;
 
   bool force_4byte_float_;
+  bool paged_perfect_hash_;
 
   ColSlotContext col_slot_context_;
 
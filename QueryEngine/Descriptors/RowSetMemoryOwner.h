@@ -30,6 +30,7 @@
 #include "DataMgr/DataMgr.h"
 #include "Logger/Logger.h"
 #include "QueryEngine/StringDictionaryGenerations.h"
+#include "QueryEngine/StringKeyArena.h"
 #include "Shared/quantile.h"
 #include "StringDictionary/StringDictionaryProxy.h"
 
@@ -155,6 +156,15 @@ class RowSetMemoryOwner final : public SimpleAllocator, boost::noncopyable {
     return lit_str_dict_proxy_.get();
   }
 
+  // Returns the arena interning the none encoded string group by keys of the query.
+  StringKeyArena* getStringKeyArena() {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    if (!string_key_arena_) {
+      string_key_arena_ = std::make_unique<StringKeyArena>();
+    }
+    return string_key_arena_.get();
+  }
+
   void addColBuffer(const void* col_buffer) {
     std::lock_guard<std::mutex> lock(state_mutex_);
     col_buffers_.push_back(const_cast<void*>(col_buffer));
@@ -215,6 +225,7 @@ class RowSetMemoryOwner final : public SimpleAllocator, boost::noncopyable {
   std::vector<void*> col_buffers_;
   std::vector<Data_Namespace::AbstractBuffer*> varlen_input_buffers_;
   std::vector<std::unique_ptr<quantile::TDigest>> t_digests_;
+  std::unique_ptr<StringKeyArena> string_key_arena_;
 
   size_t arena_block_size_;  // for cloning
   std::vector<std::unique_ptr<Arena>> allocators_;
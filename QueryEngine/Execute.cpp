@@ -58,12 +58,15 @@
 #include "QueryEngine/QueryRewrite.h"
 #include "QueryEngine/QueryTemplateGenerator.h"
 #include "QueryEngine/ResultSetReductionJIT.h"
+#include "QueryEngine/ResultSetSpill.h"
 #include "QueryEngine/RuntimeFunctions.h"
+#include "QueryEngine/SharedScan.h"
 #include "QueryEngine/SpeculativeTopN.h"
 #include "QueryEngine/StringDictionaryGenerations.h"
 #include "QueryEngine/TableFunctions/TableFunctionCompilationContext.h"
 #include "QueryEngine/TableFunctions/TableFunctionExecutionContext.h"
 #include "QueryEngine/Visitors/TransientStringLiteralsVisitor.h"
+#include "Shared/Metrics.h"
 #include "Shared/SystemParameters.h"
 #include "Shared/TypedDataAccessors.h"
 #include "Shared/checked_alloc.h"
@@ -77,7 +80,18 @@ bool g_enable_watchdog{false};
 bool g_enable_dynamic_watchdog{false};
 bool g_enable_cpu_sub_tasks{false};
 size_t g_cpu_sub_task_size{500'000};
+bool g_enable_cpu_morsel_execution{false};
+size_t g_cpu_morsel_size{100'000};
+bool g_enable_shared_scans{false};
+size_t g_shared_scan_block_size{65'536};
+bool g_enable_batched_intermediate_results{false};
+bool g_enable_spill_to_disk{false};
+size_t g_spill_threshold_bytes{0};  // 0 means derived from the buffer pool limits
+std::string g_spill_directory;      // empty means the system temporary directory
 bool g_enable_filter_function{true};
+bool g_enable_vectorized_filter{false};
+bool g_enable_tiered_compilation{false};
+size_t g_tiered_compilation_max_rows{1'000'000};
 unsigned g_dynamic_watchdog_time_limit{10000};
 bool g_allow_cpu_retry{true};
 bool g_allow_query_step_cpu_retry{true};
@@ -95,6 +109,7 @@ size_t g_filter_push_down_passing_row_ubound{0};
 bool g_enable_columnar_output{false};
 bool g_enable_left_join_filter_hoisting{true};
 bool g_optimize_row_initialization{true};
+bool g_enable_paged_perfect_hash{false};
 bool g_enable_overlaps_hashjoin{true};
 bool g_enable_distance_rangejoin{true};
 bool g_enable_hashjoin_many_to_many{false};
@@ -995,6 +1010,11 @@ ResultSetPtr Executor::reduceMultiDeviceResultSets(
 
   const auto& first = results_per_device.front().first;
 
+  int64_t compilation_queue_time = 0;
+  const auto reduction_code =
+      get_reduction_code(results_per_device, &compilation_queue_time);
+
+  bool reduced_with_spill{false};
   if (query_mem_desc.getQueryDescriptionType() ==
           QueryDescriptionType::GroupByBaselineHash &&
       results_per_device.size() > 1) {
@@ -1007,41 +1027,57 @@ ResultSetPtr Executor::reduceMultiDeviceResultSets(
           return init + r->getQueryMemDesc().getEntryCount();
         });
     CHECK(total_entry_count);
-    auto query_mem_desc = first->getQueryMemDesc();
-    query_mem_desc.setEntryCount(total_entry_count);
-    reduced_results = std::make_shared<ResultSet>(first->getTargetInfos(),
-                                                  ExecutorDeviceType::CPU,
-                                                  query_mem_desc,
-                                                  row_set_mem_owner,
-                                                  catalog_,
-                                                  blockSize(),
-                                                  gridSize());
-    auto result_storage = reduced_results->allocateStorage(plan_state_->init_agg_vals_);
-    reduced_results->initializeStorage();
-    switch (query_mem_desc.getEffectiveKeyWidth()) {
-      case 4:
-        first->getStorage()->moveEntriesToBuffer<int32_t>(
-            result_storage->getUnderlyingBuffer(), query_mem_desc.getEntryCount());
-        break;
-      case 8:
-        first->getStorage()->moveEntriesToBuffer<int64_t>(
-            result_storage->getUnderlyingBuffer(), query_mem_desc.getEntryCount());
-        break;
-      default:
-        CHECK(false);
+    const auto spill_threshold = result_set::get_spill_threshold_bytes(catalog_);
+    if (spill_threshold &&
+        total_entry_count * first->getQueryMemDesc().getRowSize() > spill_threshold) {
+      std::vector<ResultSet*> result_sets;
+      for (auto& result : results_per_device) {
+        result_sets.push_back(result.first.get());
+      }
+      reduced_results =
+          ResultSetManager::reduceBaselineWithSpill(result_sets,
+                                                    reduction_code,
+                                                    row_set_mem_owner,
+                                                    plan_state_->init_agg_vals_,
+                                                    spill_threshold);
+      reduced_with_spill = reduced_results != nullptr;
+    }
+    if (!reduced_with_spill) {
+      auto query_mem_desc = first->getQueryMemDesc();
+      query_mem_desc.setEntryCount(total_entry_count);
+      reduced_results = std::make_shared<ResultSet>(first->getTargetInfos(),
+                                                    ExecutorDeviceType::CPU,
+                                                    query_mem_desc,
+                                                    row_set_mem_owner,
+                                                    catalog_,
+                                                    blockSize(),
+                                                    gridSize());
+      auto result_storage =
+          reduced_results->allocateStorage(plan_state_->init_agg_vals_);
+      reduced_results->initializeStorage();
+      switch (query_mem_desc.getEffectiveKeyWidth()) {
+        case 4:
+          first->getStorage()->moveEntriesToBuffer<int32_t>(
+              result_storage->getUnderlyingBuffer(), query_mem_desc.getEntryCount());
+          break;
+        case 8:
+          first->getStorage()->moveEntriesToBuffer<int64_t>(
+              result_storage->getUnderlyingBuffer(), query_mem_desc.getEntryCount());
+          break;
+        default:
+          CHECK(false);
+      }
     }
   } else {
     reduced_results = first;
   }
 
-  int64_t compilation_queue_time = 0;
-  const auto reduction_code =
-      get_reduction_code(results_per_device, &compilation_queue_time);
-
-  for (size_t i = 1; i < results_per_device.size(); ++i) {
+  // A spilled reduction already merged the results of all devices.
+  for (size_t i = 1; !reduced_with_spill && i < results_per_device.size(); ++i) {
     reduced_results->getStorage()->reduce(
         *(results_per_device[i].first->getStorage()), {}, reduction_code);
   }
+  reduced_results->materializeUntouchedPages();
   reduced_results->addCompilationQueueTime(compilation_queue_time);
   return reduced_results;
 }
@@ -1394,6 +1430,13 @@ ResultSetPtr Executor::executeWorkUnit(size_t& max_groups_buffer_entry_guess,
                                        const bool has_cardinality_estimation,
                                        ColumnCacheMap& column_cache) {
   VLOG(1) << "Executor " << executor_id_ << " is executing work unit:" << ra_exe_unit_in;
+  static auto& work_units = metrics::Registry::instance().counter(
+      "omnisci_executor_work_units_total", "Work units run by executors.");
+  static auto& work_unit_latency = metrics::Registry::instance().histogram(
+      "omnisci_executor_work_unit_latency_microseconds",
+      "Time to run a work unit, including code generation and retries.");
+  work_units.add();
+  metrics::ScopedLatency work_unit_latency_scope(work_unit_latency);
 
   ScopeGuard cleanup_post_execution = [this] {
     // cleanup/unpin GPU buffer allocations
@@ -1700,6 +1743,7 @@ void Executor::executeWorkUnitPerFragment(
 
   for (const auto& [result_set_ptr, result_fragment_indexes] : all_fragment_results) {
     CHECK_EQ(result_fragment_indexes.size(), 1);
+    result_set_ptr->materializeUntouchedPages();
     cb(result_set_ptr, outer_fragments[result_fragment_indexes[0]]);
   }
 }
@@ -1987,6 +2031,9 @@ ResultSetPtr Executor::collectAllDeviceResults(
         ra_exe_unit.target_exprs, query_mem_desc, device_type);
   }
   if (use_speculative_top_n(ra_exe_unit, query_mem_desc)) {
+    for (auto& result : result_per_device) {
+      result.first->materializeUntouchedPages();
+    }
     try {
       return reduceSpeculativeTopN(
           ra_exe_unit, result_per_device, row_set_mem_owner, query_mem_desc);
@@ -2311,7 +2358,8 @@ void Executor::launchKernels(SharedKernelContext& shared_context,
       kernels.empty() ? nullptr : &kernels[0]->ra_exe_unit_;
 
 #ifdef HAVE_TBB
-  if (g_enable_cpu_sub_tasks && device_type == ExecutorDeviceType::CPU) {
+  if ((g_enable_cpu_sub_tasks || g_enable_cpu_morsel_execution) &&
+      device_type == ExecutorDeviceType::CPU) {
     shared_context.setThreadPool(&tg);
   }
   ScopeGuard pool_guard([&shared_context]() { shared_context.setThreadPool(nullptr); });
@@ -2650,6 +2698,7 @@ FetchResult Executor::fetchChunks(
       if (col_id->getScanDesc().getSourceType() == InputSourceType::RESULT) {
         frag_col_buffers[it->second] =
             column_fetcher.getResultSetColumn(col_id.get(),
+                                              (*fragments)[frag_id],
                                               memory_level_for_column,
                                               device_id,
                                               device_allocator,
@@ -2825,6 +2874,7 @@ FetchResult Executor::fetchUnionChunks(
         if (col_id->getScanDesc().getSourceType() == InputSourceType::RESULT) {
           frag_col_buffers[it->second] =
               column_fetcher.getResultSetColumn(col_id.get(),
+                                                (*fragments)[frag_id],
                                                 memory_level_for_column,
                                                 device_id,
                                                 device_allocator,
@@ -2986,6 +3036,51 @@ class OutVecOwner {
  private:
   std::vector<int64_t*> out_vec_;
 };
+
+// The fragment a CPU aggregate kernel can scan together with concurrent kernels, if any.
+// Kernels only share the order in which they visit the rows, each one still reads its own
+// column buffers, so two fragments mapped to the same key merely lose the cache benefit.
+std::optional<SharedScanManager::Key> get_shared_scan_key(
+    const RelAlgExecutionUnit& ra_exe_unit,
+    const QueryMemoryDescriptor& query_mem_desc,
+    const Catalog_Namespace::Catalog& cat,
+    const ExecutorDeviceType device_type,
+    const std::vector<std::vector<const int8_t*>>& col_buffers,
+    const std::vector<std::vector<int64_t>>& num_rows,
+    const std::vector<std::vector<uint64_t>>& frag_offsets,
+    const uint32_t start_rowid,
+    const uint32_t num_tables,
+    const std::vector<int8_t*>& join_hash_tables,
+    const int64_t rows_to_process) {
+  if (!g_enable_shared_scans || device_type != ExecutorDeviceType::CPU ||
+      ra_exe_unit.estimator || ra_exe_unit.union_all ||
+      ra_exe_unit.input_descs.size() != 1 || num_tables != 1 ||
+      col_buffers.size() != 1 || !join_hash_tables.empty() || start_rowid ||
+      rows_to_process > 0 || query_mem_desc.useStreamingTopN()) {
+    return std::nullopt;
+  }
+  const auto& input_desc = ra_exe_unit.input_descs.front();
+  if (input_desc.getSourceType() != InputSourceType::TABLE) {
+    return std::nullopt;
+  }
+  switch (query_mem_desc.getQueryDescriptionType()) {
+    case QueryDescriptionType::NonGroupedAggregate:
+    case QueryDescriptionType::GroupByPerfectHash:
+    case QueryDescriptionType::GroupByBaselineHash:
+      break;
+    default:
+      return std::nullopt;
+  }
+  CHECK_EQ(num_rows.size(), size_t(1));
+  CHECK_EQ(frag_offsets.size(), size_t(1));
+  if (SharedScanManager::getBlockCount(num_rows[0][0]) < 2) {
+    return std::nullopt;
+  }
+  return SharedScanManager::Key{cat.getCurrentDB().dbId,
+                                input_desc.getTableId(),
+                                frag_offsets[0][0],
+                                num_rows[0][0]};
+}
 }  // namespace
 
 int32_t Executor::executePlanWithoutGroupBy(
@@ -3042,10 +3137,23 @@ int32_t Executor::executePlanWithoutGroupBy(
   if (g_enable_dynamic_watchdog && interrupted_.load()) {
     throw QueryExecutionError(ERR_INTERRUPTED);
   }
+  std::optional<SharedScanManager::Key> shared_scan;
   if (device_type == ExecutorDeviceType::CPU) {
     auto cpu_generated_code = std::dynamic_pointer_cast<CpuCompilationContext>(
         compilation_result.generated_code);
     CHECK(cpu_generated_code);
+    CHECK(catalog_);
+    shared_scan = get_shared_scan_key(ra_exe_unit,
+                                      query_exe_context->query_mem_desc_,
+                                      *catalog_,
+                                      device_type,
+                                      col_buffers,
+                                      num_rows,
+                                      frag_offsets,
+                                      start_rowid,
+                                      num_tables,
+                                      join_hash_table_ptrs,
+                                      rows_to_process);
     out_vec = query_exe_context->launchCpuCode(ra_exe_unit,
                                                cpu_generated_code.get(),
                                                hoist_literals,
@@ -3057,7 +3165,8 @@ int32_t Executor::executePlanWithoutGroupBy(
                                                &error_code,
                                                num_tables,
                                                join_hash_table_ptrs,
-                                               rows_to_process);
+                                               rows_to_process,
+                                               shared_scan);
     output_memory_scope.reset(new OutVecOwner(out_vec));
   } else {
     auto gpu_generated_code = std::dynamic_pointer_cast<GpuCompilationContext>(
@@ -3110,7 +3219,10 @@ int32_t Executor::executePlanWithoutGroupBy(
   // Expect delayed results extraction (used for sub-fragments) for estimator only;
   CHECK(results);
   std::vector<int64_t> reduced_outs;
-  const auto num_frags = col_buffers.size();
+  // a shared scan leaves one partial result per block of the fragment
+  const auto num_frags = shared_scan
+                             ? SharedScanManager::getBlockCount(shared_scan->num_rows)
+                             : col_buffers.size();
   const size_t entry_count =
       device_type == ExecutorDeviceType::GPU
           ? (compilation_result.gpu_smem_context.isSharedMemoryUsed()
@@ -3312,6 +3424,18 @@ int32_t Executor::executePlanWithGroupBy(
     auto cpu_generated_code = std::dynamic_pointer_cast<CpuCompilationContext>(
         compilation_result.generated_code);
     CHECK(cpu_generated_code);
+    CHECK(catalog_);
+    const auto shared_scan = get_shared_scan_key(ra_exe_unit_copy,
+                                                 query_exe_context->query_mem_desc_,
+                                                 *catalog_,
+                                                 device_type,
+                                                 col_buffers,
+                                                 num_rows,
+                                                 frag_offsets,
+                                                 start_rowid,
+                                                 num_tables,
+                                                 join_hash_table_ptrs,
+                                                 rows_to_process);
     query_exe_context->launchCpuCode(ra_exe_unit_copy,
                                      cpu_generated_code.get(),
                                      hoist_literals,
@@ -3323,7 +3447,8 @@ int32_t Executor::executePlanWithGroupBy(
                                      &error_code,
                                      num_tables,
                                      join_hash_table_ptrs,
-                                     rows_to_process);
+                                     rows_to_process,
+                                     shared_scan);
   } else {
     try {
       auto gpu_generated_code = std::dynamic_pointer_cast<GpuCompilationContext>(
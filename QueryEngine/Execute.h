@@ -24,6 +24,7 @@
 #include <cstdlib>
 #include <deque>
 #include <functional>
+#include <future>
 #include <limits>
 #include <map>
 #include <mutex>
@@ -403,6 +404,10 @@ class Executor {
 
   static void addUdfIrToModule(const std::string& udf_ir_filename, const bool is_cuda_ir);
 
+  // Blocks until the optimized code for all queries run with lightly compiled code so far
+  // has been compiled and published to the code cache, see g_enable_tiered_compilation.
+  void waitForOptimizedCPUCode();
+
   /**
    * Returns pointer to the intermediate tables vector currently stored by this executor.
    */
@@ -894,7 +899,16 @@ class Executor {
       llvm::Function*,
       llvm::Function*,
       const std::unordered_set<llvm::Function*>&,
-      const CompilationOptions&);
+      const CompilationOptions&,
+      const bool allow_tiered_compilation = false);
+  bool scheduleOptimizedCPUCode(const CodeCacheKey& key,
+                                const llvm::Module* module,
+                                const llvm::Function* query_func,
+                                const llvm::Function* multifrag_query_func,
+                                const std::unordered_set<llvm::Function*>& live_funcs,
+                                const CompilationOptions& co);
+  struct OptimizedCpuCodeTask;
+  void compileOptimizedCPUCode(const OptimizedCpuCodeTask& task);
   std::shared_ptr<CompilationContext> optimizeAndCodegenGPU(
       llvm::Function*,
       llvm::Function*,
@@ -1092,6 +1106,23 @@ class Executor {
 
   CodeCache cpu_code_cache_;
   CodeCache gpu_code_cache_;
+  // Background compilation of optimized code for queries which run lightly compiled
+  // code. A single worker drains a bounded queue of modules serialized to bitcode. The
+  // worker is declared after the code caches, since destroying its future waits for the
+  // queued compilations to publish their code.
+  struct OptimizedCpuCodeTask {
+    CodeCacheKey key;
+    std::string bitcode;
+    std::string query_func_name;
+    std::string multifrag_query_func_name;
+    std::vector<std::string> live_func_names;
+    CompilationOptions co;
+  };
+  std::mutex optimized_cpu_code_mutex_;
+  std::condition_variable optimized_cpu_code_done_;
+  std::deque<OptimizedCpuCodeTask> optimized_cpu_code_queue_;
+  bool optimized_cpu_code_worker_running_{false};
+  std::future<void> optimized_cpu_code_worker_;
 
   static const size_t baseline_threshold{
       1000000};  // if a perfect hash needs more entries, use baseline
@@ -51,7 +51,12 @@ bool need_to_hold_chunk(const Chunk_NS::Chunk* chunk,
       (chunk_ti.is_array() ||
        (chunk_ti.is_string() && chunk_ti.get_compression() == kENCODING_NONE))) {
     for (const auto target_expr : ra_exe_unit.target_exprs) {
-      const auto col_var = dynamic_cast<const Analyzer::ColumnVar*>(target_expr);
+      auto col_var = dynamic_cast<const Analyzer::ColumnVar*>(target_expr);
+      // sampled values, such as none encoded string group by keys, point into the chunk
+      const auto agg_expr = dynamic_cast<const Analyzer::AggExpr*>(target_expr);
+      if (agg_expr && agg_expr->get_aggtype() == kSAMPLE) {
+        col_var = dynamic_cast<const Analyzer::ColumnVar*>(agg_expr->get_arg());
+      }
       if (col_var && col_var->get_column_id() == chunk->getColumnDesc()->columnId &&
           col_var->get_table_id() == chunk->getColumnDesc()->tableId) {
         return true;
@@ -122,12 +127,13 @@ SharedKernelContext::getFragmentResults() {
 void ExecutionKernel::run(Executor* executor,
                           const size_t thread_idx,
                           SharedKernelContext& shared_context) {
-  DEBUG_TIMER("ExecutionKernel::run");
-  INJECT_TIMER(kernel_run);
+  // Set the query id first so the timer lands in the query's trace.
   std::optional<logger::QidScopeGuard> qid_scope_guard;
   if (ra_exe_unit_.query_state) {
     qid_scope_guard.emplace(ra_exe_unit_.query_state->setThreadLocalQueryId());
   }
+  auto timer = DEBUG_TIMER("ExecutionKernel::run");
+  INJECT_TIMER(kernel_run);
   try {
     runImpl(executor, thread_idx, shared_context);
   } catch (const OutOfHostMemory& e) {
@@ -326,7 +332,10 @@ void ExecutionKernel::runImpl(Executor* executor,
   // result sets. Can we simply do it once and holdin an outer structure?
   if (can_run_subkernels) {
     size_t total_rows = fetch_result->num_rows[0][0];
-    size_t sub_size = g_cpu_sub_task_size;
+    size_t sub_size =
+        g_enable_cpu_morsel_execution ? g_cpu_morsel_size : g_cpu_sub_task_size;
+    CHECK_GT(sub_size, size_t(0));
+    std::vector<std::shared_ptr<KernelSubtask>> morsels;
 
     for (size_t sub_start = start_rowid; sub_start < total_rows; sub_start += sub_size) {
       sub_size = (sub_start + sub_size > total_rows) ? total_rows - sub_start : sub_size;
@@ -338,10 +347,17 @@ void ExecutionKernel::runImpl(Executor* executor,
                                                      sub_start,
                                                      sub_size,
                                                      thread_idx);
-      shared_context.getThreadPool()->run(
-          [subtask, executor] { subtask->run(executor); });
+      if (g_enable_cpu_morsel_execution) {
+        morsels.push_back(std::move(subtask));
+      } else {
+        shared_context.getThreadPool()->run(
+            [subtask, executor] { subtask->run(executor); });
+      }
     }
 
+    if (!morsels.empty()) {
+      shared_context.addMorsels(std::move(morsels), executor);
+    }
     return;
   }
 #endif  // HAVE_TBB
@@ -440,6 +456,48 @@ void ExecutionKernel::runImpl(Executor* executor,
 
 #ifdef HAVE_TBB
 
+void SharedKernelContext::addMorsels(std::vector<std::shared_ptr<KernelSubtask>>&& morsels,
+                                     Executor* executor) {
+  CHECK(task_group_);
+  const auto num_morsels = morsels.size();
+  for (auto& morsel : morsels) {
+    morsel_queue_.push(std::move(morsel));
+  }
+  // Workers already draining the queue will pick up the new morsels, so only start as
+  // many new ones as there are free worker slots.
+  for (size_t i = 0; i < num_morsels && tryAcquireMorselWorker(); ++i) {
+    task_group_->run([this, executor] { runMorsels(executor); });
+  }
+}
+
+void SharedKernelContext::runMorsels(Executor* executor) {
+  // A worker releases its slot before the final emptiness check, so morsels pushed while
+  // it was exiting are either seen here or by the pushing kernel acquiring the slot.
+  do {
+    std::shared_ptr<KernelSubtask> morsel;
+    try {
+      while (morsel_queue_.try_pop(morsel)) {
+        morsel->run(executor);
+      }
+    } catch (...) {
+      --num_morsel_workers_;
+      throw;
+    }
+    --num_morsel_workers_;
+  } while (!morsel_queue_.empty() && tryAcquireMorselWorker());
+}
+
+bool SharedKernelContext::tryAcquireMorselWorker() {
+  const size_t max_workers = std::max(cpu_threads(), 1);
+  auto num_workers = num_morsel_workers_.load();
+  while (num_workers < max_workers) {
+    if (num_morsel_workers_.compare_exchange_weak(num_workers, num_workers + 1)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void KernelSubtask::run(Executor* executor) {
   try {
     runImpl(executor);
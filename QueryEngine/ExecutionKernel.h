@@ -23,7 +23,10 @@
 #include "Shared/threading.h"
 
 #ifdef HAVE_TBB
+#include "tbb/concurrent_queue.h"
 #include "tbb/enumerable_thread_specific.h"
+
+class KernelSubtask;
 #endif
 
 class SharedKernelContext {
@@ -51,6 +54,14 @@ class SharedKernelContext {
   auto getThreadPool() { return task_group_; }
   void setThreadPool(threading::task_group* tg) { task_group_ = tg; }
   auto& getTlsExecutionContext() { return tls_execution_context_; }
+
+  // Morsel-driven execution: kernels publish fixed-size row ranges of their fetched
+  // fragments into a single queue shared by all kernels of the step. A bounded set of
+  // workers drains the queue, so idle threads pick up work from any fragment instead of
+  // waiting on the kernel which owns it.
+  void addMorsels(std::vector<std::shared_ptr<KernelSubtask>>&& morsels,
+                  Executor* executor);
+  void runMorsels(Executor* executor);
 #endif  // HAVE_TBB
 
  private:
@@ -66,6 +77,11 @@ class SharedKernelContext {
   threading::task_group* task_group_;
   tbb::enumerable_thread_specific<std::unique_ptr<QueryExecutionContext>>
       tls_execution_context_;
+
+  bool tryAcquireMorselWorker();
+
+  tbb::concurrent_queue<std::shared_ptr<KernelSubtask>> morsel_queue_;
+  std::atomic<size_t> num_morsel_workers_{0};
 #endif  // HAVE_TBB
 };
 
@@ -19,11 +19,13 @@
 #include "ExtensionFunctions.hpp"
 #include "ExtensionFunctionsBinding.h"
 #include "ExtensionFunctionsWhitelist.h"
+#include "JoinHashTable/OverlapsJoinHashTable.h"
 
 #include <tuple>
 
 extern std::unique_ptr<llvm::Module> udf_gpu_module;
 extern std::unique_ptr<llvm::Module> udf_cpu_module;
+extern bool g_enable_polygon_edge_index;
 
 namespace {
 
@@ -222,6 +224,47 @@ bool ext_func_call_requires_nullcheck(const Analyzer::FunctionOper* function_ope
   return false;
 }
 
+// Returns the edge index of the inner geometries of an overlaps join if the function is
+// a containment check of the points of the outer table in those geometries, along with
+// the runtime function which uses the index.
+std::pair<const PolygonEdgeIndex*, std::string> get_polygon_edge_index(
+    const Analyzer::FunctionOper* function_oper,
+    const std::string& ext_func_name,
+    const PlanState* plan_state) {
+  static const std::unordered_map<std::string, std::pair<std::string, bool>>
+      indexed_functions{
+          {"ST_Contains_Polygon_Point",
+           {"polygon_edge_index_contains_polygon_point", false}},
+          {"ST_cContains_Polygon_Point",
+           {"polygon_edge_index_contains_polygon_point", true}},
+          {"ST_Contains_MultiPolygon_Point",
+           {"polygon_edge_index_contains_multipolygon_point", false}},
+          {"ST_cContains_MultiPolygon_Point",
+           {"polygon_edge_index_contains_multipolygon_point", true}}};
+  const auto indexed_function_it = indexed_functions.find(ext_func_name);
+  if (!plan_state || indexed_function_it == indexed_functions.end() ||
+      !function_oper->getArity()) {
+    return {nullptr, ""};
+  }
+  const auto col_var = dynamic_cast<const Analyzer::ColumnVar*>(function_oper->getArg(0));
+  if (!col_var || col_var->get_rte_idx() == 0) {
+    return {nullptr, ""};
+  }
+  const auto& [indexed_func_name, compressed] = indexed_function_it->second;
+  for (const auto& hash_table : plan_state->join_info_.join_hash_tables_) {
+    const auto overlaps_hash_table =
+        std::dynamic_pointer_cast<OverlapsJoinHashTable>(hash_table);
+    if (overlaps_hash_table &&
+        overlaps_hash_table->getInnerTableRteIdx() == col_var->get_rte_idx() &&
+        overlaps_hash_table->getInnerTableId() == col_var->get_table_id()) {
+      return {overlaps_hash_table->getPolygonEdgeIndex(col_var->get_column_id(),
+                                                        compressed),
+              indexed_func_name};
+    }
+  }
+  return {nullptr, ""};
+}
+
 }  // namespace
 
 extern "C" RUNTIME_EXPORT void register_buffer_with_executor_rsm(int64_t exec,
@@ -352,6 +395,20 @@ llvm::Value* CodeGenerator::codegenFunctionOper(
   auto args = codegenFunctionOperCastArgs(
       function_oper, &ext_func_sig, orig_arg_lvs, orig_arg_lvs_index, const_arr_size, co);
 
+  auto ext_func_name = ext_func_sig.getName();
+  if (g_enable_polygon_edge_index && co.device_type == ExecutorDeviceType::CPU) {
+    // Containment checks against the inner geometries of an overlaps join only visit the
+    // edges near the point, using an index which is cached with the hash table.
+    const auto [polygon_edge_index, indexed_func_name] =
+        get_polygon_edge_index(function_oper, ext_func_name, plan_state_);
+    if (polygon_edge_index) {
+      args.insert(args.begin(),
+                  {cgen_state_->llInt(reinterpret_cast<int64_t>(polygon_edge_index)),
+                   posArg(function_oper->getArg(0))});
+      ext_func_name = indexed_func_name;
+    }
+  }
+
   llvm::Value* buffer_ret{nullptr};
   if (ret_ti.is_buffer()) {
     // codegen buffer return as first arg
@@ -368,7 +425,7 @@ llvm::Value* CodeGenerator::codegenFunctionOper(
   }
 
   const auto ext_call = cgen_state_->emitExternalCall(
-      ext_func_sig.getName(), ret_ty, args, {}, ret_ti.is_buffer());
+      ext_func_name, ret_ty, args, {}, ret_ti.is_buffer());
   auto ext_call_nullcheck = endArgsNullcheck(
       bbs, ret_ti.is_buffer() ? buffer_ret : ext_call, null_buffer_ptr, function_oper);
 
@@ -421,6 +421,8 @@ std::unique_ptr<ResultSet> SqliteMemDatabase::runSelect(
   auto query_mem_desc = output_spec.query_mem_desc;
   const auto num_rows = connector.getNumRows();
   query_mem_desc.setEntryCount(num_rows);
+  // Every entry of the output buffer is written below, there are no pages to track.
+  query_mem_desc.setPagedPerfectHash(false);
   auto rs = std::make_unique<ResultSet>(output_spec.target_infos,
                                         ExecutorDeviceType::CPU,
                                         query_mem_desc,
@@ -0,0 +1,204 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QueryEngine/FilterSelection.h"
+
+#include "Analyzer/Analyzer.h"
+#include "Catalog/Catalog.h"
+#include "QueryEngine/RelAlgExecutionUnit.h"
+#include "QueryEngine/TypePunning.h"
+#include "Shared/InlineNullValues.h"
+
+#include <optional>
+
+namespace {
+
+std::optional<FilterSelectionOp> to_filter_selection_op(const SQLOps op) {
+  switch (op) {
+    case kEQ:
+      return kFilterSelectionEq;
+    case kNE:
+      return kFilterSelectionNe;
+    case kLT:
+      return kFilterSelectionLt;
+    case kLE:
+      return kFilterSelectionLe;
+    case kGT:
+      return kFilterSelectionGt;
+    case kGE:
+      return kFilterSelectionGe;
+    default:
+      return std::nullopt;
+  }
+}
+
+// Physical width of the column in the fragment buffers, 0 if not supported.
+size_t get_filter_column_byte_width(const SQLTypeInfo& ti) {
+  if (ti.is_fp()) {
+    return ti.get_compression() == kENCODING_NONE ? ti.get_size() : 0;
+  }
+  if (!ti.is_integer() && !ti.is_decimal() && !ti.is_time()) {
+    return 0;
+  }
+  switch (ti.get_compression()) {
+    case kENCODING_NONE:
+      return ti.get_size();
+    case kENCODING_FIXED:
+      return ti.get_comp_param() / 8;
+    default:
+      return 0;
+  }
+}
+
+// Strips integer widening casts, which don't change the result of the comparison.
+const Analyzer::ColumnVar* get_filter_column(const Analyzer::Expr* expr) {
+  const auto cast = dynamic_cast<const Analyzer::UOper*>(expr);
+  if (cast && cast->get_optype() == kCAST) {
+    const auto& operand_ti = cast->get_operand()->get_type_info();
+    const auto& cast_ti = cast->get_type_info();
+    if (!operand_ti.is_integer() || !cast_ti.is_integer() ||
+        operand_ti.get_logical_size() > cast_ti.get_logical_size()) {
+      return nullptr;
+    }
+    expr = cast->get_operand();
+  }
+  const auto col_var = dynamic_cast<const Analyzer::ColumnVar*>(expr);
+  if (!col_var || dynamic_cast<const Analyzer::Var*>(col_var)) {
+    return nullptr;
+  }
+  return col_var;
+}
+
+bool is_compatible_constant(const SQLTypeInfo& col_ti, const SQLTypeInfo& constant_ti) {
+  if (col_ti.is_fp()) {
+    return constant_ti.is_fp();
+  }
+  if (col_ti.is_integer()) {
+    return constant_ti.is_integer();
+  }
+  return col_ti.get_type() == constant_ti.get_type() &&
+         col_ti.get_dimension() == constant_ti.get_dimension() &&
+         col_ti.get_scale() == constant_ti.get_scale();
+}
+
+std::optional<int64_t> get_local_column_id(const RelAlgExecutionUnit& ra_exe_unit,
+                                           const Analyzer::ColumnVar* col_var) {
+  int64_t local_col_id{0};
+  for (const auto& col_desc : ra_exe_unit.input_col_descs) {
+    if (col_desc->getColId() == col_var->get_column_id() &&
+        col_desc->getScanDesc().getTableId() == col_var->get_table_id() &&
+        col_desc->getScanDesc().getNestLevel() == col_var->get_rte_idx()) {
+      return local_col_id;
+    }
+    ++local_col_id;
+  }
+  return std::nullopt;
+}
+
+bool append_filter_selection_term(FilterSelectionInfo& info,
+                                  const Analyzer::Expr* qual,
+                                  const RelAlgExecutionUnit& ra_exe_unit,
+                                  const Catalog_Namespace::Catalog& cat) {
+  const auto bin_oper = dynamic_cast<const Analyzer::BinOper*>(qual);
+  if (!bin_oper || bin_oper->get_qualifier() != kONE) {
+    return false;
+  }
+  auto optype = bin_oper->get_optype();
+  auto col_var = get_filter_column(bin_oper->get_left_operand());
+  auto constant = dynamic_cast<const Analyzer::Constant*>(bin_oper->get_right_operand());
+  if (!col_var) {
+    col_var = get_filter_column(bin_oper->get_right_operand());
+    constant = dynamic_cast<const Analyzer::Constant*>(bin_oper->get_left_operand());
+    optype = COMMUTE_COMPARISON(optype);
+  }
+  const auto op = to_filter_selection_op(optype);
+  if (!op || !col_var || !constant || constant->get_is_null() ||
+      col_var->get_rte_idx() != 0 || col_var->get_table_id() <= 0) {
+    return false;
+  }
+  const auto cd = cat.getMetadataForColumn(col_var->get_table_id(),
+                                           col_var->get_column_id());
+  if (!cd || cd->isVirtualCol) {
+    return false;
+  }
+  const auto& col_ti = col_var->get_type_info();
+  const auto& constant_ti = constant->get_type_info();
+  const auto byte_width = get_filter_column_byte_width(col_ti);
+  if (!byte_width || !is_compatible_constant(col_ti, constant_ti)) {
+    return false;
+  }
+  const auto local_col_id = get_local_column_id(ra_exe_unit, col_var);
+  if (!local_col_id) {
+    return false;
+  }
+  std::vector<int64_t> term(kFilterSelectionTermSize, 0);
+  term[kFilterSelectionColumn] = *local_col_id;
+  term[kFilterSelectionOp] = *op;
+  term[kFilterSelectionNullable] = !col_ti.get_notnull();
+  if (col_ti.is_fp()) {
+    term[kFilterSelectionType] =
+        byte_width == sizeof(float) ? kFilterSelectionFloat : kFilterSelectionDouble;
+    const double value =
+        extract_fp_type_from_datum(constant->get_constval(), constant_ti);
+    const double null_value = inline_fp_null_val(col_ti);
+    term[kFilterSelectionValue] =
+        *reinterpret_cast<const int64_t*>(may_alias_ptr(&value));
+    term[kFilterSelectionNullValue] =
+        *reinterpret_cast<const int64_t*>(may_alias_ptr(&null_value));
+  } else {
+    switch (byte_width) {
+      case 1:
+        term[kFilterSelectionType] = kFilterSelectionInt8;
+        break;
+      case 2:
+        term[kFilterSelectionType] = kFilterSelectionInt16;
+        break;
+      case 4:
+        term[kFilterSelectionType] = kFilterSelectionInt32;
+        break;
+      case 8:
+        term[kFilterSelectionType] = kFilterSelectionInt64;
+        break;
+      default:
+        return false;
+    }
+    term[kFilterSelectionValue] =
+        extract_int_type_from_datum(constant->get_constval(), constant_ti);
+    term[kFilterSelectionNullValue] = inline_fixed_encoding_null_val(col_ti);
+  }
+  info.descriptor.insert(info.descriptor.end(), term.begin(), term.end());
+  info.columns.emplace_back(col_var->get_table_id(), col_var->get_column_id());
+  return true;
+}
+
+}  // namespace
+
+FilterSelectionInfo build_filter_selection_info(const RelAlgExecutionUnit& ra_exe_unit,
+                                                const Catalog_Namespace::Catalog& cat) {
+  FilterSelectionInfo info;
+  info.descriptor.push_back(0);
+  for (const auto quals : {&ra_exe_unit.simple_quals, &ra_exe_unit.quals}) {
+    for (const auto& qual : *quals) {
+      if (append_filter_selection_term(info, qual.get(), ra_exe_unit, cat)) {
+        ++info.descriptor.front();
+      }
+    }
+  }
+  if (!info.descriptor.front()) {
+    info.descriptor.clear();
+  }
+  return info;
+}
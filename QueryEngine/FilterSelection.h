@@ -0,0 +1,87 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    FilterSelection.h
+ * @brief   Block at a time evaluation of simple filters into a selection vector.
+ *
+ * Comparisons between a fixed width column of the outer table and a literal are encoded
+ * in a descriptor of 64-bit slots. The runtime evaluates them over blocks of rows in
+ * tight loops which the compiler vectorizes and the query loop only visits the selected
+ * positions. The row function still evaluates the complete filter.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+constexpr int64_t kFilterSelectionBlockSize{1024};
+
+// The selection state starts with the number of selected positions in the current
+// block, the index of the current position and the first row of the next block.
+constexpr int64_t kFilterSelectionStateHeaderSize{3};
+constexpr int64_t kFilterSelectionStateSize{kFilterSelectionStateHeaderSize +
+                                            kFilterSelectionBlockSize};
+
+// The descriptor starts with the number of terms, followed by the slots of each term.
+enum FilterSelectionTermSlot {
+  kFilterSelectionColumn,
+  kFilterSelectionType,
+  kFilterSelectionOp,
+  kFilterSelectionValue,
+  kFilterSelectionNullValue,
+  kFilterSelectionNullable,
+  kFilterSelectionTermSize
+};
+
+// Physical type of the column; integers are compared as int64_t, floating point values
+// as double.
+enum FilterSelectionType {
+  kFilterSelectionInt8,
+  kFilterSelectionInt16,
+  kFilterSelectionInt32,
+  kFilterSelectionInt64,
+  kFilterSelectionFloat,
+  kFilterSelectionDouble
+};
+
+enum FilterSelectionOp {
+  kFilterSelectionEq,
+  kFilterSelectionNe,
+  kFilterSelectionLt,
+  kFilterSelectionLe,
+  kFilterSelectionGt,
+  kFilterSelectionGe
+};
+
+struct RelAlgExecutionUnit;
+
+namespace Catalog_Namespace {
+class Catalog;
+}  // namespace Catalog_Namespace
+
+struct FilterSelectionInfo {
+  std::vector<int64_t> descriptor;
+  // (table id, column id) of the columns read by the terms
+  std::vector<std::pair<int, int>> columns;
+};
+
+// Collects the top level conjuncts of the filter which the runtime can evaluate on
+// blocks of rows. Returns an empty descriptor if there are none.
+FilterSelectionInfo build_filter_selection_info(const RelAlgExecutionUnit& ra_exe_unit,
+                                                const Catalog_Namespace::Catalog& cat);
@@ -19,6 +19,8 @@
 #include "Execute.h"
 #include "RangeTableIndexVisitor.h"
 
+#include <cmath>
+#include <limits>
 #include <numeric>
 #include <queue>
 #include <regex>
@@ -34,6 +36,26 @@ static std::unordered_map<SQLTypes, cost_t> GEO_TYPE_COSTS{{kPOINT, 60},
                                                            {kPOLYGON, 80},
                                                            {kMULTIPOLYGON, 90}};
 
+// Returns the cost of an equi-join with the given column on the hash table build side,
+// from the statistics collected by ANALYZE TABLE. One-to-one hash tables are the
+// cheapest, the cost grows with the number of rows per key but stays below the one of
+// a loop join.
+cost_t get_hash_join_build_cost(const Analyzer::ColumnVar* col_var,
+                                const Executor* executor) {
+  const auto stats = executor->getCatalog()->getColumnStatistics(
+      col_var->get_table_id(), col_var->get_column_id());
+  if (!stats) {
+    return 100;
+  }
+  const auto distinct_count = stats->getDistinctCount();
+  const auto non_null_count = stats->getRowCount() - stats->getNullCount();
+  if (!distinct_count || non_null_count <= static_cast<int64_t>(distinct_count)) {
+    return 100;
+  }
+  const auto rows_per_key = static_cast<double>(non_null_count) / distinct_count;
+  return 100 + std::min(cost_t(99), static_cast<cost_t>(10 * std::log2(rows_per_key)));
+}
+
 // Returns a lhs/rhs cost for the given qualifier. Must be strictly greater than 0.
 std::pair<cost_t, cost_t> get_join_qual_cost(const Analyzer::Expr* qual,
                                              const Executor* executor) {
@@ -63,12 +85,32 @@ std::pair<cost_t, cost_t> get_join_qual_cost(const Analyzer::Expr* qual,
     return {200, 200};
   }
   if (executor) {
+    std::vector<InnerOuter> inner_outer_pairs;
     try {
-      HashJoin::normalizeColumnPairs(
+      inner_outer_pairs = HashJoin::normalizeColumnPairs(
           bin_oper, *executor->getCatalog(), executor->getTemporaryTables());
     } catch (...) {
       return {200, 200};
     }
+    // The key columns with the fewest rows per distinct value bound the cost of
+    // composite keys.
+    cost_t lhs_cost{std::numeric_limits<cost_t>::max()};
+    cost_t rhs_cost{std::numeric_limits<cost_t>::max()};
+    for (const auto& [inner_col, outer_expr] : inner_outer_pairs) {
+      const auto outer_col = dynamic_cast<const Analyzer::ColumnVar*>(outer_expr);
+      const auto inner_cost = get_hash_join_build_cost(inner_col, executor);
+      const auto outer_cost =
+          outer_col ? get_hash_join_build_cost(outer_col, executor) : cost_t(100);
+      if (outer_col && outer_col->get_rte_idx() > inner_col->get_rte_idx()) {
+        lhs_cost = std::min(lhs_cost, inner_cost);
+        rhs_cost = std::min(rhs_cost, outer_cost);
+      } else {
+        lhs_cost = std::min(lhs_cost, outer_cost);
+        rhs_cost = std::min(rhs_cost, inner_cost);
+      }
+    }
+    CHECK(!inner_outer_pairs.empty());
+    return {lhs_cost, rhs_cost};
   }
   return {100, 100};
 }
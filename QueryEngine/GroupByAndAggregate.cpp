@@ -53,6 +53,7 @@ bool g_bigint_count{false};
 int g_hll_precision_bits{11};
 size_t g_watchdog_baseline_max_groups{120000000};
 extern size_t g_leaf_count;
+extern bool g_enable_paged_perfect_hash;
 
 namespace {
 
@@ -236,9 +237,8 @@ ColRangeInfo GroupByAndAggregate::getColRangeInfo() {
     max_entry_count = std::min(max_entry_count, baseline_threshold);
   }
   const auto& groupby_expr_ti = ra_exe_unit_.groupby_exprs.front()->get_type_info();
-  if (groupby_expr_ti.is_string() && !col_range_info.bucket) {
-    CHECK(groupby_expr_ti.get_compression() == kENCODING_DICT);
-
+  if (groupby_expr_ti.is_string() &&
+      groupby_expr_ti.get_compression() == kENCODING_DICT && !col_range_info.bucket) {
     const bool has_filters =
         !ra_exe_unit_.quals.empty() || !ra_exe_unit_.simple_quals.empty();
     if (has_filters &&
@@ -331,10 +331,6 @@ GroupByAndAggregate::GroupByAndAggregate(
       continue;
     }
     const auto& groupby_ti = groupby_expr->get_type_info();
-    if (groupby_ti.is_bytes()) {
-      throw std::runtime_error(
-          "Cannot group by string columns which are not dictionary encoded.");
-    }
     if (groupby_ti.is_buffer()) {
       throw std::runtime_error("Group by buffer not supported");
     }
@@ -651,6 +647,30 @@ CountDistinctDescriptors init_count_distinct_descriptors(
   return count_distinct_descriptors;
 }
 
+// Pages are worth tracking only for buffers spanning many of them. Targets which own
+// memory per entry, like count distinct bitmaps, cannot be copied from a template row.
+bool use_paged_perfect_hash(const RelAlgExecutionUnit& ra_exe_unit,
+                            const QueryMemoryDescriptor& query_mem_desc,
+                            const ExecutorDeviceType device_type) {
+  constexpr size_t min_page_count{16};
+  if (!g_enable_paged_perfect_hash || device_type != ExecutorDeviceType::CPU ||
+      query_mem_desc.getQueryDescriptionType() !=
+          QueryDescriptionType::GroupByPerfectHash ||
+      query_mem_desc.didOutputColumnar() || query_mem_desc.useStreamingTopN() ||
+      query_mem_desc.mustUseBaselineSort() || query_mem_desc.hasVarlenOutput() ||
+      !query_mem_desc.countDistinctDescriptorsLogicallyEmpty()) {
+    return false;
+  }
+  for (const auto target_expr : ra_exe_unit.target_exprs) {
+    const auto agg_expr = dynamic_cast<const Analyzer::AggExpr*>(target_expr);
+    if (agg_expr && agg_expr->get_aggtype() == kAPPROX_QUANTILE) {
+      return false;
+    }
+  }
+  return query_mem_desc.getEntryCount() >=
+         min_page_count << PAGED_GROUP_BY_PAGE_BITS;
+}
+
 }  // namespace
 
 std::unique_ptr<QueryMemoryDescriptor> GroupByAndAggregate::initQueryMemoryDescriptor(
@@ -692,6 +712,8 @@ std::unique_ptr<QueryMemoryDescriptor> GroupByAndAggregate::initQueryMemoryDescr
       break;
     }
   }
+  query_mem_desc->setPagedPerfectHash(
+      use_paged_perfect_hash(ra_exe_unit_, *query_mem_desc, device_type_));
   return query_mem_desc;
 }
 
@@ -1204,6 +1226,10 @@ GroupByAndAggregate::codegenSingleColumnPerfectHash(
     CHECK(query_mem_desc.hasKeylessHash());
     get_group_fn_name += "_semiprivate";
   }
+  if (query_mem_desc.usesPagedPerfectHash()) {
+    CHECK(co.device_type == ExecutorDeviceType::CPU);
+    get_group_fn_name += "_paged";
+  }
   std::vector<llvm::Value*> get_group_fn_args{&*groups_buffer,
                                               &*group_expr_lv_translated};
   if (group_expr_lv_original && get_group_fn_name == "get_group_value_fast" &&
@@ -1227,6 +1253,10 @@ GroupByAndAggregate::codegenSingleColumnPerfectHash(
       get_group_fn_args.push_back(LL_INT(executor_->warpSize()));
     }
   }
+  if (query_mem_desc.usesPagedPerfectHash()) {
+    get_group_fn_args.push_back(
+        LL_INT(static_cast<int32_t>(query_mem_desc.getEntryCount())));
+  }
   if (get_group_fn_name == "get_columnar_group_bin_offset") {
     return std::make_tuple(&*groups_buffer,
                            emitCall(get_group_fn_name, get_group_fn_args));
@@ -1262,6 +1292,23 @@ std::tuple<llvm::Value*, llvm::Value*> GroupByAndAggregate::codegenMultiColumnPe
       emitCall(set_matching_func_name, set_matching_func_arg);
     }
     return std::make_tuple(groups_buffer, hash_lv);
+  } else if (query_mem_desc.usesPagedPerfectHash()) {
+    const auto entry_count_lv =
+        LL_INT(static_cast<int32_t>(query_mem_desc.getEntryCount()));
+    if (query_mem_desc.hasKeylessHash()) {
+      return std::make_tuple(
+          emitCall("get_matching_group_value_perfect_hash_keyless_paged",
+                   {groups_buffer, hash_lv, LL_INT(row_size_quad), entry_count_lv}),
+          nullptr);
+    }
+    return std::make_tuple(emitCall("get_matching_group_value_perfect_hash_paged",
+                                    {groups_buffer,
+                                     hash_lv,
+                                     group_key,
+                                     key_size_lv,
+                                     LL_INT(row_size_quad),
+                                     entry_count_lv}),
+                           nullptr);
   } else {
     if (query_mem_desc.hasKeylessHash()) {
       return std::make_tuple(emitCall("get_matching_group_value_perfect_hash_keyless",
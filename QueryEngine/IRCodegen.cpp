@@ -1319,6 +1319,23 @@ Executor::GroupColLLVMValue Executor::groupByColumnCodegen(
   CodeGenerator code_generator(this);
   auto group_key = code_generator.codegen(group_by_col, true, co).front();
   auto key_to_cache = group_key;
+  const auto& group_by_ti = group_by_col->get_type_info();
+  if (group_by_ti.is_string() && group_by_ti.get_compression() == kENCODING_NONE) {
+    // None encoded strings are grouped by their key in the string key arena of the
+    // query, while the packed pointer and length is cached for the grouped references.
+    if (co.device_type == ExecutorDeviceType::GPU) {
+      throw QueryMustRunOnCpu();
+    }
+    CHECK_EQ(col_width, sizeof(int64_t));
+    cgen_state_->group_by_expr_cache_.push_back(key_to_cache);
+    CHECK(row_set_mem_owner_);
+    const auto string_key_arena = row_set_mem_owner_->getStringKeyArena();
+    group_key = cgen_state_->emitExternalCall(
+        "string_key_id",
+        get_int_type(64, cgen_state_->context_),
+        {group_key, cgen_state_->llInt(reinterpret_cast<int64_t>(string_key_arena))});
+    return {group_key, nullptr};
+  }
   if (dynamic_cast<Analyzer::UOper*>(group_by_col) &&
       static_cast<Analyzer::UOper*>(group_by_col)->get_optype() == kUNNEST) {
     auto preheader = cgen_state_->ir_builder_.GetInsertBlock();
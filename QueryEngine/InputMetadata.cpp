@@ -24,6 +24,9 @@
 #include <tbb/task_group.h>
 #include <future>
 
+extern bool g_enable_batched_intermediate_results;
+extern size_t g_cpu_morsel_size;
+
 InputTableInfoCache::InputTableInfoCache(Executor* executor) : executor_(executor) {}
 
 namespace {
@@ -86,24 +89,80 @@ bool uses_int_meta(const SQLTypeInfo& col_ti) {
          (col_ti.is_string() && col_ti.get_compression() == kENCODING_DICT);
 }
 
-Fragmenter_Namespace::TableInfo synthesize_table_info(const ResultSetPtr& rows) {
+// Splits the result set into fragments of `batch_size` entries when it has more
+// entries than that. Kernels consuming such a fragment columnarize its range only.
+Fragmenter_Namespace::TableInfo synthesize_table_info(const ResultSetPtr& rows,
+                                                      const size_t batch_size) {
   std::vector<Fragmenter_Namespace::FragmentInfo> result;
   if (rows) {
-    result.resize(1);
-    auto& fragment = result.front();
-    fragment.fragmentId = 0;
-    fragment.deviceIds.resize(3);
-    fragment.resultSet = rows.get();
-    fragment.resultSetMutex.reset(new std::mutex());
+    const auto entry_count = rows->entryCount();
+    const bool split = batch_size && entry_count > batch_size;
+    result.resize(split ? (entry_count + batch_size - 1) / batch_size : 1);
+    for (size_t i = 0; i < result.size(); ++i) {
+      auto& fragment = result[i];
+      fragment.fragmentId = i;
+      fragment.deviceIds.resize(3);
+      fragment.resultSet = rows.get();
+      fragment.resultSetMutex.reset(new std::mutex());
+      if (split) {
+        fragment.resultSetEntryOffset = i * batch_size;
+        fragment.resultSetEntryCount = std::min(batch_size, entry_count - i * batch_size);
+      }
+    }
   }
   Fragmenter_Namespace::TableInfo table_info;
   table_info.fragments = result;
   return table_info;
 }
 
+bool is_varlen_target(const SQLTypeInfo& ti) {
+  return ti.is_array() || (ti.is_string() && ti.get_compression() == kENCODING_NONE) ||
+         ti.is_geometry();
+}
+
+// Returns the batch size of the temporary table read by the execution unit, or zero if
+// the table has to be consumed as a single fragment. Only steps scanning a single
+// temporary table without joins or window functions consume it in batches.
+size_t get_result_batch_size(const RelAlgExecutionUnit& ra_exe_unit,
+                             Executor* executor) {
+  if (!g_enable_batched_intermediate_results || !g_cpu_morsel_size ||
+      ra_exe_unit.input_descs.size() != 1 || !ra_exe_unit.join_quals.empty() ||
+      ra_exe_unit.union_all) {
+    return 0;
+  }
+  const auto& input_desc = ra_exe_unit.input_descs.front();
+  if (input_desc.getSourceType() != InputSourceType::RESULT) {
+    return 0;
+  }
+  for (const auto target_expr : ra_exe_unit.target_exprs) {
+    if (dynamic_cast<const Analyzer::WindowFunction*>(target_expr)) {
+      return 0;
+    }
+  }
+  const auto temporary_tables = executor->getTemporaryTables();
+  CHECK(temporary_tables);
+  const auto it = temporary_tables->find(input_desc.getTableId());
+  if (it == temporary_tables->end() || !it->second) {
+    return 0;
+  }
+  const auto& rows = *it->second;
+  if (rows.getQueryMemDesc().getQueryDescriptionType() ==
+          QueryDescriptionType::TableFunction ||
+      !rows.isPermutationBufferEmpty() || rows.isTruncated()) {
+    return 0;
+  }
+  for (size_t i = 0; i < rows.colCount(); ++i) {
+    if (is_varlen_target(rows.getColType(i))) {
+      return 0;
+    }
+  }
+  return g_cpu_morsel_size;
+}
+
 void collect_table_infos(std::vector<InputTableInfo>& table_infos,
                          const std::vector<InputDescriptor>& input_descs,
-                         Executor* executor) {
+                         Executor* executor,
+                         const size_t result_batch_size = 0) {
   const auto temporary_tables = executor->getTemporaryTables();
   const auto cat = executor->getCatalog();
   CHECK(cat);
@@ -123,7 +182,8 @@ void collect_table_infos(std::vector<InputTableInfo>& table_infos,
       const auto it = temporary_tables->find(table_id);
       LOG_IF(FATAL, it == temporary_tables->end())
           << "Failed to find previous query result for node " << -table_id;
-      table_infos.push_back({table_id, synthesize_table_info(it->second)});
+      table_infos.push_back(
+          {table_id, synthesize_table_info(it->second, result_batch_size)});
     } else {
       CHECK(input_desc.getSourceType() == InputSourceType::TABLE);
       table_infos.push_back({table_id, executor->getTableInfo(table_id)});
@@ -304,6 +364,69 @@ ChunkMetadataMap synthesize_metadata_table_function(const ResultSet* rows) {
   return chunk_metadata_map;
 }
 
+namespace {
+
+std::vector<std::unique_ptr<Encoder>> create_dummy_encoders(const ResultSet* rows) {
+  std::vector<std::unique_ptr<Encoder>> dummy_encoders;
+  for (size_t i = 0; i < rows->colCount(); ++i) {
+    const auto& col_ti = rows->getColType(i);
+    dummy_encoders.emplace_back(Encoder::Create(nullptr, col_ti));
+  }
+  return dummy_encoders;
+}
+
+void update_dummy_encoders(const ResultSet* rows,
+                           const std::vector<TargetValue>& crt_row,
+                           std::vector<std::unique_ptr<Encoder>>& dummy_encoders) {
+  for (size_t i = 0; i < rows->colCount(); ++i) {
+    const auto& col_ti = rows->getColType(i);
+    const auto& col_val = crt_row[i];
+    const auto scalar_col_val = boost::get<ScalarTargetValue>(&col_val);
+    CHECK(scalar_col_val);
+    if (uses_int_meta(col_ti)) {
+      const auto i64_p = boost::get<int64_t>(scalar_col_val);
+      CHECK(i64_p);
+      dummy_encoders[i]->updateStats(*i64_p, *i64_p == inline_int_null_val(col_ti));
+    } else if (col_ti.is_fp()) {
+      switch (col_ti.get_type()) {
+        case kFLOAT: {
+          const auto float_p = boost::get<float>(scalar_col_val);
+          CHECK(float_p);
+          dummy_encoders[i]->updateStats(*float_p,
+                                         *float_p == inline_fp_null_val(col_ti));
+          break;
+        }
+        case kDOUBLE: {
+          const auto double_p = boost::get<double>(scalar_col_val);
+          CHECK(double_p);
+          dummy_encoders[i]->updateStats(*double_p,
+                                         *double_p == inline_fp_null_val(col_ti));
+          break;
+        }
+        default:
+          CHECK(false);
+      }
+    } else {
+      throw std::runtime_error(col_ti.get_type_name() +
+                               " is not supported in temporary table.");
+    }
+  }
+}
+
+ChunkMetadataMap get_dummy_encoders_metadata(
+    const ResultSet* rows,
+    const std::vector<std::unique_ptr<Encoder>>& dummy_encoders) {
+  ChunkMetadataMap metadata_map;
+  for (size_t i = 0; i < rows->colCount(); ++i) {
+    const auto it_ok =
+        metadata_map.emplace(i, dummy_encoders[i]->getMetadata(rows->getColType(i)));
+    CHECK(it_ok.second);
+  }
+  return metadata_map;
+}
+
+}  // namespace
+
 ChunkMetadataMap synthesize_metadata(const ResultSet* rows) {
   auto timer = DEBUG_TIMER(__func__);
   rows->moveToBegin();
@@ -315,47 +438,11 @@ ChunkMetadataMap synthesize_metadata(const ResultSet* rows) {
   const size_t worker_count =
       result_set::use_parallel_algorithms(*rows) ? cpu_threads() : 1;
   for (size_t worker_idx = 0; worker_idx < worker_count; ++worker_idx) {
-    dummy_encoders.emplace_back();
-    for (size_t i = 0; i < rows->colCount(); ++i) {
-      const auto& col_ti = rows->getColType(i);
-      dummy_encoders.back().emplace_back(Encoder::Create(nullptr, col_ti));
-    }
+    dummy_encoders.emplace_back(create_dummy_encoders(rows));
   }
   const auto do_work = [rows](const std::vector<TargetValue>& crt_row,
                               std::vector<std::unique_ptr<Encoder>>& dummy_encoders) {
-    for (size_t i = 0; i < rows->colCount(); ++i) {
-      const auto& col_ti = rows->getColType(i);
-      const auto& col_val = crt_row[i];
-      const auto scalar_col_val = boost::get<ScalarTargetValue>(&col_val);
-      CHECK(scalar_col_val);
-      if (uses_int_meta(col_ti)) {
-        const auto i64_p = boost::get<int64_t>(scalar_col_val);
-        CHECK(i64_p);
-        dummy_encoders[i]->updateStats(*i64_p, *i64_p == inline_int_null_val(col_ti));
-      } else if (col_ti.is_fp()) {
-        switch (col_ti.get_type()) {
-          case kFLOAT: {
-            const auto float_p = boost::get<float>(scalar_col_val);
-            CHECK(float_p);
-            dummy_encoders[i]->updateStats(*float_p,
-                                           *float_p == inline_fp_null_val(col_ti));
-            break;
-          }
-          case kDOUBLE: {
-            const auto double_p = boost::get<double>(scalar_col_val);
-            CHECK(double_p);
-            dummy_encoders[i]->updateStats(*double_p,
-                                           *double_p == inline_fp_null_val(col_ti));
-            break;
-          }
-          default:
-            CHECK(false);
-        }
-      } else {
-        throw std::runtime_error(col_ti.get_type_name() +
-                                 " is not supported in temporary table.");
-      }
-    }
+    update_dummy_encoders(rows, crt_row, dummy_encoders);
   };
   if (result_set::use_parallel_algorithms(*rows)) {
     const size_t worker_count = cpu_threads();
@@ -398,7 +485,6 @@ ChunkMetadataMap synthesize_metadata(const ResultSet* rows) {
     }
     rows->moveToBegin();
   }
-  ChunkMetadataMap metadata_map;
   for (size_t worker_idx = 1; worker_idx < worker_count; ++worker_idx) {
     CHECK_LT(worker_idx, dummy_encoders.size());
     const auto& worker_encoders = dummy_encoders[worker_idx];
@@ -406,12 +492,22 @@ ChunkMetadataMap synthesize_metadata(const ResultSet* rows) {
       dummy_encoders[0][i]->reduceStats(*worker_encoders[i]);
     }
   }
-  for (size_t i = 0; i < rows->colCount(); ++i) {
-    const auto it_ok =
-        metadata_map.emplace(i, dummy_encoders[0][i]->getMetadata(rows->getColType(i)));
-    CHECK(it_ok.second);
+  return get_dummy_encoders_metadata(rows, dummy_encoders[0]);
+}
+
+ChunkMetadataMap synthesize_metadata(const ResultSet* rows,
+                                     const size_t entry_begin,
+                                     const size_t entry_end) {
+  CHECK(rows->getQueryMemDesc().getQueryDescriptionType() !=
+        QueryDescriptionType::TableFunction);
+  auto dummy_encoders = create_dummy_encoders(rows);
+  for (size_t i = entry_begin; i < entry_end; ++i) {
+    const auto crt_row = rows->getRowAtNoTranslations(i);
+    if (!crt_row.empty()) {
+      update_dummy_encoders(rows, crt_row, dummy_encoders);
+    }
   }
-  return metadata_map;
+  return get_dummy_encoders_metadata(rows, dummy_encoders);
 }
 
 size_t get_frag_count_of_table(const int table_id, Executor* executor) {
@@ -439,13 +535,21 @@ std::vector<InputTableInfo> get_table_infos(const RelAlgExecutionUnit& ra_exe_un
                                             Executor* executor) {
   INJECT_TIMER(get_table_infos);
   std::vector<InputTableInfo> table_infos;
-  collect_table_infos(table_infos, ra_exe_unit.input_descs, executor);
+  collect_table_infos(table_infos,
+                      ra_exe_unit.input_descs,
+                      executor,
+                      get_result_batch_size(ra_exe_unit, executor));
   return table_infos;
 }
 
 const ChunkMetadataMap& Fragmenter_Namespace::FragmentInfo::getChunkMetadataMap() const {
   if (resultSet && !synthesizedMetadataIsValid) {
-    chunkMetadataMap = synthesize_metadata(resultSet);
+    chunkMetadataMap =
+        resultSetEntryCount
+            ? synthesize_metadata(resultSet,
+                                  resultSetEntryOffset,
+                                  resultSetEntryOffset + resultSetEntryCount)
+            : synthesize_metadata(resultSet);
     synthesizedMetadataIsValid = true;
   }
   return chunkMetadataMap;
@@ -467,7 +571,17 @@ size_t Fragmenter_Namespace::FragmentInfo::getNumTuples() const {
   }
   CHECK_EQ(!!resultSet, !!resultSetMutex);
   if (resultSet && !synthesizedNumTuplesIsValid) {
-    numTuples = resultSet->rowCount();
+    if (resultSetEntryCount) {
+      numTuples = 0;
+      const auto entry_end = resultSetEntryOffset + resultSetEntryCount;
+      for (size_t i = resultSetEntryOffset; i < entry_end; ++i) {
+        if (!resultSet->isRowAtEmpty(i)) {
+          ++numTuples;
+        }
+      }
+    } else {
+      numTuples = resultSet->rowCount();
+    }
     synthesizedNumTuplesIsValid = true;
   }
   return numTuples;
@@ -475,7 +589,11 @@ size_t Fragmenter_Namespace::FragmentInfo::getNumTuples() const {
 
 size_t Fragmenter_Namespace::TableInfo::getNumTuples() const {
   if (!fragments.empty() && fragments.front().resultSet) {
-    return fragments.front().getNumTuples();
+    size_t num_tuples{0};
+    for (const auto& fragment : fragments) {
+      num_tuples += fragment.getNumTuples();
+    }
+    return num_tuples;
   }
   return numTuples;
 }
@@ -489,7 +607,9 @@ size_t Fragmenter_Namespace::TableInfo::getNumTuplesUpperBound() const {
 
 size_t Fragmenter_Namespace::TableInfo::getFragmentNumTuplesUpperBound() const {
   if (!fragments.empty() && fragments.front().resultSet) {
-    return fragments.front().resultSet->entryCount();
+    const auto& fragment = fragments.front();
+    return fragment.resultSetEntryCount ? fragment.resultSetEntryCount
+                                        : fragment.resultSet->entryCount();
   }
   size_t fragment_num_tupples_upper_bound = 0;
   for (const auto& fragment : fragments) {
@@ -50,6 +50,11 @@ class InputTableInfoCache {
 
 ChunkMetadataMap synthesize_metadata(const ResultSet* rows);
 
+// Metadata of the result set entries in [entry_begin, entry_end).
+ChunkMetadataMap synthesize_metadata(const ResultSet* rows,
+                                     const size_t entry_begin,
+                                     const size_t entry_end);
+
 size_t get_frag_count_of_table(const int table_id, Executor* executor);
 
 std::vector<InputTableInfo> get_table_infos(
@@ -22,6 +22,7 @@
 #include "QueryEngine/JoinHashTable/HashJoin.h"
 
 #include "QueryEngine/JoinHashTable/HashTable.h"
+#include "QueryEngine/JoinHashTable/PolygonEdgeIndex.h"
 
 class BaselineHashTable : public HashTable {
  public:
@@ -97,6 +98,15 @@ class BaselineHashTable : public HashTable {
   size_t getEntryCount() const override { return entry_count_; }
   size_t getEmittedKeysCount() const override { return emitted_keys_count_; }
 
+  // Edge index of the inner geometries of an overlaps join, built along with the hash
+  // table and cached with it. Set before the hash table is shared.
+  const PolygonEdgeIndex* getPolygonEdgeIndex() const {
+    return polygon_edge_index_.get();
+  }
+  void setPolygonEdgeIndex(std::unique_ptr<PolygonEdgeIndex> polygon_edge_index) {
+    polygon_edge_index_ = std::move(polygon_edge_index);
+  }
+
  private:
   std::unique_ptr<int8_t[]> cpu_hash_table_buff_;
   size_t cpu_hash_table_buff_size_;
@@ -110,4 +120,6 @@ class BaselineHashTable : public HashTable {
   HashType layout_;
   size_t entry_count_;         // number of keys in the hash table
   size_t emitted_keys_count_;  // number of keys emitted across all rows
+
+  std::unique_ptr<PolygonEdgeIndex> polygon_edge_index_;
 };
@@ -16,6 +16,7 @@
 
 #include "QueryEngine/JoinHashTable/OverlapsJoinHashTable.h"
 
+#include "Geospatial/Compression.h"
 #include "QueryEngine/CodeGenerator.h"
 #include "QueryEngine/DataRecycler/DataRecycler.h"
 #include "QueryEngine/Execute.h"
@@ -26,6 +27,9 @@
 #include "QueryEngine/JoinHashTable/RangeJoinHashTable.h"
 #include "QueryEngine/JoinHashTable/Runtime/HashJoinKeyHandlers.h"
 #include "QueryEngine/JoinHashTable/Runtime/JoinHashTableGpuUtils.h"
+#include "Utils/ChunkIter.h"
+
+extern bool g_enable_polygon_edge_index;
 
 std::unique_ptr<HashTableRecycler> OverlapsJoinHashTable::hash_table_cache_ =
     std::make_unique<HashTableRecycler>(CacheItemType::OVERLAPS_HT, 0);
@@ -1344,6 +1348,11 @@ std::shared_ptr<BaselineHashTable> OverlapsJoinHashTable::initHashTableOnCpu(
         std::to_string(err) + std::string(")"));
   }
   std::shared_ptr<BaselineHashTable> hash_table = builder.getHashTable();
+  if (g_enable_polygon_edge_index &&
+      memory_level_ == Data_Namespace::MemoryLevel::CPU_LEVEL) {
+    buildPolygonEdgeIndex(*hash_table);
+    ts2 = std::chrono::steady_clock::now();
+  }
   if (skip_hashtable_caching) {
     VLOG(1) << "Skipping overlaps join hash table caching";
   } else {
@@ -1813,6 +1822,135 @@ int OverlapsJoinHashTable::getInnerTableId() const noexcept {
   return 0;
 }
 
+void OverlapsJoinHashTable::buildPolygonEdgeIndex(BaselineHashTable& hash_table) const {
+  auto timer = DEBUG_TIMER(__func__);
+  CHECK_EQ(inner_outer_pairs_.size(), size_t(1));
+  const auto inner_col = inner_outer_pairs_.front().first;
+  if (inner_col->get_table_id() < 0) {
+    return;
+  }
+  const auto& catalog = *executor_->getCatalog();
+  // The bounds column is the last but one physical column of the geometry, after its
+  // coordinates, ring sizes and, for multipolygons, polygon sizes.
+  const ColumnDescriptor* geo_cd{nullptr};
+  for (const int bounds_offset : {3, 4}) {
+    const auto cd = catalog.getMetadataForColumn(
+        inner_col->get_table_id(), inner_col->get_column_id() - bounds_offset);
+    if (cd && (cd->columnType.get_type() == kPOLYGON ||
+               cd->columnType.get_type() == kMULTIPOLYGON) &&
+        cd->columnType.get_physical_cols() == bounds_offset + 1) {
+      geo_cd = cd;
+      break;
+    }
+  }
+  if (!geo_cd) {
+    return;
+  }
+  const auto& geo_ti = geo_cd->columnType;
+  const bool is_multipolygon = geo_ti.get_type() == kMULTIPOLYGON;
+  const auto ic = Geospatial::get_compression_scheme(geo_ti);
+  std::vector<const ColumnDescriptor*> physical_cds;
+  for (int i = 1; i <= (is_multipolygon ? 3 : 2); ++i) {
+    physical_cds.push_back(catalog.getMetadataForColumn(geo_cd->tableId,
+                                                        geo_cd->columnId + i));
+    CHECK(physical_cds.back());
+  }
+
+  const auto& query_info =
+      get_inner_query_info(inner_col->get_table_id(), query_infos_).info;
+  // The index over the compressed coordinates serves the ST_cContains variants, which
+  // are used for the compressed geometries.
+  auto polygon_edge_index =
+      std::make_unique<PolygonEdgeIndex>(physical_cds.front()->columnId,
+                                         query_info.getNumTuplesUpperBound(),
+                                         geo_ti.get_compression() == kENCODING_GEOINT);
+  // Row ids follow the inner columns linearized across the fragments, as in the probes.
+  size_t first_row_id{0};
+  for (const auto& fragment : query_info.fragments) {
+    const auto num_rows = fragment.getNumTuples();
+    if (fragment.isEmptyPhysicalFragment() || !num_rows) {
+      continue;
+    }
+    std::vector<std::shared_ptr<Chunk_NS::Chunk>> chunks;
+    std::vector<ChunkIter> chunk_iters;
+    for (const auto cd : physical_cds) {
+      const auto chunk_meta_it = fragment.getChunkMetadataMap().find(cd->columnId);
+      CHECK(chunk_meta_it != fragment.getChunkMetadataMap().end());
+      ChunkKey chunk_key{catalog.getCurrentDB().dbId,
+                         fragment.physicalTableId,
+                         cd->columnId,
+                         fragment.fragmentId};
+      chunks.push_back(Chunk_NS::Chunk::getChunk(cd,
+                                                 &catalog.getDataMgr(),
+                                                 chunk_key,
+                                                 Data_Namespace::CPU_LEVEL,
+                                                 0,
+                                                 chunk_meta_it->second->numBytes,
+                                                 chunk_meta_it->second->numElements));
+      CHECK(chunks.back());
+      chunk_iters.push_back(chunks.back()->begin_iterator(chunk_meta_it->second));
+    }
+    const int thread_count = cpu_threads();
+    std::vector<std::future<void>> build_threads;
+    for (int thread_idx = 0; thread_idx < thread_count; ++thread_idx) {
+      build_threads.push_back(std::async(std::launch::async, [&, thread_idx] {
+        // each thread reads through its own copy of the iterators
+        auto thread_chunk_iters = chunk_iters;
+        std::vector<ArrayDatum> values(thread_chunk_iters.size());
+        for (size_t row = thread_idx; row < num_rows; row += thread_count) {
+          bool is_end{false};
+          for (size_t i = 0; i < thread_chunk_iters.size(); ++i) {
+            ChunkIter_get_nth(&thread_chunk_iters[i], row, &values[i], &is_end);
+            CHECK(!is_end);
+          }
+          if (values[0].is_null || values[1].is_null) {
+            continue;
+          }
+          const auto ring_sizes = reinterpret_cast<const int32_t*>(values[1].pointer);
+          const int64_t num_rings = values[1].length / sizeof(int32_t);
+          const int32_t poly_size = num_rings;
+          polygon_edge_index->buildRowIndex(
+              first_row_id + row,
+              values[0].pointer,
+              ring_sizes,
+              num_rings,
+              is_multipolygon ? reinterpret_cast<const int32_t*>(values[2].pointer)
+                              : &poly_size,
+              is_multipolygon ? values[2].length / sizeof(int32_t) : 1,
+              ic);
+        }
+      }));
+    }
+    for (auto& build_thread : build_threads) {
+      build_thread.wait();
+    }
+    for (auto& build_thread : build_threads) {
+      build_thread.get();
+    }
+    first_row_id += num_rows;
+  }
+  hash_table.setPolygonEdgeIndex(std::move(polygon_edge_index));
+}
+
+const PolygonEdgeIndex* OverlapsJoinHashTable::getPolygonEdgeIndex(
+    const int coords_column_id,
+    const bool compressed) const {
+  if (memory_level_ != Data_Namespace::MemoryLevel::CPU_LEVEL) {
+    return nullptr;
+  }
+  auto hash_table = dynamic_cast<BaselineHashTable*>(getHashTableForDevice(0));
+  if (!hash_table) {
+    return nullptr;
+  }
+  const auto polygon_edge_index = hash_table->getPolygonEdgeIndex();
+  if (!polygon_edge_index ||
+      polygon_edge_index->getCoordsColumnId() != coords_column_id ||
+      polygon_edge_index->isCompressed() != compressed) {
+    return nullptr;
+  }
+  return polygon_edge_index;
+}
+
 std::shared_ptr<HashTable> OverlapsJoinHashTable::initHashTableOnCpuFromCache(
     QueryPlanHash key,
     CacheItemType item_type,
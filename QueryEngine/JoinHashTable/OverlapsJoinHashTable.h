@@ -100,6 +100,12 @@ class OverlapsJoinHashTable : public HashJoin {
     return auto_tuner_cache_.get();
   }
 
+  // Returns the edge index of the inner geometries for the containment checks of the
+  // join on the geometries with the given coordinates column, or nullptr if the hash
+  // table doesn't live in CPU memory or has no index for those geometries.
+  const PolygonEdgeIndex* getPolygonEdgeIndex(const int coords_column_id,
+                                              const bool compressed) const;
+
  protected:
   void reify(const HashType preferred_layout);
 
@@ -179,6 +185,10 @@ class OverlapsJoinHashTable : public HashJoin {
       const size_t emitted_keys_count,
       const bool skip_hashtable_caching);
 
+  // Builds the edge index of the inner polygons or multipolygons, whose bounds are the
+  // inner column of the join, for the containment checks of the probes on CPU.
+  void buildPolygonEdgeIndex(BaselineHashTable& hash_table) const;
+
 #ifdef HAVE_CUDA
   std::shared_ptr<BaselineHashTable> initHashTableOnGpu(
       const std::vector<JoinColumn>& join_columns,
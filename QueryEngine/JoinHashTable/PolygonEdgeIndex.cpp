@@ -0,0 +1,480 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QueryEngine/JoinHashTable/PolygonEdgeIndex.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include "Geospatial/CompressionRuntime.h"
+#include "Logger/Logger.h"
+
+bool g_enable_polygon_edge_index{true};
+size_t g_polygon_edge_index_min_vertices{64};
+
+// The containment functions of ExtensionFunctionsGeo.hpp, used for the geometries which
+// aren't indexed.
+extern "C" bool ST_Contains_Polygon_Point(const int8_t* poly_coords,
+                                          const int64_t poly_coords_size,
+                                          const int32_t* poly_ring_sizes,
+                                          const int64_t poly_num_rings,
+                                          const double* poly_bounds,
+                                          const int64_t poly_bounds_size,
+                                          const int8_t* p,
+                                          const int64_t psize,
+                                          const int32_t ic1,
+                                          const int32_t isr1,
+                                          const int32_t ic2,
+                                          const int32_t isr2,
+                                          const int32_t osr);
+
+extern "C" bool ST_cContains_Polygon_Point(const int8_t* poly_coords,
+                                           const int64_t poly_coords_size,
+                                           const int32_t* poly_ring_sizes,
+                                           const int64_t poly_num_rings,
+                                           const double* poly_bounds,
+                                           const int64_t poly_bounds_size,
+                                           const int8_t* p,
+                                           const int64_t psize,
+                                           const int32_t ic1,
+                                           const int32_t isr1,
+                                           const int32_t ic2,
+                                           const int32_t isr2,
+                                           const int32_t osr);
+
+extern "C" bool ST_Contains_MultiPolygon_Point(int8_t* mpoly_coords,
+                                               int64_t mpoly_coords_size,
+                                               int32_t* mpoly_ring_sizes,
+                                               int64_t mpoly_num_rings,
+                                               int32_t* mpoly_poly_sizes,
+                                               int64_t mpoly_num_polys,
+                                               double* mpoly_bounds,
+                                               int64_t mpoly_bounds_size,
+                                               int8_t* p,
+                                               int64_t psize,
+                                               int32_t ic1,
+                                               int32_t isr1,
+                                               int32_t ic2,
+                                               int32_t isr2,
+                                               int32_t osr);
+
+extern "C" bool ST_cContains_MultiPolygon_Point(int8_t* mpoly_coords,
+                                                int64_t mpoly_coords_size,
+                                                int32_t* mpoly_ring_sizes,
+                                                int64_t mpoly_num_rings,
+                                                int32_t* mpoly_poly_sizes,
+                                                int64_t mpoly_num_polys,
+                                                double* mpoly_bounds,
+                                                int64_t mpoly_bounds_size,
+                                                int8_t* p,
+                                                int64_t psize,
+                                                int32_t ic1,
+                                                int32_t isr1,
+                                                int32_t ic2,
+                                                int32_t isr2,
+                                                int32_t osr);
+
+namespace {
+
+constexpr int32_t kMaxBandsPerRing{4096};
+constexpr int32_t kEdgesPerBand{4};
+
+struct RingBands {
+  int32_t first_vertex;
+  int32_t num_vertices;
+  double y_min;
+  double inv_band_height;
+  int32_t num_bands;
+  // offset of the first band in band_offsets, which has num_bands + 1 entries per ring
+  int32_t first_band;
+
+  int32_t getBand(const double y) const {
+    // monotonic in y, so the bands of the endpoints of an edge enclose the band of any
+    // y in between
+    const double band = (y - y_min) * inv_band_height;
+    if (!(band > 0)) {
+      return 0;
+    }
+    if (band >= num_bands) {
+      return num_bands - 1;
+    }
+    return static_cast<int32_t>(band);
+  }
+};
+
+template <typename T>
+struct PolygonBands {
+  std::vector<T> xs;
+  std::vector<T> ys;
+  std::vector<RingBands> rings;
+  // first ring of each polygon, followed by the number of rings
+  std::vector<int32_t> poly_first_ring;
+  std::vector<int32_t> band_offsets;
+  // index of the first vertex of each edge within its ring
+  std::vector<int32_t> band_edges;
+};
+
+double decompress_coord(const int8_t* data,
+                        const int64_t index,
+                        const int32_t ic,
+                        const bool is_x) {
+  if (ic == COMPRESSION_GEOINT32) {
+    const auto compressed_coord = reinterpret_cast<const int32_t*>(data)[index];
+    return is_x ? Geospatial::decompress_longitude_coord_geoint32(compressed_coord)
+                : Geospatial::decompress_latitude_coord_geoint32(compressed_coord);
+  }
+  return reinterpret_cast<const double*>(data)[index];
+}
+
+template <typename T>
+T get_coord(const int8_t* data, const int64_t index, const int32_t ic, const bool is_x) {
+  if constexpr (std::is_floating_point<T>::value) {
+    return decompress_coord(data, index, ic, is_x);
+  } else {
+    return reinterpret_cast<const int32_t*>(data)[index];
+  }
+}
+
+template <typename T>
+void add_ring(PolygonBands<T>& bands,
+              const int8_t* coords,
+              const int64_t first_coord,
+              const int32_t num_vertices,
+              const int32_t ic) {
+  RingBands ring{};
+  ring.first_vertex = bands.xs.size();
+  ring.num_vertices = std::max(num_vertices, 0);
+  ring.first_band = bands.band_offsets.size();
+  double y_min{0};
+  double y_max{0};
+  for (int32_t i = 0; i < ring.num_vertices; ++i) {
+    const T x = get_coord<T>(coords, first_coord + 2 * i, ic, true);
+    const T y = get_coord<T>(coords, first_coord + 2 * i + 1, ic, false);
+    bands.xs.push_back(x);
+    bands.ys.push_back(y);
+    y_min = i ? std::min(y_min, static_cast<double>(y)) : y;
+    y_max = i ? std::max(y_max, static_cast<double>(y)) : y;
+  }
+  ring.y_min = y_min;
+  ring.num_bands =
+      std::clamp(ring.num_vertices / kEdgesPerBand, int32_t(1), kMaxBandsPerRing);
+  ring.inv_band_height = y_max > y_min ? ring.num_bands / (y_max - y_min) : 0;
+
+  // Count the edges of each band first, then fill them in. Horizontal edges never
+  // change the winding number and are left out.
+  std::vector<int32_t> band_counts(ring.num_bands + 1, 0);
+  auto for_each_edge_band = [&](auto func) {
+    for (int32_t e = 0; e < ring.num_vertices; ++e) {
+      const T e0y = bands.ys[ring.first_vertex + e];
+      const T e1y = bands.ys[ring.first_vertex + (e + 1) % ring.num_vertices];
+      if (e0y == e1y) {
+        continue;
+      }
+      const auto first_band = ring.getBand(std::min(e0y, e1y));
+      const auto last_band = ring.getBand(std::max(e0y, e1y));
+      for (int32_t b = first_band; b <= last_band; ++b) {
+        func(e, b);
+      }
+    }
+  };
+  for_each_edge_band([&](const int32_t, const int32_t b) { ++band_counts[b + 1]; });
+  const int32_t first_edge = bands.band_edges.size();
+  for (int32_t b = 0; b <= ring.num_bands; ++b) {
+    band_counts[b] += b ? band_counts[b - 1] : first_edge;
+    bands.band_offsets.push_back(band_counts[b]);
+  }
+  bands.band_edges.resize(band_counts.back());
+  for_each_edge_band([&](const int32_t e, const int32_t b) {
+    bands.band_edges[band_counts[b]++] = e;
+  });
+  bands.rings.push_back(ring);
+}
+
+// Same as point_in_polygon_winding_number with EdgeBehavior::kExcludePointOnEdge, over
+// the edges of the band of the point.
+template <typename T>
+bool ring_contains_point(const PolygonBands<T>& bands,
+                         const RingBands& ring,
+                         const T px,
+                         const T py) {
+  if (ring.num_vertices == 0) {
+    return false;
+  }
+  const auto band = ring.first_band + ring.getBand(py);
+  const auto xs = bands.xs.data() + ring.first_vertex;
+  const auto ys = bands.ys.data() + ring.first_vertex;
+  int32_t wn = 0;
+  for (int32_t i = bands.band_offsets[band]; i < bands.band_offsets[band + 1]; ++i) {
+    const auto e0 = bands.band_edges[i];
+    const auto e1 = (e0 + 1) % ring.num_vertices;
+    const T e0x = xs[e0];
+    const T e0y = ys[e0];
+    const T e1x = xs[e1];
+    const T e1y = ys[e1];
+    T epsilon{0};
+    if constexpr (std::is_floating_point<T>::value) {
+      const T edge_vec_magnitude = (e1x - e0x) * (e1x - e0x) + (e1y - e0y) * (e1y - e0y);
+      epsilon = 0.003 * edge_vec_magnitude;
+    }
+    auto on_edge = [epsilon](const T is_left_val) {
+      if constexpr (std::is_floating_point<T>::value) {
+        return (-epsilon <= is_left_val) && (is_left_val <= epsilon);
+      }
+      return is_left_val == 0;
+    };
+    if (e0y <= py) {
+      if (e1y > py) {
+        const T is_left_val = (e1x - e0x) * (py - e0y) - (px - e0x) * (e1y - e0y);
+        if (on_edge(is_left_val)) {
+          return false;
+        } else if (is_left_val > T(0)) {
+          ++wn;
+        }
+      }
+    } else if (e1y <= py) {
+      const T is_left_val = (e1x - e0x) * (py - e0y) - (px - e0x) * (e1y - e0y);
+      if (on_edge(is_left_val)) {
+        return false;
+      } else if (is_left_val < T(0)) {
+        --wn;
+      }
+    }
+  }
+  return wn != 0;
+}
+
+template <typename T>
+bool contains_point(const PolygonBands<T>& bands, const T px, const T py) {
+  for (size_t poly = 0; poly + 1 < bands.poly_first_ring.size(); ++poly) {
+    const auto first_ring = bands.poly_first_ring[poly];
+    const auto last_ring = bands.poly_first_ring[poly + 1];
+    if (first_ring == last_ring ||
+        !ring_contains_point(bands, bands.rings[first_ring], px, py)) {
+      continue;
+    }
+    bool in_hole = false;
+    for (auto ring = first_ring + 1; ring < last_ring && !in_hole; ++ring) {
+      in_hole = ring_contains_point(bands, bands.rings[ring], px, py);
+    }
+    if (!in_hole) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool box_contains_point(const double* bounds, const double px, const double py) {
+  return px + TOLERANCE_DEFAULT >= bounds[0] && py + TOLERANCE_DEFAULT >= bounds[1] &&
+         px <= bounds[2] + TOLERANCE_DEFAULT && py <= bounds[3] + TOLERANCE_DEFAULT;
+}
+
+bool is_transformed(const int32_t isr, const int32_t osr) {
+  return isr != osr && osr != 0;
+}
+
+}  // namespace
+
+struct PolygonEdgeIndex::RowIndex {
+  PolygonBands<double> decompressed;
+  PolygonBands<int64_t> compressed;
+
+  template <typename T>
+  const PolygonBands<T>& getBands() const {
+    if constexpr (std::is_floating_point<T>::value) {
+      return decompressed;
+    } else {
+      return compressed;
+    }
+  }
+};
+
+PolygonEdgeIndex::PolygonEdgeIndex(const int coords_column_id,
+                                   const size_t num_rows,
+                                   const bool compressed)
+    : coords_column_id_(coords_column_id)
+    , num_rows_(num_rows)
+    , compressed_(compressed)
+    , row_indexes_(new std::unique_ptr<RowIndex>[num_rows]) {}
+
+PolygonEdgeIndex::~PolygonEdgeIndex() {}
+
+void PolygonEdgeIndex::buildRowIndex(const size_t row_id,
+                                     const int8_t* coords,
+                                     const int32_t* ring_sizes,
+                                     const int64_t num_rings,
+                                     const int32_t* poly_sizes,
+                                     const int64_t num_polys,
+                                     const int32_t ic) {
+  CHECK_LT(row_id, num_rows_);
+  int64_t num_vertices{0};
+  for (int64_t ring = 0; ring < num_rings; ++ring) {
+    num_vertices += ring_sizes[ring];
+  }
+  if (num_rings <= 0 ||
+      num_vertices < static_cast<int64_t>(g_polygon_edge_index_min_vertices)) {
+    return;
+  }
+  auto row_index = std::make_unique<RowIndex>();
+  auto build = [&](auto& bands) {
+    int64_t ring = 0;
+    int64_t first_coord = 0;
+    for (int64_t poly = 0; poly < num_polys; ++poly) {
+      bands.poly_first_ring.push_back(bands.rings.size());
+      for (int32_t i = 0; i < poly_sizes[poly] && ring < num_rings; ++i, ++ring) {
+        add_ring(bands, coords, first_coord, ring_sizes[ring], ic);
+        first_coord += 2 * static_cast<int64_t>(ring_sizes[ring]);
+      }
+    }
+    bands.poly_first_ring.push_back(bands.rings.size());
+  };
+  if (compressed_) {
+    build(row_index->compressed);
+  } else {
+    build(row_index->decompressed);
+  }
+  row_indexes_[row_id] = std::move(row_index);
+}
+
+const PolygonEdgeIndex::RowIndex* PolygonEdgeIndex::getRowIndex(
+    const size_t row_id) const {
+  CHECK_LT(row_id, num_rows_);
+  return row_indexes_[row_id].get();
+}
+
+namespace {
+
+template <typename T>
+bool index_contains_point(const PolygonEdgeIndex::RowIndex* row_index,
+                          const double* bounds,
+                          const int8_t* p,
+                          const int32_t ic2) {
+  const double x = decompress_coord(p, 0, ic2, true);
+  const double y = decompress_coord(p, 1, ic2, false);
+  if (bounds && !box_contains_point(bounds, x, y)) {
+    return false;
+  }
+  if constexpr (std::is_floating_point<T>::value) {
+    return contains_point(row_index->getBands<T>(), x, y);
+  } else {
+    const auto compressed_coords = reinterpret_cast<const int32_t*>(p);
+    return contains_point(
+        row_index->getBands<T>(), T(compressed_coords[0]), T(compressed_coords[1]));
+  }
+}
+
+PolygonEdgeIndex::RowIndex const* get_row_index(const int64_t index_handle,
+                                                const int64_t row_id,
+                                                const int64_t num_rings,
+                                                const int32_t isr1,
+                                                const int32_t isr2,
+                                                const int32_t osr) {
+  const auto index = reinterpret_cast<const PolygonEdgeIndex*>(index_handle);
+  if (row_id < 0 || static_cast<size_t>(row_id) >= index->getNumRows() ||
+      num_rings <= 0 || is_transformed(isr1, osr) || is_transformed(isr2, osr)) {
+    return nullptr;
+  }
+  return index->getRowIndex(row_id);
+}
+
+}  // namespace
+
+extern "C" RUNTIME_EXPORT bool polygon_edge_index_contains_polygon_point(
+    const int64_t index_handle,
+    const int64_t row_id,
+    const int8_t* poly_coords,
+    const int64_t poly_coords_size,
+    const int32_t* poly_ring_sizes,
+    const int64_t poly_num_rings,
+    const double* poly_bounds,
+    const int64_t poly_bounds_size,
+    const int8_t* p,
+    const int64_t psize,
+    const int32_t ic1,
+    const int32_t isr1,
+    const int32_t ic2,
+    const int32_t isr2,
+    const int32_t osr) {
+  const bool compressed =
+      reinterpret_cast<const PolygonEdgeIndex*>(index_handle)->isCompressed();
+  const auto row_index =
+      get_row_index(index_handle, row_id, poly_num_rings, isr1, isr2, osr);
+  if (!row_index) {
+    return (compressed ? ST_cContains_Polygon_Point : ST_Contains_Polygon_Point)(
+        poly_coords,
+        poly_coords_size,
+        poly_ring_sizes,
+        poly_num_rings,
+        poly_bounds,
+        poly_bounds_size,
+        p,
+        psize,
+        ic1,
+        isr1,
+        ic2,
+        isr2,
+        osr);
+  }
+  return compressed ? index_contains_point<int64_t>(row_index, poly_bounds, p, ic2)
+                    : index_contains_point<double>(row_index, poly_bounds, p, ic2);
+}
+
+extern "C" RUNTIME_EXPORT bool polygon_edge_index_contains_multipolygon_point(
+    const int64_t index_handle,
+    const int64_t row_id,
+    int8_t* mpoly_coords,
+    int64_t mpoly_coords_size,
+    int32_t* mpoly_ring_sizes,
+    int64_t mpoly_num_rings,
+    int32_t* mpoly_poly_sizes,
+    int64_t mpoly_num_polys,
+    double* mpoly_bounds,
+    int64_t mpoly_bounds_size,
+    int8_t* p,
+    int64_t psize,
+    int32_t ic1,
+    int32_t isr1,
+    int32_t ic2,
+    int32_t isr2,
+    int32_t osr) {
+  if (mpoly_num_polys <= 0) {
+    return false;
+  }
+  const bool compressed =
+      reinterpret_cast<const PolygonEdgeIndex*>(index_handle)->isCompressed();
+  const auto row_index =
+      get_row_index(index_handle, row_id, mpoly_num_rings, isr1, isr2, osr);
+  if (!row_index) {
+    return (compressed ? ST_cContains_MultiPolygon_Point
+                       : ST_Contains_MultiPolygon_Point)(mpoly_coords,
+                                                         mpoly_coords_size,
+                                                         mpoly_ring_sizes,
+                                                         mpoly_num_rings,
+                                                         mpoly_poly_sizes,
+                                                         mpoly_num_polys,
+                                                         mpoly_bounds,
+                                                         mpoly_bounds_size,
+                                                         p,
+                                                         psize,
+                                                         ic1,
+                                                         isr1,
+                                                         ic2,
+                                                         isr2,
+                                                         osr);
+  }
+  return compressed ? index_contains_point<int64_t>(row_index, mpoly_bounds, p, ic2)
+                    : index_contains_point<double>(row_index, mpoly_bounds, p, ic2);
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    PolygonEdgeIndex.h
+ * @brief   Per row edge index for point in polygon tests on the inner table of an
+ * overlaps join.
+ *
+ * The edges of each ring are bucketed into horizontal bands of equal height. A point
+ * can only change the winding number of a ring through an edge whose y range contains
+ * the point, so the winding number test only visits the edges of the band the point
+ * falls into and gives the same result as the test over all edges. The index is built
+ * along with the overlaps hash table, from the coordinates of the inner geometries, and
+ * is only read by the probes.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+class PolygonEdgeIndex {
+ public:
+  // Index of the geometries whose coordinates are in the given physical column.
+  // compressed selects the index over the raw GEOINT32 coordinates, as used by the
+  // ST_cContains variants
+  PolygonEdgeIndex(const int coords_column_id,
+                   const size_t num_rows,
+                   const bool compressed);
+
+  ~PolygonEdgeIndex();
+
+  int getCoordsColumnId() const { return coords_column_id_; }
+
+  size_t getNumRows() const { return num_rows_; }
+
+  bool isCompressed() const { return compressed_; }
+
+  struct RowIndex;
+
+  // Builds the index of the given row from its geometry, unless the geometry is too small
+  // to benefit from an index. Rows can be built concurrently, each by a single thread.
+  void buildRowIndex(const size_t row_id,
+                     const int8_t* coords,
+                     const int32_t* ring_sizes,
+                     const int64_t num_rings,
+                     const int32_t* poly_sizes,
+                     const int64_t num_polys,
+                     const int32_t ic);
+
+  // Returns the index of the given row, nullptr if the row has none.
+  const RowIndex* getRowIndex(const size_t row_id) const;
+
+ private:
+  const int coords_column_id_;
+  const size_t num_rows_;
+  const bool compressed_;
+  std::unique_ptr<std::unique_ptr<RowIndex>[]> row_indexes_;
+};
@@ -64,6 +64,7 @@ static_assert(false, "LLVM Version >= 9 is required.");
 #include "OSDependent/omnisci_path.h"
 #include "QueryEngine/CodeGenerator.h"
 #include "QueryEngine/ExtensionFunctionsWhitelist.h"
+#include "QueryEngine/FilterSelection.h"
 #include "QueryEngine/GpuSharedMemoryUtils.h"
 #include "QueryEngine/LLVMFunctionAttributesUtil.h"
 #include "QueryEngine/Optimization/AnnotateInternalFunctionsPass.h"
@@ -71,6 +72,7 @@ static_assert(false, "LLVM Version >= 9 is required.");
 #include "QueryEngine/QueryTemplateGenerator.h"
 #include "Shared/InlineNullValues.h"
 #include "Shared/MathUtils.h"
+#include "Shared/Metrics.h"
 #include "StreamingTopN.h"
 
 float g_fraction_code_cache_to_evict = 0.2;
@@ -323,6 +325,12 @@ void optimize_ir(llvm::Function* query_func,
   pass_manager.add(llvm::createVerifierPass());
   pass_manager.add(llvm::createAlwaysInlinerLegacyPass());
 
+  if (co.opt_level == ExecutorOptLevel::LightJIT) {
+    pass_manager.run(*module);
+    eliminate_dead_self_recursive_funcs(*module, live_funcs);
+    return;
+  }
+
   pass_manager.add(new AnnotateInternalFunctionsPass());
 
   pass_manager.add(llvm::createSROAPass());
@@ -406,12 +414,18 @@ void verify_function_ir(const llvm::Function* func) {
 
 std::shared_ptr<CompilationContext> Executor::getCodeFromCache(const CodeCacheKey& key,
                                                                const CodeCache& cache) {
+  static auto& hits = metrics::Registry::instance().counter(
+      "omnisci_code_cache_hits_total", "Compiled query code found in the code cache.");
+  static auto& misses = metrics::Registry::instance().counter(
+      "omnisci_code_cache_misses_total", "Query code compiled for a code cache miss.");
   auto it = cache.find(key);
   if (it != cache.cend()) {
+    hits.add();
     delete cgen_state_->module_;
     cgen_state_->module_ = it->second.second;
     return it->second.first;
   }
+  misses.add();
   return {};
 }
 
@@ -474,7 +488,8 @@ ExecutionEngineWrapper CodeGenerator::generateNativeCPUCode(
   llvm::TargetOptions to;
   to.EnableFastISel = true;
   eb.setTargetOptions(to);
-  if (co.opt_level == ExecutorOptLevel::ReductionJIT) {
+  if (co.opt_level == ExecutorOptLevel::ReductionJIT ||
+      co.opt_level == ExecutorOptLevel::LightJIT) {
     eb.setOptLevel(llvm::CodeGenOpt::None);
   }
 
@@ -493,7 +508,8 @@ std::shared_ptr<CompilationContext> Executor::optimizeAndCodegenCPU(
     llvm::Function* query_func,
     llvm::Function* multifrag_query_func,
     const std::unordered_set<llvm::Function*>& live_funcs,
-    const CompilationOptions& co) {
+    const CompilationOptions& co,
+    const bool allow_tiered_compilation) {
   auto module = multifrag_query_func->getParent();
   CodeCacheKey key{serialize_llvm_object(query_func),
                    serialize_llvm_object(cgen_state_->row_func_)};
@@ -533,8 +549,22 @@ std::shared_ptr<CompilationContext> Executor::optimizeAndCodegenCPU(
 #endif
   }
 
+  auto compile_co = co;
+  if (g_enable_tiered_compilation && allow_tiered_compilation &&
+      co.opt_level == ExecutorOptLevel::Default &&
+      scheduleOptimizedCPUCode(
+          key, module, query_func, multifrag_query_func, live_funcs, co)) {
+    // Run lightly compiled code first. The optimized code is compiled from a copy of the
+    // module in the background and replaces the light code in the cache once done.
+    static auto& light_compilations = metrics::Registry::instance().counter(
+        "omnisci_tiered_compilation_light_total",
+        "Query code compiled lightly while its optimized code compiles in background.");
+    light_compilations.add();
+    compile_co.opt_level = ExecutorOptLevel::LightJIT;
+  }
+
   auto execution_engine =
-      CodeGenerator::generateNativeCPUCode(query_func, live_funcs, co);
+      CodeGenerator::generateNativeCPUCode(query_func, live_funcs, compile_co);
   auto cpu_compilation_context =
       std::make_shared<CpuCompilationContext>(std::move(execution_engine));
   cpu_compilation_context->setFunctionPointer(multifrag_query_func);
@@ -542,6 +572,108 @@ std::shared_ptr<CompilationContext> Executor::optimizeAndCodegenCPU(
   return cpu_compilation_context;
 }
 
+namespace {
+
+// Bounds the modules waiting for their optimized compilation. Code cache misses while
+// the queue is full are compiled with full optimization right away.
+constexpr size_t kMaxQueuedOptimizedCpuCode{16};
+
+}  // namespace
+
+bool Executor::scheduleOptimizedCPUCode(
+    const CodeCacheKey& key,
+    const llvm::Module* module,
+    const llvm::Function* query_func,
+    const llvm::Function* multifrag_query_func,
+    const std::unordered_set<llvm::Function*>& live_funcs,
+    const CompilationOptions& co) {
+  std::lock_guard<std::mutex> lock(optimized_cpu_code_mutex_);
+  if (optimized_cpu_code_queue_.size() >= kMaxQueuedOptimizedCpuCode) {
+    return false;
+  }
+  // The module lives in the global LLVM context, guarded by the compilation mutex the
+  // caller holds. The worker optimizes a copy parsed from bitcode into a context of its
+  // own, so it does not hold up other compilations.
+  OptimizedCpuCodeTask task{key,
+                            {},
+                            query_func->getName().str(),
+                            multifrag_query_func->getName().str(),
+                            {},
+                            co};
+  llvm::raw_string_ostream os(task.bitcode);
+  llvm::WriteBitcodeToFile(*module, os);
+  os.flush();
+  for (const auto live_func : live_funcs) {
+    task.live_func_names.push_back(live_func->getName().str());
+  }
+  optimized_cpu_code_queue_.push_back(std::move(task));
+  if (!optimized_cpu_code_worker_running_) {
+    optimized_cpu_code_worker_running_ = true;
+    optimized_cpu_code_worker_ = std::async(std::launch::async, [this] {
+      std::unique_lock<std::mutex> worker_lock(optimized_cpu_code_mutex_);
+      while (!optimized_cpu_code_queue_.empty()) {
+        const auto task = std::move(optimized_cpu_code_queue_.front());
+        optimized_cpu_code_queue_.pop_front();
+        worker_lock.unlock();
+        compileOptimizedCPUCode(task);
+        worker_lock.lock();
+      }
+      optimized_cpu_code_worker_running_ = false;
+      optimized_cpu_code_done_.notify_all();
+    });
+  }
+  return true;
+}
+
+void Executor::compileOptimizedCPUCode(const OptimizedCpuCodeTask& task) {
+  static auto& replaced = metrics::Registry::instance().counter(
+      "omnisci_tiered_compilation_replaced_total",
+      "Lightly compiled query code replaced by optimized code in the code cache.");
+  try {
+    auto llvm_context = std::make_unique<llvm::LLVMContext>();
+    auto buffer = llvm::MemoryBuffer::getMemBuffer(task.bitcode, "", false);
+    auto owner = llvm::parseBitcodeFile(buffer->getMemBufferRef(), *llvm_context);
+    if (!owner) {
+      throw std::runtime_error(llvm::toString(owner.takeError()));
+    }
+    auto module = std::move(owner.get());
+    auto query_func = module->getFunction(task.query_func_name);
+    CHECK(query_func);
+    auto multifrag_query_func = module->getFunction(task.multifrag_query_func_name);
+    CHECK(multifrag_query_func);
+    std::unordered_set<llvm::Function*> live_funcs;
+    for (const auto& live_func_name : task.live_func_names) {
+      const auto live_func = module->getFunction(live_func_name);
+      CHECK(live_func);
+      live_funcs.insert(live_func);
+    }
+    // the execution engine takes ownership of the module
+    auto module_ptr = module.release();
+    auto execution_engine =
+        CodeGenerator::generateNativeCPUCode(query_func, live_funcs, task.co);
+    auto cpu_compilation_context = std::make_shared<CpuCompilationContext>(
+        std::move(llvm_context), std::move(execution_engine));
+    cpu_compilation_context->setFunctionPointer(multifrag_query_func);
+    std::lock_guard<std::mutex> compilation_lock(compilation_mutex_);
+    if (cpu_code_cache_.find(task.key) == cpu_code_cache_.cend()) {
+      // the light code has been evicted meanwhile, keep it that way
+      return;
+    }
+    addCodeToCache(task.key, cpu_compilation_context, module_ptr, cpu_code_cache_);
+    replaced.add();
+  } catch (const std::exception& e) {
+    LOG(WARNING) << "Failed to compile optimized code, the lightly compiled code "
+                    "remains in use: "
+                 << e.what();
+  }
+}
+
+void Executor::waitForOptimizedCPUCode() {
+  std::unique_lock<std::mutex> lock(optimized_cpu_code_mutex_);
+  optimized_cpu_code_done_.wait(lock,
+                                [this] { return !optimized_cpu_code_worker_running_; });
+}
+
 void CodeGenerator::link_udf_module(const std::unique_ptr<llvm::Module>& udf_module,
                                     llvm::Module& module,
                                     CgenState* cgen_state,
@@ -2443,6 +2575,14 @@ std::vector<llvm::Value*> Executor::inlineHoistedLiterals() {
 
 namespace {
 
+size_t get_input_row_count(const std::vector<InputTableInfo>& query_infos) {
+  size_t row_count{0};
+  for (const auto& query_info : query_infos) {
+    row_count += query_info.info.getNumTuplesUpperBound();
+  }
+  return row_count;
+}
+
 size_t get_shared_memory_size(const bool shared_mem_used,
                               const QueryMemoryDescriptor* query_mem_desc_ptr) {
   return shared_mem_used
@@ -2767,19 +2907,34 @@ Executor::compileWorkUnit(const std::vector<InputTableInfo>& query_infos,
 
   const auto agg_slot_count = ra_exe_unit.estimator ? size_t(1) : agg_fnames.size();
 
+  // The filter selection descriptor is passed to the query function as a hoisted
+  // literal, so queries which only differ in the literals of the terms share the code.
+  const auto filter_selection_info =
+      g_enable_vectorized_filter && co.device_type == ExecutorDeviceType::CPU &&
+              co.hoist_literals && !ra_exe_unit.union_all
+          ? build_filter_selection_info(ra_exe_unit, *catalog_)
+          : FilterSelectionInfo{};
+  std::optional<size_t> filter_selection_desc_offset;
+  if (!filter_selection_info.descriptor.empty()) {
+    filter_selection_desc_offset = cgen_state_->getOrAddInt64ArrayLiteral(
+        filter_selection_info.descriptor, /*device_id=*/0);
+  }
+
   const bool is_group_by{query_mem_desc->isGroupBy()};
-  auto [query_func, row_func_call] = is_group_by
-                                         ? query_group_by_template(cgen_state_->module_,
-                                                                   co.hoist_literals,
-                                                                   *query_mem_desc,
-                                                                   co.device_type,
-                                                                   ra_exe_unit.scan_limit,
-                                                                   gpu_smem_context)
-                                         : query_template(cgen_state_->module_,
-                                                          agg_slot_count,
-                                                          co.hoist_literals,
-                                                          !!ra_exe_unit.estimator,
-                                                          gpu_smem_context);
+  auto [query_func, row_func_call] =
+      is_group_by ? query_group_by_template(cgen_state_->module_,
+                                            co.hoist_literals,
+                                            *query_mem_desc,
+                                            co.device_type,
+                                            ra_exe_unit.scan_limit,
+                                            gpu_smem_context,
+                                            filter_selection_desc_offset)
+                  : query_template(cgen_state_->module_,
+                                   agg_slot_count,
+                                   co.hoist_literals,
+                                   !!ra_exe_unit.estimator,
+                                   gpu_smem_context,
+                                   filter_selection_desc_offset);
   bind_pos_placeholders("pos_start", true, query_func, cgen_state_->module_);
   bind_pos_placeholders("group_buff_idx", false, query_func, cgen_state_->module_);
   bind_pos_placeholders("pos_step", false, query_func, cgen_state_->module_);
@@ -2830,6 +2985,9 @@ Executor::compileWorkUnit(const std::vector<InputTableInfo>& query_infos,
       buildJoinLoops(body_execution_unit, co, eo, query_infos, column_cache);
 
   plan_state_->allocateLocalColumnIds(ra_exe_unit.input_col_descs);
+  for (const auto& column : filter_selection_info.columns) {
+    plan_state_->columns_to_fetch_.insert(column);
+  }
   for (auto& simple_qual : ra_exe_unit.simple_quals) {
     plan_state_->addSimpleQual(simple_qual);
   }
@@ -3017,7 +3175,13 @@ Executor::compileWorkUnit(const std::vector<InputTableInfo>& query_infos,
   return std::make_tuple(
       CompilationResult{
           co.device_type == ExecutorDeviceType::CPU
-              ? optimizeAndCodegenCPU(query_func, multifrag_query_func, live_funcs, co)
+              ? optimizeAndCodegenCPU(query_func,
+                                      multifrag_query_func,
+                                      live_funcs,
+                                      co,
+                                      !eo.just_explain &&
+                                          get_input_row_count(query_infos) <=
+                                              g_tiered_compilation_max_rows)
               : optimizeAndCodegenGPU(query_func,
                                       multifrag_query_func,
                                       live_funcs,
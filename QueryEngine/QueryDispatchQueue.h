@@ -16,20 +16,82 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
+#include <functional>
 #include <future>
+#include <list>
 #include <mutex>
-#include <queue>
+#include <optional>
+#include <set>
+#include <string>
 #include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Logger/Logger.h"
+#include "Shared/Metrics.h"
 
 /**
  * QueryDispatchQueue maintains a list of pending queries and dispatches those queries as
- * Executors become available
+ * Executors become available.
+ *
+ * Pending queries are grouped into priority classes. Idle workers are shared between the
+ * classes by weight (stride scheduling), so a backlog of low priority queries cannot
+ * starve high priority ones and vice versa. Within a class, queries are dispatched
+ * round-robin across fair share keys (typically the submitting user), so a single user
+ * issuing many long running queries does not monopolize the class. Before a query is
+ * dispatched, its estimated output buffer memory is checked against the memory currently
+ * available for query execution; queries which do not fit are deferred while other
+ * queries are running.
  */
 class QueryDispatchQueue {
  public:
   using Task = std::packaged_task<void(size_t)>;
 
+  enum class Priority { HIGH = 0, NORMAL, LOW };
+  static constexpr size_t NUM_PRIORITIES{3};
+
+  // relative share of idle workers given to each priority class, indexed by Priority
+  static constexpr std::array<size_t, NUM_PRIORITIES> PRIORITY_WEIGHTS{4, 2, 1};
+
+  // number of times a query may be passed over for lack of memory before the queue stops
+  // admitting other queries so that running queries can drain
+  static constexpr size_t MAX_MEMORY_DEFERRALS{16};
+
+  // bound on the number of remembered per-query memory estimates
+  static constexpr size_t MAX_MEMORY_ESTIMATES{1024};
+
+  /**
+   * Scheduling information attached to a submitted task.
+   */
+  struct TaskInfo {
+    Priority priority{Priority::NORMAL};
+    std::string fair_share_key;
+    size_t estimated_memory_bytes{0};
+  };
+
+  /**
+   * Point in time queue statistics for a single priority class.
+   */
+  struct PriorityStats {
+    Priority priority;
+    size_t weight{0};
+    size_t queued_count{0};
+    size_t running_count{0};
+    size_t dispatched_count{0};
+    size_t memory_deferred_count{0};
+    int64_t total_wait_time_ms{0};
+    int64_t max_wait_time_ms{0};
+    int64_t oldest_queued_wait_time_ms{0};
+  };
+
+  // returns the memory (in bytes) currently available for query execution
+  using AvailableMemoryCallback = std::function<size_t()>;
+
   QueryDispatchQueue(const size_t parallel_executors_max) {
     workers_.resize(parallel_executors_max);
     for (size_t i = 0; i < workers_.size(); i++) {
@@ -38,6 +100,12 @@ class QueryDispatchQueue {
     }
     num_running_workers_ = 0;
     num_workers_ = parallel_executors_max;
+    for (size_t i = 0; i < NUM_PRIORITIES; i++) {
+      priority_classes_[i].stats.priority = static_cast<Priority>(i);
+      priority_classes_[i].stats.weight = PRIORITY_WEIGHTS[i];
+    }
+    std::lock_guard<std::mutex> registry_lock(registry_mutex_);
+    registry_.insert(this);
   }
 
   /**
@@ -46,6 +114,12 @@ class QueryDispatchQueue {
    * once the task runs.
    */
   void submit(std::shared_ptr<Task> task, const bool is_update_delete) {
+    submit(task, is_update_delete, TaskInfo{});
+  }
+
+  void submit(std::shared_ptr<Task> task,
+              const bool is_update_delete,
+              const TaskInfo& task_info) {
     if (workers_.size() == 1 && is_update_delete) {
       std::lock_guard<decltype(update_delete_mutex_)> update_delete_lock(
           update_delete_mutex_);
@@ -60,8 +134,24 @@ class QueryDispatchQueue {
     }
     std::unique_lock<decltype(queue_mutex_)> lock(queue_mutex_);
 
-    LOG(INFO) << "Dispatching query with " << queue_.size() << " queries in the queue.";
-    queue_.push(task);
+    auto& priority_class = getPriorityClass(task_info.priority);
+    if (priority_class.stats.queued_count == 0) {
+      // a class which was idle must not be able to bank credit while it had no work
+      priority_class.pass = std::max(priority_class.pass, global_pass_);
+    }
+    auto tasks_it = priority_class.tasks_by_key.find(task_info.fair_share_key);
+    if (tasks_it == priority_class.tasks_by_key.end()) {
+      tasks_it = priority_class.tasks_by_key
+                     .emplace(task_info.fair_share_key, std::deque<QueuedTask>{})
+                     .first;
+      priority_class.key_order.push_back(task_info.fair_share_key);
+    }
+    tasks_it->second.push_back({task, task_info, std::chrono::steady_clock::now(), 0});
+    ++priority_class.stats.queued_count;
+
+    LOG(INFO) << "Dispatching query with " << getQueuedCountUnlocked()
+              << " queries in the queue (priority " << toString(task_info.priority)
+              << ").";
     lock.unlock();
     cv_.notify_all();
   }
@@ -71,7 +161,109 @@ class QueryDispatchQueue {
     return num_running_workers_ < num_workers_;
   }
 
+  void setAvailableMemoryCallback(AvailableMemoryCallback callback) {
+    std::lock_guard<decltype(queue_mutex_)> lock(queue_mutex_);
+    available_memory_callback_ = std::move(callback);
+  }
+
+  void setUserPriority(const std::string& user_name, const Priority priority) {
+    std::lock_guard<decltype(queue_mutex_)> lock(queue_mutex_);
+    user_priorities_[user_name] = priority;
+  }
+
+  Priority getUserPriority(const std::string& user_name) {
+    std::lock_guard<decltype(queue_mutex_)> lock(queue_mutex_);
+    const auto it = user_priorities_.find(user_name);
+    return it == user_priorities_.end() ? Priority::NORMAL : it->second;
+  }
+
+  /**
+   * Remembers the output buffer size of the last execution of a query, so that
+   * subsequent submissions of the same query can be admitted based on their memory
+   * footprint.
+   */
+  void recordMemoryEstimate(const size_t query_hash, const size_t memory_bytes) {
+    std::lock_guard<decltype(queue_mutex_)> lock(queue_mutex_);
+    if (memory_estimates_.size() >= MAX_MEMORY_ESTIMATES &&
+        memory_estimates_.find(query_hash) == memory_estimates_.end()) {
+      memory_estimates_.clear();
+    }
+    memory_estimates_[query_hash] = memory_bytes;
+  }
+
+  size_t getMemoryEstimate(const size_t query_hash) {
+    std::lock_guard<decltype(queue_mutex_)> lock(queue_mutex_);
+    const auto it = memory_estimates_.find(query_hash);
+    return it == memory_estimates_.end() ? 0 : it->second;
+  }
+
+  std::vector<PriorityStats> getQueueStats() {
+    std::lock_guard<decltype(queue_mutex_)> lock(queue_mutex_);
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<PriorityStats> stats;
+    for (const auto& priority_class : priority_classes_) {
+      stats.emplace_back(priority_class.stats);
+      auto& class_stats = stats.back();
+      for (const auto& [key, tasks] : priority_class.tasks_by_key) {
+        if (!tasks.empty()) {
+          class_stats.oldest_queued_wait_time_ms =
+              std::max(class_stats.oldest_queued_wait_time_ms,
+                       getElapsedMs(tasks.front().enqueue_time, now));
+        }
+      }
+    }
+    return stats;
+  }
+
+  /**
+   * Returns queue statistics accumulated over all live dispatch queues in the process.
+   */
+  static std::vector<PriorityStats> getGlobalQueueStats() {
+    std::vector<PriorityStats> global_stats;
+    for (size_t i = 0; i < NUM_PRIORITIES; i++) {
+      global_stats.emplace_back();
+      global_stats.back().priority = static_cast<Priority>(i);
+      global_stats.back().weight = PRIORITY_WEIGHTS[i];
+    }
+    std::lock_guard<std::mutex> registry_lock(registry_mutex_);
+    for (auto dispatch_queue : registry_) {
+      const auto queue_stats = dispatch_queue->getQueueStats();
+      CHECK_EQ(queue_stats.size(), global_stats.size());
+      for (size_t i = 0; i < queue_stats.size(); i++) {
+        auto& stats = global_stats[i];
+        stats.queued_count += queue_stats[i].queued_count;
+        stats.running_count += queue_stats[i].running_count;
+        stats.dispatched_count += queue_stats[i].dispatched_count;
+        stats.memory_deferred_count += queue_stats[i].memory_deferred_count;
+        stats.total_wait_time_ms += queue_stats[i].total_wait_time_ms;
+        stats.max_wait_time_ms =
+            std::max(stats.max_wait_time_ms, queue_stats[i].max_wait_time_ms);
+        stats.oldest_queued_wait_time_ms =
+            std::max(stats.oldest_queued_wait_time_ms,
+                     queue_stats[i].oldest_queued_wait_time_ms);
+      }
+    }
+    return global_stats;
+  }
+
+  static std::string toString(const Priority priority) {
+    switch (priority) {
+      case Priority::HIGH:
+        return "HIGH";
+      case Priority::NORMAL:
+        return "NORMAL";
+      case Priority::LOW:
+        return "LOW";
+    }
+    UNREACHABLE();
+    return "";
+  }
+
   ~QueryDispatchQueue() {
+    {
+      std::lock_guard<std::mutex> registry_lock(registry_mutex_);
+      registry_.erase(this);
+    }
     {
       std::lock_guard<decltype(queue_mutex_)> lock(queue_mutex_);
       threads_should_exit_ = true;
@@ -83,32 +275,178 @@ class QueryDispatchQueue {
   }
 
  private:
+  struct QueuedTask {
+    std::shared_ptr<Task> task;
+    TaskInfo info;
+    std::chrono::steady_clock::time_point enqueue_time;
+    size_t memory_deferrals;
+  };
+
+  struct PriorityClass {
+    // virtual time of the class; the non-empty class with the lowest pass runs next
+    double pass{0};
+    std::unordered_map<std::string, std::deque<QueuedTask>> tasks_by_key;
+    std::list<std::string> key_order;  // round-robin order of keys with pending tasks
+    PriorityStats stats;
+  };
+
+  PriorityClass& getPriorityClass(const Priority priority) {
+    const auto idx = static_cast<size_t>(priority);
+    CHECK_LT(idx, priority_classes_.size());
+    return priority_classes_[idx];
+  }
+
+  size_t getQueuedCountUnlocked() const {
+    size_t queued_count{0};
+    for (const auto& priority_class : priority_classes_) {
+      queued_count += priority_class.stats.queued_count;
+    }
+    return queued_count;
+  }
+
+  static int64_t getElapsedMs(const std::chrono::steady_clock::time_point& begin,
+                              const std::chrono::steady_clock::time_point& end) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+  }
+
+  static metrics::Histogram& getWaitTimeHistogram(const Priority priority) {
+    static const auto histograms = [] {
+      std::array<metrics::Histogram*, NUM_PRIORITIES> histograms;
+      for (size_t i = 0; i < NUM_PRIORITIES; i++) {
+        histograms[i] = &metrics::Registry::instance().histogram(
+            "omnisci_dispatch_queue_wait_microseconds",
+            "Time queries wait in the dispatch queue for an executor.",
+            "priority=\"" + toString(static_cast<Priority>(i)) + "\"");
+      }
+      return histograms;
+    }();
+    return *histograms[static_cast<size_t>(priority)];
+  }
+
+  bool fitsInMemory(const QueuedTask& queued_task, const size_t available_memory) const {
+    if (num_running_workers_ == 0 || queued_task.info.estimated_memory_bytes == 0) {
+      // always make progress when nothing else is running
+      return true;
+    }
+    const auto reserved = std::min(reserved_memory_bytes_, available_memory);
+    return queued_task.info.estimated_memory_bytes <= available_memory - reserved;
+  }
+
+  /**
+   * Picks the next task to run, visiting priority classes in order of their virtual time
+   * and fair share keys in round-robin order. Returns an empty optional if there is no
+   * pending task, or if none of the pending tasks can be admitted at this time.
+   */
+  std::optional<QueuedTask> popNextTaskUnlocked() {
+    std::vector<size_t> class_order;
+    for (size_t i = 0; i < priority_classes_.size(); i++) {
+      if (priority_classes_[i].stats.queued_count > 0) {
+        class_order.push_back(i);
+      }
+    }
+    if (class_order.empty()) {
+      return std::nullopt;
+    }
+    std::stable_sort(class_order.begin(), class_order.end(), [this](size_t a, size_t b) {
+      return priority_classes_[a].pass < priority_classes_[b].pass;
+    });
+
+    std::optional<size_t> available_memory;
+    std::vector<QueuedTask*> deferred_tasks;
+    for (const auto class_idx : class_order) {
+      auto& priority_class = priority_classes_[class_idx];
+      for (auto key_it = priority_class.key_order.begin();
+           key_it != priority_class.key_order.end();
+           ++key_it) {
+        auto tasks_it = priority_class.tasks_by_key.find(*key_it);
+        CHECK(tasks_it != priority_class.tasks_by_key.end());
+        auto& tasks = tasks_it->second;
+        CHECK(!tasks.empty());
+        auto& candidate = tasks.front();
+        if (candidate.info.estimated_memory_bytes > 0 && available_memory_callback_ &&
+            num_running_workers_ > 0) {
+          if (!available_memory) {
+            available_memory = available_memory_callback_();
+          }
+          if (!fitsInMemory(candidate, *available_memory)) {
+            if (candidate.memory_deferrals >= MAX_MEMORY_DEFERRALS) {
+              // stop admitting smaller queries until this one fits
+              return std::nullopt;
+            }
+            deferred_tasks.push_back(&candidate);
+            continue;
+          }
+        }
+        for (auto deferred_task : deferred_tasks) {
+          if (deferred_task->memory_deferrals++ == 0) {
+            ++getPriorityClass(deferred_task->info.priority).stats.memory_deferred_count;
+          }
+        }
+        QueuedTask queued_task = std::move(candidate);
+        tasks.pop_front();
+        const auto key = *key_it;
+        priority_class.key_order.erase(key_it);
+        if (tasks.empty()) {
+          priority_class.tasks_by_key.erase(tasks_it);
+        } else {
+          priority_class.key_order.push_back(key);
+        }
+        --priority_class.stats.queued_count;
+        priority_class.pass += 1.0 / priority_class.stats.weight;
+        global_pass_ = priority_class.pass;
+        return queued_task;
+      }
+    }
+    return std::nullopt;
+  }
+
   void worker(const size_t worker_idx) {
     std::unique_lock<std::mutex> lock(queue_mutex_);
     while (true) {
-      cv_.wait(lock, [this] { return !queue_.empty() || threads_should_exit_; });
-
       if (threads_should_exit_) {
         return;
       }
 
-      if (!queue_.empty()) {
-        auto task = queue_.front();
-        queue_.pop();
-        ++num_running_workers_;
-
-        LOG(INFO) << "Worker " << worker_idx
-                  << " running query and returning control. There are now "
-                  << num_running_workers_ << " workers are running and " << queue_.size()
-                  << " queries in the queue.";
-        // allow other threads to pick up tasks
-        lock.unlock();
-        CHECK(task);
-        (*task)(worker_idx);
-        // wait for signal
-        lock.lock();
-        --num_running_workers_;
+      auto queued_task = popNextTaskUnlocked();
+      if (!queued_task) {
+        // wait for a new query or for a running query to release its memory
+        cv_.wait(lock);
+        continue;
       }
+
+      auto& priority_class = getPriorityClass(queued_task->info.priority);
+      const auto dispatch_time = std::chrono::steady_clock::now();
+      const auto wait_time_ms = getElapsedMs(queued_task->enqueue_time, dispatch_time);
+      getWaitTimeHistogram(queued_task->info.priority)
+          .record(std::chrono::duration_cast<std::chrono::microseconds>(
+                      dispatch_time - queued_task->enqueue_time)
+                      .count());
+      ++priority_class.stats.dispatched_count;
+      ++priority_class.stats.running_count;
+      priority_class.stats.total_wait_time_ms += wait_time_ms;
+      priority_class.stats.max_wait_time_ms =
+          std::max(priority_class.stats.max_wait_time_ms, wait_time_ms);
+      const auto reserved_memory_bytes = queued_task->info.estimated_memory_bytes;
+      reserved_memory_bytes_ += reserved_memory_bytes;
+      ++num_running_workers_;
+
+      LOG(INFO) << "Worker " << worker_idx
+                << " running query and returning control. There are now "
+                << num_running_workers_ << " workers are running and "
+                << getQueuedCountUnlocked() << " queries in the queue. Query waited "
+                << wait_time_ms << " ms (priority "
+                << toString(queued_task->info.priority) << ").";
+      // allow other threads to pick up tasks
+      lock.unlock();
+      CHECK(queued_task->task);
+      (*queued_task->task)(worker_idx);
+      // wait for signal
+      lock.lock();
+      --num_running_workers_;
+      --priority_class.stats.running_count;
+      reserved_memory_bytes_ -= reserved_memory_bytes;
+      // memory deferred queries may be admissible now
+      cv_.notify_all();
     }
   }
 
@@ -118,8 +456,16 @@ class QueryDispatchQueue {
   std::mutex update_delete_mutex_;
 
   bool threads_should_exit_{false};
-  std::queue<std::shared_ptr<Task>> queue_;
+  std::array<PriorityClass, NUM_PRIORITIES> priority_classes_;
+  double global_pass_{0};
   std::vector<std::thread> workers_;
   int num_running_workers_;  // manipulate this under queue_lock
   int num_workers_;
+  size_t reserved_memory_bytes_{0};
+  AvailableMemoryCallback available_memory_callback_;
+  std::unordered_map<std::string, Priority> user_priorities_;
+  std::unordered_map<size_t, size_t> memory_estimates_;
+
+  inline static std::mutex registry_mutex_;
+  inline static std::set<QueryDispatchQueue*> registry_;
 };
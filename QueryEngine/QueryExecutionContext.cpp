@@ -556,7 +556,8 @@ std::vector<int64_t*> QueryExecutionContext::launchCpuCode(
     int32_t* error_code,
     const uint32_t num_tables,
     const std::vector<int8_t*>& join_hash_tables,
-    const int64_t num_rows_to_process) {
+    const int64_t num_rows_to_process,
+    const std::optional<SharedScanManager::Key>& shared_scan) {
   auto timer = DEBUG_TIMER(__func__);
   INJECT_TIMER(lauchCpuCode);
 
@@ -586,8 +587,15 @@ std::vector<int64_t*> QueryExecutionContext::launchCpuCode(
         reinterpret_cast<int64_t*>(estimator_result_set_->getHostEstimatorBuffer()));
   } else {
     if (!is_group_by) {
+      // a shared scan runs the kernel once per block, each into an output slot of its own
+      const auto num_out_slots =
+          shared_scan ? SharedScanManager::getBlockCount(shared_scan->num_rows)
+                      : num_out_frags;
       for (size_t i = 0; i < init_agg_vals.size(); ++i) {
-        auto buff = new int64_t[num_out_frags];
+        auto buff = new int64_t[num_out_slots];
+        if (shared_scan) {
+          std::fill(buff, buff + num_out_slots, init_agg_vals[i]);
+        }
         out_vec.push_back(static_cast<int64_t*>(buff));
       }
     }
@@ -629,85 +637,91 @@ std::vector<int64_t*> QueryExecutionContext::launchCpuCode(
           : (join_hash_tables.size() > 1
                  ? reinterpret_cast<const int64_t*>(&join_hash_tables[0])
                  : nullptr);
-  if (hoist_literals) {
-    using agg_query = void (*)(const int8_t***,  // col_buffers
-                               const uint64_t*,  // num_fragments
-                               const int8_t*,    // literals
-                               const int64_t*,   // num_rows
-                               const uint64_t*,  // frag_row_offsets
-                               const int32_t*,   // max_matched
-                               int32_t*,         // total_matched
-                               const int64_t*,   // init_agg_value
-                               int64_t**,        // out
-                               int32_t*,         // error_code
-                               const uint32_t*,  // num_tables
-                               const int64_t*);  // join_hash_tables_ptr
-    if (is_group_by) {
-      reinterpret_cast<agg_query>(native_code->func())(
-          multifrag_cols_ptr,
-          &num_fragments,
-          literal_buff.data(),
-          num_rows_ptr,
-          flatened_frag_offsets.data(),
-          &scan_limit,
-          &total_matched_init,
-          cmpt_val_buff.data(),
-          query_buffers_->getGroupByBuffersPtr(),
-          error_code,
-          &num_tables,
-          join_hash_tables_ptr);
-    } else {
+  const int64_t* init_vals_ptr =
+      is_group_by ? cmpt_val_buff.data() : init_agg_vals.data();
+  auto launch = [&](const int64_t* rows_ptr, int64_t** out, int32_t* launch_error_code) {
+    if (hoist_literals) {
+      using agg_query = void (*)(const int8_t***,  // col_buffers
+                                 const uint64_t*,  // num_fragments
+                                 const int8_t*,    // literals
+                                 const int64_t*,   // num_rows
+                                 const uint64_t*,  // frag_row_offsets
+                                 const int32_t*,   // max_matched
+                                 int32_t*,         // total_matched
+                                 const int64_t*,   // init_agg_value
+                                 int64_t**,        // out
+                                 int32_t*,         // error_code
+                                 const uint32_t*,  // num_tables
+                                 const int64_t*);  // join_hash_tables_ptr
       reinterpret_cast<agg_query>(native_code->func())(multifrag_cols_ptr,
                                                        &num_fragments,
                                                        literal_buff.data(),
-                                                       num_rows_ptr,
+                                                       rows_ptr,
                                                        flatened_frag_offsets.data(),
                                                        &scan_limit,
                                                        &total_matched_init,
-                                                       init_agg_vals.data(),
-                                                       out_vec.data(),
-                                                       error_code,
+                                                       init_vals_ptr,
+                                                       out,
+                                                       launch_error_code,
                                                        &num_tables,
                                                        join_hash_tables_ptr);
-    }
-  } else {
-    using agg_query = void (*)(const int8_t***,  // col_buffers
-                               const uint64_t*,  // num_fragments
-                               const int64_t*,   // num_rows
-                               const uint64_t*,  // frag_row_offsets
-                               const int32_t*,   // max_matched
-                               int32_t*,         // total_matched
-                               const int64_t*,   // init_agg_value
-                               int64_t**,        // out
-                               int32_t*,         // error_code
-                               const uint32_t*,  // num_tables
-                               const int64_t*);  // join_hash_tables_ptr
-    if (is_group_by) {
-      reinterpret_cast<agg_query>(native_code->func())(
-          multifrag_cols_ptr,
-          &num_fragments,
-          num_rows_ptr,
-          flatened_frag_offsets.data(),
-          &scan_limit,
-          &total_matched_init,
-          cmpt_val_buff.data(),
-          query_buffers_->getGroupByBuffersPtr(),
-          error_code,
-          &num_tables,
-          join_hash_tables_ptr);
     } else {
+      using agg_query = void (*)(const int8_t***,  // col_buffers
+                                 const uint64_t*,  // num_fragments
+                                 const int64_t*,   // num_rows
+                                 const uint64_t*,  // frag_row_offsets
+                                 const int32_t*,   // max_matched
+                                 int32_t*,         // total_matched
+                                 const int64_t*,   // init_agg_value
+                                 int64_t**,        // out
+                                 int32_t*,         // error_code
+                                 const uint32_t*,  // num_tables
+                                 const int64_t*);  // join_hash_tables_ptr
       reinterpret_cast<agg_query>(native_code->func())(multifrag_cols_ptr,
                                                        &num_fragments,
-                                                       num_rows_ptr,
+                                                       rows_ptr,
                                                        flatened_frag_offsets.data(),
                                                        &scan_limit,
                                                        &total_matched_init,
-                                                       init_agg_vals.data(),
-                                                       out_vec.data(),
-                                                       error_code,
+                                                       init_vals_ptr,
+                                                       out,
+                                                       launch_error_code,
                                                        &num_tables,
                                                        join_hash_tables_ptr);
     }
+  };
+  if (shared_scan) {
+    CHECK(!ra_exe_unit.estimator);
+    CHECK_EQ(num_fragments, uint64_t(1));
+    CHECK_EQ(num_tables, uint32_t(1));
+    CHECK_EQ(*error_code, 0);
+    SharedScanManager::BlockFunction run_block =
+        [&](const int64_t begin, const int64_t end, const size_t block_idx) {
+          // the kernel resumes at the row passed in the error code and stops at the
+          // row count, so both delimit the block
+          int32_t block_error_code = static_cast<int32_t>(begin);
+          int64_t block_num_rows = end;
+          std::vector<int64_t*> block_out_vec;
+          if (!is_group_by) {
+            for (auto out : out_vec) {
+              block_out_vec.push_back(out + block_idx);
+            }
+          }
+          launch(&block_num_rows,
+                 is_group_by ? query_buffers_->getGroupByBuffersPtr()
+                             : block_out_vec.data(),
+                 &block_error_code);
+          if (block_error_code) {
+            *error_code = block_error_code;
+            return false;
+          }
+          return true;
+        };
+    SharedScanManager::instance().scan(*shared_scan, run_block);
+  } else {
+    launch(num_rows_ptr,
+           is_group_by ? query_buffers_->getGroupByBuffersPtr() : out_vec.data(),
+           error_code);
   }
 
   if (ra_exe_unit.estimator) {
@@ -25,8 +25,10 @@
 
 #include "CompilationContext.h"
 #include "QueryMemoryInitializer.h"
+#include "SharedScan.h"
 
 #include <boost/core/noncopyable.hpp>
+#include <optional>
 #include <vector>
 
 class GpuCompilationContext;
@@ -92,7 +94,8 @@ class QueryExecutionContext : boost::noncopyable {
       int32_t* error_code,
       const uint32_t num_tables,
       const std::vector<int8_t*>& join_hash_tables,
-      const int64_t num_rows_to_process = -1);
+      const int64_t num_rows_to_process = -1,
+      const std::optional<SharedScanManager::Key>& shared_scan = std::nullopt);
 
   int64_t getAggInitValForIndex(const size_t index) const;
 
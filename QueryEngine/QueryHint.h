@@ -36,6 +36,7 @@ enum QueryHint {
   kOverlapsNoCache,
   kOverlapsKeysPerBin,
   kHashJoin,
+  kQueryTrace,
   kHintCount,   // should be at the last elem before INVALID enum value to count #
                 // supported hints correctly
   kInvalidHint  // this should be the last elem of this enum
@@ -95,6 +96,7 @@ static const std::unordered_map<std::string, QueryHint> SupportedQueryHints = {
     {"overlaps_no_cache", QueryHint::kOverlapsNoCache},
     {"overlaps_keys_per_bin", QueryHint::kOverlapsKeysPerBin},
     {"hash_join", QueryHint::kHashJoin},
+    {"query_trace", QueryHint::kQueryTrace},
 };
 
 struct HintIdentifier {
@@ -200,6 +202,7 @@ struct RegisteredQueryHint {
       , overlaps_allow_gpu_build(false)
       , overlaps_no_cache(false)
       , overlaps_keys_per_bin(g_overlaps_target_entries_per_bin)
+      , query_trace(false)
       , registered_hint(QueryHint::kHintCount, false) {}
 
   RegisteredQueryHint operator||(const RegisteredQueryHint& global_hints) const {
@@ -251,6 +254,10 @@ struct RegisteredQueryHint {
                 global_hints.overlaps_keys_per_bin;
             break;
           }
+          case static_cast<int>(QueryHint::kQueryTrace): {
+            updated_query_hints.query_trace = true;
+            break;
+          }
         }
       }
     }
@@ -272,6 +279,9 @@ struct RegisteredQueryHint {
   bool overlaps_no_cache;
   double overlaps_keys_per_bin;
 
+  // query tracing
+  bool query_trace;
+
   std::vector<bool> registered_hint;
 
   static RegisteredQueryHint defaults() { return RegisteredQueryHint(); }
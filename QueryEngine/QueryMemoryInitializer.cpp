@@ -408,6 +408,9 @@ void QueryMemoryInitializer::initGroupByBuffer(
     const Executor* executor) {
   if (output_columnar) {
     initColumnarGroups(query_mem_desc, buffer, init_agg_vals_, executor);
+  } else if (query_mem_desc.usesPagedPerfectHash()) {
+    CHECK(device_type == ExecutorDeviceType::CPU);
+    initPagedRowGroups(query_mem_desc, buffer, init_agg_vals_, executor);
   } else {
     auto rows_ptr = buffer;
     auto actual_entry_count = query_mem_desc.getEntryCount();
@@ -514,6 +517,34 @@ void QueryMemoryInitializer::initRowGroups(const QueryMemoryDescriptor& query_me
   }
 }
 
+void QueryMemoryInitializer::initPagedRowGroups(
+    const QueryMemoryDescriptor& query_mem_desc,
+    int64_t* groups_buffer,
+    const std::vector<int64_t>& init_vals,
+    const Executor* executor) {
+  const size_t row_size{query_mem_desc.getRowSize()};
+  const size_t col_base_off{query_mem_desc.getColOffInBytes(0)};
+  auto agg_bitmap_size = allocateCountDistinctBuffers(query_mem_desc, true, executor);
+  auto quantile_params = allocateTDigests(query_mem_desc, true, executor);
+  auto const is_true = [](auto const& x) { return static_cast<bool>(x); };
+  CHECK(std::none_of(agg_bitmap_size.begin(), agg_bitmap_size.end(), is_true));
+  CHECK(std::none_of(quantile_params.begin(), quantile_params.end(), is_true));
+
+  auto template_row = reinterpret_cast<int8_t*>(groups_buffer) +
+                      query_mem_desc.getEntryCount() * row_size;
+  if (!query_mem_desc.hasKeylessHash()) {
+    result_set::fill_empty_key(template_row,
+                               query_mem_desc.getGroupbyColCount(),
+                               query_mem_desc.getEffectiveKeyWidth());
+  }
+  initColumnsPerRow(ResultSet::fixupQueryMemoryDescriptor(query_mem_desc),
+                    template_row + col_base_off,
+                    init_vals,
+                    agg_bitmap_size,
+                    quantile_params);
+  memset(template_row + row_size, 0, query_mem_desc.getPageCount());
+}
+
 namespace {
 
 template <typename T>
@@ -147,6 +147,13 @@ class QueryMemoryInitializer {
                      const size_t warp_size,
                      const Executor* executor);
 
+  // Writes the template row and clears the page flags of a paged perfect hash buffer,
+  // the entries themselves are initialized by the kernel on first touch.
+  void initPagedRowGroups(const QueryMemoryDescriptor& query_mem_desc,
+                          int64_t* groups_buffer,
+                          const std::vector<int64_t>& init_vals,
+                          const Executor* executor);
+
   void initColumnarGroups(const QueryMemoryDescriptor& query_mem_desc,
                           int64_t* groups_buffer,
                           const std::vector<int64_t>& init_vals,
@@ -15,6 +15,7 @@
  */
 
 #include "QueryTemplateGenerator.h"
+#include "FilterSelection.h"
 #include "IRCodegenUtils.h"
 #include "Logger/Logger.h"
 
@@ -190,6 +191,49 @@ llvm::Function* row_process(llvm::Module* mod,
   return func_ptr;
 }
 
+// Allocates the filter selection state on the stack of the query function and loads the
+// address of the descriptor, a hoisted literal, so that queries which only differ in the
+// literals of their filter terms share the generated code.
+std::pair<llvm::Value*, llvm::Value*> create_filter_selection_state(
+    llvm::Module* mod,
+    llvm::Value* literals,
+    const size_t filter_selection_desc_offset,
+    llvm::BasicBlock* bb_entry) {
+  using namespace llvm;
+  CHECK(mod->getFunction("filter_selection_fill"));
+  CHECK(mod->getFunction("filter_selection_next"));
+  CHECK(literals);
+  auto i8_type = IntegerType::get(mod->getContext(), 8);
+  auto i32_type = IntegerType::get(mod->getContext(), 32);
+  auto i64_type = IntegerType::get(mod->getContext(), 64);
+  auto pi32_type = PointerType::get(i32_type, 0);
+  auto pi64_type = PointerType::get(i64_type, 0);
+  // the literal slot holds the offset of the array in its upper 16 bits
+  auto desc_slot_ptr = GetElementPtrInst::CreateInBounds(
+      i8_type,
+      literals,
+      ConstantInt::get(i32_type, filter_selection_desc_offset),
+      "",
+      bb_entry);
+  auto desc_off_and_len =
+      new LoadInst(i32_type,
+                   new BitCastInst(desc_slot_ptr, pi32_type, "", bb_entry),
+                   "filter_selection_desc_off_and_len",
+                   false,
+                   bb_entry);
+  auto desc_off = BinaryOperator::Create(
+      Instruction::LShr, desc_off_and_len, ConstantInt::get(i32_type, 16), "", bb_entry);
+  auto desc_ptr =
+      GetElementPtrInst::CreateInBounds(i8_type, literals, desc_off, "", bb_entry);
+  auto state_ptr =
+      new AllocaInst(ArrayType::get(i64_type, kFilterSelectionStateSize),
+                     0,
+                     "filter_selection_state",
+                     bb_entry);
+  return {new BitCastInst(state_ptr, pi64_type, "", bb_entry),
+          new BitCastInst(desc_ptr, pi64_type, "filter_selection_desc", bb_entry)};
+}
+
 }  // namespace
 
 template <class Attributes>
@@ -198,7 +242,8 @@ std::tuple<llvm::Function*, llvm::CallInst*> query_template_impl(
     const size_t aggr_col_count,
     const bool hoist_literals,
     const bool is_estimate_query,
-    const GpuSharedMemoryContext& gpu_smem_context) {
+    const GpuSharedMemoryContext& gpu_smem_context,
+    const std::optional<size_t>& filter_selection_desc_offset) {
   using namespace llvm;
 
   auto func_pos_start = pos_start<Attributes>(mod);
@@ -395,7 +440,22 @@ std::tuple<llvm::Function*, llvm::CallInst*> query_template_impl(
     group_buff_idx->setAttributes(group_buff_idx_pal);
   }
 
-  CastInst* pos_start_i64 = new SExtInst(pos_start, i64_type, "", bb_entry);
+  Value* pos_start_i64 = new SExtInst(pos_start, i64_type, "", bb_entry);
+  Value* filter_selection_state{nullptr};
+  Value* filter_selection_desc_ptr{nullptr};
+  if (filter_selection_desc_offset) {
+    std::tie(filter_selection_state, filter_selection_desc_ptr) =
+        create_filter_selection_state(
+            mod, literals, *filter_selection_desc_offset, bb_entry);
+    pos_start_i64 = CallInst::Create(mod->getFunction("filter_selection_fill"),
+                                     std::vector<Value*>{filter_selection_state,
+                                                         filter_selection_desc_ptr,
+                                                         byte_stream,
+                                                         pos_start_i64,
+                                                         row_count},
+                                     "",
+                                     bb_entry);
+  }
   ICmpInst* enter_or_not =
       new ICmpInst(*bb_entry, ICmpInst::ICMP_SLT, pos_start_i64, row_count, "");
   BranchInst::Create(bb_preheader, bb_exit, enter_or_not, bb_entry);
@@ -432,8 +492,18 @@ std::tuple<llvm::Function*, llvm::CallInst*> query_template_impl(
   Attributes row_process_pal;
   row_process->setAttributes(row_process_pal);
 
-  BinaryOperator* pos_inc =
-      BinaryOperator::CreateNSW(Instruction::Add, pos, pos_step_i64, "", bb_forbody);
+  Value* pos_inc{nullptr};
+  if (!filter_selection_desc_offset) {
+    pos_inc =
+        BinaryOperator::CreateNSW(Instruction::Add, pos, pos_step_i64, "", bb_forbody);
+  } else {
+    pos_inc = CallInst::Create(
+        mod->getFunction("filter_selection_next"),
+        std::vector<Value*>{
+            filter_selection_state, filter_selection_desc_ptr, byte_stream, row_count},
+        "",
+        bb_forbody);
+  }
   ICmpInst* loop_or_exit =
       new ICmpInst(*bb_forbody, ICmpInst::ICMP_SLT, pos_inc, row_count, "");
   BranchInst::Create(bb_forbody, bb_crit_edge, loop_or_exit, bb_forbody);
@@ -564,7 +634,8 @@ std::tuple<llvm::Function*, llvm::CallInst*> query_group_by_template_impl(
     const QueryMemoryDescriptor& query_mem_desc,
     const ExecutorDeviceType device_type,
     const bool check_scan_limit,
-    const GpuSharedMemoryContext& gpu_smem_context) {
+    const GpuSharedMemoryContext& gpu_smem_context,
+    const std::optional<size_t>& filter_selection_desc_offset) {
   if (gpu_smem_context.isSharedMemoryUsed()) {
     CHECK(device_type == ExecutorDeviceType::GPU);
   }
@@ -774,7 +845,23 @@ std::tuple<llvm::Function*, llvm::CallInst*> query_group_by_template_impl(
   }
   CHECK(varlen_output_buffer);
 
-  CastInst* pos_start_i64 = new SExtInst(pos_start, i64_type, "", bb_entry);
+  Value* pos_start_i64 = new SExtInst(pos_start, i64_type, "", bb_entry);
+  Value* filter_selection_state{nullptr};
+  Value* filter_selection_desc_ptr{nullptr};
+  if (filter_selection_desc_offset) {
+    CHECK(device_type == ExecutorDeviceType::CPU);
+    std::tie(filter_selection_state, filter_selection_desc_ptr) =
+        create_filter_selection_state(
+            mod, literals, *filter_selection_desc_offset, bb_entry);
+    pos_start_i64 = CallInst::Create(mod->getFunction("filter_selection_fill"),
+                                     std::vector<Value*>{filter_selection_state,
+                                                         filter_selection_desc_ptr,
+                                                         byte_stream,
+                                                         pos_start_i64,
+                                                         row_count},
+                                     "",
+                                     bb_entry);
+  }
   GetElementPtrInst* group_by_buffers_gep = GetElementPtrInst::Create(
       Ty->getElementType(), group_by_buffers, group_buff_idx, "", bb_entry);
   LoadInst* col_buffer = new LoadInst(get_pointer_element_type(group_by_buffers_gep),
@@ -843,8 +930,17 @@ std::tuple<llvm::Function*, llvm::CallInst*> query_group_by_template_impl(
                      bb_forbody);
   }
 
-  BinaryOperator* pos_inc =
-      BinaryOperator::Create(Instruction::Add, pos, pos_step_i64, "", bb_forbody);
+  Value* pos_inc{nullptr};
+  if (!filter_selection_desc_offset) {
+    pos_inc = BinaryOperator::Create(Instruction::Add, pos, pos_step_i64, "", bb_forbody);
+  } else {
+    pos_inc = CallInst::Create(
+        mod->getFunction("filter_selection_next"),
+        std::vector<Value*>{
+            filter_selection_state, filter_selection_desc_ptr, byte_stream, row_count},
+        "",
+        bb_forbody);
+  }
   ICmpInst* loop_or_exit =
       new ICmpInst(*bb_forbody, ICmpInst::ICMP_SLT, pos_inc, row_count, "");
   if (check_scan_limit) {
@@ -917,9 +1013,14 @@ std::tuple<llvm::Function*, llvm::CallInst*> query_template(
     const size_t aggr_col_count,
     const bool hoist_literals,
     const bool is_estimate_query,
-    const GpuSharedMemoryContext& gpu_smem_context) {
-  return query_template_impl<llvm::AttributeList>(
-      module, aggr_col_count, hoist_literals, is_estimate_query, gpu_smem_context);
+    const GpuSharedMemoryContext& gpu_smem_context,
+    const std::optional<size_t>& filter_selection_desc_offset) {
+  return query_template_impl<llvm::AttributeList>(module,
+                                                  aggr_col_count,
+                                                  hoist_literals,
+                                                  is_estimate_query,
+                                                  gpu_smem_context,
+                                                  filter_selection_desc_offset);
 }
 std::tuple<llvm::Function*, llvm::CallInst*> query_group_by_template(
     llvm::Module* module,
@@ -927,11 +1028,13 @@ std::tuple<llvm::Function*, llvm::CallInst*> query_group_by_template(
     const QueryMemoryDescriptor& query_mem_desc,
     const ExecutorDeviceType device_type,
     const bool check_scan_limit,
-    const GpuSharedMemoryContext& gpu_smem_context) {
+    const GpuSharedMemoryContext& gpu_smem_context,
+    const std::optional<size_t>& filter_selection_desc_offset) {
   return query_group_by_template_impl<llvm::AttributeList>(module,
                                                            hoist_literals,
                                                            query_mem_desc,
                                                            device_type,
                                                            check_scan_limit,
-                                                           gpu_smem_context);
+                                                           gpu_smem_context,
+                                                           filter_selection_desc_offset);
 }
@@ -22,20 +22,24 @@
 #include <llvm/IR/Function.h>
 #include <llvm/IR/Module.h>
 
+#include <optional>
 #include <string>
+#include <vector>
 
 std::tuple<llvm::Function*, llvm::CallInst*> query_template(
     llvm::Module*,
     const size_t aggr_col_count,
     const bool hoist_literals,
     const bool is_estimate_query,
-    const GpuSharedMemoryContext& gpu_smem_context);
+    const GpuSharedMemoryContext& gpu_smem_context,
+    const std::optional<size_t>& filter_selection_desc_offset);
 std::tuple<llvm::Function*, llvm::CallInst*> query_group_by_template(
     llvm::Module*,
     const bool hoist_literals,
     const QueryMemoryDescriptor& query_mem_desc,
     const ExecutorDeviceType,
     const bool check_scan_limit,
-    const GpuSharedMemoryContext& gpu_smem_context);
+    const GpuSharedMemoryContext& gpu_smem_context,
+    const std::optional<size_t>& filter_selection_desc_offset);
 
 #endif  // QUERYENGINE_QUERYTEMPLATEGENERATOR_H
@@ -2362,6 +2362,15 @@ class RelAlgDagBuilder : public boost::noncopyable {
           }
           break;
         }
+        case QueryHint::kQueryTrace: {
+          // a trace covers the whole query, so the hint applies globally wherever it is
+          // given
+          query_hint.registerHint(QueryHint::kQueryTrace);
+          query_hint.query_trace = true;
+          global_query_hint.registerHint(QueryHint::kQueryTrace);
+          global_query_hint.query_trace = true;
+          break;
+        }
         default:
           break;
       }
@@ -17,6 +17,7 @@
 #include "RelAlgExecutor.h"
 #include "DataMgr/ForeignStorage/ForeignStorageException.h"
 #include "DataMgr/ForeignStorage/MetadataPlaceholder.h"
+#include "Fragmenter/InsertWriteAheadLog.h"
 #include "Parser/ParserNode.h"
 #include "QueryEngine/CalciteDeserializerUtils.h"
 #include "QueryEngine/CardinalityEstimator.h"
@@ -55,6 +56,7 @@ bool g_enable_union{false};
 size_t g_estimator_failure_max_groupby_size{256000000};
 bool g_columnar_large_projections{true};
 size_t g_columnar_large_projections_threshold{1000000};
+bool g_enable_string_key_group_by{false};
 
 extern bool g_enable_bump_allocator;
 extern size_t g_default_max_groups_buffer_entry_guess;
@@ -1468,6 +1470,41 @@ std::vector<std::shared_ptr<Analyzer::Expr>> translate_scalar_sources_for_update
   return scalar_sources;
 }
 
+// None encoded string keys are grouped by through the string key arena when enabled,
+// which makes the translation of the scalar source to a transient dictionary useless.
+std::shared_ptr<Analyzer::Expr> set_transient_dict_for_groupby(
+    const std::shared_ptr<Analyzer::Expr> expr) {
+  if (g_enable_string_key_group_by) {
+    const auto uoper = std::dynamic_pointer_cast<Analyzer::UOper>(expr);
+    if (uoper && uoper->get_optype() == kCAST) {
+      const auto& ti = uoper->get_type_info();
+      const auto& operand_ti = uoper->get_operand()->get_type_info();
+      if (ti.is_string() && ti.get_compression() == kENCODING_DICT &&
+          ti.get_comp_param() == TRANSIENT_DICT_ID && operand_ti.is_string() &&
+          operand_ti.get_compression() == kENCODING_NONE) {
+        return uoper->get_own_operand();
+      }
+    }
+    const auto& ti = expr->get_type_info();
+    if (ti.is_string() && ti.get_compression() == kENCODING_NONE) {
+      return expr;
+    }
+  }
+  return set_transient_dict(expr);
+}
+
+// Group by targets are read from the group key, except for none encoded strings whose key
+// is only their id in the string key arena. Those sample the string itself instead.
+std::shared_ptr<Analyzer::Expr> groupby_target_ref(
+    const std::shared_ptr<Analyzer::Expr>& groupby_expr,
+    const int varno) {
+  const auto& ti = groupby_expr->get_type_info();
+  if (ti.is_string() && ti.get_compression() == kENCODING_NONE) {
+    return makeExpr<Analyzer::AggExpr>(ti, kSAMPLE, groupby_expr, false, nullptr);
+  }
+  return var_ref(groupby_expr.get(), Analyzer::Var::kGROUPBY, varno);
+}
+
 std::list<std::shared_ptr<Analyzer::Expr>> translate_groupby_exprs(
     const RelCompound* compound,
     const std::vector<std::shared_ptr<Analyzer::Expr>>& scalar_sources) {
@@ -1476,7 +1513,7 @@ std::list<std::shared_ptr<Analyzer::Expr>> translate_groupby_exprs(
   }
   std::list<std::shared_ptr<Analyzer::Expr>> groupby_exprs;
   for (size_t group_idx = 0; group_idx < compound->getGroupByCount(); ++group_idx) {
-    groupby_exprs.push_back(set_transient_dict(scalar_sources[group_idx]));
+    groupby_exprs.push_back(set_transient_dict_for_groupby(scalar_sources[group_idx]));
   }
   return groupby_exprs;
 }
@@ -1486,7 +1523,7 @@ std::list<std::shared_ptr<Analyzer::Expr>> translate_groupby_exprs(
     const std::vector<std::shared_ptr<Analyzer::Expr>>& scalar_sources) {
   std::list<std::shared_ptr<Analyzer::Expr>> groupby_exprs;
   for (size_t group_idx = 0; group_idx < aggregate->getGroupByCount(); ++group_idx) {
-    groupby_exprs.push_back(set_transient_dict(scalar_sources[group_idx]));
+    groupby_exprs.push_back(set_transient_dict_for_groupby(scalar_sources[group_idx]));
   }
   return groupby_exprs;
 }
@@ -1523,7 +1560,7 @@ std::vector<Analyzer::Expr*> translate_targets(
         CHECK_GE(ref_idx, size_t(1));
         CHECK_LE(ref_idx, groupby_exprs.size());
         const auto groupby_expr = *std::next(groupby_exprs.begin(), ref_idx - 1);
-        target_expr = var_ref(groupby_expr.get(), Analyzer::Var::kGROUPBY, ref_idx);
+        target_expr = groupby_target_ref(groupby_expr, ref_idx);
       } else {
         target_expr = translator.translateScalarRex(target_rex_scalar);
         auto rewritten_expr = rewrite_expr(target_expr.get());
@@ -1555,8 +1592,7 @@ std::vector<Analyzer::Expr*> translate_targets(
   std::vector<Analyzer::Expr*> target_exprs;
   size_t group_key_idx = 1;
   for (const auto& groupby_expr : groupby_exprs) {
-    auto target_expr =
-        var_ref(groupby_expr.get(), Analyzer::Var::kGROUPBY, group_key_idx++);
+    auto target_expr = groupby_target_ref(groupby_expr, group_key_idx++);
     target_exprs_owned.push_back(target_expr);
     target_exprs.push_back(target_expr.get());
   }
@@ -1681,16 +1717,21 @@ void RelAlgExecutor::executeUpdate(const RelAlgNode* node,
           CompilationOptions co_project = CompilationOptions::makeCpuOnly(co);
 
           auto eo = eo_in;
+          auto update_transaction_parameters = dynamic_cast<UpdateTransactionParameters*>(
+              dml_transaction_parameters_.get());
+          CHECK(update_transaction_parameters);
           if (dml_transaction_parameters_->tableIsTemporary()) {
             eo.output_columnar_hint = true;
             co_project.allow_lazy_fetch = false;
             co_project.filter_on_deleted_column =
                 false;  // project the entire delete column for columnar update
+          } else if (!is_aggregate &&
+                     !update_transaction_parameters->isVarlenUpdateRequired()) {
+            // materialize the updated columns contiguously, so fixed width targets can
+            // be written into the chunks without boxing each value
+            eo.output_columnar_hint = true;
+            co_project.allow_lazy_fetch = false;
           }
-
-          auto update_transaction_parameters = dynamic_cast<UpdateTransactionParameters*>(
-              dml_transaction_parameters_.get());
-          CHECK(update_transaction_parameters);
           auto update_callback = yieldUpdateCallback(*update_transaction_parameters);
           try {
             auto table_update_metadata =
@@ -2258,12 +2299,15 @@ ExecutionResult RelAlgExecutor::executeLogicalValues(
 
 namespace {
 
+// Encodes the string into `col_data`. Dictionaries which got new strings are added to
+// `dicts_to_checkpoint`, so they are checkpointed once for all the inserted rows.
 template <class T>
 int64_t insert_one_dict_str(T* col_data,
                             const std::string& columnName,
                             const SQLTypeInfo& columnType,
                             const Analyzer::Constant* col_cv,
-                            const Catalog_Namespace::Catalog& catalog) {
+                            const Catalog_Namespace::Catalog& catalog,
+                            std::map<int, std::string>& dicts_to_checkpoint) {
   if (col_cv->get_is_null()) {
     *col_data = inline_fixed_encoding_null_val(columnType);
   } else {
@@ -2274,11 +2318,7 @@ int64_t insert_one_dict_str(T* col_data,
     CHECK(dd && dd->stringDict);
     int32_t str_id = dd->stringDict->getOrAdd(str);
     if (!dd->dictIsTemp) {
-      const auto checkpoint_ok = dd->stringDict->checkpoint();
-      if (!checkpoint_ok) {
-        throw std::runtime_error("Failed to checkpoint dictionary for column " +
-                                 columnName);
-      }
+      dicts_to_checkpoint.emplace(dict_id, columnName);
     }
     const bool invalid = str_id > max_valid_int_value<T>();
     if (invalid || str_id == inline_int_null_value<int32_t>()) {
@@ -2298,8 +2338,10 @@ template <class T>
 int64_t insert_one_dict_str(T* col_data,
                             const ColumnDescriptor* cd,
                             const Analyzer::Constant* col_cv,
-                            const Catalog_Namespace::Catalog& catalog) {
-  return insert_one_dict_str(col_data, cd->columnName, cd->columnType, col_cv, catalog);
+                            const Catalog_Namespace::Catalog& catalog,
+                            std::map<int, std::string>& dicts_to_checkpoint) {
+  return insert_one_dict_str(
+      col_data, cd->columnName, cd->columnType, col_cv, catalog, dicts_to_checkpoint);
 }
 
 }  // namespace
@@ -2324,7 +2366,9 @@ ExecutionResult RelAlgExecutor::executeModify(const RelModify* modify,
 }
 
 namespace {
-int64_t int_value_from_numbers_ptr(const SQLTypeInfo& type_info, const int8_t* data) {
+int64_t int_value_from_numbers_ptr(const SQLTypeInfo& type_info,
+                                   const int8_t* data,
+                                   const size_t row_idx) {
   size_t sz = 0;
   switch (type_info.get_type()) {
     case kTINYINT:
@@ -2348,13 +2392,13 @@ int64_t int_value_from_numbers_ptr(const SQLTypeInfo& type_info, const int8_t* d
 
   switch (sz) {
     case 1:
-      return *(reinterpret_cast<const int8_t*>(data));
+      return reinterpret_cast<const int8_t*>(data)[row_idx];
     case 2:
-      return *(reinterpret_cast<const int16_t*>(data));
+      return reinterpret_cast<const int16_t*>(data)[row_idx];
     case 4:
-      return *(reinterpret_cast<const int32_t*>(data));
+      return reinterpret_cast<const int32_t*>(data)[row_idx];
     case 8:
-      return *(reinterpret_cast<const int64_t*>(data));
+      return reinterpret_cast<const int64_t*>(data)[row_idx];
     default:
       CHECK(false);
       return 0;
@@ -2363,7 +2407,8 @@ int64_t int_value_from_numbers_ptr(const SQLTypeInfo& type_info, const int8_t* d
 
 const TableDescriptor* get_shard_for_key(const TableDescriptor* td,
                                          const Catalog_Namespace::Catalog& cat,
-                                         const Fragmenter_Namespace::InsertData& data) {
+                                         const Fragmenter_Namespace::InsertData& data,
+                                         const size_t row_idx) {
   auto shard_column_md = cat.getShardColumnMetadataForTable(td);
   CHECK(shard_column_md);
   auto sharded_column_id = shard_column_md->columnId;
@@ -2373,8 +2418,9 @@ const TableDescriptor* get_shard_for_key(const TableDescriptor* td,
       const auto shard_tables = cat.getPhysicalTablesDescriptors(td);
       const auto shard_count = shard_tables.size();
       CHECK(data.data[i].numbersPtr);
-      auto value = int_value_from_numbers_ptr(shard_column_md->columnType,
-                                              data.data[i].numbersPtr);
+      const bool is_default = i < data.is_default.size() && data.is_default[i];
+      auto value = int_value_from_numbers_ptr(
+          shard_column_md->columnType, data.data[i].numbersPtr, is_default ? 0 : row_idx);
       const size_t shard_idx = SHARD_FOR_KEY(value, shard_count);
       shard = shard_tables[shard_idx];
       break;
@@ -2391,15 +2437,21 @@ ExecutionResult RelAlgExecutor::executeSimpleInsert(const Analyzer::Query& query
   // future, we will likely want to use the executor to evaluate expressions in the insert
   // statement.
 
-  const auto& targets = query.get_targetlist();
+  const auto& values_lists = query.get_values_lists();
   const int table_id = query.get_result_table_id();
   const auto& col_id_list = query.get_result_col_list();
+  const size_t num_rows = values_lists.size();
+  CHECK_GT(num_rows, size_t(0));
 
+  // The rows are converted column-wise into buffers holding all rows of the VALUES list,
+  // which are then inserted at once.
   std::vector<const ColumnDescriptor*> col_descriptors;
   std::vector<int> col_ids;
   std::unordered_map<int, std::unique_ptr<uint8_t[]>> col_buffers;
+  std::unordered_map<int, size_t> col_element_sizes;
   std::unordered_map<int, std::vector<std::string>> str_col_buffers;
   std::unordered_map<int, std::vector<ArrayDatum>> arr_col_buffers;
+  std::map<int, std::string> dicts_to_checkpoint;
 
   for (const int col_id : col_id_list) {
     const auto cd = get_column_descriptor(col_id, table_id, cat_);
@@ -2416,8 +2468,9 @@ ExecutionResult RelAlgExecutor::executeSimpleInsert(const Analyzer::Query& query
           const auto dd = cat_.getMetadataForDict(cd->columnType.get_comp_param());
           CHECK(dd);
           const auto it_ok = col_buffers.emplace(
-              col_id, std::make_unique<uint8_t[]>(cd->columnType.get_size()));
+              col_id, std::make_unique<uint8_t[]>(cd->columnType.get_size() * num_rows));
           CHECK(it_ok.second);
+          col_element_sizes.emplace(col_id, cd->columnType.get_size());
           break;
         }
         default:
@@ -2435,14 +2488,13 @@ ExecutionResult RelAlgExecutor::executeSimpleInsert(const Analyzer::Query& query
       const auto it_ok = col_buffers.emplace(
           col_id,
           std::unique_ptr<uint8_t[]>(
-              new uint8_t[cd->columnType.get_logical_size()]()));  // changed to zero-init
-                                                                   // the buffer
+              new uint8_t[cd->columnType.get_logical_size() * num_rows]()));  // zero-init
       CHECK(it_ok.second);
+      col_element_sizes.emplace(col_id, cd->columnType.get_logical_size());
     }
     col_descriptors.push_back(cd);
     col_ids.push_back(col_id);
   }
-  size_t col_idx = 0;
   Fragmenter_Namespace::InsertData insert_data;
   insert_data.databaseId = cat_.getCurrentDB().dbId;
   insert_data.tableId = table_id;
@@ -2452,6 +2504,15 @@ ExecutionResult RelAlgExecutor::executeSimpleInsert(const Analyzer::Query& query
   auto table_key = boost::hash_value(table_chunk_key_prefix);
   UpdateTriggeredCacheInvalidator::invalidateCachesByTable(table_key);
 
+  // the target entries of all rows, row by row
+  std::vector<std::shared_ptr<Analyzer::TargetEntry>> targets;
+  targets.reserve(num_rows * col_descriptors.size());
+  for (const auto& values_list : values_lists) {
+    CHECK_EQ(values_list.size(), col_descriptors.size());
+    targets.insert(targets.end(), values_list.begin(), values_list.end());
+  }
+  size_t row_idx = 0;
+  size_t col_idx = 0;
   for (auto target_entry : targets) {
     auto col_cv = dynamic_cast<const Analyzer::Constant*>(target_entry->get_expr());
     if (!col_cv) {
@@ -2470,7 +2531,8 @@ ExecutionResult RelAlgExecutor::executeSimpleInsert(const Analyzer::Query& query
          cd->columnType.get_compression() == kENCODING_DICT)) {
       const auto col_data_bytes_it = col_buffers.find(col_ids[col_idx]);
       CHECK(col_data_bytes_it != col_buffers.end());
-      col_data_bytes = col_data_bytes_it->second.get();
+      col_data_bytes = col_data_bytes_it->second.get() +
+                       row_idx * col_element_sizes[col_ids[col_idx]];
     }
     switch (col_type) {
       case kBOOLEAN: {
@@ -2529,16 +2591,25 @@ ExecutionResult RelAlgExecutor::executeSimpleInsert(const Analyzer::Query& query
           case kENCODING_DICT: {
             switch (cd->columnType.get_size()) {
               case 1:
-                insert_one_dict_str(
-                    reinterpret_cast<uint8_t*>(col_data_bytes), cd, col_cv, cat_);
+                insert_one_dict_str(reinterpret_cast<uint8_t*>(col_data_bytes),
+                                    cd,
+                                    col_cv,
+                                    cat_,
+                                    dicts_to_checkpoint);
                 break;
               case 2:
-                insert_one_dict_str(
-                    reinterpret_cast<uint16_t*>(col_data_bytes), cd, col_cv, cat_);
+                insert_one_dict_str(reinterpret_cast<uint16_t*>(col_data_bytes),
+                                    cd,
+                                    col_cv,
+                                    cat_,
+                                    dicts_to_checkpoint);
                 break;
               case 4:
-                insert_one_dict_str(
-                    reinterpret_cast<int32_t*>(col_data_bytes), cd, col_cv, cat_);
+                insert_one_dict_str(reinterpret_cast<int32_t*>(col_data_bytes),
+                                    cd,
+                                    col_cv,
+                                    cat_,
+                                    dicts_to_checkpoint);
                 break;
               default:
                 CHECK(false);
@@ -2597,7 +2668,12 @@ ExecutionResult RelAlgExecutor::executeSimpleInsert(const Analyzer::Query& query
           for (auto& e : l) {
             auto c = std::dynamic_pointer_cast<Analyzer::Constant>(e);
             CHECK(c);
-            insert_one_dict_str(&p[elemIndex], cd->columnName, elem_ti, c.get(), cat_);
+            insert_one_dict_str(&p[elemIndex],
+                                cd->columnName,
+                                elem_ti,
+                                c.get(),
+                                cat_,
+                                dicts_to_checkpoint);
             elemIndex++;
           }
           arr_col_buffers[col_ids[col_idx]].push_back(ArrayDatum(len, buf, is_null));
@@ -2625,7 +2701,18 @@ ExecutionResult RelAlgExecutor::executeSimpleInsert(const Analyzer::Query& query
       default:
         CHECK(false);
     }
-    ++col_idx;
+    if (++col_idx == col_descriptors.size()) {
+      col_idx = 0;
+      ++row_idx;
+    }
+  }
+  for (const auto& [dict_id, column_name] : dicts_to_checkpoint) {
+    const auto dd = cat_.getMetadataForDict(dict_id);
+    CHECK(dd && dd->stringDict);
+    if (!dd->stringDict->checkpoint()) {
+      throw std::runtime_error("Failed to checkpoint dictionary for column " +
+                               column_name);
+    }
   }
   for (const auto& kv : col_buffers) {
     insert_data.columnIds.push_back(kv.first);
@@ -2645,21 +2732,83 @@ ExecutionResult RelAlgExecutor::executeSimpleInsert(const Analyzer::Query& query
     p.arraysPtr = &kv.second;
     insert_data.data.push_back(p);
   }
-  insert_data.numRows = 1;
+  insert_data.numRows = num_rows;
   auto data_memory_holder = import_export::fill_missing_columns(&cat_, insert_data);
   const auto table_descriptor = cat_.getMetadataForTable(table_id);
   CHECK(table_descriptor);
+  const bool log_insert =
+      !g_cluster &&
+      table_descriptor->persistenceLevel == Data_Namespace::MemoryLevel::DISK_LEVEL &&
+      g_enable_insert_wal &&
+      Fragmenter_Namespace::InsertWriteAheadLog::instance().isRunning();
+  auto insert_into = [this, log_insert](const TableDescriptor* td,
+                                        Fragmenter_Namespace::InsertData& data) {
+    td->fragmenter->insertDataNoCheckpoint(data);
+    if (log_insert) {
+      auto& insert_wal = Fragmenter_Namespace::InsertWriteAheadLog::instance();
+      insert_wal.commit(data, cat_, td->tableId);
+    }
+  };
   if (table_descriptor->nShards > 0) {
-    auto shard = get_shard_for_key(table_descriptor, cat_, insert_data);
-    CHECK(shard);
-    shard->fragmenter->insertDataNoCheckpoint(insert_data);
+    std::map<const TableDescriptor*, std::vector<size_t>> rows_of_shards;
+    for (size_t row = 0; row < num_rows; ++row) {
+      auto shard = get_shard_for_key(table_descriptor, cat_, insert_data, row);
+      CHECK(shard);
+      rows_of_shards[shard].push_back(row);
+    }
+    if (rows_of_shards.size() == 1) {
+      insert_into(rows_of_shards.begin()->first, insert_data);
+    } else {
+      // Copy the rows of each shard, columns not given in the statement hold a single
+      // default value for all rows and are shared.
+      for (const auto& [shard, rows] : rows_of_shards) {
+        auto shard_data = insert_data;
+        shard_data.numRows = rows.size();
+        std::list<std::vector<uint8_t>> numbers;
+        std::list<std::vector<std::string>> strings;
+        std::list<std::vector<ArrayDatum>> arrays;
+        for (size_t i = 0; i < shard_data.columnIds.size(); ++i) {
+          if (shard_data.is_default[i]) {
+            continue;
+          }
+          const auto col_id = shard_data.columnIds[i];
+          if (const auto it = col_buffers.find(col_id); it != col_buffers.end()) {
+            const auto element_size = col_element_sizes[col_id];
+            auto& shard_numbers = numbers.emplace_back(rows.size() * element_size);
+            for (size_t j = 0; j < rows.size(); ++j) {
+              std::memcpy(&shard_numbers[j * element_size],
+                          it->second.get() + rows[j] * element_size,
+                          element_size);
+            }
+            shard_data.data[i].numbersPtr =
+                reinterpret_cast<int8_t*>(shard_numbers.data());
+          } else if (const auto it = str_col_buffers.find(col_id);
+                     it != str_col_buffers.end()) {
+            auto& shard_strings = strings.emplace_back();
+            for (const auto row : rows) {
+              shard_strings.push_back(it->second[row]);
+            }
+            shard_data.data[i].stringsPtr = &shard_strings;
+          } else {
+            const auto arr_it = arr_col_buffers.find(col_id);
+            CHECK(arr_it != arr_col_buffers.end());
+            auto& shard_arrays = arrays.emplace_back();
+            for (const auto row : rows) {
+              shard_arrays.push_back(arr_it->second[row]);
+            }
+            shard_data.data[i].arraysPtr = &shard_arrays;
+          }
+        }
+        insert_into(shard, shard_data);
+      }
+    }
   } else {
-    table_descriptor->fragmenter->insertDataNoCheckpoint(insert_data);
+    insert_into(table_descriptor, insert_data);
   }
 
   // Ensure checkpoint happens across all shards, if not in distributed
   // mode (aggregator handles checkpointing in distributed mode)
-  if (!g_cluster &&
+  if (!g_cluster && !log_insert &&
       table_descriptor->persistenceLevel == Data_Namespace::MemoryLevel::DISK_LEVEL) {
     const_cast<Catalog_Namespace::Catalog&>(cat_).checkpointWithAutoRollback(table_id);
   }
@@ -2918,6 +3067,96 @@ bool is_projection(const RelAlgExecutionUnit& ra_exe_unit) {
   return ra_exe_unit.groupby_exprs.size() == 1 && !ra_exe_unit.groupby_exprs.front();
 }
 
+/**
+ * Estimated fraction of the rows passing a filter, from the column statistics collected
+ * by ANALYZE TABLE: the filter is the conjunction of the quals, taken as independent.
+ * Empty if any qual isn't a comparison of an analyzed column with a constant of the
+ * same type.
+ */
+std::optional<double> quals_statistics_selectivity(
+    const RelAlgExecutionUnit& ra_exe_unit,
+    const Catalog_Namespace::Catalog& cat) {
+  double selectivity{1};
+  for (const auto quals : {&ra_exe_unit.simple_quals, &ra_exe_unit.quals}) {
+    for (const auto& qual : *quals) {
+      int rte_idx{-1};
+      const auto normalized_qual = qual->normalize_simple_predicate(rte_idx);
+      const auto bin_oper = dynamic_cast<const Analyzer::BinOper*>(normalized_qual.get());
+      if (!bin_oper) {
+        return std::nullopt;
+      }
+      const auto col_var =
+          dynamic_cast<const Analyzer::ColumnVar*>(bin_oper->get_left_operand());
+      const auto constant =
+          dynamic_cast<const Analyzer::Constant*>(bin_oper->get_right_operand());
+      if (!col_var || !constant || constant->get_is_null() ||
+          col_var->get_table_id() < 0) {
+        return std::nullopt;
+      }
+      const auto& col_ti = col_var->get_type_info();
+      const auto& constant_ti = constant->get_type_info();
+      if (!Catalog_Namespace::ColumnStatistics::hasHistogram(col_ti) ||
+          col_ti.get_type() != constant_ti.get_type() ||
+          col_ti.get_scale() != constant_ti.get_scale() ||
+          col_ti.get_dimension() != constant_ti.get_dimension()) {
+        return std::nullopt;
+      }
+      const auto stats =
+          cat.getColumnStatistics(col_var->get_table_id(), col_var->get_column_id());
+      if (!stats || !stats->getRowCount()) {
+        return std::nullopt;
+      }
+      // physical value of the constant, the one the histogram bounds are made of
+      const double val = constant_ti.is_fp()
+                             ? extract_fp_type_from_datum(constant->get_constval(),
+                                                          constant_ti)
+                             : extract_int_type_from_datum(constant->get_constval(),
+                                                           constant_ti);
+      const auto qual_selectivity = stats->getSelectivity(bin_oper->get_optype(), val);
+      if (!qual_selectivity) {
+        return std::nullopt;
+      }
+      selectivity *= *qual_selectivity;
+    }
+  }
+  return selectivity;
+}
+
+/**
+ * Estimation of the number of groups from the column statistics collected by ANALYZE
+ * TABLE: the product of the distinct counts of the group by columns, bounded by the
+ * estimated number of rows passing the filter. Empty if any group by expression isn't
+ * an analyzed column, or if the selectivity of the filter can't be estimated.
+ */
+std::optional<size_t> groups_statistics_estimation(
+    const RelAlgExecutionUnit& ra_exe_unit,
+    const std::vector<InputTableInfo>& table_infos,
+    const Catalog_Namespace::Catalog& cat) {
+  if (ra_exe_unit.groupby_exprs.empty() || is_projection(ra_exe_unit)) {
+    return std::nullopt;
+  }
+  const auto selectivity = quals_statistics_selectivity(ra_exe_unit, cat);
+  if (!selectivity) {
+    return std::nullopt;
+  }
+  double estimation{1};
+  for (const auto& groupby_expr : ra_exe_unit.groupby_exprs) {
+    const auto col_var = dynamic_cast<const Analyzer::ColumnVar*>(groupby_expr.get());
+    if (!col_var || col_var->get_table_id() < 0) {
+      return std::nullopt;
+    }
+    const auto stats =
+        cat.getColumnStatistics(col_var->get_table_id(), col_var->get_column_id());
+    if (!stats || !stats->getRowCount()) {
+      return std::nullopt;
+    }
+    estimation *= stats->getDistinctCount() + (stats->getNullCount() ? 1 : 0);
+  }
+  const auto upper_bound =
+      *selectivity * static_cast<double>(groups_approx_upper_bound(table_infos));
+  return std::max(size_t(1), static_cast<size_t>(std::min(estimation, upper_bound)));
+}
+
 bool should_output_columnar(const RelAlgExecutionUnit& ra_exe_unit,
                             const RenderInfo* render_info) {
   if (!is_projection(ra_exe_unit)) {
@@ -3199,6 +3438,12 @@ ExecutionResult RelAlgExecutor::executeWorkUnit(
     if (cached_cardinality.first && card >= 0) {
       result = execute_and_handle_errors(
           card, /*has_cardinality_estimation=*/true, /*has_ndv_estimation=*/false);
+    } else if (const auto statistics_groups_estimation =
+                   groups_statistics_estimation(ra_exe_unit, table_infos, cat_)) {
+      // the NDV estimator still runs if the statistics turn out to be stale
+      result = execute_and_handle_errors(2 * *statistics_groups_estimation,
+                                         /*has_cardinality_estimation=*/true,
+                                         /*has_ndv_estimation=*/false);
     } else {
       result = execute_and_handle_errors(
           max_groups_buffer_entry_guess,
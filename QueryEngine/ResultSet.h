@@ -418,6 +418,10 @@ class ResultSet {
 
   void initializeStorage() const;
 
+  // Initializes the pages of a paged perfect hash group by buffer no kernel has touched,
+  // which must happen before the entries are read outside of reduction.
+  void materializeUntouchedPages();
+
   void holdChunks(const std::list<std::shared_ptr<Chunk_NS::Chunk>>& chunks) {
     chunks_ = chunks;
   }
@@ -468,6 +472,21 @@ class ResultSet {
   bool isZeroCopyColumnarConversionPossible(size_t column_idx) const;
   const int8_t* getColumnarBuffer(size_t column_idx) const;
 
+  // Consecutive rows of a lazily fetched column, stored in a fetched chunk buffer.
+  struct LazyColumnRun {
+    const int8_t* col_buffer;
+    int64_t start_row;
+    size_t row_count;
+  };
+
+  // Returns the rows selected by the first `entry_count` non-empty entries of a
+  // projection for a lazily fetched column, merged into runs of consecutive chunk rows.
+  // The chunk buffers stay valid as long as the result set lives. Returns std::nullopt
+  // if an entry does not reference a chunk row, e.g. for the null side of outer joins.
+  std::optional<std::vector<LazyColumnRun>> getLazyColumnRuns(
+      const size_t column_idx,
+      const size_t entry_count) const;
+
   QueryDescriptionType getQueryDescriptionType() const {
     return query_mem_desc_.getQueryDescriptionType();
   }
@@ -906,6 +925,20 @@ class ResultSetManager {
 
   void rewriteVarlenAggregates(ResultSet*);
 
+  // Reduces baseline hash group by results out of core: the entries are hash-partitioned
+  // into spill files and the partitions are reduced one at a time, so only one partition
+  // and the reduced result need to fit in memory. The reduced result is owned by
+  // row_set_mem_owner and initialized with init_agg_vals. The storage of each input is
+  // released once its entries are partitioned, so the inputs cannot be read afterwards.
+  // Returns nullptr, leaving the inputs untouched, if the layout of the results is not
+  // supported (columnar, appended storage or varlen buffers).
+  static std::shared_ptr<ResultSet> reduceBaselineWithSpill(
+      const std::vector<ResultSet*>& result_sets,
+      const ReductionCode& reduction_code,
+      std::shared_ptr<RowSetMemoryOwner> row_set_mem_owner,
+      const std::vector<int64_t>& init_agg_vals,
+      const size_t spill_threshold);
+
  private:
   std::shared_ptr<ResultSet> rs_;
 };
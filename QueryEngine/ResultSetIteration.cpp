@@ -462,7 +462,7 @@ InternalTargetValue ResultSet::RowWiseTargetAccessor::getColumnInternal(
     return InternalTargetValue(i1, i2);
   } else {
     if (type_info.is_string() && type_info.get_compression() == kENCODING_NONE) {
-      CHECK(!agg_info.is_agg);
+      CHECK(!agg_info.is_agg || agg_info.agg_kind == kSAMPLE);
       if (!result_set_->lazy_fetch_info_.empty()) {
         CHECK_LT(target_logical_idx, result_set_->lazy_fetch_info_.size());
         const auto& col_lazy_fetch = result_set_->lazy_fetch_info_[target_logical_idx];
@@ -590,7 +590,7 @@ InternalTargetValue ResultSet::ColumnWiseTargetAccessor::getColumnInternal(
   } else {
     // for TEXT ENCODING NONE:
     if (type_info.is_string() && type_info.get_compression() == kENCODING_NONE) {
-      CHECK(!agg_info.is_agg);
+      CHECK(!agg_info.is_agg || agg_info.agg_kind == kSAMPLE);
       if (!result_set_->lazy_fetch_info_.empty()) {
         CHECK_LT(target_logical_idx, result_set_->lazy_fetch_info_.size());
         const auto& col_lazy_fetch = result_set_->lazy_fetch_info_[target_logical_idx];
@@ -685,6 +685,51 @@ int64_t ResultSet::lazyReadInt(const int64_t ival,
   return ival;
 }
 
+std::optional<std::vector<ResultSet::LazyColumnRun>> ResultSet::getLazyColumnRuns(
+    const size_t column_idx,
+    const size_t entry_count) const {
+  CHECK(query_mem_desc_.getQueryDescriptionType() == QueryDescriptionType::Projection);
+  CHECK(permutation_.empty());
+  CHECK_LE(entry_count, entryCount());
+  CHECK_LT(column_idx, lazy_fetch_info_.size());
+  const auto& col_lazy_fetch = lazy_fetch_info_[column_idx];
+  CHECK(col_lazy_fetch.is_lazily_fetched);
+  const size_t slot_idx = query_mem_desc_.getSlotIndexForSingleSlotCol(column_idx);
+  std::vector<LazyColumnRun> runs;
+  for (size_t entry_idx = 0; entry_idx < entry_count; ++entry_idx) {
+    const auto storage_lookup_result = findStorage(entry_idx);
+    const auto storage = storage_lookup_result.storage_ptr;
+    const auto local_entry_idx = storage_lookup_result.fixedup_entry_idx;
+    if (storage->isEmptyEntry(local_entry_idx)) {
+      continue;
+    }
+    const auto& storage_query_mem_desc = storage->query_mem_desc_;
+    const auto slot_width = storage_query_mem_desc.getPaddedSlotWidthBytes(slot_idx);
+    const auto slot_ptr =
+        storage_query_mem_desc.didOutputColumnar()
+            ? columnar_elem_ptr(local_entry_idx,
+                                storage->buff_ +
+                                    storage_query_mem_desc.getColOffInBytes(slot_idx),
+                                slot_width)
+            : row_ptr_rowwise(storage->buff_, storage_query_mem_desc, local_entry_idx) +
+                  storage_query_mem_desc.getColOffInBytes(slot_idx);
+    int64_t row_idx = read_int_from_buff(slot_ptr, slot_width);
+    if (row_idx < 0) {
+      return std::nullopt;
+    }
+    const auto col_buffer = getColumnFrag(storage_lookup_result.storage_idx,
+                                          column_idx,
+                                          row_idx)[col_lazy_fetch.local_col_id];
+    if (!runs.empty() && runs.back().col_buffer == col_buffer &&
+        runs.back().start_row + static_cast<int64_t>(runs.back().row_count) == row_idx) {
+      ++runs.back().row_count;
+    } else {
+      runs.push_back({col_buffer, row_idx, 1});
+    }
+  }
+  return runs;
+}
+
 // Not all entries in the buffer represent a valid row. Advance the internal cursor
 // used for the getNextRow method to the next row which is valid.
 void ResultSet::advanceCursorToNextEntry(ResultSetRowIterator& iter) const {
@@ -24,9 +24,12 @@
 
 #include "DynamicWatchdog.h"
 #include "Execute.h"
+#include "MurmurHash.h"
+#include "OSDependent/omnisci_fs.h"
 #include "ResultSet.h"
 #include "ResultSetReductionInterpreter.h"
 #include "ResultSetReductionJIT.h"
+#include "ResultSetSpill.h"
 #include "RuntimeFunctions.h"
 #include "Shared/SqlTypesLayout.h"
 #include "Shared/likely.h"
@@ -180,6 +183,44 @@ void run_reduction_code(const ReductionCode& reduction_code,
   }
 }
 
+// First and one past the last entry of a page of a paged perfect hash buffer.
+std::pair<size_t, size_t> get_page_entry_range(const size_t page_idx,
+                                               const size_t entry_count) {
+  constexpr size_t page_entry_count{size_t(1) << PAGED_GROUP_BY_PAGE_BITS};
+  const auto page_start = page_idx * page_entry_count;
+  return {page_start, std::min(page_start + page_entry_count, entry_count)};
+}
+
+// Calls `page_func` for each of the given pages, on several threads when the pages
+// hold enough entries.
+template <typename PageFunc>
+void for_each_page(const std::vector<size_t>& pages, const PageFunc& page_func) {
+  if (!use_multithreaded_reduction(pages.size() << PAGED_GROUP_BY_PAGE_BITS)) {
+    for (const auto page_idx : pages) {
+      page_func(page_idx);
+    }
+    return;
+  }
+  const size_t thread_count = cpu_threads();
+  const auto thread_page_count = (pages.size() + thread_count - 1) / thread_count;
+  std::vector<std::future<void>> page_threads;
+  for (size_t start = 0; start < pages.size(); start += thread_page_count) {
+    const auto end = std::min(start + thread_page_count, pages.size());
+    page_threads.emplace_back(
+        std::async(std::launch::async, [&pages, &page_func, start, end] {
+          for (size_t i = start; i < end; ++i) {
+            page_func(pages[i]);
+          }
+        }));
+  }
+  for (auto& page_thread : page_threads) {
+    page_thread.wait();
+  }
+  for (auto& page_thread : page_threads) {
+    page_thread.get();
+  }
+}
+
 }  // namespace
 
 void result_set::fill_empty_key(void* key_ptr,
@@ -297,6 +338,11 @@ void ResultSetStorage::reduce(const ResultSetStorage& that,
     }
     return;
   }
+  if (query_mem_desc_.usesPagedPerfectHash() ||
+      that.query_mem_desc_.usesPagedPerfectHash()) {
+    reducePages(that, serialized_varlen_buffer, reduction_code);
+    return;
+  }
   auto executor = query_mem_desc_.getExecutor();
   if (!executor) {
     executor = Executor::getExecutor(Executor::UNITARY_EXECUTOR_ID).get();
@@ -383,6 +429,85 @@ void ResultSetStorage::reduce(const ResultSetStorage& that,
   }
 }
 
+int8_t* ResultSetStorage::getPageFlags() const {
+  if (!query_mem_desc_.usesPagedPerfectHash()) {
+    return nullptr;
+  }
+  const auto row_bytes = query_mem_desc_.getRowSize();
+  return buff_ + (query_mem_desc_.getEntryCount() + 1) * row_bytes;
+}
+
+void ResultSetStorage::reducePages(
+    const ResultSetStorage& that,
+    const std::vector<std::string>& serialized_varlen_buffer,
+    const ReductionCode& reduction_code) const {
+  CHECK(!query_mem_desc_.didOutputColumnar());
+  CHECK(reduction_code.ir_reduce_loop);
+  const auto entry_count = query_mem_desc_.getEntryCount();
+  const auto row_bytes = query_mem_desc_.getRowSize();
+  // A storage which isn't paged, or no longer is, has all of its pages initialized.
+  auto this_page_flags = getPageFlags();
+  const auto that_page_flags = that.getPageFlags();
+  constexpr size_t page_entry_count{size_t(1) << PAGED_GROUP_BY_PAGE_BITS};
+  const auto page_count = (entry_count + page_entry_count - 1) / page_entry_count;
+  std::vector<size_t> pages_to_copy;
+  std::vector<size_t> pages_to_reduce;
+  for (size_t page_idx = 0; page_idx < page_count; ++page_idx) {
+    if (that_page_flags && !that_page_flags[page_idx]) {
+      continue;
+    }
+    if (this_page_flags && !this_page_flags[page_idx]) {
+      pages_to_copy.push_back(page_idx);
+    } else {
+      pages_to_reduce.push_back(page_idx);
+    }
+  }
+  for_each_page(pages_to_copy, [&](const size_t page_idx) {
+    const auto [page_start, page_end] = get_page_entry_range(page_idx, entry_count);
+    memcpy(buff_ + page_start * row_bytes,
+           that.buff_ + page_start * row_bytes,
+           (page_end - page_start) * row_bytes);
+    this_page_flags[page_idx] = 1;
+  });
+  for_each_page(pages_to_reduce, [&](const size_t page_idx) {
+    const auto [page_start, page_end] = get_page_entry_range(page_idx, entry_count);
+    run_reduction_code(reduction_code,
+                       buff_,
+                       that.buff_,
+                       page_start,
+                       page_end,
+                       entry_count,
+                       &query_mem_desc_,
+                       &that.query_mem_desc_,
+                       &serialized_varlen_buffer);
+  });
+}
+
+void ResultSetStorage::materializeUntouchedPages() {
+  const auto page_flags = getPageFlags();
+  if (!page_flags) {
+    return;
+  }
+  CHECK(!query_mem_desc_.didOutputColumnar());
+  const auto entry_count = query_mem_desc_.getEntryCount();
+  const auto row_bytes = query_mem_desc_.getRowSize();
+  const auto template_row = buff_ + entry_count * row_bytes;
+  std::vector<size_t> untouched_pages;
+  for (size_t page_idx = 0; page_idx < query_mem_desc_.getPageCount(); ++page_idx) {
+    if (!page_flags[page_idx]) {
+      untouched_pages.push_back(page_idx);
+    }
+  }
+  for_each_page(untouched_pages, [&](const size_t page_idx) {
+    const auto [page_start, page_end] = get_page_entry_range(page_idx, entry_count);
+    for (size_t entry_idx = page_start; entry_idx < page_end; ++entry_idx) {
+      memcpy(buff_ + entry_idx * row_bytes, template_row, row_bytes);
+    }
+    page_flags[page_idx] = 1;
+  });
+  query_mem_desc_.setPagedPerfectHash(false);
+}
+
 namespace {
 
 ALWAYS_INLINE void check_watchdog() {
@@ -1049,6 +1174,15 @@ void ResultSet::initializeStorage() const {
   }
 }
 
+void ResultSet::materializeUntouchedPages() {
+  if (!query_mem_desc_.usesPagedPerfectHash()) {
+    return;
+  }
+  CHECK(storage_);
+  storage_->materializeUntouchedPages();
+  query_mem_desc_.setPagedPerfectHash(false);
+}
+
 // Driver for reductions. Needed because the result of a reduction on the baseline
 // layout, which can have collisions, cannot be done in place and something needs
 // to take the ownership of the new result set with the bigger underlying buffer.
@@ -1076,6 +1210,26 @@ ResultSet* ResultSetManager::reduce(std::vector<ResultSet*>& result_sets) {
                           return init + rs->query_mem_desc_.getEntryCount();
                         });
     CHECK(total_entry_count);
+    const auto spill_threshold = result_set::get_spill_threshold_bytes(catalog);
+    if (spill_threshold &&
+        total_entry_count * first_result.query_mem_desc_.getRowSize() >
+            spill_threshold) {
+      const auto reduction_code = [&first_result]() {
+        std::lock_guard<std::mutex> compilation_lock(Executor::compilation_mutex_);
+        ResultSetReductionJIT reduction_jit(first_result.query_mem_desc_,
+                                            first_result.targets_,
+                                            first_result.target_init_vals_);
+        return reduction_jit.codegen();
+      }();
+      rs_ = reduceBaselineWithSpill(result_sets,
+                                    reduction_code,
+                                    row_set_mem_owner,
+                                    first_result.target_init_vals_,
+                                    spill_threshold);
+      if (rs_) {
+        return rs_.get();
+      }
+    }
     auto query_mem_desc = first_result.query_mem_desc_;
     query_mem_desc.setEntryCount(total_entry_count);
     rs_.reset(new ResultSet(first_result.targets_,
@@ -1132,6 +1286,151 @@ ResultSet* ResultSetManager::reduce(std::vector<ResultSet*>& result_sets) {
   return result_rs;
 }
 
+namespace {
+
+// Seed for partitioning spilled entries, different from the one used by the baseline
+// hash table so that the entries of a partition don't collide more than usual.
+constexpr uint64_t kSpillPartitionSeed{0x9e3779b97f4a7c15};
+
+}  // namespace
+
+std::shared_ptr<ResultSet> ResultSetManager::reduceBaselineWithSpill(
+    const std::vector<ResultSet*>& result_sets,
+    const ReductionCode& reduction_code,
+    std::shared_ptr<RowSetMemoryOwner> row_set_mem_owner,
+    const std::vector<int64_t>& init_agg_vals,
+    const size_t spill_threshold) {
+  auto timer = DEBUG_TIMER(__func__);
+  CHECK(!result_sets.empty());
+  CHECK_GT(spill_threshold, size_t(0));
+  const auto first_rs = result_sets.front();
+  CHECK(first_rs->storage_);
+  // copied, the storage of the inputs is released once it is partitioned
+  const auto query_mem_desc = first_rs->storage_->query_mem_desc_;
+  const auto targets = first_rs->storage_->targets_;
+  size_t total_entry_count{0};
+  for (const auto result_set : result_sets) {
+    const auto& storage = result_set->storage_;
+    CHECK(storage);
+    if (storage->query_mem_desc_.getQueryDescriptionType() !=
+            QueryDescriptionType::GroupByBaselineHash ||
+        storage->query_mem_desc_.didOutputColumnar() ||
+        !result_set->appended_storage_.empty() ||
+        !result_set->serialized_varlen_buffer_.empty() ||
+        storage->getVarlenOutputInfo()) {
+      return nullptr;
+    }
+    CHECK_EQ(storage->query_mem_desc_.getRowSize(), query_mem_desc.getRowSize());
+    total_entry_count += storage->getEntryCount();
+  }
+
+  const auto row_bytes = get_row_bytes(query_mem_desc);
+  const auto key_bytes = get_key_bytes_rowwise(query_mem_desc);
+  const size_t num_partitions =
+      std::min(std::max((total_entry_count * row_bytes + spill_threshold - 1) /
+                            spill_threshold,
+                        size_t(2)),
+               result_set::kMaxSpillPartitions);
+  VLOG(1) << "Spilling baseline hash reduction of " << result_sets.size()
+          << " result sets with " << total_entry_count << " entries into "
+          << num_partitions << " partitions.";
+
+  std::vector<std::unique_ptr<result_set::SpillFile>> partitions(num_partitions);
+  for (auto& partition : partitions) {
+    partition = std::make_unique<result_set::SpillFile>();
+  }
+  std::vector<size_t> partition_entry_counts(num_partitions, 0);
+  for (const auto result_set : result_sets) {
+    auto& storage = result_set->storage_;
+    for (size_t i = 0; i < storage->getEntryCount(); ++i) {
+      if (storage->isEmptyEntry(i, storage->buff_)) {
+        continue;
+      }
+      const auto row_ptr = storage->buff_ + i * row_bytes;
+      const auto partition_idx =
+          MurmurHash64A(row_ptr, key_bytes, kSpillPartitionSeed) % num_partitions;
+      partitions[partition_idx]->append(row_ptr, row_bytes);
+      ++partition_entry_counts[partition_idx];
+    }
+    // The entries are in the partitions now. Release the input before the next one is
+    // partitioned, so that the inputs are not all kept in memory during the reduction.
+    if (storage->buff_is_provided_) {
+      // owned by the arenas of the row set memory owner, which are freed with the query
+      omnisci::discard_pages(storage->buff_, storage->getEntryCount() * row_bytes);
+    } else {
+      free(storage->buff_);
+    }
+    storage.reset();
+  }
+
+  // Reduce one partition at a time and append its groups to the reduced spill file. The
+  // partitions hold disjoint sets of keys, so the reduced groups can be concatenated.
+  auto reduced_file = std::make_unique<result_set::SpillFile>();
+  size_t reduced_entry_count{0};
+  for (size_t partition_idx = 0; partition_idx < num_partitions; ++partition_idx) {
+    const auto partition_entry_count = partition_entry_counts[partition_idx];
+    if (!partition_entry_count) {
+      partitions[partition_idx].reset();
+      continue;
+    }
+    std::vector<int64_t> that_buff(partition_entry_count * row_bytes / sizeof(int64_t));
+    auto& partition = partitions[partition_idx];
+    partition->rewind();
+    CHECK_EQ(partition->read(that_buff.data(), partition_entry_count * row_bytes),
+             partition_entry_count * row_bytes);
+    partition.reset();
+    auto that_query_mem_desc = query_mem_desc;
+    that_query_mem_desc.setEntryCount(partition_entry_count);
+    ResultSetStorage that_storage(targets,
+                                  that_query_mem_desc,
+                                  reinterpret_cast<int8_t*>(that_buff.data()),
+                                  /*buff_is_provided=*/true);
+    that_storage.target_init_vals_ = init_agg_vals;
+
+    // Size the hash table for the usual 50% fill rate of the baseline layout.
+    auto this_query_mem_desc = query_mem_desc;
+    this_query_mem_desc.setEntryCount(2 * partition_entry_count);
+    std::vector<int64_t> this_buff(2 * partition_entry_count * row_bytes /
+                                   sizeof(int64_t));
+    ResultSetStorage this_storage(targets,
+                                  this_query_mem_desc,
+                                  reinterpret_cast<int8_t*>(this_buff.data()),
+                                  /*buff_is_provided=*/true);
+    this_storage.target_init_vals_ = init_agg_vals;
+    this_storage.initializeRowWise();
+    this_storage.reduce(that_storage, {}, reduction_code);
+
+    for (size_t i = 0; i < this_storage.getEntryCount(); ++i) {
+      if (!this_storage.isEmptyEntry(i)) {
+        reduced_file->append(this_storage.buff_ + i * row_bytes, row_bytes);
+        ++reduced_entry_count;
+      }
+    }
+  }
+
+  // The reduced buffer is densely packed; iteration skips empty entries only, and
+  // reducing it again rehashes its entries into a new buffer first.
+  auto reduced_query_mem_desc = query_mem_desc;
+  reduced_query_mem_desc.setEntryCount(std::max(reduced_entry_count, size_t(1)));
+  auto reduced_rs = std::make_shared<ResultSet>(targets,
+                                                ExecutorDeviceType::CPU,
+                                                reduced_query_mem_desc,
+                                                row_set_mem_owner,
+                                                first_rs->catalog_,
+                                                first_rs->block_size_,
+                                                first_rs->grid_size_);
+  auto reduced_storage = reduced_rs->allocateStorage(init_agg_vals);
+  if (reduced_entry_count) {
+    reduced_file->rewind();
+    CHECK_EQ(reduced_file->read(reduced_storage->getUnderlyingBuffer(),
+                                reduced_entry_count * row_bytes),
+             reduced_entry_count * row_bytes);
+  } else {
+    reduced_rs->initializeStorage();
+  }
+  return reduced_rs;
+}
+
 std::shared_ptr<ResultSet> ResultSetManager::getOwnResultSet() {
   return rs_;
 }
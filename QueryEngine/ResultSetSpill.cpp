@@ -0,0 +1,89 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QueryEngine/ResultSetSpill.h"
+
+#include <boost/filesystem.hpp>
+
+#include "Catalog/Catalog.h"
+#include "Logger/Logger.h"
+
+extern bool g_enable_spill_to_disk;
+extern size_t g_spill_threshold_bytes;
+extern std::string g_spill_directory;
+
+namespace result_set {
+
+SpillFile::SpillFile() : file_(nullptr), size_(0) {
+  const auto spill_dir = g_spill_directory.empty()
+                             ? boost::filesystem::temp_directory_path()
+                             : boost::filesystem::path(g_spill_directory);
+  path_ =
+      (spill_dir / boost::filesystem::unique_path("omnisci_spill_%%%%-%%%%-%%%%-%%%%"))
+          .string();
+  file_ = std::fopen(path_.c_str(), "w+b");
+  if (!file_) {
+    throw std::runtime_error("Failed to create spill file " + path_);
+  }
+}
+
+SpillFile::~SpillFile() {
+  std::fclose(file_);
+  boost::system::error_code ec;
+  boost::filesystem::remove(path_, ec);
+  if (ec) {
+    LOG(WARNING) << "Failed to remove spill file " << path_ << ": " << ec.message();
+  }
+}
+
+void SpillFile::append(const void* data, const size_t num_bytes) {
+  if (std::fwrite(data, 1, num_bytes, file_) != num_bytes) {
+    throw std::runtime_error("Failed to write " + std::to_string(num_bytes) +
+                             " bytes to spill file " + path_);
+  }
+  size_ += num_bytes;
+}
+
+void SpillFile::rewind() {
+  if (std::fflush(file_) != 0 || std::fseek(file_, 0, SEEK_SET) != 0) {
+    throw std::runtime_error("Failed to rewind spill file " + path_);
+  }
+}
+
+size_t SpillFile::read(void* data, const size_t num_bytes) {
+  const auto bytes_read = std::fread(data, 1, num_bytes, file_);
+  if (bytes_read < num_bytes && std::ferror(file_)) {
+    throw std::runtime_error("Failed to read from spill file " + path_);
+  }
+  return bytes_read;
+}
+
+size_t get_spill_threshold_bytes(const Catalog_Namespace::Catalog* catalog) {
+  if (!g_enable_spill_to_disk) {
+    return 0;
+  }
+  if (g_spill_threshold_bytes) {
+    return g_spill_threshold_bytes;
+  }
+  if (!catalog) {
+    return 0;
+  }
+  // Leave half of the memory which is not reserved by the buffer pool to the spilled
+  // partitions and to concurrent queries.
+  return std::max(catalog->getDataMgr().getAvailableCpuQueryMemory() / 2, size_t(1));
+}
+
+}  // namespace result_set
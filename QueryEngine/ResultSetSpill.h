@@ -0,0 +1,71 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    ResultSetSpill.h
+ * @brief   Temporary files for result set buffers which do not fit in memory.
+ *
+ * Baseline hash group by reduction hash-partitions the entries of the partial results
+ * into spill files and reduces one partition at a time.
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+
+namespace Catalog_Namespace {
+class Catalog;
+}  // namespace Catalog_Namespace
+
+namespace result_set {
+
+// Upper bound on the number of partitions of a spilled reduction, which keeps the number
+// of open files reasonable.
+constexpr size_t kMaxSpillPartitions{256};
+
+// A temporary file which is written once, then read back sequentially. The file is
+// removed when the object is destroyed.
+class SpillFile {
+ public:
+  SpillFile();
+  ~SpillFile();
+
+  SpillFile(const SpillFile&) = delete;
+  SpillFile& operator=(const SpillFile&) = delete;
+
+  void append(const void* data, const size_t num_bytes);
+
+  // Flushes pending writes and positions the file at its start for reading.
+  void rewind();
+
+  // Returns the number of bytes read, which is less than num_bytes only at end of file.
+  size_t read(void* data, const size_t num_bytes);
+
+  size_t size() const { return size_; }
+
+ private:
+  std::string path_;
+  std::FILE* file_;
+  size_t size_;
+};
+
+// Returns the size in bytes above which reductions spill to disk, or 0 if spilling is
+// disabled. Unless set explicitly, the threshold is derived from the memory left to
+// queries by the CPU buffer pool.
+size_t get_spill_threshold_bytes(const Catalog_Namespace::Catalog* catalog);
+
+}  // namespace result_set
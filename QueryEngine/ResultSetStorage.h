@@ -130,6 +130,10 @@ class ResultSetStorage {
     query_mem_desc_.setEntryCount(new_entry_count);
   }
 
+  // Initializes the pages of a paged perfect hash buffer no kernel has touched. The
+  // storage is an ordinary perfect hash buffer afterwards.
+  void materializeUntouchedPages();
+
   void reduceOneApproxQuantileSlot(int8_t* this_ptr1,
                                    const int8_t* that_ptr1,
                                    const size_t target_logical_idx,
@@ -217,6 +221,15 @@ class ResultSetStorage {
 
   void fillOneEntryColWise(const std::vector<int64_t>& entry);
 
+  // One flag per page of a paged perfect hash buffer, null for other layouts.
+  int8_t* getPageFlags() const;
+
+  // Reduction driver for paged perfect hash buffers. Pages untouched in `that` are
+  // skipped, pages untouched in this buffer are copied over instead of reduced.
+  void reducePages(const ResultSetStorage& that,
+                   const std::vector<std::string>& serialized_varlen_buffer,
+                   const ReductionCode& reduction_code) const;
+
   void initializeRowWise() const;
 
   void initializeColWise() const;
@@ -21,6 +21,7 @@
 #include "RuntimeFunctions.h"
 #include "../Shared/funcannotations.h"
 #include "BufferCompaction.h"
+#include "FilterSelection.h"
 #include "HyperLogLogRank.h"
 #include "MurmurHash.h"
 #include "Shared/quantile.h"
@@ -983,6 +984,172 @@ extern "C" RUNTIME_EXPORT NEVER_INLINE int32_t pos_step_impl() {
   return 1;
 }
 
+namespace {
+
+template <typename T, typename V>
+ALWAYS_INLINE void filter_selection_apply(uint8_t* mask,
+                                          const T* col,
+                                          const int64_t num_rows,
+                                          const int64_t op,
+                                          const V value,
+                                          const bool nullable,
+                                          const T null_value) {
+  // one loop per operator, so that each of them is vectorized
+  switch (op) {
+    case kFilterSelectionEq:
+      for (int64_t i = 0; i < num_rows; ++i) {
+        mask[i] &= static_cast<V>(col[i]) == value;
+      }
+      break;
+    case kFilterSelectionNe:
+      for (int64_t i = 0; i < num_rows; ++i) {
+        mask[i] &= static_cast<V>(col[i]) != value;
+      }
+      break;
+    case kFilterSelectionLt:
+      for (int64_t i = 0; i < num_rows; ++i) {
+        mask[i] &= static_cast<V>(col[i]) < value;
+      }
+      break;
+    case kFilterSelectionLe:
+      for (int64_t i = 0; i < num_rows; ++i) {
+        mask[i] &= static_cast<V>(col[i]) <= value;
+      }
+      break;
+    case kFilterSelectionGt:
+      for (int64_t i = 0; i < num_rows; ++i) {
+        mask[i] &= static_cast<V>(col[i]) > value;
+      }
+      break;
+    case kFilterSelectionGe:
+      for (int64_t i = 0; i < num_rows; ++i) {
+        mask[i] &= static_cast<V>(col[i]) >= value;
+      }
+      break;
+    default:
+      break;
+  }
+  if (nullable) {
+    for (int64_t i = 0; i < num_rows; ++i) {
+      mask[i] &= col[i] != null_value;
+    }
+  }
+}
+
+template <typename T>
+ALWAYS_INLINE void filter_selection_apply_int(uint8_t* mask,
+                                              const int8_t* col_buffer,
+                                              const int64_t block_start,
+                                              const int64_t num_rows,
+                                              const int64_t* term) {
+  filter_selection_apply(mask,
+                         reinterpret_cast<const T*>(col_buffer) + block_start,
+                         num_rows,
+                         term[kFilterSelectionOp],
+                         term[kFilterSelectionValue],
+                         term[kFilterSelectionNullable],
+                         static_cast<T>(term[kFilterSelectionNullValue]));
+}
+
+template <typename T>
+ALWAYS_INLINE void filter_selection_apply_fp(uint8_t* mask,
+                                             const int8_t* col_buffer,
+                                             const int64_t block_start,
+                                             const int64_t num_rows,
+                                             const int64_t* term) {
+  const auto value =
+      *reinterpret_cast<const double*>(may_alias_ptr(&term[kFilterSelectionValue]));
+  const auto null_value =
+      *reinterpret_cast<const double*>(may_alias_ptr(&term[kFilterSelectionNullValue]));
+  filter_selection_apply(mask,
+                         reinterpret_cast<const T*>(col_buffer) + block_start,
+                         num_rows,
+                         term[kFilterSelectionOp],
+                         value,
+                         term[kFilterSelectionNullable],
+                         static_cast<T>(null_value));
+}
+
+}  // namespace
+
+// Evaluates the filter selection terms on blocks of rows starting at block_start, until
+// a block has a selected row or all rows have been evaluated. Returns the first selected
+// position or row_count.
+extern "C" RUNTIME_EXPORT NEVER_INLINE int64_t
+filter_selection_fill(int64_t* state,
+                      const int64_t* desc,
+                      const int8_t** col_buffers,
+                      int64_t block_start,
+                      const int64_t row_count) {
+  uint8_t mask[kFilterSelectionBlockSize];
+  int64_t* selected = state + kFilterSelectionStateHeaderSize;
+  while (block_start < row_count) {
+    const auto num_rows = std::min(row_count - block_start, kFilterSelectionBlockSize);
+    memset(mask, 1, num_rows);
+    for (int64_t term_idx = 0; term_idx < desc[0]; ++term_idx) {
+      const auto term = desc + 1 + term_idx * kFilterSelectionTermSize;
+      const auto col_buffer = col_buffers[term[kFilterSelectionColumn]];
+      switch (term[kFilterSelectionType]) {
+        case kFilterSelectionInt8:
+          filter_selection_apply_int<int8_t>(
+              mask, col_buffer, block_start, num_rows, term);
+          break;
+        case kFilterSelectionInt16:
+          filter_selection_apply_int<int16_t>(
+              mask, col_buffer, block_start, num_rows, term);
+          break;
+        case kFilterSelectionInt32:
+          filter_selection_apply_int<int32_t>(
+              mask, col_buffer, block_start, num_rows, term);
+          break;
+        case kFilterSelectionInt64:
+          filter_selection_apply_int<int64_t>(
+              mask, col_buffer, block_start, num_rows, term);
+          break;
+        case kFilterSelectionFloat:
+          filter_selection_apply_fp<float>(mask, col_buffer, block_start, num_rows, term);
+          break;
+        case kFilterSelectionDouble:
+          filter_selection_apply_fp<double>(
+              mask, col_buffer, block_start, num_rows, term);
+          break;
+        default:
+          break;
+      }
+    }
+    // branch-free compaction of the mask into the selection vector
+    int64_t num_selected{0};
+    for (int64_t i = 0; i < num_rows; ++i) {
+      selected[num_selected] = block_start + i;
+      num_selected += mask[i];
+    }
+    block_start += num_rows;
+    if (num_selected) {
+      state[0] = num_selected;
+      state[1] = 0;
+      state[2] = block_start;
+      return selected[0];
+    }
+  }
+  state[0] = 0;
+  state[1] = 0;
+  state[2] = row_count;
+  return row_count;
+}
+
+extern "C" RUNTIME_EXPORT ALWAYS_INLINE int64_t
+filter_selection_next(int64_t* state,
+                      const int64_t* desc,
+                      const int8_t** col_buffers,
+                      const int64_t row_count) {
+  const auto idx = state[1] + 1;
+  if (idx < state[0]) {
+    state[1] = idx;
+    return state[kFilterSelectionStateHeaderSize + idx];
+  }
+  return filter_selection_fill(state, desc, col_buffers, state[2], row_count);
+}
+
 extern "C" GPU_RT_STUB int8_t thread_warp_idx(const int8_t warp_sz) {
   return 0;
 }
@@ -1276,6 +1443,97 @@ extern "C" RUNTIME_EXPORT ALWAYS_INLINE int64_t* get_group_value_fast_keyless_se
   return groups_buffer + row_size_quad * (warp_size * (key - min_key) + thread_warp_idx);
 }
 
+/*
+ * Paged perfect hash group by buffers are followed by a template row holding the
+ * initial value of every entry and by one flag byte per page of
+ * 2^PAGED_GROUP_BY_PAGE_BITS entries. A page is copied from the template row on the
+ * first write into it, untouched pages are never initialized.
+ *
+ * Memory layout:
+ *
+ * | entries (entry_count rows) | template row | page flags |
+ */
+extern "C" RUNTIME_EXPORT NEVER_INLINE void init_group_by_buffer_page(
+    int64_t* groups_buffer,
+    const int64_t page_idx,
+    const uint32_t row_size_quad,
+    const uint32_t entry_count) {
+  const auto template_row =
+      groups_buffer + static_cast<int64_t>(entry_count) * row_size_quad;
+  auto page_flags = reinterpret_cast<int8_t*>(template_row + row_size_quad);
+  const int64_t page_start = page_idx << PAGED_GROUP_BY_PAGE_BITS;
+  const int64_t page_end =
+      std::min(page_start + (int64_t(1) << PAGED_GROUP_BY_PAGE_BITS),
+               static_cast<int64_t>(entry_count));
+  for (int64_t entry_idx = page_start; entry_idx < page_end; ++entry_idx) {
+    memcpy(groups_buffer + entry_idx * row_size_quad,
+           template_row,
+           row_size_quad * sizeof(int64_t));
+  }
+  page_flags[page_idx] = 1;
+}
+
+extern "C" RUNTIME_EXPORT ALWAYS_INLINE void touch_group_by_buffer_page(
+    int64_t* groups_buffer,
+    const int64_t entry_idx,
+    const uint32_t row_size_quad,
+    const uint32_t entry_count) {
+  const auto page_flags = reinterpret_cast<const int8_t*>(
+      groups_buffer + (static_cast<int64_t>(entry_count) + 1) * row_size_quad);
+  const int64_t page_idx = entry_idx >> PAGED_GROUP_BY_PAGE_BITS;
+  if (!page_flags[page_idx]) {
+    init_group_by_buffer_page(groups_buffer, page_idx, row_size_quad, entry_count);
+  }
+}
+
+extern "C" RUNTIME_EXPORT ALWAYS_INLINE int64_t* get_group_value_fast_paged(
+    int64_t* groups_buffer,
+    const int64_t key,
+    const int64_t min_key,
+    const int64_t bucket,
+    const uint32_t row_size_quad,
+    const uint32_t entry_count) {
+  int64_t key_diff = key - min_key;
+  if (bucket) {
+    key_diff /= bucket;
+  }
+  touch_group_by_buffer_page(groups_buffer, key_diff, row_size_quad, entry_count);
+  return get_group_value_fast(groups_buffer, key, min_key, bucket, row_size_quad);
+}
+
+extern "C" RUNTIME_EXPORT ALWAYS_INLINE int64_t* get_group_value_fast_keyless_paged(
+    int64_t* groups_buffer,
+    const int64_t key,
+    const int64_t min_key,
+    const int64_t bucket,
+    const uint32_t row_size_quad,
+    const uint32_t entry_count) {
+  touch_group_by_buffer_page(groups_buffer, key - min_key, row_size_quad, entry_count);
+  return get_group_value_fast_keyless(groups_buffer, key, min_key, bucket, row_size_quad);
+}
+
+extern "C" RUNTIME_EXPORT ALWAYS_INLINE int64_t*
+get_matching_group_value_perfect_hash_paged(int64_t* groups_buffer,
+                                            const uint32_t hashed_index,
+                                            const int64_t* key,
+                                            const uint32_t key_count,
+                                            const uint32_t row_size_quad,
+                                            const uint32_t entry_count) {
+  touch_group_by_buffer_page(groups_buffer, hashed_index, row_size_quad, entry_count);
+  return get_matching_group_value_perfect_hash(
+      groups_buffer, hashed_index, key, key_count, row_size_quad);
+}
+
+extern "C" RUNTIME_EXPORT ALWAYS_INLINE int64_t*
+get_matching_group_value_perfect_hash_keyless_paged(int64_t* groups_buffer,
+                                                    const uint32_t hashed_index,
+                                                    const uint32_t row_size_quad,
+                                                    const uint32_t entry_count) {
+  touch_group_by_buffer_page(groups_buffer, hashed_index, row_size_quad, entry_count);
+  return get_matching_group_value_perfect_hash_keyless(
+      groups_buffer, hashed_index, row_size_quad);
+}
+
 extern "C" RUNTIME_EXPORT ALWAYS_INLINE int8_t* extract_str_ptr(
     const uint64_t str_and_len) {
   return reinterpret_cast<int8_t*>(str_and_len & 0xffffffffffff);
@@ -122,6 +122,10 @@ extern "C" RUNTIME_EXPORT void agg_count_distinct_bitmap(int64_t* agg,
 #define EMPTY_KEY_16 std::numeric_limits<int16_t>::max()
 #define EMPTY_KEY_8 std::numeric_limits<int8_t>::max()
 
+// Paged perfect hash group by buffers are initialized in pages of
+// 2^PAGED_GROUP_BY_PAGE_BITS entries, on the first write to the page.
+#define PAGED_GROUP_BY_PAGE_BITS 12
+
 extern "C" RUNTIME_EXPORT uint32_t key_hash(const int64_t* key,
                                             const uint32_t key_qw_count,
                                             const uint32_t key_byte_width);
@@ -191,6 +195,41 @@ extern "C" RUNTIME_EXPORT int64_t* get_matching_group_value_perfect_hash_keyless
     const uint32_t hashed_index,
     const uint32_t row_size_quad);
 
+extern "C" RUNTIME_EXPORT void touch_group_by_buffer_page(int64_t* groups_buffer,
+                                                          const int64_t entry_idx,
+                                                          const uint32_t row_size_quad,
+                                                          const uint32_t entry_count);
+
+extern "C" RUNTIME_EXPORT int64_t* get_group_value_fast_paged(
+    int64_t* groups_buffer,
+    const int64_t key,
+    const int64_t min_key,
+    const int64_t bucket,
+    const uint32_t row_size_quad,
+    const uint32_t entry_count);
+
+extern "C" RUNTIME_EXPORT int64_t* get_group_value_fast_keyless_paged(
+    int64_t* groups_buffer,
+    const int64_t key,
+    const int64_t min_key,
+    const int64_t bucket,
+    const uint32_t row_size_quad,
+    const uint32_t entry_count);
+
+extern "C" RUNTIME_EXPORT int64_t* get_matching_group_value_perfect_hash_paged(
+    int64_t* groups_buffer,
+    const uint32_t hashed_index,
+    const int64_t* key,
+    const uint32_t key_count,
+    const uint32_t row_size_quad,
+    const uint32_t entry_count);
+
+extern "C" RUNTIME_EXPORT int64_t* get_matching_group_value_perfect_hash_keyless_paged(
+    int64_t* groups_buffer,
+    const uint32_t hashed_index,
+    const uint32_t row_size_quad,
+    const uint32_t entry_count);
+
 extern "C" RUNTIME_EXPORT int32_t* get_bucketized_hash_slot(
     int32_t* buff,
     const int64_t key,
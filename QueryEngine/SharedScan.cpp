@@ -0,0 +1,117 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QueryEngine/SharedScan.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "Logger/Logger.h"
+#include "Shared/Metrics.h"
+
+extern size_t g_shared_scan_block_size;
+
+SharedScanManager& SharedScanManager::instance() {
+  static SharedScanManager shared_scan_manager;
+  return shared_scan_manager;
+}
+
+size_t SharedScanManager::getBlockCount(const int64_t num_rows) {
+  CHECK_GT(g_shared_scan_block_size, size_t(0));
+  return (num_rows + g_shared_scan_block_size - 1) / g_shared_scan_block_size;
+}
+
+void SharedScanManager::scan(const Key& key, const BlockFunction& run_block) {
+  static auto& joined_kernels = metrics::Registry::instance().counter(
+      "omnisci_shared_scan_joined_kernels_total",
+      "CPU kernels which joined the scan of a fragment by a concurrent query.");
+  auto kernel = std::make_shared<Kernel>();
+  kernel->run_block = &run_block;
+  auto scan = std::make_shared<Scan>();
+  scan->kernels.push_back(kernel);
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    const auto it = scans_.find(key);
+    if (it != scans_.end()) {
+      it->second->kernels.push_back(kernel);
+      ++joined_kernel_count_;
+      joined_kernels.add();
+      VLOG(1) << "Kernel joined the shared scan of the fragment at row " << key.frag_offset
+              << " of table " << key.table_id;
+      kernel_finished_.wait(lock, [&kernel] { return kernel->finished; });
+      if (kernel->error) {
+        std::rethrow_exception(kernel->error);
+      }
+      return;
+    }
+    scans_.emplace(key, scan);
+    ++scan_count_;
+  }
+  lead(key, scan);
+  if (kernel->error) {
+    std::rethrow_exception(kernel->error);
+  }
+}
+
+void SharedScanManager::lead(const Key& key, const std::shared_ptr<Scan>& scan) {
+  const auto block_count = getBlockCount(key.num_rows);
+  std::vector<std::shared_ptr<Kernel>> kernels;
+  // The first pass runs every block for the leading kernel, the second one the blocks
+  // the kernels which joined during the first pass have missed.
+  for (size_t i = 0;; ++i) {
+    const auto block_idx = i % block_count;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      scan->kernels.remove_if([](const auto& kernel) { return kernel->finished; });
+      if (i == block_count || scan->kernels.empty()) {
+        // kernels starting on the fragment from now on lead a scan of their own
+        scans_.erase(key);
+      }
+      if (scan->kernels.empty()) {
+        break;
+      }
+      kernels.assign(scan->kernels.begin(), scan->kernels.end());
+    }
+    const auto begin = static_cast<int64_t>(block_idx * g_shared_scan_block_size);
+    const auto end =
+        std::min(begin + static_cast<int64_t>(g_shared_scan_block_size), key.num_rows);
+    for (auto& kernel : kernels) {
+      bool proceed{false};
+      std::exception_ptr error;
+      try {
+        proceed = (*kernel->run_block)(begin, end, block_idx);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!proceed || ++kernel->blocks_done == block_count) {
+        kernel->error = error;
+        kernel->finished = true;
+        kernel_finished_.notify_all();
+      }
+    }
+  }
+}
+
+size_t SharedScanManager::getScanCount() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return scan_count_;
+}
+
+size_t SharedScanManager::getJoinedKernelCount() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return joined_kernel_count_;
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    SharedScan.h
+ * @brief   One pass over a fragment for the CPU kernels of concurrent queries.
+ *
+ * A kernel scanning a fragment splits it into blocks of rows small enough to stay in
+ * the CPU caches. The first kernel to scan the fragment leads the scan: for every block
+ * it runs the compiled function of each kernel which has joined the scan in turn, so the
+ * block is read from memory once for all of them. A kernel starting on a fragment which
+ * is being scanned joins at the next block and waits for the leader, which wraps around
+ * to the blocks the kernel missed once its own pass is complete.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+class SharedScanManager {
+ public:
+  // A fragment of a physical table, by the offset of its first row in the table.
+  struct Key {
+    int db_id;
+    int table_id;
+    uint64_t frag_offset;
+    int64_t num_rows;
+
+    bool operator<(const Key& other) const {
+      return std::tie(db_id, table_id, frag_offset, num_rows) <
+             std::tie(other.db_id, other.table_id, other.frag_offset, other.num_rows);
+    }
+  };
+
+  // Runs a kernel over the rows [begin, end) of the fragment, the block with the given
+  // index. Returns false if the kernel failed and must not run any further blocks.
+  using BlockFunction =
+      std::function<bool(const int64_t begin, const int64_t end, const size_t block_idx)>;
+
+  static SharedScanManager& instance();
+
+  static size_t getBlockCount(const int64_t num_rows);
+
+  // Runs the kernel over every block of the fragment, either by leading a scan of the
+  // fragment or by joining the one in progress. Returns once the kernel has seen every
+  // block, possibly run by another thread.
+  void scan(const Key& key, const BlockFunction& run_block);
+
+  // Number of scans started and of kernels which joined a scan, since startup.
+  size_t getScanCount() const;
+  size_t getJoinedKernelCount() const;
+
+ private:
+  SharedScanManager() {}
+
+  struct Kernel {
+    const BlockFunction* run_block;
+    size_t blocks_done{0};
+    bool finished{false};
+    std::exception_ptr error;
+  };
+
+  struct Scan {
+    std::list<std::shared_ptr<Kernel>> kernels;
+  };
+
+  void lead(const Key& key, const std::shared_ptr<Scan>& scan);
+
+  mutable std::mutex mutex_;
+  std::condition_variable kernel_finished_;
+  // scans which kernels can still join
+  std::map<Key, std::shared_ptr<Scan>> scans_;
+  size_t scan_count_{0};
+  size_t joined_kernel_count_{0};
+};
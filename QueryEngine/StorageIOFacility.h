@@ -101,6 +101,28 @@ bool should_recompute_metadata(
     return is_chunk_min_max_updated(update_stats.value(), min, max);
   }
 }
+
+/**
+ * Checks if the projected values of an update target are held in a contiguous buffer
+ * in the storage type of the target column, so they can be written into its chunks as
+ * is.
+ */
+bool is_buffer_update_possible(const ResultSet& rs,
+                               const size_t col_idx,
+                               const SQLTypeInfo& lhs_type,
+                               const SQLTypeInfo& rhs_type) {
+  if (lhs_type.is_varlen() || lhs_type.is_string() ||
+      lhs_type.get_compression() != kENCODING_NONE) {
+    return false;
+  }
+  if (lhs_type.get_type() != rhs_type.get_type() ||
+      lhs_type.get_dimension() != rhs_type.get_dimension() ||
+      lhs_type.get_scale() != rhs_type.get_scale()) {
+    return false;
+  }
+  return rs.isZeroCopyColumnarConversionPossible(col_idx) &&
+         rs.getPaddedSlotWidthBytes(col_idx) == static_cast<size_t>(lhs_type.get_size());
+}
 }  // namespace
 
 class StorageIOFacility {
@@ -327,6 +349,20 @@ class StorageIOFacility {
           usable_threads = 1;
         }
 
+        // Columnar projections hold the fragment offsets and the values of each updated
+        // column in contiguous buffers, which are handed to the fragmenter as is when
+        // the projected type matches the storage type of the column.
+        auto rs = update_log.getResultSet();
+        const auto offset_col_idx = update_parameters.getUpdateColumnCount();
+        OffsetVector buffer_offsets;
+        if (entries_per_column == rows_per_column &&
+            rs->isZeroCopyColumnarConversionPossible(offset_col_idx) &&
+            rs->getPaddedSlotWidthBytes(offset_col_idx) == sizeof(int64_t)) {
+          const auto offsets =
+              reinterpret_cast<const uint64_t*>(rs->getColumnarBuffer(offset_col_idx));
+          buffer_offsets.assign(offsets, offsets + rows_per_column);
+        }
+
         std::atomic<size_t> row_idx{0};
 
         auto process_rows =
@@ -376,6 +412,33 @@ class StorageIOFacility {
         for (decltype(update_parameters.getUpdateColumnCount()) column_index = 0;
              column_index < update_parameters.getUpdateColumnCount();
              column_index++) {
+          const auto table_id = update_log.getPhysicalTableId();
+          const auto fragmenter = table_descriptor->fragmenter;
+          CHECK(fragmenter);
+          auto const* target_column = catalog_.getMetadataForColumn(
+              table_id, update_parameters.getUpdateColumnNames()[column_index]);
+
+          if (!buffer_offsets.empty() &&
+              is_buffer_update_possible(*rs,
+                                        column_index,
+                                        target_column->columnType,
+                                        update_log.getColumnType(column_index))) {
+            auto update_stats = fragmenter->updateColumnFromBuffer(
+                &catalog_,
+                table_descriptor,
+                target_column,
+                fragment_id,
+                buffer_offsets,
+                rs->getColumnarBuffer(column_index),
+                Data_Namespace::MemoryLevel::CPU_LEVEL,
+                update_parameters.getTransactionTracker());
+            if (should_recompute_metadata(update_stats)) {
+              table_update_metadata.columns_for_metadata_update[target_column].emplace(
+                  fragment_id);
+            }
+            continue;
+          }
+
           row_idx = 0;
           RowProcessingFuturesVector entry_processing_futures;
           entry_processing_futures.reserve(usable_threads);
@@ -416,11 +479,6 @@ class StorageIOFacility {
 
           CHECK(row_idx == rows_per_column);
 
-          const auto table_id = update_log.getPhysicalTableId();
-          const auto fragmenter = table_descriptor->fragmenter;
-          CHECK(fragmenter);
-          auto const* target_column = catalog_.getMetadataForColumn(
-              table_id, update_parameters.getUpdateColumnNames()[column_index]);
           auto update_stats =
               fragmenter->updateColumn(&catalog_,
                                        table_descriptor,
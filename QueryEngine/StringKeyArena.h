@@ -0,0 +1,92 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    StringKeyArena.h
+ * @brief   Query scoped interning of none encoded strings used as group by keys.
+ *
+ * Grouping on a none encoded string hashes the string itself instead of translating it
+ * to a transient dictionary id. Each distinct string is copied once into the arena,
+ * which hands out a 64-bit key for it. The key is then used as the group by key in the
+ * baseline hash table. Since all the kernels of a query share the arena, equal strings
+ * get equal keys on every kernel and the partial results are reduced like integer keys.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Logger/Logger.h"
+
+class StringKeyArena {
+ public:
+  // Returns the key of the given string, adding the string to the arena if needed. Keys
+  // are never negative.
+  int64_t getOrAddKey(const char* str, const size_t len) {
+    const std::string_view str_view(str, len);
+    const auto hash = std::hash<std::string_view>{}(str_view);
+    const size_t shard_idx = hash & (kShardCount - 1);
+    auto& shard = shards_[shard_idx];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const auto it = shard.keys.find(str_view);
+    if (it != shard.keys.end()) {
+      return it->second;
+    }
+    const auto key = static_cast<int64_t>((shard.strings.size() << kShardBits) |
+                                          static_cast<size_t>(shard_idx));
+    // the deque doesn't move its elements when growing, which keeps the views valid
+    const auto& stored = shard.strings.emplace_back(str, len);
+    shard.keys.emplace(std::string_view(stored), key);
+    return key;
+  }
+
+  std::string_view getString(const int64_t key) const {
+    CHECK_GE(key, 0);
+    const auto& shard = shards_[key & (kShardCount - 1)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const auto idx = static_cast<size_t>(key >> kShardBits);
+    CHECK_LT(idx, shard.strings.size());
+    return shard.strings[idx];
+  }
+
+  size_t size() const {
+    size_t total{0};
+    for (const auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      total += shard.strings.size();
+    }
+    return total;
+  }
+
+ private:
+  static constexpr size_t kShardBits{6};
+  static constexpr size_t kShardCount{size_t(1) << kShardBits};
+
+  struct Shard {
+    mutable std::mutex mutex;
+    std::unordered_map<std::string_view, int64_t> keys;
+    std::deque<std::string> strings;
+  };
+
+  std::array<Shard, kShardCount> shards_;
+};
@@ -56,6 +56,17 @@ extern "C" RUNTIME_EXPORT int32_t string_compress(const int64_t ptr_and_len,
   return string_dict_proxy->getIdOfString(raw_str);
 }
 
+extern "C" RUNTIME_EXPORT int64_t string_key_id(const int64_t ptr_and_len,
+                                                const int64_t string_key_arena_handle) {
+  if (ptr_and_len == 0) {
+    return inline_int_null_value<int64_t>();
+  }
+  auto string_key_arena = reinterpret_cast<StringKeyArena*>(string_key_arena_handle);
+  return string_key_arena->getOrAddKey(
+      reinterpret_cast<const char*>(extract_str_ptr_noinline(ptr_and_len)),
+      extract_str_len_noinline(ptr_and_len));
+}
+
 extern "C" RUNTIME_EXPORT int32_t lower_encoded(int32_t string_id,
                                                 int64_t string_dict_proxy_address) {
   StringDictionaryProxy* string_dict_proxy =
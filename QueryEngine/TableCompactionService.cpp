@@ -0,0 +1,131 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QueryEngine/TableCompactionService.h"
+
+#include <chrono>
+#include <vector>
+
+#include "Catalog/Catalog.h"
+#include "Catalog/SysCatalog.h"
+#include "LockMgr/LockMgr.h"
+#include "Logger/Logger.h"
+#include "QueryEngine/Execute.h"
+#include "QueryEngine/TableOptimizer.h"
+
+bool g_enable_table_compaction{false};
+size_t g_table_compaction_interval_ms{60000};
+size_t g_table_compaction_max_mb_per_sec{32};
+
+TableCompactionService& TableCompactionService::instance() {
+  static TableCompactionService table_compaction_service;
+  return table_compaction_service;
+}
+
+void TableCompactionService::start() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    CHECK(!running_);
+    running_ = true;
+  }
+  compaction_thread_ = std::thread([this] {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_requested_.wait_for(
+        lock, std::chrono::milliseconds(g_table_compaction_interval_ms), [this] {
+          return !running_;
+        })) {
+      lock.unlock();
+      compactTables();
+      lock.lock();
+    }
+  });
+  LOG(INFO) << "Started table compaction service";
+}
+
+void TableCompactionService::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_) {
+      return;
+    }
+    running_ = false;
+  }
+  stop_requested_.notify_all();
+  compaction_thread_.join();
+}
+
+bool TableCompactionService::isRunning() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return running_;
+}
+
+size_t TableCompactionService::compactTables() {
+  const bool was_running = isRunning();
+  const auto stopped = [this, was_running] { return was_running && !isRunning(); };
+  size_t merged_fragment_count{0};
+  auto& sys_catalog = Catalog_Namespace::SysCatalog::instance();
+  for (const auto& db : sys_catalog.getAllDBMetadata()) {
+    const auto cat = sys_catalog.getCatalog(db, false);
+    CHECK(cat);
+    // Tables may be dropped while others are compacted, so only their ids are kept.
+    std::vector<int> table_ids;
+    for (const auto td : cat->getAllTableMetadata()) {
+      if (td->compactionFillPercent > 0 && !td->isView && td->shard < 0) {
+        table_ids.push_back(td->tableId);
+      }
+    }
+    for (const auto table_id : table_ids) {
+      if (stopped()) {
+        return merged_fragment_count;
+      }
+      try {
+        // The schema read lock keeps the table from being dropped or altered, the
+        // optimizer takes the data write lock for every merge.
+        const auto td_with_lock =
+            lockmgr::TableSchemaLockContainer<lockmgr::ReadLock>::acquireTableDescriptor(
+                *cat, table_id);
+        const TableOptimizer optimizer(
+            td_with_lock(),
+            Executor::getExecutor(Executor::UNITARY_EXECUTOR_ID).get(),
+            *cat);
+        merged_fragment_count += optimizer.compactFragments(
+            [this, &stopped](const size_t num_bytes) {
+              return throttle(num_bytes) && !stopped();
+            });
+      } catch (const std::exception& e) {
+        LOG(ERROR) << "Failed to compact table " << table_id << " of database "
+                   << db.dbName << ": " << e.what();
+      }
+    }
+  }
+  if (merged_fragment_count) {
+    LOG(INFO) << "Table compaction merged " << merged_fragment_count << " fragments";
+  }
+  return merged_fragment_count;
+}
+
+bool TableCompactionService::throttle(const size_t num_bytes) {
+  if (!g_table_compaction_max_mb_per_sec) {
+    return true;
+  }
+  const std::chrono::microseconds delay(
+      num_bytes * 1000000 / (g_table_compaction_max_mb_per_sec << 20));
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (!running_) {
+    return true;
+  }
+  return !stop_requested_.wait_for(lock, delay, [this] { return !running_; });
+}
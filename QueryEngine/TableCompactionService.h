@@ -0,0 +1,59 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    TableCompactionService.h
+ * @brief   Background thread merging the under-filled fragments of the tables created
+ *          with a COMPACTION_FILL_PERCENT option.
+ *
+ * Every interval, the thread walks the tables of all databases and runs
+ * TableOptimizer::compactFragments on the ones which opted in. The rate at which chunk
+ * data is rewritten is capped, and the thread sleeps between merges to stay below it.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+class TableCompactionService {
+ public:
+  static TableCompactionService& instance();
+
+  // Starts the compaction thread. Requires the system catalog to be initialized.
+  void start();
+  // Stops the compaction thread once the current merge is done.
+  void stop();
+  bool isRunning();
+
+  // Compacts every table of every database once and returns the number of merged
+  // fragments. Merges are only throttled while the service is running.
+  size_t compactTables();
+
+ private:
+  TableCompactionService() {}
+
+  // Sleeps long enough for `num_bytes` to stay below the configured rate. Returns false
+  // if the service is being stopped.
+  bool throttle(const size_t num_bytes);
+
+  std::mutex mutex_;
+  std::condition_variable stop_requested_;
+  bool running_{false};
+  std::thread compaction_thread_;
+};
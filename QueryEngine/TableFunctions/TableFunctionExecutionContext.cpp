@@ -22,7 +22,13 @@
 #include "QueryEngine/GpuMemUtils.h"
 #include "QueryEngine/TableFunctions/TableFunctionCompilationContext.h"
 #include "QueryEngine/TableFunctions/TableFunctionManager.h"
+#include "Shared/Intervals.h"
 #include "Shared/funcannotations.h"
+#include "Shared/thread_count.h"
+#include "Shared/threading.h"
+
+bool g_enable_parallel_table_functions{true};
+size_t g_parallel_table_function_threshold{1 << 16};  // 65536
 
 namespace {
 
@@ -113,6 +119,57 @@ size_t get_output_row_count(const TableFunctionExecutionUnit& exe_unit,
   return allocated_output_row_count;
 }
 
+// Whether the function can run on morsels of its input: it must declare a combine step,
+// size its output from the rows of each invocation and read fixed width columns of a
+// single input table.
+bool can_run_on_morsels(const TableFunctionExecutionUnit& exe_unit,
+                        const std::vector<size_t>& input_col_widths,
+                        const std::vector<int64_t>& col_sizes) {
+  using table_functions::ParallelCombineType;
+  const auto& table_func = exe_unit.table_func;
+  const auto combine_type = table_func.getParallelCombineType();
+  if (!g_enable_parallel_table_functions || combine_type == ParallelCombineType::kNone ||
+      !table_func.usesManager() || input_col_widths.empty()) {
+    return false;
+  }
+  if (!table_func.hasUserSpecifiedOutputSizeMultiplier() &&
+      !table_func.hasTableFunctionSpecifiedParameter()) {
+    return false;
+  }
+  const auto first_col_it =
+      std::find_if(input_col_widths.begin(), input_col_widths.end(), [](auto width) {
+        return width > 0;
+      });
+  if (first_col_it == input_col_widths.end()) {
+    return false;
+  }
+  const auto num_rows = col_sizes[first_col_it - input_col_widths.begin()];
+  if (num_rows < 2 ||
+      static_cast<size_t>(num_rows) < g_parallel_table_function_threshold) {
+    return false;
+  }
+  if (combine_type == ParallelCombineType::kMerge) {
+    // The merge step reads the partial outputs in place of the input columns.
+    size_t output_col_idx = 0;
+    for (size_t i = 0; i < input_col_widths.size(); ++i) {
+      if (!input_col_widths[i]) {
+        continue;
+      }
+      if (output_col_idx == exe_unit.target_exprs.size()) {
+        return false;
+      }
+      const auto& input_ti = exe_unit.input_exprs[i]->get_type_info();
+      const auto& output_ti = exe_unit.target_exprs[output_col_idx++]->get_type_info();
+      if (input_ti.get_subtype() != output_ti.get_type() ||
+          input_col_widths[i] != static_cast<size_t>(output_ti.get_size())) {
+        return false;
+      }
+    }
+    return output_col_idx == exe_unit.target_exprs.size();
+  }
+  return true;
+}
+
 }  // namespace
 
 ResultSetPtr TableFunctionExecutionContext::execute(
@@ -142,6 +199,11 @@ ResultSetPtr TableFunctionExecutionContext::execute(
   // TODO: col_list_bufs are allocated on CPU memory, so UDTFs with column_list
   // arguments are not supported on GPU atm.
   std::vector<std::vector<const int8_t*>> col_list_bufs;
+  // Element widths of the input columns and zero for literals, used to split the input
+  // into morsels. Cleared if the input cannot be split.
+  std::vector<size_t> input_col_widths;
+  std::optional<int> input_table_id;
+  bool can_split_input{true};
   for (const auto& input_expr : exe_unit.input_exprs) {
     auto ti = input_expr->get_type_info();
     if (!ti.is_column_list()) {
@@ -154,6 +216,13 @@ ResultSetPtr TableFunctionExecutionContext::execute(
             return table_info.table_id == table_id;
           });
       CHECK(table_info_it != table_infos.end());
+      const auto elem_width = ti.get_elem_type().get_size();
+      if (ti.is_column_list() || elem_width <= 0 ||
+          (input_table_id && *input_table_id != table_id)) {
+        can_split_input = false;
+      }
+      input_table_id = table_id;
+      input_col_widths.push_back(std::max(elem_width, 0));
       auto [col_buf, buf_elem_count] = ColumnFetcher::getOneColumnFragment(
           executor,
           *col_var,
@@ -193,6 +262,7 @@ ResultSetPtr TableFunctionExecutionContext::execute(
       // TODO(adb): Unify literal handling with rest of system, either in Codegen or as a
       // separate serialization component
       col_sizes.push_back(0);
+      input_col_widths.push_back(0);
       const auto const_val_datum = constant_val->get_constval();
       const auto& ti = constant_val->get_type_info();
       if (ti.is_fp()) {
@@ -259,6 +329,9 @@ ResultSetPtr TableFunctionExecutionContext::execute(
   }
   CHECK_EQ(col_buf_ptrs.size(), exe_unit.input_exprs.size());
   CHECK_EQ(col_sizes.size(), exe_unit.input_exprs.size());
+  if (!can_split_input) {
+    input_col_widths.clear();
+  }
   if (!exe_unit.table_func
            .hasOutputSizeIndependentOfInputSize()) {  // includes compile-time constants,
                                                       // user-specified constants,
@@ -282,6 +355,16 @@ ResultSetPtr TableFunctionExecutionContext::execute(
   } else {
     switch (device_type) {
       case ExecutorDeviceType::CPU:
+        if (can_run_on_morsels(exe_unit, input_col_widths, col_sizes)) {
+          return launchCpuCodeOnMorsels(
+              exe_unit,
+              std::dynamic_pointer_cast<CpuCompilationContext>(compilation_context),
+              col_buf_ptrs,
+              col_sizes,
+              input_col_widths,
+              *input_num_rows,
+              executor);
+        }
         return launchCpuCode(
             exe_unit,
             std::dynamic_pointer_cast<CpuCompilationContext>(compilation_context),
@@ -471,6 +554,125 @@ ResultSetPtr TableFunctionExecutionContext::launchCpuCode(
   return mgr->query_buffers->getResultSetOwned(0);
 }
 
+ResultSetPtr TableFunctionExecutionContext::launchCpuCodeOnMorsels(
+    const TableFunctionExecutionUnit& exe_unit,
+    const std::shared_ptr<CpuCompilationContext>& compilation_context,
+    const std::vector<const int8_t*>& col_buf_ptrs,
+    const std::vector<int64_t>& col_sizes,
+    const std::vector<size_t>& input_col_widths,
+    const size_t elem_count,
+    Executor* executor) {
+  auto timer = DEBUG_TIMER(__func__);
+  CHECK_EQ(input_col_widths.size(), col_buf_ptrs.size());
+  std::vector<Interval<size_t>> morsels;
+  for (const auto morsel : makeIntervals<size_t>(0, elem_count, cpu_threads())) {
+    morsels.push_back(morsel);
+  }
+  std::vector<ResultSetPtr> partial_outputs(morsels.size());
+  std::vector<std::exception_ptr> errors(morsels.size());
+  threading::task_group thread_pool;
+  for (const auto& morsel : morsels) {
+    thread_pool.run([&, morsel] {
+      // The columns of the morsel are views over the rows of the input columns.
+      auto morsel_col_buf_ptrs = col_buf_ptrs;
+      auto morsel_col_sizes = col_sizes;
+      for (size_t i = 0; i < input_col_widths.size(); ++i) {
+        if (input_col_widths[i]) {
+          morsel_col_buf_ptrs[i] += morsel.begin * input_col_widths[i];
+          morsel_col_sizes[i] = morsel.size();
+        }
+      }
+      try {
+        partial_outputs[morsel.index] = launchCpuCode(exe_unit,
+                                                      compilation_context,
+                                                      morsel_col_buf_ptrs,
+                                                      morsel_col_sizes,
+                                                      morsel.size(),
+                                                      executor);
+      } catch (...) {
+        errors[morsel.index] = std::current_exception();
+      }
+    });
+  }
+  thread_pool.wait();
+  for (const auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  auto concat_col_buf_ptrs = col_buf_ptrs;
+  auto output = concatOutputs(exe_unit, partial_outputs, concat_col_buf_ptrs, executor);
+  if (exe_unit.table_func.getParallelCombineType() !=
+      table_functions::ParallelCombineType::kMerge) {
+    return output;
+  }
+  // Run the function once more with the partial outputs in place of the input columns,
+  // can_run_on_morsels has checked that their types match.
+  auto merge_col_buf_ptrs = col_buf_ptrs;
+  auto merge_col_sizes = col_sizes;
+  const auto merge_elem_count = output->entryCount();
+  size_t output_col_idx = 0;
+  for (size_t i = 0; i < input_col_widths.size(); ++i) {
+    if (input_col_widths[i]) {
+      merge_col_buf_ptrs[i] = output->getColumnarBuffer(output_col_idx++);
+      merge_col_sizes[i] = merge_elem_count;
+    }
+  }
+  return launchCpuCode(exe_unit,
+                       compilation_context,
+                       merge_col_buf_ptrs,
+                       merge_col_sizes,
+                       merge_elem_count ? merge_elem_count : 1,
+                       executor);
+}
+
+ResultSetPtr TableFunctionExecutionContext::concatOutputs(
+    const TableFunctionExecutionUnit& exe_unit,
+    const std::vector<ResultSetPtr>& partial_outputs,
+    std::vector<const int8_t*>& col_buf_ptrs,
+    Executor* executor) {
+  auto timer = DEBUG_TIMER(__func__);
+  size_t output_row_count = 0;
+  for (const auto& partial_output : partial_outputs) {
+    CHECK(partial_output);
+    output_row_count += partial_output->entryCount();
+  }
+
+  // The members layout must match with Column defined in OmniSciTypes.h
+  struct OutputColumn {
+    int8_t* ptr;
+    int64_t size;
+  };
+  const auto num_out_columns = exe_unit.target_exprs.size();
+  std::vector<OutputColumn> output_columns(num_out_columns);
+  auto mgr = std::make_unique<TableFunctionManager>(
+      exe_unit, executor, col_buf_ptrs, row_set_mem_owner_, /*is_singleton=*/false);
+  for (size_t col_idx = 0; col_idx < num_out_columns; col_idx++) {
+    mgr->set_output_column(col_idx, reinterpret_cast<int8_t*>(&output_columns[col_idx]));
+  }
+  mgr->allocate_output_buffers(output_row_count);
+
+  size_t row_offset = 0;
+  for (const auto& partial_output : partial_outputs) {
+    const auto row_count = partial_output->entryCount();
+    if (!row_count) {
+      continue;
+    }
+    for (size_t col_idx = 0; col_idx < num_out_columns; col_idx++) {
+      const size_t target_width =
+          exe_unit.target_exprs[col_idx]->get_type_info().get_size();
+      std::memcpy(output_columns[col_idx].ptr + row_offset * target_width,
+                  partial_output->getColumnarBuffer(col_idx),
+                  row_count * target_width);
+    }
+    row_offset += row_count;
+  }
+  CHECK_EQ(row_offset, output_row_count);
+  mgr->query_buffers->getResultSet(0)->updateStorageEntryCount(output_row_count);
+  return mgr->query_buffers->getResultSetOwned(0);
+}
+
 namespace {
 enum {
   MANAGER,
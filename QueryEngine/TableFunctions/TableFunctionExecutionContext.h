@@ -59,6 +59,23 @@ class TableFunctionExecutionContext {
       const size_t elem_count,
       Executor* executor);
 
+  // Runs the function on morsels of the input columns in parallel and combines the
+  // partial outputs as declared by the function. Columns with a zero width in
+  // input_col_widths are passed unchanged to every invocation.
+  ResultSetPtr launchCpuCodeOnMorsels(
+      const TableFunctionExecutionUnit& exe_unit,
+      const std::shared_ptr<CpuCompilationContext>& compilation_context,
+      const std::vector<const int8_t*>& col_buf_ptrs,
+      const std::vector<int64_t>& col_sizes,
+      const std::vector<size_t>& input_col_widths,
+      const size_t elem_count,
+      Executor* executor);
+
+  ResultSetPtr concatOutputs(const TableFunctionExecutionUnit& exe_unit,
+                             const std::vector<ResultSetPtr>& partial_outputs,
+                             std::vector<const int8_t*>& col_buf_ptrs,
+                             Executor* executor);
+
   ResultSetPtr launchGpuCode(
       const TableFunctionExecutionUnit& exe_unit,
       const std::shared_ptr<GpuCompilationContext>& compilation_context,
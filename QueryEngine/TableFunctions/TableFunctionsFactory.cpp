@@ -195,6 +195,21 @@ const std::map<std::string, std::string>& TableFunction::getFunctionAnnotation()
   return getAnnotation(sql_args_.size() + output_args_.size());
 }
 
+ParallelCombineType TableFunction::getParallelCombineType() const {
+  const auto& annotation = getFunctionAnnotation();
+  const auto it = annotation.find("parallel");
+  if (it == annotation.end()) {
+    return ParallelCombineType::kNone;
+  }
+  if (it->second == "concat") {
+    return ParallelCombineType::kConcat;
+  }
+  if (it->second == "merge") {
+    return ParallelCombineType::kMerge;
+  }
+  return ParallelCombineType::kNone;
+}
+
 std::pair<int32_t, int32_t> TableFunction::getInputID(const size_t idx) const {
   // if the annotation is of the form args<INT,INT>, it is refering to a column list
 #define PREFIX_LENGTH 5
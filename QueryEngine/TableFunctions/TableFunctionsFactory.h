@@ -101,6 +101,11 @@
 
 namespace table_functions {
 
+// Combine step of a table function which runs on morsels of its input in parallel, as
+// declared by the `parallel` function annotation. kConcat concatenates the partial
+// outputs, kMerge runs the function once more on the concatenated partial outputs.
+enum class ParallelCombineType { kNone, kConcat, kMerge };
+
 struct TableFunctionOutputRowSizer {
   OutputBufferSizeType type{OutputBufferSizeType::kConstant};
   const size_t val{0};
@@ -241,6 +246,8 @@ class TableFunction {
       const size_t output_arg_idx) const;
   const std::map<std::string, std::string>& getFunctionAnnotation() const;
 
+  ParallelCombineType getParallelCombineType() const;
+
   std::pair<int32_t, int32_t> getInputID(const size_t idx) const;
 
   size_t getSqlOutputRowSizeParameter() const;
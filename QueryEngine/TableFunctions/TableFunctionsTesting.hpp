@@ -1731,4 +1731,39 @@ ct_test_preflight_multicursor_qe227__cpu_(TableFunctionManager& mgr,
   return out.size();
 }
 
+// clang-format off
+/*
+  The UDTFs below run on morsels of the input cursor in parallel when
+  the input is large enough. The outputs of ct_parallel_scale are
+  concatenated, ct_parallel_sum is run once more on the concatenated
+  partial sums.
+
+  UDTF: ct_parallel_scale(TableFunctionManager, Cursor<Column<int32_t> x>, int32_t factor) | parallel=concat -> Column<int32_t> x
+  UDTF: ct_parallel_sum(TableFunctionManager, Cursor<Column<int32_t> x>) | parallel=merge -> Column<int32_t> x
+*/
+// clang-format on
+
+EXTENSION_NOINLINE_HOST int32_t ct_parallel_scale(TableFunctionManager& mgr,
+                                                  const Column<int32_t>& input,
+                                                  const int32_t factor,
+                                                  Column<int32_t>& output) {
+  mgr.set_output_row_size(input.size());
+  for (int32_t i = 0; i < input.size(); i++) {
+    output[i] = input[i] * factor;
+  }
+  return output.size();
+}
+
+EXTENSION_NOINLINE_HOST int32_t ct_parallel_sum(TableFunctionManager& mgr,
+                                                const Column<int32_t>& input,
+                                                Column<int32_t>& output) {
+  mgr.set_output_row_size(1);
+  int32_t sum = 0;
+  for (int32_t i = 0; i < input.size(); i++) {
+    sum += input[i];
+  }
+  output[0] = sum;
+  return output.size();
+}
+
 #endif
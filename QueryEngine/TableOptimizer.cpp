@@ -16,7 +16,10 @@
 
 #include "TableOptimizer.h"
 
+#include <algorithm>
+
 #include "Analyzer/Analyzer.h"
+#include "Fragmenter/SortedOrderFragmenter.h"
 #include "LockMgr/LockMgr.h"
 #include "Logger/Logger.h"
 #include "QueryEngine/Execute.h"
@@ -429,7 +432,7 @@ void TableOptimizer::vacuumDeletedRows() const {
   const auto shards = cat_.getPhysicalTablesDescriptors(td_);
   try {
     for (const auto shard : shards) {
-      vacuumFragments(shard);
+      vacuumFragments(shard, table_lock);
     }
     cat_.checkpoint(table_id);
   } catch (...) {
@@ -444,7 +447,190 @@ void TableOptimizer::vacuumDeletedRows() const {
   }
 }
 
+void TableOptimizer::clusterRows(const std::string& column_name) const {
+  auto timer = DEBUG_TIMER(__func__);
+  const auto cd = cat_.getMetadataForColumn(td_->tableId, column_name);
+  if (!cd) {
+    throw std::runtime_error("Column " + column_name + " does not exist in table " +
+                             td_->tableName + ".");
+  }
+  if (!cd->columnType.is_geometry()) {
+    throw std::runtime_error("Cannot cluster table " + td_->tableName + " by column " +
+                             column_name + ", which is not a geo column.");
+  }
+  if (td_->persistenceLevel != Data_Namespace::MemoryLevel::DISK_LEVEL ||
+      !cat_.getDeletedColumn(td_)) {
+    throw std::runtime_error("Cannot cluster table " + td_->tableName +
+                             ", which does not support deletes.");
+  }
+  const auto table_id = td_->tableId;
+  const auto db_id = cat_.getDatabaseId();
+  const auto table_lock =
+      lockmgr::TableDataLockMgr::getWriteLockForTable({db_id, table_id});
+  const auto table_epochs = cat_.getTableEpochs(db_id, table_id);
+  const auto shards = cat_.getPhysicalTablesDescriptors(td_);
+  try {
+    for (const auto shard : shards) {
+      const auto shard_cd = cat_.getMetadataForColumn(shard->tableId, cd->columnId);
+      CHECK(shard_cd);
+      UpdelRoll updel_roll;
+      shard->fragmenter->clusterRows(
+          &cat_,
+          shard,
+          Fragmenter_Namespace::get_geo_location_column(cat_, shard_cd),
+          Data_Namespace::MemoryLevel::CPU_LEVEL,
+          updel_roll);
+      updel_roll.stageUpdate(table_lock);
+      vacuumFragments(shard, table_lock);
+    }
+    cat_.checkpoint(table_id);
+  } catch (...) {
+    cat_.setTableEpochsLogExceptions(db_id, table_epochs);
+    throw;
+  }
+
+  for (auto shard : shards) {
+    cat_.removeFragmenterForTable(shard->tableId);
+    cat_.getDataMgr().getGlobalFileMgr()->compactDataFiles(cat_.getDatabaseId(),
+                                                           shard->tableId);
+  }
+}
+
+namespace {
+
+// Groups runs of adjacent fragments holding fewer than `max_rows` rows each into sets of
+// at most `fragment_size` rows. Empty fragments don't end a run. The last fragment is
+// left out, since it takes the merged rows.
+std::vector<std::set<int>> get_compaction_groups(
+    const std::vector<Fragmenter_Namespace::FragmentInfo>& fragments,
+    const size_t max_rows,
+    const size_t fragment_size) {
+  std::vector<std::set<int>> groups;
+  std::set<int> group;
+  size_t group_rows{0};
+  const auto close_group = [&groups, &group, &group_rows]() {
+    if (group.size() > 1) {
+      groups.push_back(group);
+    }
+    group.clear();
+    group_rows = 0;
+  };
+  for (size_t i = 0; i + 1 < fragments.size(); ++i) {
+    const auto num_rows = fragments[i].getPhysicalNumTuples();
+    if (!num_rows) {
+      continue;
+    }
+    if (num_rows >= max_rows) {
+      close_group();
+      continue;
+    }
+    if (group_rows + num_rows > fragment_size) {
+      close_group();
+    }
+    group.insert(fragments[i].fragmentId);
+    group_rows += num_rows;
+  }
+  close_group();
+  return groups;
+}
+
+size_t get_chunk_bytes(const std::vector<Fragmenter_Namespace::FragmentInfo>& fragments,
+                       const std::set<int>& fragment_ids) {
+  size_t num_bytes{0};
+  for (const auto& fragment : fragments) {
+    if (!shared::contains(fragment_ids, fragment.fragmentId)) {
+      continue;
+    }
+    for (const auto& [column_id, chunk_metadata] :
+         fragment.getChunkMetadataMapPhysical()) {
+      num_bytes += chunk_metadata->numBytes;
+    }
+  }
+  return num_bytes;
+}
+
+}  // namespace
+
+size_t TableOptimizer::compactFragments(
+    const std::function<bool(const size_t)>& throttle) const {
+  if (td_->compactionFillPercent <= 0 || td_->isView || td_->isForeignTable() ||
+      td_->persistenceLevel != Data_Namespace::MemoryLevel::DISK_LEVEL ||
+      !cat_.getDeletedColumn(td_)) {
+    return 0;
+  }
+  auto timer = DEBUG_TIMER(__func__);
+  const auto table_id = td_->tableId;
+  const auto db_id = cat_.getDatabaseId();
+  size_t merged_fragment_count{0};
+  for (const auto shard : cat_.getPhysicalTablesDescriptors(td_)) {
+    CHECK(shard->fragmenter);
+    const ColumnDescriptor* sort_cd{nullptr};
+    if (shard->sortedColumnId) {
+      sort_cd = cat_.getMetadataForColumn(shard->tableId, shard->sortedColumnId);
+      CHECK(sort_cd);
+      if (sort_cd->columnType.is_varlen()) {
+        sort_cd = nullptr;
+      }
+    }
+    const size_t max_rows = shard->maxFragRows * td_->compactionFillPercent / 100;
+    // Every merge empties at least two fragments ahead of the last one and adds no
+    // under-filled fragment there, so the loop ends. Fragments showing up in a second
+    // group were not emptied, which stops the compaction of the shard.
+    std::set<int> merged_fragment_ids;
+    while (true) {
+      size_t num_bytes{0};
+      {
+        // Inserts, updates and deletes hold the insert lock until they checkpoint, which
+        // keeps the merge from checkpointing or rolling back their rows.
+        const auto insert_data_lock =
+            lockmgr::InsertDataLockMgr::getWriteLockForTable({db_id, table_id});
+        const auto table_lock =
+            lockmgr::TableDataLockMgr::getWriteLockForTable({db_id, table_id});
+        const auto fragments = shard->fragmenter->getFragmentsForQuery().fragments;
+        const auto groups =
+            get_compaction_groups(fragments, max_rows, shard->maxFragRows);
+        if (groups.empty()) {
+          break;
+        }
+        const auto& fragment_ids = groups.front();
+        if (std::any_of(fragment_ids.begin(), fragment_ids.end(), [&](const int id) {
+              return !merged_fragment_ids.insert(id).second;
+            })) {
+          LOG(WARNING) << "Fragments of table " << shard->tableName
+                       << " were not emptied by a merge, stopping compaction";
+          break;
+        }
+        num_bytes = get_chunk_bytes(fragments, fragment_ids);
+        const auto table_epochs = cat_.getTableEpochs(db_id, table_id);
+        try {
+          UpdelRoll updel_roll;
+          shard->fragmenter->mergeFragments(&cat_,
+                                            shard,
+                                            fragment_ids,
+                                            sort_cd,
+                                            Data_Namespace::MemoryLevel::CPU_LEVEL,
+                                            updel_roll);
+          updel_roll.stageUpdate(table_lock);
+          vacuumFragments(shard, table_lock, fragment_ids);
+          cat_.checkpoint(table_id);
+        } catch (...) {
+          cat_.setTableEpochsLogExceptions(db_id, table_epochs);
+          throw;
+        }
+        merged_fragment_count += fragment_ids.size();
+        VLOG(1) << "Merged fragments " << shared::printContainer(fragment_ids)
+                << " of table " << shard->tableName;
+      }
+      if (throttle && !throttle(num_bytes)) {
+        return merged_fragment_count;
+      }
+    }
+  }
+  return merged_fragment_count;
+}
+
 void TableOptimizer::vacuumFragments(const TableDescriptor* td,
+                                     const lockmgr::WriteLock& table_data_lock,
                                      const std::set<int>& fragment_ids) const {
   // "if not a table that supports delete return,  nothing more to do"
   const ColumnDescriptor* cd = cat_.getDeletedColumn(td);
@@ -480,7 +666,7 @@ void TableOptimizer::vacuumFragments(const TableDescriptor* td,
                                   td->fragmenter->getVacuumOffsets(chunk),
                                   updel_roll.memoryLevel,
                                   updel_roll);
-      updel_roll.stageUpdate();
+      updel_roll.stageUpdate(table_data_lock);
     }
   }
   td->fragmenter->resetSizesFromFragments();
@@ -535,7 +721,7 @@ void TableOptimizer::vacuumFragmentsAboveMinSelectivity(
     const auto table_epochs = cat_.getTableEpochs(db_id, td_->tableId);
     try {
       for (const auto& [td, fragment_ids] : fragments_to_vacuum) {
-        vacuumFragments(td, fragment_ids);
+        vacuumFragments(td, table_lock, fragment_ids);
         VLOG(1) << "Auto-vacuumed fragments: " << shared::printContainer(fragment_ids)
                 << ", table id: " << td->tableId;
       }
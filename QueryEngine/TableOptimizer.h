@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <functional>
+
 #include "Catalog/Catalog.h"
+#include "LockMgr/LockMgrImpl.h"
 
 class Executor;
 struct TableUpdateMetadata;
@@ -65,6 +68,28 @@ class TableOptimizer {
    */
   void vacuumDeletedRows() const;
 
+  /**
+   * @brief Rewrites the rows of the table in the order of the Hilbert curve key of the
+   * centroids of the given geo column.
+   * Rows inserted in arbitrary order give every fragment bounds spanning most of the
+   * data, so no fragment can be skipped by a spatial filter. After clustering, each
+   * fragment holds spatially close rows and its bounds are tight. The old rows are
+   * deleted and vacuumed, so the table must support deletes.
+   */
+  void clusterRows(const std::string& column_name) const;
+
+  /**
+   * @brief Merges runs of adjacent fragments filled below the COMPACTION_FILL_PERCENT of
+   * the table into full fragments, ordering the merged rows by the sort column of the
+   * table if it is a fixed length scalar column.
+   * Every run is rewritten, vacuumed and checkpointed under its own table data write
+   * lock, so concurrent queries are only blocked for the duration of one run. The new
+   * fragments get their chunk metadata computed on insert. `throttle` is called with
+   * the number of chunk bytes read by a run after releasing the lock, and compaction
+   * stops once it returns false. Returns the number of merged fragments.
+   */
+  size_t compactFragments(const std::function<bool(const size_t)>& throttle = {}) const;
+
   /**
    * Vacuums fragments with a deleted rows percentage that exceeds the configured minimum
    * vacuum selectivity threshold.
@@ -86,7 +111,10 @@ class TableOptimizer {
   std::set<size_t> getFragmentIndexes(const TableDescriptor* td,
                                       const std::set<int>& fragment_ids) const;
 
+  // Vacuums the given fragments, or all fragments of the table if none are given. The
+  // caller holds the data write lock of the table.
   void vacuumFragments(const TableDescriptor* td,
+                       const lockmgr::WriteLock& table_data_lock,
                        const std::set<int>& fragment_ids = {}) const;
 
   DeletedColumnStats getDeletedColumnStats(
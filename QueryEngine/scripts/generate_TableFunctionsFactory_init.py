@@ -41,6 +41,18 @@ Supported annotation labels are:
 - name: to specify argument name
 - input_id: to specify the dict id mapping for output TextEncodingDict columns.
 
+Function annotations follow the closing parenthesis of the argument
+list. Supported function annotation labels are:
+
+- filter_table_function_transpose: to allow pushing filters on the
+  outputs down to the input cursor.
+- parallel: to run the function on morsels of its input columns in
+  parallel on CPU. The value is the combine step of the partial
+  outputs, `concat` (or `on`) to concatenate them or `merge` to
+  concatenate them and run the function once more on the result,
+  which requires the output column types to match the input column
+  types.
+
 If argument type follows an identifier, it will be mapped to name
 annotations. For example, the following argument type specifications
 are equivalent:
@@ -98,7 +110,7 @@ input_id, name, fields, require
 
 # TODO: support `gpu`, `cpu`, `template` as function annotations
 SupportedFunctionAnnotations = '''
-filter_table_function_transpose
+filter_table_function_transpose, parallel
 '''.strip().replace(' ', '').split(',')
 
 translate_map = dict(
@@ -895,6 +907,13 @@ class SupportedAnnotationsTransformer(AstTransformer):
                 annot.value = '1'
             elif annot.value.lower() in ['disable', 'off', '0', 'false']:
                 annot.value = '0'
+            if annot.key == 'parallel':
+                if annot.value == '1':
+                    annot.value = 'concat'
+                if annot.value not in ['0', 'concat', 'merge']:
+                    raise TransformerException('unknown parallel combine: `%s`' % (annot.value))
+                if annot.value != '0' and (not udtf_node.inputs or udtf_node.inputs[0].type.accept(AstPrinter()) != 'TableFunctionManager'):
+                    raise TransformerException('parallel table functions must use TableFunctionManager')
         return udtf_node
 
 
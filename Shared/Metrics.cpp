@@ -0,0 +1,158 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Shared/Metrics.h"
+
+#include <sstream>
+
+#include "Logger/Logger.h"
+
+namespace metrics {
+
+namespace {
+
+std::atomic<size_t> g_next_shard{0};
+
+std::string with_label(const std::string& labels,
+                       const std::string& name,
+                       const std::string& value) {
+  return "{" + labels + (labels.empty() ? "" : ",") + name + "=\"" + value + "\"}";
+}
+
+std::string braced(const std::string& labels) {
+  return labels.empty() ? labels : "{" + labels + "}";
+}
+
+}  // namespace
+
+size_t Counter::shardIndex() {
+  thread_local const size_t shard = g_next_shard++ % kNumShards;
+  return shard;
+}
+
+uint64_t Counter::value() const {
+  uint64_t total = 0;
+  for (const auto& shard : shards_) {
+    total += shard.value.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+size_t Histogram::bucketIndex(const uint64_t value) {
+  if (value < kSubBuckets) {
+    return value;
+  }
+  if (value >> kMaxValueBits) {
+    return kNumBuckets - 1;
+  }
+  size_t msb = kSubBucketBits;
+  while (value >> (msb + 1)) {
+    ++msb;
+  }
+  const size_t shift = msb - kSubBucketBits;
+  return (shift + 1) * kSubBuckets + static_cast<size_t>(value >> shift) - kSubBuckets;
+}
+
+uint64_t Histogram::bucketUpperBound(const size_t bucket) {
+  CHECK_LT(bucket, kNumBuckets);
+  if (bucket < kSubBuckets) {
+    return bucket;
+  }
+  const size_t shift = bucket / kSubBuckets - 1;
+  const uint64_t sub_bucket = kSubBuckets + bucket % kSubBuckets;
+  return ((sub_bucket + 1) << shift) - 1;
+}
+
+Registry& Registry::instance() {
+  static Registry registry;
+  return registry;
+}
+
+Registry::Family& Registry::getFamily(const std::string& name,
+                                      const std::string& help,
+                                      const bool is_histogram) {
+  auto it = families_.find(name);
+  if (it == families_.end()) {
+    it = families_.emplace(name, Family{help, is_histogram, {}, {}}).first;
+  }
+  CHECK_EQ(it->second.is_histogram, is_histogram)
+      << "Metric " << name << " registered with two types";
+  return it->second;
+}
+
+Counter& Registry::counter(const std::string& name,
+                           const std::string& help,
+                           const std::string& labels) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& metric = getFamily(name, help, false).counters[labels];
+  if (!metric) {
+    metric = std::make_unique<Counter>();
+  }
+  return *metric;
+}
+
+Histogram& Registry::histogram(const std::string& name,
+                               const std::string& help,
+                               const std::string& labels) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& metric = getFamily(name, help, true).histograms[labels];
+  if (!metric) {
+    metric = std::make_unique<Histogram>();
+  }
+  return *metric;
+}
+
+std::string Registry::toPrometheusText() const {
+  std::ostringstream oss;
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& [name, family] : families_) {
+    oss << "# HELP " << name << " " << family.help << "\n";
+    if (!family.is_histogram) {
+      oss << "# TYPE " << name << " counter\n";
+      for (const auto& [labels, counter] : family.counters) {
+        oss << name << braced(labels) << " " << counter->value() << "\n";
+      }
+      continue;
+    }
+    oss << "# TYPE " << name << " histogram\n";
+    for (const auto& [labels, histogram] : family.histograms) {
+      // Empty buckets are left out. Bucket counts never decrease, so a bucket that was
+      // exported once keeps being exported. The last bucket also holds values past its
+      // bound and is only exported as part of +Inf.
+      uint64_t cumulative_count = 0;
+      for (size_t bucket = 0; bucket + 1 < Histogram::kNumBuckets; ++bucket) {
+        const auto count = histogram->bucketCount(bucket);
+        if (!count) {
+          continue;
+        }
+        cumulative_count += count;
+        oss << name << "_bucket"
+            << with_label(labels,
+                          "le",
+                          std::to_string(Histogram::bucketUpperBound(bucket)))
+            << " " << cumulative_count << "\n";
+      }
+      cumulative_count += histogram->bucketCount(Histogram::kNumBuckets - 1);
+      oss << name << "_bucket" << with_label(labels, "le", "+Inf") << " "
+          << cumulative_count << "\n";
+      oss << name << "_sum" << braced(labels) << " " << histogram->sum() << "\n";
+      oss << name << "_count" << braced(labels) << " " << cumulative_count << "\n";
+    }
+  }
+  return oss.str();
+}
+
+}  // namespace metrics
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    Metrics.h
+ * @brief   Process-wide registry of counters and latency histograms, exported in the
+ *          Prometheus text format.
+ *
+ * Metrics are registered once, typically into a function local static reference, and
+ * updated without locks afterwards:
+ *
+ *   static auto& hits = metrics::Registry::instance().counter(
+ *       "omnisci_code_cache_hits_total", "Compiled code cache hits.");
+ *   hits.add();
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace metrics {
+
+// Monotonic counter. Increments go to one of several cache line sized shards picked by
+// the calling thread, so hot paths on different threads do not contend.
+class Counter {
+ public:
+  static constexpr size_t kNumShards{16};
+
+  void add(const uint64_t n = 1) {
+    shards_[shardIndex()].value.fetch_add(n, std::memory_order_relaxed);
+  }
+
+  uint64_t value() const;
+
+ private:
+  static size_t shardIndex();
+
+  struct alignas(64) Shard {
+    std::atomic<uint64_t> value{0};
+  };
+  std::array<Shard, kNumShards> shards_;
+};
+
+// Log-linear histogram in the style of HdrHistogram. Values below kSubBuckets get a
+// bucket each, every larger power of two range is split into kSubBuckets equal buckets,
+// which bounds the relative error of a bucket to 1 / kSubBuckets. Values of
+// kMaxValueBits bits and more are counted in the last bucket.
+class Histogram {
+ public:
+  static constexpr size_t kSubBucketBits{2};
+  static constexpr size_t kSubBuckets{size_t(1) << kSubBucketBits};
+  static constexpr size_t kMaxValueBits{40};
+  static constexpr size_t kNumBuckets{kSubBuckets * (kMaxValueBits - kSubBucketBits + 1)};
+
+  void record(const uint64_t value) {
+    buckets_[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    sum_.add(value);
+  }
+
+  static size_t bucketIndex(const uint64_t value);
+
+  // Largest value counted in the given bucket.
+  static uint64_t bucketUpperBound(const size_t bucket);
+
+  uint64_t bucketCount(const size_t bucket) const {
+    return buckets_[bucket].load(std::memory_order_relaxed);
+  }
+
+  uint64_t sum() const { return sum_.value(); }
+
+ private:
+  std::array<std::atomic<uint64_t>, kNumBuckets> buckets_{};
+  Counter sum_;
+};
+
+// Records the microseconds between its construction and destruction into a histogram.
+class ScopedLatency {
+ public:
+  explicit ScopedLatency(Histogram& histogram)
+      : histogram_(histogram), start_(std::chrono::steady_clock::now()) {}
+  ~ScopedLatency() {
+    histogram_.record(std::chrono::duration_cast<std::chrono::microseconds>(
+                          std::chrono::steady_clock::now() - start_)
+                          .count());
+  }
+  ScopedLatency(const ScopedLatency&) = delete;
+  ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+ private:
+  Histogram& histogram_;
+  const std::chrono::steady_clock::time_point start_;
+};
+
+class Registry {
+ public:
+  static Registry& instance();
+
+  // Returns the metric with the given name and labels, registering it on first use.
+  // Labels are given in the exposition format, e.g. level="cpu". Metrics live for the
+  // lifetime of the process, so the returned references stay valid.
+  Counter& counter(const std::string& name,
+                   const std::string& help,
+                   const std::string& labels = "");
+  Histogram& histogram(const std::string& name,
+                       const std::string& help,
+                       const std::string& labels = "");
+
+  // All metrics in the Prometheus text exposition format (version 0.0.4).
+  std::string toPrometheusText() const;
+
+ private:
+  struct Family {
+    std::string help;
+    bool is_histogram;
+    std::map<std::string, std::unique_ptr<Counter>> counters;
+    std::map<std::string, std::unique_ptr<Histogram>> histograms;
+  };
+
+  Family& getFamily(const std::string& name,
+                    const std::string& help,
+                    const bool is_histogram);
+
+  mutable std::mutex mutex_;
+  std::map<std::string, Family> families_;
+};
+
+}  // namespace metrics
@@ -71,6 +71,8 @@ struct SystemParameters {
   size_t calcite_timeout = 5000;     // calcite connect/send/receive timeout
   size_t calcite_keepalive = false;  // calcite keepalive connection
   int num_executors = 2;
+  std::string high_priority_query_users = "";  // users dispatched with high priority
+  std::string low_priority_query_users = "";   // users dispatched with low priority
   int num_sessions = -1;  // maximum number of user sessions
 
   SystemParameters() : cuda_block_size(0), cuda_grid_size(0), calcite_max_mem(1024) {}
@@ -16,14 +16,23 @@
 #ifndef UPDELROLL_H
 #define UPDELROLL_H
 
+#include <list>
 #include <map>
 #include <mutex>
 #include <set>
 #include <utility>
+#include <vector>
 
 #include "DataMgr/Chunk/Chunk.h"
 #include "DataMgr/ChunkMetadata.h"
 #include "DataMgr/MemoryLevel.h"
+#include "Shared/mapd_shared_mutex.h"
+
+namespace lockmgr {
+template <typename LOCK>
+class TrackedRefLock;
+using WriteLock = TrackedRefLock<mapd_unique_lock<mapd_shared_mutex>>;
+}  // namespace lockmgr
 
 namespace Fragmenter_Namespace {
 class InsertOrderFragmenter;
@@ -63,11 +72,25 @@ struct UpdelRoll {
   bool commitUpdate();
 
   // Writes chunks at the CPU memory level to storage without checkpointing at the storage
-  // level.
-  void stageUpdate();
+  // level. The caller holds the data write lock of the table, under which the staged
+  // updates are published.
+  void stageUpdate(const lockmgr::WriteLock& table_data_lock);
 
   void addDirtyChunk(std::shared_ptr<Chunk_NS::Chunk> chunk, int fragment_id);
 
+  // Stages a fixed width update of the elements of the chunk at the given row offsets.
+  // Returns a buffer holding the current values of those elements, in the order of the
+  // offsets, which the update overwrites with the new values.
+  int8_t* stageChunkUpdate(std::shared_ptr<Chunk_NS::Chunk> chunk,
+                           int fragment_id,
+                           const std::vector<uint64_t>& frag_offsets,
+                           size_t element_size);
+
+  // Called once the new values are written to the buffer returned by stageChunkUpdate.
+  // Unless published now, the values are only written to the chunk buffer on commit, so
+  // concurrent queries do not read uncommitted values.
+  void finishChunkUpdate(const int8_t* values, const bool publish_now);
+
   std::shared_ptr<ChunkMetadata> getChunkMetadata(
       const MetaDataKey& key,
       int32_t column_id,
@@ -82,6 +105,13 @@ struct UpdelRoll {
  private:
   void updateFragmenterAndCleanupChunks();
 
+  void publishStagedChunkData();
+
+  struct StagedChunkUpdate;
+
+  void publishStagedChunkUpdate(const ChunkKey& chunk_key,
+                                const StagedChunkUpdate& update);
+
   void initializeUnsetMetadata(const TableDescriptor* td,
                                Fragmenter_Namespace::FragmentInfo& fragment_info);
 
@@ -91,6 +121,16 @@ struct UpdelRoll {
   // chunks changed during this query
   std::map<ChunkKey, std::shared_ptr<Chunk_NS::Chunk>> dirty_chunks;
 
+  struct StagedChunkUpdate {
+    std::vector<uint64_t> frag_offsets;
+    size_t element_size;
+    // the values of the elements at frag_offsets, in the same order
+    std::vector<int8_t> values;
+  };
+
+  // updated elements of dirty chunks, which are written to the chunk buffers on commit
+  std::map<ChunkKey, std::list<StagedChunkUpdate>> staged_chunk_updates;
+
   // new FragmentInfo.numTuples
   std::map<MetaDataKey, size_t> num_tuples;
 
@@ -33,6 +33,8 @@
 #include <thrift/transport/TBufferTransports.h>
 #include <thrift/transport/TSocket.h>
 #include <boost/program_options.hpp>
+#include <rapidjson/document.h>
+#include <set>
 #include "Shared/ThriftJSONProtocolInclude.h"
 
 #ifdef HAVE_CUDA
@@ -254,6 +256,20 @@ void run_ddl_statement(const std::string& ddl) {
   run_multiple_agg(ddl);
 }
 
+// Returns the names of the events in the last query trace of the session.
+std::set<std::string> get_query_trace_event_names() {
+  std::string trace;
+  g_client->get_query_trace(trace, g_session_id);
+  rapidjson::Document doc;
+  doc.Parse(trace.c_str());
+  CHECK(!doc.HasParseError()) << trace;
+  std::set<std::string> names;
+  for (const auto& event : doc["traceEvents"].GetArray()) {
+    names.emplace(event["name"].GetString());
+  }
+  return names;
+}
+
 // Verify that column types match
 void test_scalar_values(const std::shared_ptr<arrow::RecordBatch>& read_batch) {
   using namespace arrow;
@@ -508,6 +524,113 @@ TEST_F(ArrowIpcBasic, IpcCpuWithCpuExecution) {
   deallocate_df(data_frame, ExecutorDeviceType::CPU);
 }
 
+TEST_F(ArrowIpcBasic, IpcCpuFilteredProjection) {
+  g_client->set_execution_mode(g_session_id, TExecuteMode::CPU);
+  g_client->set_query_tracing(g_session_id, true);
+  ScopeGuard reset_session = [&] {
+    g_client->set_execution_mode(g_session_id, TExecuteMode::GPU);
+    g_client->set_query_tracing(g_session_id, false);
+  };
+  // The trace of the query tells which converter built the columns. Only columns made
+  // of several runs of chunk rows are copied.
+  const auto assert_converted_from_chunks = [](const bool copied) {
+    const auto names = get_query_trace_event_names();
+    ASSERT_TRUE(names.count("lazy column converter"));
+    ASSERT_FALSE(names.count("row converter"));
+    ASSERT_EQ(names.count("convert_lazy_column copy runs"), size_t(copied));
+  };
+  const auto make_int_array = [](const std::vector<int32_t>& values,
+                                 const std::vector<bool>& is_valid) {
+    std::shared_ptr<arrow::Array> array;
+    arrow::Int32Builder builder(arrow::default_memory_pool());
+    ARROW_THROW_NOT_OK(builder.AppendValues(values, is_valid));
+    ARROW_THROW_NOT_OK(builder.Finish(&array));
+    return array;
+  };
+
+  // The selected rows span several fragments, so the lazily fetched column is compacted.
+  {
+    auto data_frame = execute_arrow_ipc("SELECT x FROM arrow_ipc_test WHERE y > 2.0;",
+                                        ExecutorDeviceType::CPU);
+    assert_converted_from_chunks(true);
+    auto df =
+        ArrowOutput(data_frame, ExecutorDeviceType::CPU, TArrowTransport::SHARED_MEMORY);
+    ASSERT_EQ(df.schema->num_fields(), 1);
+    auto int_array = df.record_batch->column(0);
+    ASSERT_EQ(int_array->type()->id(), arrow::Type::type::INT32);
+    ASSERT_TRUE(int_array->Equals(make_int_array({2, 3, 5}, {1, 0, 1})));
+    deallocate_df(data_frame, ExecutorDeviceType::CPU);
+  }
+
+  // Only the first rows are converted when the number of rows is limited.
+  {
+    auto data_frame = execute_arrow_ipc("SELECT x FROM arrow_ipc_test WHERE y > 2.0;",
+                                        ExecutorDeviceType::CPU,
+                                        0,
+                                        2);
+    assert_converted_from_chunks(true);
+    auto df =
+        ArrowOutput(data_frame, ExecutorDeviceType::CPU, TArrowTransport::SHARED_MEMORY);
+    ASSERT_EQ(df.record_batch->num_rows(), 2);
+    ASSERT_TRUE(df.record_batch->column(0)->Equals(make_int_array({2, 3}, {1, 0})));
+    deallocate_df(data_frame, ExecutorDeviceType::CPU);
+  }
+  {
+    auto data_frame = execute_arrow_ipc("SELECT x FROM arrow_ipc_test WHERE y > 2.0;",
+                                        ExecutorDeviceType::CPU,
+                                        0,
+                                        1);
+    assert_converted_from_chunks(false);
+    auto df =
+        ArrowOutput(data_frame, ExecutorDeviceType::CPU, TArrowTransport::SHARED_MEMORY);
+    ASSERT_EQ(df.record_batch->num_rows(), 1);
+    ASSERT_TRUE(df.record_batch->column(0)->Equals(make_int_array({2}, {1})));
+    deallocate_df(data_frame, ExecutorDeviceType::CPU);
+  }
+
+  // A single selected row is exported straight from its chunk.
+  {
+    auto data_frame = execute_arrow_ipc(
+        "SELECT x, y FROM arrow_ipc_test WHERE t = 'hello';", ExecutorDeviceType::CPU);
+    assert_converted_from_chunks(false);
+    auto df =
+        ArrowOutput(data_frame, ExecutorDeviceType::CPU, TArrowTransport::SHARED_MEMORY);
+    ASSERT_EQ(df.schema->num_fields(), 2);
+    ASSERT_EQ(df.record_batch->num_rows(), 1);
+    const auto& int_array =
+        static_cast<const arrow::Int32Array&>(*df.record_batch->column(0));
+    ASSERT_EQ(int_array.Value(0), 4);
+    ASSERT_TRUE(df.record_batch->column(1)->IsNull(0));
+    deallocate_df(data_frame, ExecutorDeviceType::CPU);
+  }
+}
+
+TEST_F(ArrowIpcBasic, QueryTracing) {
+  ScopeGuard reset_query_tracing = [] {
+    g_client->set_query_tracing(g_session_id, false);
+  };
+  g_client->set_query_tracing(g_session_id, true);
+  execute_arrow_ipc("SELECT x FROM arrow_ipc_test;",
+                    ExecutorDeviceType::CPU,
+                    0,
+                    -1,
+                    TArrowTransport::type::WIRE);
+  const auto names = get_query_trace_event_names();
+  ASSERT_TRUE(names.count("sql_execute_df"));
+  ASSERT_TRUE(names.count("ExecutionKernel::run"));
+
+  // Queries run while tracing is off keep the last trace of the session.
+  g_client->set_query_tracing(g_session_id, false);
+  run_multiple_agg("SELECT COUNT(*) FROM arrow_ipc_test;");
+  ASSERT_EQ(get_query_trace_event_names(), names);
+
+  // The hint traces a single query from the point it is parsed.
+  run_multiple_agg("SELECT /*+ query_trace */ COUNT(*) FROM arrow_ipc_test;");
+  const auto hinted_names = get_query_trace_event_names();
+  ASSERT_TRUE(hinted_names.count("ExecutionKernel::run"));
+  ASSERT_FALSE(hinted_names.count("sql_execute"));
+}
+
 TEST_F(ArrowIpcBasic, IpcCpuScalarValues) {
   auto data_frame =
       execute_arrow_ipc("SELECT * FROM test_data_scalars;", ExecutorDeviceType::CPU);
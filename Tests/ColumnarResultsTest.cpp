@@ -42,6 +42,19 @@ class ColumnarResultsTester : public ColumnarResults {
                         Executor::UNITARY_EXECUTOR_ID,
                         is_parallel_execution_enforced) {}
 
+  ColumnarResultsTester(const std::shared_ptr<RowSetMemoryOwner> row_set_mem_owner,
+                        const ResultSet& rows,
+                        const size_t entry_begin,
+                        const size_t entry_end,
+                        const std::vector<SQLTypeInfo>& target_types)
+      : ColumnarResults(row_set_mem_owner,
+                        rows,
+                        entry_begin,
+                        entry_end,
+                        target_types,
+                        Executor::UNITARY_EXECUTOR_ID,
+                        0) {}
+
   template <typename ENTRY_TYPE>
   ENTRY_TYPE getEntryAt(const size_t row_idx, const size_t column_idx) const {
     CHECK_LT(column_idx, column_buffers_.size());
@@ -66,6 +79,64 @@ double ColumnarResultsTester::getEntryAt<double>(const size_t row_idx,
   return reinterpret_cast<double*>(column_buffers_[column_idx])[row_idx];
 }
 
+void check_converted_row(const std::vector<TargetValue>& row,
+                         const std::vector<TargetInfo>& target_infos,
+                         const ColumnarResultsTester& columnar_results,
+                         const size_t cr_row_idx) {
+  CHECK_EQ(target_infos.size(), row.size());
+  for (size_t target_idx = 0; target_idx < target_infos.size(); ++target_idx) {
+    const auto& target_info = target_infos[target_idx];
+    const auto& ti = target_info.agg_kind == kAVG ? SQLTypeInfo{kDOUBLE, false}
+                                                  : target_info.sql_type;
+    switch (ti.get_type()) {
+      case kBIGINT: {
+        const auto ival_result_set = v<int64_t>(row[target_idx]);
+        const auto ival_converted = static_cast<int64_t>(
+            columnar_results.getEntryAt<int64_t>(cr_row_idx, target_idx));
+        ASSERT_EQ(ival_converted, ival_result_set);
+        break;
+      }
+      case kINT: {
+        const auto ival_result_set = v<int64_t>(row[target_idx]);
+        const auto ival_converted = static_cast<int64_t>(
+            columnar_results.getEntryAt<int32_t>(cr_row_idx, target_idx));
+        ASSERT_EQ(ival_converted, ival_result_set);
+        break;
+      }
+      case kSMALLINT: {
+        const auto ival_result_set = v<int64_t>(row[target_idx]);
+        const auto ival_converted = static_cast<int64_t>(
+            columnar_results.getEntryAt<int16_t>(cr_row_idx, target_idx));
+        ASSERT_EQ(ival_result_set, ival_converted);
+        break;
+      }
+      case kTINYINT: {
+        const auto ival_result_set = v<int64_t>(row[target_idx]);
+        const auto ival_converted = static_cast<int64_t>(
+            columnar_results.getEntryAt<int8_t>(cr_row_idx, target_idx));
+        ASSERT_EQ(ival_converted, ival_result_set);
+        break;
+      }
+      case kFLOAT: {
+        const auto fval_result_set = v<float>(row[target_idx]);
+        const auto fval_converted =
+            columnar_results.getEntryAt<float>(cr_row_idx, target_idx);
+        ASSERT_FLOAT_EQ(fval_result_set, fval_converted);
+        break;
+      }
+      case kDOUBLE: {
+        const auto dval_result_set = v<double>(row[target_idx]);
+        const auto dval_converted =
+            columnar_results.getEntryAt<double>(cr_row_idx, target_idx);
+        ASSERT_FLOAT_EQ(dval_result_set, dval_converted);
+        break;
+      }
+      default:
+        UNREACHABLE() << "Invalid type info encountered.";
+    }
+  }
+}
+
 void test_columnar_conversion(const std::vector<TargetInfo>& target_infos,
                               const QueryMemoryDescriptor& query_mem_desc,
                               const size_t non_empty_step_size,
@@ -108,59 +179,55 @@ void test_columnar_conversion(const std::vector<TargetInfo>& target_infos,
     if (row.empty()) {
       break;
     }
-    CHECK_EQ(target_infos.size(), row.size());
-    for (size_t target_idx = 0; target_idx < target_infos.size(); ++target_idx) {
-      const auto& target_info = target_infos[target_idx];
-      const auto& ti = target_info.agg_kind == kAVG ? SQLTypeInfo{kDOUBLE, false}
-                                                    : target_info.sql_type;
-      switch (ti.get_type()) {
-        case kBIGINT: {
-          const auto ival_result_set = v<int64_t>(row[target_idx]);
-          const auto ival_converted = static_cast<int64_t>(
-              columnar_results.getEntryAt<int64_t>(cr_row_idx, target_idx));
-          ASSERT_EQ(ival_converted, ival_result_set);
-          break;
-        }
-        case kINT: {
-          const auto ival_result_set = v<int64_t>(row[target_idx]);
-          const auto ival_converted = static_cast<int64_t>(
-              columnar_results.getEntryAt<int32_t>(cr_row_idx, target_idx));
-          ASSERT_EQ(ival_converted, ival_result_set);
-          break;
-        }
-        case kSMALLINT: {
-          const auto ival_result_set = v<int64_t>(row[target_idx]);
-          const auto ival_converted = static_cast<int64_t>(
-              columnar_results.getEntryAt<int16_t>(cr_row_idx, target_idx));
-          ASSERT_EQ(ival_result_set, ival_converted);
-          break;
-        }
-        case kTINYINT: {
-          const auto ival_result_set = v<int64_t>(row[target_idx]);
-          const auto ival_converted = static_cast<int64_t>(
-              columnar_results.getEntryAt<int8_t>(cr_row_idx, target_idx));
-          ASSERT_EQ(ival_converted, ival_result_set);
-          break;
-        }
-        case kFLOAT: {
-          const auto fval_result_set = v<float>(row[target_idx]);
-          const auto fval_converted =
-              columnar_results.getEntryAt<float>(cr_row_idx, target_idx);
-          ASSERT_FLOAT_EQ(fval_result_set, fval_converted);
-          break;
-        }
-        case kDOUBLE: {
-          const auto dval_result_set = v<double>(row[target_idx]);
-          const auto dval_converted =
-              columnar_results.getEntryAt<double>(cr_row_idx, target_idx);
-          ASSERT_FLOAT_EQ(dval_result_set, dval_converted);
-          break;
+    check_converted_row(row, target_infos, columnar_results, cr_row_idx);
+    cr_row_idx++;
+  }
+}
+
+// Converts the result set in ranges of entries, as the fragments of a temporary table
+// split into batches do.
+void test_range_columnar_conversion(const std::vector<TargetInfo>& target_infos,
+                                    const QueryMemoryDescriptor& query_mem_desc,
+                                    const size_t non_empty_step_size) {
+  auto row_set_mem_owner = std::make_shared<RowSetMemoryOwner>(
+      Executor::getArenaBlockSize(), /*num_threads=*/1);
+  ResultSet result_set(target_infos,
+                       ExecutorDeviceType::CPU,
+                       query_mem_desc,
+                       row_set_mem_owner,
+                       nullptr,
+                       0,
+                       0);
+  const auto storage = result_set.allocateStorage();
+  EvenNumberGenerator generator;
+  fill_storage_buffer(storage->getUnderlyingBuffer(),
+                      target_infos,
+                      query_mem_desc,
+                      generator,
+                      non_empty_step_size);
+  ASSERT_TRUE(result_set.isDirectColumnarConversionPossible());
+
+  std::vector<SQLTypeInfo> col_types;
+  for (size_t i = 0; i < result_set.colCount(); ++i) {
+    col_types.push_back(get_logical_type_info(result_set.getColType(i)));
+  }
+  const auto entry_count = query_mem_desc.getEntryCount();
+  for (const auto batch_size : {size_t(1), size_t(7), entry_count}) {
+    for (size_t entry_begin = 0; entry_begin < entry_count; entry_begin += batch_size) {
+      const auto entry_end = std::min(entry_begin + batch_size, entry_count);
+      ColumnarResultsTester columnar_results(
+          row_set_mem_owner, result_set, entry_begin, entry_end, col_types);
+      size_t cr_row_idx = 0;
+      for (size_t rs_row_idx = entry_begin; rs_row_idx < entry_end; rs_row_idx++) {
+        if (result_set.isRowAtEmpty(rs_row_idx)) {
+          continue;
         }
-        default:
-          UNREACHABLE() << "Invalid type info encountered.";
+        check_converted_row(
+            result_set.getRowAt(rs_row_idx), target_infos, columnar_results, cr_row_idx);
+        cr_row_idx++;
       }
+      ASSERT_EQ(cr_row_idx, columnar_results.size());
     }
-    cr_row_idx++;
   }
 }
 
@@ -182,7 +249,64 @@ TEST(Construct, Empty) {
 }
 
 // Projections:
-// TODO(Saman): add tests for Projections
+TEST(Projection, ColumnarRanges) {
+  const size_t entry_count{100};
+  const std::vector<TargetInfo> target_infos(2,
+                                             TargetInfo{false,
+                                                        kMIN,
+                                                        SQLTypeInfo{kBIGINT, false},
+                                                        SQLTypeInfo{kNULLT, false},
+                                                        false,
+                                                        false});
+  QueryMemoryDescriptor query_mem_desc(
+      QueryDescriptionType::Projection, 0, 0, false, std::vector<int8_t>{8});
+  for (size_t i = 0; i < target_infos.size(); ++i) {
+    query_mem_desc.addColSlotInfo({std::make_tuple<int8_t, int8_t>(8, 8)});
+  }
+  query_mem_desc.setEntryCount(entry_count);
+  query_mem_desc.setOutputColumnar(true);
+  auto row_set_mem_owner = std::make_shared<RowSetMemoryOwner>(
+      Executor::getArenaBlockSize(), /*num_threads=*/1);
+  ResultSet result_set(target_infos,
+                       ExecutorDeviceType::CPU,
+                       query_mem_desc,
+                       row_set_mem_owner,
+                       nullptr,
+                       0,
+                       0);
+  const auto storage = result_set.allocateStorage();
+  auto buff = storage->getUnderlyingBuffer();
+  for (size_t i = 0; i < entry_count; ++i) {
+    // the row index column marks the entries as non-empty
+    reinterpret_cast<int64_t*>(buff)[i] = i;
+    for (size_t col_idx = 0; col_idx < target_infos.size(); ++col_idx) {
+      reinterpret_cast<int64_t*>(buff + query_mem_desc.getColOffInBytes(col_idx))[i] =
+          i * (col_idx + 1);
+    }
+  }
+
+  const std::vector<SQLTypeInfo> col_types(target_infos.size(),
+                                           SQLTypeInfo{kBIGINT, false});
+  for (const auto batch_size : {size_t(1), size_t(7), entry_count}) {
+    for (size_t entry_begin = 0; entry_begin < entry_count; entry_begin += batch_size) {
+      const auto entry_end = std::min(entry_begin + batch_size, entry_count);
+      ColumnarResultsTester columnar_results(
+          row_set_mem_owner, result_set, entry_begin, entry_end, col_types);
+      ASSERT_EQ(entry_end - entry_begin, columnar_results.size());
+      for (size_t col_idx = 0; col_idx < target_infos.size(); ++col_idx) {
+        // the columns of the range are used in place, without a copy
+        ASSERT_TRUE(result_set.isZeroCopyColumnarConversionPossible(col_idx));
+        EXPECT_EQ(static_cast<const void*>(result_set.getColumnarBuffer(col_idx) +
+                                           entry_begin * sizeof(int64_t)),
+                  static_cast<const void*>(columnar_results.getColumnBuffers()[col_idx]));
+        for (size_t row_idx = 0; row_idx < columnar_results.size(); ++row_idx) {
+          EXPECT_EQ(static_cast<int64_t>((entry_begin + row_idx) * (col_idx + 1)),
+                    columnar_results.getEntryAt<int64_t>(row_idx, col_idx));
+        }
+      }
+    }
+  }
+}
 
 // Perfect Hash:
 TEST(PerfectHashRowWise, OneCol_64Key_64Agg_wo_avg) {
@@ -844,6 +968,38 @@ TEST(BaselineHashColumnar, TwoCol_32_32_MixedAggs_w_avg) {
   }
 }
 
+// Ranges of entries:
+TEST(PerfectHashColumnar, Ranges_64Key_MixedAggs_w_avg) {
+  std::vector<int8_t> key_column_widths{8};
+  const int8_t suggested_agg_width = 1;
+  std::vector<TargetInfo> target_infos = generate_custom_agg_target_infos(
+      key_column_widths,
+      {kMAX, kMAX, kAVG, kMAX, kMAX, kAVG, kMAX, kMAX},
+      {kDOUBLE, kFLOAT, kDOUBLE, kBIGINT, kINT, kDOUBLE, kSMALLINT, kTINYINT},
+      {kDOUBLE, kFLOAT, kINT, kBIGINT, kINT, kSMALLINT, kSMALLINT, kTINYINT});
+  auto query_mem_desc =
+      perfect_hash_one_col_desc(target_infos, suggested_agg_width, 0, 118);
+  query_mem_desc.setOutputColumnar(true);
+  for (auto step_size : {3, 7, 16, 127}) {
+    test_range_columnar_conversion(target_infos, query_mem_desc, step_size);
+  }
+}
+
+TEST(BaselineHashRowWise, Ranges_64_32_MixedAggs_wo_avg) {
+  std::vector<int8_t> key_column_widths{8, 4};
+  const int8_t suggested_agg_width = 8;
+  std::vector<TargetInfo> target_infos = generate_custom_agg_target_infos(
+      key_column_widths,
+      {kMAX, kMAX, kMAX, kMAX, kMAX, kMAX},
+      {kFLOAT, kBIGINT, kTINYINT, kINT, kSMALLINT, kDOUBLE},
+      {kFLOAT, kBIGINT, kTINYINT, kINT, kSMALLINT, kDOUBLE});
+  auto query_mem_desc = baseline_hash_two_col_desc(target_infos, suggested_agg_width);
+  query_mem_desc.setAllTargetGroupbyIndices({0, 1, -1, -1, -1, -1, -1, -1});
+  for (auto step_size : {2, 3, 13, 67}) {
+    test_range_columnar_conversion(target_infos, query_mem_desc, step_size);
+  }
+}
+
 int main(int argc, char** argv) {
   g_is_test_env = true;
 
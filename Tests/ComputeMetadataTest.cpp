@@ -18,9 +18,12 @@
 
 #include "Catalog/Catalog.h"
 #include "DBHandlerTestHelpers.h"
+#include "LockMgr/LockMgr.h"
 #include "QueryEngine/TableOptimizer.h"
 
 #include <gtest/gtest.h>
+#include <chrono>
+#include <future>
 #include <string>
 #include <utility>
 
@@ -591,6 +594,28 @@ class OptimizeTableVacuumTest : public DBHandlerTestFixture {
     ASSERT_EQ(used_data_page_count, total_data_page_count - total_free_data_page_count);
   }
 
+  // Asserts the range of the values of column x of each non-empty fragment.
+  void assertFragmentXRanges(const std::vector<std::pair<double, double>>& x_ranges) {
+    const auto& catalog = getCatalog();
+    const auto td = catalog.getMetadataForTable("test_table");
+    const auto x_cd = catalog.getMetadataForColumn(td->tableId, "x");
+    CHECK(x_cd);
+    std::vector<std::pair<double, double>> fragment_x_ranges;
+    run_op_per_fragment(
+        catalog,
+        td,
+        [&fragment_x_ranges, x_cd](const Fragmenter_Namespace::FragmentInfo& fragment) {
+          if (fragment.getPhysicalNumTuples() == 0) {
+            return;
+          }
+          const auto& chunk_stats =
+              fragment.getChunkMetadataMapPhysical().at(x_cd->columnId)->chunkStats;
+          fragment_x_ranges.emplace_back(chunk_stats.min.doubleval,
+                                         chunk_stats.max.doubleval);
+        });
+    EXPECT_EQ(x_ranges, fragment_x_ranges);
+  }
+
   void insertRange(int start, int end) {
     for (int value = start; value <= end; value++) {
       sql("insert into test_table values (" + std::to_string(value) + ");");
@@ -1098,6 +1123,120 @@ TEST_F(OptimizeTableVacuumTest, NoneEncodedStringColumnWithNullInBetween) {
   sqlAndCompareResult("select * from test_table;", {{Null}, {"b"}});
 }
 
+TEST_F(OptimizeTableVacuumTest, ClusterByGeoColumn) {
+  sql("create table test_table (i integer, x double, p point) with (fragment_size = 2);");
+  sql("insert into test_table values (1, 0, 'POINT (0 0)');");
+  sql("insert into test_table values (2, 10, 'POINT (10 10)');");
+  sql("insert into test_table values (3, 0, 'POINT (0 1)');");
+  sql("insert into test_table values (4, 10, 'POINT (10 11)');");
+  sqlAndCompareResult("select i from test_table;", {{i(1)}, {i(2)}, {i(3)}, {i(4)}});
+  assertFragmentXRanges({{0.0, 10.0}, {0.0, 10.0}});
+
+  // rows are rewritten in Hilbert curve order, so that each fragment holds close points
+  sql("optimize table test_table with (cluster = 'p');");
+  sqlAndCompareResult("select i from test_table;", {{i(1)}, {i(3)}, {i(4)}, {i(2)}});
+  sqlAndCompareResult("select i, ST_X(p), ST_Y(p) from test_table order by i;",
+                      {{i(1), 0.0, 0.0},
+                       {i(2), 10.0, 10.0},
+                       {i(3), 0.0, 1.0},
+                       {i(4), 10.0, 11.0}});
+  sqlAndCompareResult("select count(*) from test_table where ST_X(p) > 5;", {{i(2)}});
+  assertFragmentXRanges({{0.0, 0.0}, {10.0, 10.0}});
+}
+
+TEST_F(OptimizeTableVacuumTest, SortInsertedRowsByGeoColumn) {
+  sql("create table test_table (i integer, x double, p point) with (fragment_size = 2, "
+      "sort_column = 'p');");
+  // the rows of an inserted batch are sorted in Hilbert curve order of the points
+  sql("insert into test_table values (1, 0, 'POINT (0 0)'), (2, 10, 'POINT (10 10)'), "
+      "(3, 0, 'POINT (0 1)'), (4, 10, 'POINT (10 11)');");
+  sqlAndCompareResult("select i from test_table;", {{i(1)}, {i(3)}, {i(4)}, {i(2)}});
+  assertFragmentXRanges({{0.0, 0.0}, {10.0, 10.0}});
+}
+
+TEST_F(OptimizeTableVacuumTest, ClusterByNonGeoColumn) {
+  sql("create table test_table (i integer, p point);");
+  queryAndAssertPartialException("optimize table test_table with (cluster = 'i');",
+                                 "Cannot cluster table test_table by column i, which is "
+                                 "not a geo column.");
+}
+
+TEST_F(OptimizeTableVacuumTest, CompactUnderFilledFragments) {
+  sql("create table test_table (i integer) with (fragment_size = 4, sort_column = 'i', "
+      "compaction_fill_percent = 75);");
+  for (int value = 12; value >= 1; value--) {
+    sql("insert into test_table values (" + std::to_string(value) + ");");
+  }
+  sql("delete from test_table where i in (6, 7, 10, 11);");
+  sql("optimize table test_table with (vacuum = 'true');");
+  sqlAndCompareResult("select i from test_table;",
+                      {{i(12)}, {i(9)}, {i(8)}, {i(5)}, {i(4)}, {i(3)}, {i(2)}, {i(1)}});
+
+  auto& cat = getCatalog();
+  auto executor = Executor::getExecutor(Executor::UNITARY_EXECUTOR_ID);
+  // the first two fragments hold 2 of 4 rows each and are merged in sort column order
+  EXPECT_EQ(size_t(2),
+            TableOptimizer(cat.getMetadataForTable("test_table"), executor.get(), cat)
+                .compactFragments());
+  sqlAndCompareResult("select i from test_table;",
+                      {{i(4)}, {i(3)}, {i(2)}, {i(1)}, {i(5)}, {i(8)}, {i(9)}, {i(12)}});
+  sqlAndCompareResult("select count(*) from test_table where i > 4;", {{i(4)}});
+  EXPECT_EQ(size_t(0),
+            TableOptimizer(cat.getMetadataForTable("test_table"), executor.get(), cat)
+                .compactFragments());
+}
+
+TEST_F(OptimizeTableVacuumTest, CompactFragmentsWithConcurrentInserts) {
+  sql("create table test_table (i integer) with (fragment_size = 4, "
+      "compaction_fill_percent = 75);");
+  for (int value = 1; value <= 16; value++) {
+    sql("insert into test_table values (" + std::to_string(value) + ");");
+  }
+  sql("delete from test_table where mod(i, 2) = 0;");
+  sql("optimize table test_table with (vacuum = 'true');");
+
+  auto& cat = getCatalog();
+  auto executor = Executor::getExecutor(Executor::UNITARY_EXECUTOR_ID);
+  const auto td = cat.getMetadataForTable("test_table");
+  auto compact = [&] {
+    return TableOptimizer(td, executor.get(), cat).compactFragments();
+  };
+
+  // A writer holding the insert lock keeps the compaction from starting.
+  std::future<size_t> compaction;
+  {
+    const auto insert_data_lock = lockmgr::InsertDataLockMgr::getWriteLockForTable(
+        {cat.getDatabaseId(), td->tableId});
+    compaction = std::async(std::launch::async, compact);
+    EXPECT_EQ(std::future_status::timeout,
+              compaction.wait_for(std::chrono::milliseconds(200)));
+  }
+  EXPECT_GT(compaction.get(), size_t(0));
+  sqlAndCompareResult("select count(*), sum(i) from test_table;", {{i(8), i(64)}});
+
+  // Rows inserted while the table is compacted are neither lost nor duplicated.
+  sql("delete from test_table where i in (1, 5, 9);");
+  sql("optimize table test_table with (vacuum = 'true');");
+  auto inserts = std::async(std::launch::async, [this] {
+    for (int value = 17; value <= 40; value++) {
+      sql("insert into test_table values (" + std::to_string(value) + ");");
+    }
+  });
+  while (inserts.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready) {
+    compact();
+  }
+  inserts.get();
+  compact();
+  sqlAndCompareResult("select count(*), sum(i) from test_table;", {{i(29), i(733)}});
+}
+
+TEST_F(OptimizeTableVacuumTest, InvalidCompactionFillPercent) {
+  queryAndAssertPartialException(
+      "create table test_table (i integer) with (compaction_fill_percent = 101);",
+      "COMPACTION_FILL_PERCENT must be between 0 and 100.");
+  sql("create table test_table (i integer);");
+}
+
 TEST_F(OptimizeTableVacuumTest, NoneEncodedStringColumnWithLastValueNull) {
   sql("create table test_table (t text encoding none);");
   sql("insert into test_table values ('a');");
@@ -0,0 +1,665 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    EngineMicroBenchmarks.cpp
+ * @brief   Microbenchmarks of the core engine kernels: join hash table builds, group by
+ * hashing, result set reduction, string dictionary bulk encoding, column encoders and
+ * delimited file parsing, each at several data sizes and thread counts, and filtered
+ * table scans with and without selection vectors.
+ *
+ * Results are reported as JSON unless another --benchmark_format is given. Two reports
+ * can be compared with ThirdParty/googlebenchmark/tools/compare.py, e.g.
+ *   EngineMicroBenchmarks --benchmark_out=before.json
+ *   compare.py benchmarks before.json after.json
+ */
+
+#include "TestHelpers.h"
+
+#include <benchmark/benchmark.h>
+#include <tbb/task_arena.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "DataMgr/Encoder.h"
+#include "DataMgr/ForeignStorage/ForeignStorageBuffer.h"
+#include "ImportExport/CopyParams.h"
+#include "ImportExport/DelimitedParserUtils.h"
+#include "ImportExport/Importer.h"
+#include "Logger/Logger.h"
+#include "QueryEngine/Descriptors/RowSetMemoryOwner.h"
+#include "QueryEngine/Execute.h"
+#include "QueryEngine/JoinHashTable/Runtime/HashJoinRuntime.h"
+#include "QueryEngine/ResultSet.h"
+#include "QueryEngine/ResultSetReductionJIT.h"
+#include "QueryEngine/RuntimeFunctions.h"
+#include "QueryRunner/QueryRunner.h"
+#include "Shared/InlineNullValues.h"
+#include "Shared/thread_count.h"
+#include "StringDictionary/StringDictionary.h"
+#include "Tests/ResultSetTestUtils.h"
+
+#ifndef BASE_PATH
+#define BASE_PATH "./tmp"
+#endif
+
+using QR = QueryRunner::QueryRunner;
+
+extern bool g_is_test_env;
+extern bool g_enable_vectorized_filter;
+
+namespace {
+
+std::once_flag setup_flag;
+void global_setup() {
+  TestHelpers::init_logger_stderr_only();
+  QR::init(BASE_PATH);
+}
+
+const std::vector<int64_t> kRowCounts{1 << 16, 1 << 20, 1 << 23};
+const std::vector<int64_t> kCardinalities{1 << 10, 1 << 16, 1 << 20};
+const std::vector<int64_t> kThreadCounts{1, 2, 4, 8};
+
+void row_count_and_thread_args(benchmark::Benchmark* b) {
+  for (const auto row_count : kRowCounts) {
+    for (const auto thread_count : kThreadCounts) {
+      b->Args({row_count, thread_count});
+    }
+  }
+}
+
+void cardinality_and_thread_args(benchmark::Benchmark* b) {
+  for (const auto cardinality : kCardinalities) {
+    for (const auto thread_count : kThreadCounts) {
+      b->Args({cardinality, thread_count});
+    }
+  }
+}
+
+void row_count_and_vectorized_args(benchmark::Benchmark* b) {
+  for (const auto row_count : kRowCounts) {
+    for (const int64_t vectorized : {0, 1}) {
+      b->Args({row_count, vectorized});
+    }
+  }
+}
+
+void row_count_args(benchmark::Benchmark* b) {
+  for (const auto row_count : kRowCounts) {
+    b->Args({row_count});
+  }
+}
+
+// Uniformly distributed keys in [0, cardinality), with a fixed seed so that runs of
+// different commits see the same data.
+template <typename T>
+std::vector<T> generate_keys(const size_t row_count, const int64_t cardinality) {
+  std::mt19937_64 gen(42);
+  std::uniform_int_distribution<int64_t> dist(0, cardinality - 1);
+  std::vector<T> keys(row_count);
+  for (auto& key : keys) {
+    key = static_cast<T>(dist(gen));
+  }
+  return keys;
+}
+
+// Runs the given function on thread_count threads, passing the thread index.
+template <typename FUNC>
+void run_on_threads(const int thread_count, FUNC func) {
+  std::vector<std::thread> threads;
+  for (int thread_idx = 0; thread_idx < thread_count; ++thread_idx) {
+    threads.emplace_back(func, thread_idx);
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+}
+
+// Overrides the thread count of the kernels which size their work by cpu_threads().
+class CpuThreadsOverride {
+ public:
+  CpuThreadsOverride(const unsigned thread_count)
+      : saved_thread_count_(g_cpu_threads_override) {
+    g_cpu_threads_override = thread_count;
+  }
+
+  ~CpuThreadsOverride() { g_cpu_threads_override = saved_thread_count_; }
+
+ private:
+  const unsigned saved_thread_count_;
+};
+
+}  // namespace
+
+//! Perfect join hash table builds over an int column, as done for the inner table of a
+//! hash join. Unique keys build a one to one table, a quarter as many distinct keys
+//! build a one to many table.
+class JoinHashBuildFixture : public benchmark::Fixture {
+ public:
+  void SetUp(const ::benchmark::State& state) override {
+    const auto row_count = state.range(0);
+    keys_.resize(row_count);
+    std::iota(keys_.begin(), keys_.end(), 0);
+    std::shuffle(keys_.begin(), keys_.end(), std::mt19937_64(42));
+    chunk_ = JoinChunk{reinterpret_cast<const int8_t*>(keys_.data()), keys_.size()};
+  }
+
+  void TearDown(const ::benchmark::State& state) override {
+    keys_.clear();
+    keys_.shrink_to_fit();
+  }
+
+ protected:
+  JoinColumn getJoinColumn() const {
+    return JoinColumn{reinterpret_cast<const int8_t*>(&chunk_),
+                      sizeof(JoinChunk),
+                      1,
+                      keys_.size(),
+                      sizeof(int32_t)};
+  }
+
+  JoinColumnTypeInfo getTypeInfo(const int64_t max_key) const {
+    return JoinColumnTypeInfo{sizeof(int32_t),
+                              0,
+                              max_key,
+                              inline_int_null_value<int32_t>(),
+                              false,
+                              max_key + 1,
+                              Signed};
+  }
+
+  std::vector<int32_t> keys_;
+  JoinChunk chunk_;
+};
+
+BENCHMARK_DEFINE_F(JoinHashBuildFixture, OneToOne)(benchmark::State& state) {
+  const auto thread_count = state.range(1);
+  const auto entry_count = static_cast<int64_t>(keys_.size());
+  const auto join_column = getJoinColumn();
+  const auto type_info = getTypeInfo(entry_count - 1);
+  std::vector<int32_t> hash_table(entry_count);
+  for (auto _ : state) {
+    run_on_threads(thread_count, [&](const int thread_idx) {
+      init_hash_join_buff(hash_table.data(), entry_count, -1, thread_idx, thread_count);
+    });
+    std::atomic<int> err{0};
+    run_on_threads(thread_count, [&](const int thread_idx) {
+      const auto partial_err = fill_hash_join_buff(hash_table.data(),
+                                                   -1,
+                                                   false,
+                                                   join_column,
+                                                   type_info,
+                                                   nullptr,
+                                                   nullptr,
+                                                   thread_idx,
+                                                   thread_count);
+      int zero{0};
+      err.compare_exchange_strong(zero, partial_err);
+    });
+    CHECK_EQ(err.load(), 0);
+    benchmark::DoNotOptimize(hash_table.data());
+  }
+  state.SetItemsProcessed(state.iterations() * keys_.size());
+}
+
+BENCHMARK_REGISTER_F(JoinHashBuildFixture, OneToOne)
+    ->Apply(row_count_and_thread_args)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(JoinHashBuildFixture, OneToMany)(benchmark::State& state) {
+  const auto thread_count = state.range(1);
+  const auto entry_count = std::max<int64_t>(keys_.size() / 4, 1);
+  for (auto& key : keys_) {
+    key %= entry_count;
+  }
+  const auto join_column = getJoinColumn();
+  const auto type_info = getTypeInfo(entry_count - 1);
+  const HashEntryInfo hash_entry_info{static_cast<size_t>(entry_count), 1};
+  std::vector<int32_t> hash_table(2 * entry_count + keys_.size());
+  for (auto _ : state) {
+    run_on_threads(thread_count, [&](const int thread_idx) {
+      init_hash_join_buff(hash_table.data(), entry_count, -1, thread_idx, thread_count);
+    });
+    fill_one_to_many_hash_table(hash_table.data(),
+                                hash_entry_info,
+                                -1,
+                                join_column,
+                                type_info,
+                                nullptr,
+                                nullptr,
+                                thread_count);
+    benchmark::DoNotOptimize(hash_table.data());
+  }
+  state.SetItemsProcessed(state.iterations() * keys_.size());
+}
+
+BENCHMARK_REGISTER_F(JoinHashBuildFixture, OneToMany)
+    ->Apply(row_count_and_thread_args)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+//! Group by hashing of a single bigint key with a count aggregate. As in the CPU query
+//! kernels, each thread aggregates its share of the rows into its own buffer.
+class GroupByHashFixture : public benchmark::Fixture {
+ public:
+  static constexpr size_t kRowCount{1 << 22};
+  static constexpr uint32_t kRowSizeQuad{2};  // key, count
+
+  void SetUp(const ::benchmark::State& state) override {
+    keys_ = generate_keys<int64_t>(kRowCount, state.range(0));
+  }
+
+  void TearDown(const ::benchmark::State& state) override {
+    keys_.clear();
+    keys_.shrink_to_fit();
+  }
+
+ protected:
+  std::vector<int64_t> keys_;
+};
+
+BENCHMARK_DEFINE_F(GroupByHashFixture, PerfectHash)(benchmark::State& state) {
+  const auto cardinality = state.range(0);
+  const auto thread_count = state.range(1);
+  std::vector<std::vector<int64_t>> buffers(
+      thread_count, std::vector<int64_t>(cardinality * kRowSizeQuad));
+  const auto rows_per_thread = (keys_.size() + thread_count - 1) / thread_count;
+  for (auto _ : state) {
+    run_on_threads(thread_count, [&](const int thread_idx) {
+      auto groups_buffer = buffers[thread_idx].data();
+      std::fill(buffers[thread_idx].begin(), buffers[thread_idx].end(), 0);
+      const auto end = std::min(keys_.size(), (thread_idx + 1) * rows_per_thread);
+      for (size_t i = thread_idx * rows_per_thread; i < end; ++i) {
+        auto value_slots =
+            get_group_value_fast(groups_buffer, keys_[i], 0, 0, kRowSizeQuad);
+        ++value_slots[0];
+      }
+    });
+    benchmark::DoNotOptimize(buffers.data());
+  }
+  state.SetItemsProcessed(state.iterations() * keys_.size());
+}
+
+BENCHMARK_REGISTER_F(GroupByHashFixture, PerfectHash)
+    ->Apply(cardinality_and_thread_args)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(GroupByHashFixture, BaselineHash)(benchmark::State& state) {
+  const auto cardinality = state.range(0);
+  const auto thread_count = state.range(1);
+  // the baseline hash buffers are sized at twice the cardinality estimate
+  const uint32_t entry_count = 2 * cardinality;
+  std::vector<std::vector<int64_t>> buffers(
+      thread_count, std::vector<int64_t>(entry_count * kRowSizeQuad));
+  const auto rows_per_thread = (keys_.size() + thread_count - 1) / thread_count;
+  for (auto _ : state) {
+    run_on_threads(thread_count, [&](const int thread_idx) {
+      auto& buffer = buffers[thread_idx];
+      for (size_t i = 0; i < buffer.size(); i += kRowSizeQuad) {
+        buffer[i] = EMPTY_KEY_64;
+        buffer[i + 1] = 0;
+      }
+      const auto end = std::min(keys_.size(), (thread_idx + 1) * rows_per_thread);
+      for (size_t i = thread_idx * rows_per_thread; i < end; ++i) {
+        auto value_slots = get_group_value(
+            buffer.data(), entry_count, &keys_[i], 1, sizeof(int64_t), kRowSizeQuad);
+        CHECK(value_slots);
+        ++value_slots[0];
+      }
+    });
+    benchmark::DoNotOptimize(buffers.data());
+  }
+  state.SetItemsProcessed(state.iterations() * keys_.size());
+}
+
+BENCHMARK_REGISTER_F(GroupByHashFixture, BaselineHash)
+    ->Apply(cardinality_and_thread_args)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+//! Reduction of two perfect hash group by result sets with integer aggregates, as done
+//! for the per device results of a group by query.
+class ResultSetReduceFixture : public benchmark::Fixture {
+ public:
+  void SetUp(const ::benchmark::State& state) override {
+    std::call_once(setup_flag, global_setup);
+    const auto entry_count = state.range(0);
+    SQLTypeInfo bigint_ti(kBIGINT, false);
+    SQLTypeInfo null_ti(kNULLT, false);
+    target_infos_ = {TargetInfo{false, kMIN, bigint_ti, null_ti, false, false},
+                     TargetInfo{true, kSUM, bigint_ti, bigint_ti, true, false},
+                     TargetInfo{true, kMAX, bigint_ti, bigint_ti, true, false},
+                     TargetInfo{true, kCOUNT, bigint_ti, null_ti, false, false}};
+    query_mem_desc_ = std::make_unique<QueryMemoryDescriptor>(
+        perfect_hash_one_col_desc(target_infos_, 8, 0, entry_count - 1));
+    row_set_mem_owner_ =
+        std::make_shared<RowSetMemoryOwner>(Executor::getArenaBlockSize());
+    EvenNumberGenerator generator1;
+    ReverseOddOrEvenNumberGenerator generator2(entry_count - 1);
+    for (auto generator : std::vector<NumberGenerator*>{&generator1, &generator2}) {
+      result_sets_.push_back(std::make_unique<ResultSet>(target_infos_,
+                                                         ExecutorDeviceType::CPU,
+                                                         *query_mem_desc_,
+                                                         row_set_mem_owner_,
+                                                         nullptr,
+                                                         0,
+                                                         0));
+      const auto storage = result_sets_.back()->allocateStorage();
+      fill_storage_buffer(
+          storage->getUnderlyingBuffer(), target_infos_, *query_mem_desc_, *generator, 2);
+    }
+    const auto buffer_size =
+        query_mem_desc_->getBufferSizeBytes(ExecutorDeviceType::CPU);
+    const auto buffer = result_sets_.front()->getStorage()->getUnderlyingBuffer();
+    initial_buffer_.assign(buffer, buffer + buffer_size);
+  }
+
+  void TearDown(const ::benchmark::State& state) override {
+    result_sets_.clear();
+    row_set_mem_owner_.reset();
+    query_mem_desc_.reset();
+    initial_buffer_.clear();
+  }
+
+ protected:
+  std::vector<TargetInfo> target_infos_;
+  std::unique_ptr<QueryMemoryDescriptor> query_mem_desc_;
+  std::shared_ptr<RowSetMemoryOwner> row_set_mem_owner_;
+  std::vector<std::unique_ptr<ResultSet>> result_sets_;
+  std::vector<int8_t> initial_buffer_;
+};
+
+BENCHMARK_DEFINE_F(ResultSetReduceFixture, PerfectHash)(benchmark::State& state) {
+  CpuThreadsOverride threads_override(state.range(1));
+  std::vector<ResultSet*> result_sets{result_sets_[0].get(), result_sets_[1].get()};
+  ResultSetManager rs_manager;
+  for (auto _ : state) {
+    state.PauseTiming();
+    // the reduction accumulates into the first result set
+    std::memcpy(result_sets_.front()->getStorage()->getUnderlyingBuffer(),
+                initial_buffer_.data(),
+                initial_buffer_.size());
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(rs_manager.reduce(result_sets));
+  }
+  state.SetItemsProcessed(state.iterations() * query_mem_desc_->getEntryCount());
+}
+
+BENCHMARK_REGISTER_F(ResultSetReduceFixture, PerfectHash)
+    ->Apply(cardinality_and_thread_args)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+//! Bulk encoding of strings into a new dictionary, as done by the importer for every
+//! batch of a dictionary encoded column.
+class StringDictionaryFixture : public benchmark::Fixture {
+ public:
+  static constexpr size_t kRowCount{1 << 20};
+
+  void SetUp(const ::benchmark::State& state) override {
+    const auto keys = generate_keys<int64_t>(kRowCount, state.range(0));
+    strings_.reserve(keys.size());
+    for (const auto key : keys) {
+      strings_.push_back("string_dictionary_value_" + std::to_string(key));
+    }
+  }
+
+  void TearDown(const ::benchmark::State& state) override {
+    strings_.clear();
+    strings_.shrink_to_fit();
+  }
+
+ protected:
+  void runGetOrAddBulk(benchmark::State& state, const bool parallel) {
+    const auto saved_parallel = g_enable_stringdict_parallel;
+    g_enable_stringdict_parallel = parallel;
+    tbb::task_arena arena(state.range(1));
+    std::vector<int32_t> ids(strings_.size());
+    for (auto _ : state) {
+      state.PauseTiming();
+      auto string_dict = std::make_unique<StringDictionary>("", true, false);
+      state.ResumeTiming();
+      arena.execute([&] { string_dict->getOrAddBulk(strings_, ids.data()); });
+      benchmark::DoNotOptimize(ids.data());
+      state.PauseTiming();
+      string_dict.reset();
+      state.ResumeTiming();
+    }
+    g_enable_stringdict_parallel = saved_parallel;
+    state.SetItemsProcessed(state.iterations() * strings_.size());
+  }
+
+  std::vector<std::string> strings_;
+};
+
+BENCHMARK_DEFINE_F(StringDictionaryFixture, GetOrAddBulk)(benchmark::State& state) {
+  runGetOrAddBulk(state, false);
+}
+
+BENCHMARK_REGISTER_F(StringDictionaryFixture, GetOrAddBulk)
+    ->Apply(cardinality_and_thread_args)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(StringDictionaryFixture, GetOrAddBulkParallel)
+(benchmark::State& state) {
+  runGetOrAddBulk(state, true);
+}
+
+BENCHMARK_REGISTER_F(StringDictionaryFixture, GetOrAddBulkParallel)
+    ->Apply(cardinality_and_thread_args)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+//! Appending a batch of values to a chunk buffer through the encoder of the column type,
+//! which compresses the values and updates the chunk statistics.
+template <typename T>
+void run_encoder_append(benchmark::State& state, const SQLTypeInfo& ti) {
+  std::vector<T> values(state.range(0));
+  std::mt19937_64 gen(42);
+  std::uniform_int_distribution<int64_t> dist(0, 30000);
+  for (auto& value : values) {
+    value = static_cast<T>(dist(gen));
+  }
+  for (auto _ : state) {
+    state.PauseTiming();
+    foreign_storage::ForeignStorageBuffer buffer;
+    buffer.initEncoder(ti);
+    buffer.reserve(values.size() * ti.get_size());
+    state.ResumeTiming();
+    auto data = reinterpret_cast<int8_t*>(values.data());
+    benchmark::DoNotOptimize(buffer.getEncoder()->appendData(data, values.size(), ti));
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(T));
+}
+
+void BM_EncoderAppendBigInt(benchmark::State& state) {
+  run_encoder_append<int64_t>(state, SQLTypeInfo(kBIGINT, false));
+}
+BENCHMARK(BM_EncoderAppendBigInt)->Apply(row_count_args)->Unit(benchmark::kMillisecond);
+
+void BM_EncoderAppendIntFixed16(benchmark::State& state) {
+  run_encoder_append<int32_t>(state, SQLTypeInfo(kINT, kENCODING_FIXED, 16, kNULLT));
+}
+BENCHMARK(BM_EncoderAppendIntFixed16)
+    ->Apply(row_count_args)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_EncoderAppendDateInDays(benchmark::State& state) {
+  run_encoder_append<int64_t>(state,
+                              SQLTypeInfo(kDATE, kENCODING_DATE_IN_DAYS, 0, kNULLT));
+}
+BENCHMARK(BM_EncoderAppendDateInDays)
+    ->Apply(row_count_args)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_EncoderAppendDouble(benchmark::State& state) {
+  run_encoder_append<double>(state, SQLTypeInfo(kDOUBLE, false));
+}
+BENCHMARK(BM_EncoderAppendDouble)->Apply(row_count_args)->Unit(benchmark::kMillisecond);
+
+//! Splitting CSV rows into fields, as done by the importer threads for their slice of
+//! the input buffer.
+class DelimitedParserFixture : public benchmark::Fixture {
+ public:
+  void SetUp(const ::benchmark::State& state) override {
+    const auto row_count = state.range(0);
+    const auto thread_count = state.range(1);
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<int64_t> dist(0, 1000000);
+    slice_begins_.clear();
+    for (int64_t row = 0; row < row_count; ++row) {
+      if (row % ((row_count + thread_count - 1) / thread_count) == 0) {
+        slice_begins_.push_back(buffer_.size());
+      }
+      const auto value = dist(gen);
+      buffer_ += std::to_string(value) + "," + std::to_string(value / 7.0) +
+                 ",\"text, with a delimiter " + std::to_string(value % 100) +
+                 "\",2021-03-" + std::to_string(10 + value % 18) + "," +
+                 (value % 2 ? "true" : "false") + "\n";
+    }
+    slice_begins_.push_back(buffer_.size());
+  }
+
+  void TearDown(const ::benchmark::State& state) override {
+    buffer_.clear();
+    buffer_.shrink_to_fit();
+  }
+
+ protected:
+  std::string buffer_;
+  std::vector<size_t> slice_begins_;
+};
+
+BENCHMARK_DEFINE_F(DelimitedParserFixture, GetRow)(benchmark::State& state) {
+  const import_export::CopyParams copy_params;
+  const auto buffer_end = buffer_.data() + buffer_.size();
+  for (auto _ : state) {
+    run_on_threads(slice_begins_.size() - 1, [&](const int thread_idx) {
+      const auto slice_end = buffer_.data() + slice_begins_[thread_idx + 1];
+      std::vector<std::string_view> row;
+      std::vector<std::unique_ptr<char[]>> tmp_buffers;
+      bool try_single_thread{false};
+      for (const char* p = buffer_.data() + slice_begins_[thread_idx]; p < slice_end;
+           p++) {
+        row.clear();
+        p = import_export::delimited_parser::get_row(p,
+                                                     slice_end,
+                                                     buffer_end,
+                                                     copy_params,
+                                                     nullptr,
+                                                     row,
+                                                     tmp_buffers,
+                                                     try_single_thread,
+                                                     true);
+        benchmark::DoNotOptimize(row.data());
+      }
+    });
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * buffer_.size());
+}
+
+BENCHMARK_REGISTER_F(DelimitedParserFixture, GetRow)
+    ->Apply(row_count_and_thread_args)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+//! A scan of a table with a conjunctive filter on three columns, evaluated row by row
+//! or over selection vectors of the rows passing each predicate in turn.
+class FilterScanFixture : public benchmark::Fixture {
+ public:
+  void SetUp(const ::benchmark::State& state) override {
+    std::call_once(setup_flag, global_setup);
+    const auto row_count = state.range(0);
+    QR::get()->runDDLStatement("DROP TABLE IF EXISTS filter_bench;");
+    QR::get()->runDDLStatement(
+        "CREATE TABLE filter_bench (a INT, b BIGINT, c DOUBLE) WITH (FRAGMENT_SIZE=" +
+        std::to_string(row_count) + ");");
+    const auto td = QR::get()->getCatalog()->getMetadataForTable("filter_bench");
+    CHECK(td);
+    auto loader = QR::get()->getLoader(td);
+    CHECK(loader);
+    std::vector<std::unique_ptr<import_export::TypedImportBuffer>> import_buffers;
+    for (const auto cd : loader->get_column_descs()) {
+      import_buffers.push_back(std::make_unique<import_export::TypedImportBuffer>(
+          cd, loader->getStringDict(cd)));
+    }
+    CHECK_EQ(import_buffers.size(), size_t(3));
+    const auto keys = generate_keys<int32_t>(row_count, 100'000);
+    for (const auto key : keys) {
+      import_buffers[0]->addInt(key % 100);
+      import_buffers[1]->addBigint(key);
+      import_buffers[2]->addDouble(key / 100'000.0);
+    }
+    loader->load(import_buffers, row_count, nullptr);
+  }
+
+  void TearDown(const ::benchmark::State& state) override {
+    QR::get()->runDDLStatement("DROP TABLE IF EXISTS filter_bench;");
+  }
+};
+
+BENCHMARK_DEFINE_F(FilterScanFixture, Count)(benchmark::State& state) {
+  const auto vectorized_filter = g_enable_vectorized_filter;
+  g_enable_vectorized_filter = state.range(1);
+  const std::string query{
+      "SELECT COUNT(*) FROM filter_bench WHERE a > 50 AND b < 90000 AND c >= 0.2;"};
+  // compile outside of the timed loop
+  QR::get()->runSQL(query, ExecutorDeviceType::CPU, true, false);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        QR::get()->runSQL(query, ExecutorDeviceType::CPU, true, false));
+  }
+  g_enable_vectorized_filter = vectorized_filter;
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(FilterScanFixture, Count)
+    ->Apply(row_count_and_vectorized_args)
+    ->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+  g_is_test_env = true;
+  // report in JSON by default, so that results can be kept and compared across commits
+  std::vector<char*> args(argv, argv + argc);
+  std::string json_format{"--benchmark_format=json"};
+  if (std::none_of(args.begin() + 1, args.end(), [](const char* arg) {
+        return std::strncmp(arg, "--benchmark_format", 18) == 0;
+      })) {
+    args.push_back(json_format.data());
+  }
+  int args_count = args.size();
+  ::benchmark::Initialize(&args_count, args.data());
+  if (::benchmark::ReportUnrecognizedArguments(args_count, args.data())) {
+    return 1;
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+  ResultSetReductionJIT::clearCache();
+  QR::reset();
+  return 0;
+}
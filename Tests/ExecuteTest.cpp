@@ -16,6 +16,7 @@
 
 #include "TestHelpers.h"
 
+#include "../Fragmenter/InsertWriteAheadLog.h"
 #include "../ImportExport/Importer.h"
 #include "../Parser/parser.h"
 #include "../QueryEngine/ArrowResultSet.h"
@@ -24,9 +25,11 @@
 #include "../QueryEngine/Execute.h"
 #include "../QueryEngine/ExpressionRange.h"
 #include "../QueryEngine/ResultSetReductionJIT.h"
+#include "../QueryEngine/SharedScan.h"
 #include "../QueryRunner/QueryRunner.h"
 #include "../Shared/DateConverters.h"
 #include "../Shared/DateTimeParser.h"
+#include "../Shared/Metrics.h"
 #include "../Shared/StringTransform.h"
 #include "../Shared/scope.h"
 #include "../SqliteConnector/SqliteConnector.h"
@@ -40,7 +43,9 @@
 
 #include <cmath>
 #include <cstdio>
+#include <future>
 #include <random>
+#include <thread>
 
 #ifndef BASE_PATH
 #define BASE_PATH "./tmp"
@@ -74,6 +79,19 @@ extern bool g_enable_calcite_view_optimize;
 extern bool g_enable_bump_allocator;
 extern bool g_enable_interop;
 extern bool g_enable_union;
+extern bool g_enable_cpu_morsel_execution;
+extern size_t g_cpu_morsel_size;
+extern bool g_enable_shared_scans;
+extern size_t g_shared_scan_block_size;
+extern bool g_enable_batched_intermediate_results;
+extern bool g_enable_paged_perfect_hash;
+extern bool g_enable_vectorized_filter;
+extern bool g_enable_tiered_compilation;
+extern bool g_enable_string_key_group_by;
+extern bool g_enable_insert_wal;
+extern size_t g_insert_wal_checkpoint_interval_ms;
+extern bool g_enable_spill_to_disk;
+extern size_t g_spill_threshold_bytes;
 
 extern size_t g_leaf_count;
 extern bool g_cluster;
@@ -883,6 +901,272 @@ TEST(Insert, InvalidColumnName) {
   }
 }
 
+TEST(Insert, MultipleRows) {
+  for (auto dt : {ExecutorDeviceType::CPU, ExecutorDeviceType::GPU}) {
+    SKIP_NO_GPU();
+    run_ddl_statement("DROP TABLE IF EXISTS multi_row_inserts_test;");
+    run_ddl_statement(
+        "CREATE TABLE multi_row_inserts_test(i INTEGER, d TEXT ENCODING DICT, "
+        "t TEXT ENCODING NONE, ia INTEGER[], b BOOLEAN, SHARD KEY (i)) "
+        "WITH (shard_count = 4);");
+    run_multiple_agg(
+        "INSERT INTO multi_row_inserts_test (i, d, t, ia) VALUES (1, 'a', 'one', {1}), "
+        "(2, 'b', 'two', {2, 2}), (3, NULL, NULL, NULL), (4, 'a', 'four', {4});",
+        dt);
+    ASSERT_EQ(4,
+              v<int64_t>(run_simple_agg("SELECT COUNT(*) FROM multi_row_inserts_test;",
+                                        dt)));
+    ASSERT_EQ(2,
+              v<int64_t>(run_simple_agg(
+                  "SELECT COUNT(*) FROM multi_row_inserts_test WHERE d = 'a';", dt)));
+    ASSERT_EQ(
+        "two",
+        boost::get<std::string>(v<NullableString>(run_simple_agg(
+            "SELECT t FROM multi_row_inserts_test WHERE ia[2] = 2;", dt))));
+    ASSERT_EQ(4,
+              v<int64_t>(run_simple_agg(
+                  "SELECT COUNT(*) FROM multi_row_inserts_test WHERE b IS NULL;", dt)));
+    // all rows are analyzed before any of them is inserted, so neither a row with the
+    // wrong number of values nor one with a bad value leaves the rows before it behind
+    EXPECT_THROW(run_multiple_agg("INSERT INTO multi_row_inserts_test (i, d) VALUES "
+                                  "(5, 'e'), (6);",
+                                  dt),
+                 std::runtime_error);
+    EXPECT_THROW(run_multiple_agg("INSERT INTO multi_row_inserts_test (i, d) VALUES "
+                                  "(5, 'e'), ('six', 'f');",
+                                  dt),
+                 std::runtime_error);
+    ASSERT_EQ(4,
+              v<int64_t>(run_simple_agg("SELECT COUNT(*) FROM multi_row_inserts_test;",
+                                        dt)));
+    run_ddl_statement("DROP TABLE multi_row_inserts_test;");
+  }
+}
+
+namespace {
+
+// Copies the log segments, as a crash before the next checkpoint would leave them.
+void copy_insert_wal(const std::string& log_path, const std::string& copy_path) {
+  boost::filesystem::remove_all(copy_path);
+  boost::filesystem::create_directories(copy_path);
+  for (const auto& entry : boost::filesystem::directory_iterator(log_path)) {
+    boost::filesystem::copy_file(
+        entry.path(), boost::filesystem::path(copy_path) / entry.path().filename());
+  }
+}
+
+// Returns the log segment holding the last record.
+boost::filesystem::path get_last_insert_wal_segment(const std::string& log_path) {
+  boost::filesystem::path last_segment;
+  int64_t last_segment_id{-1};
+  for (const auto& entry : boost::filesystem::directory_iterator(log_path)) {
+    const auto segment_id = std::stoll(entry.path().extension().string().substr(1));
+    if (boost::filesystem::file_size(entry.path()) && segment_id > last_segment_id) {
+      last_segment = entry.path();
+      last_segment_id = segment_id;
+    }
+  }
+  CHECK(!last_segment.empty());
+  return last_segment;
+}
+
+}  // namespace
+
+TEST(Insert, WriteAheadLog) {
+  auto& insert_wal = Fragmenter_Namespace::InsertWriteAheadLog::instance();
+  ScopeGuard reset = [enable_insert_wal = g_enable_insert_wal,
+                      checkpoint_interval_ms = g_insert_wal_checkpoint_interval_ms,
+                      &insert_wal] {
+    insert_wal.stop();
+    g_enable_insert_wal = enable_insert_wal;
+    g_insert_wal_checkpoint_interval_ms = checkpoint_interval_ms;
+    run_ddl_statement("DROP TABLE IF EXISTS insert_wal_test;");
+  };
+  g_enable_insert_wal = true;
+  // only the explicit checkpoint below may advance the epoch
+  g_insert_wal_checkpoint_interval_ms = 3600 * 1000;
+  insert_wal.start(std::string(BASE_PATH) + "/mapd_insert_wal_test");
+  run_ddl_statement("DROP TABLE IF EXISTS insert_wal_test;");
+  run_ddl_statement(
+      "CREATE TABLE insert_wal_test(i INTEGER, t TEXT ENCODING NONE, ia INTEGER[], "
+      "SHARD KEY (i)) WITH (shard_count = 2);");
+  const auto& cat = QR::get()->getSession()->getCatalog();
+  const auto td = cat.getMetadataForTable("insert_wal_test");
+  CHECK(td);
+  const auto epoch = cat.getTableEpoch(cat.getDatabaseId(), td->tableId);
+  for (int i = 0; i < 10; ++i) {
+    run_multiple_agg("INSERT INTO insert_wal_test VALUES(" + std::to_string(i) +
+                         ", 'str', {" + std::to_string(i) + ", 1});",
+                     ExecutorDeviceType::CPU);
+  }
+  // The inserts are made durable by the log, not by checkpoints.
+  EXPECT_EQ(epoch, cat.getTableEpoch(cat.getDatabaseId(), td->tableId));
+  ASSERT_EQ(10,
+            v<int64_t>(run_simple_agg("SELECT COUNT(*) FROM insert_wal_test;",
+                                      ExecutorDeviceType::CPU)));
+  ASSERT_EQ(45,
+            v<int64_t>(run_simple_agg("SELECT SUM(ia[1]) FROM insert_wal_test;",
+                                      ExecutorDeviceType::CPU)));
+  insert_wal.checkpoint();
+  EXPECT_LT(epoch, cat.getTableEpoch(cat.getDatabaseId(), td->tableId));
+}
+
+TEST(Insert, WriteAheadLogReplay) {
+  auto& insert_wal = Fragmenter_Namespace::InsertWriteAheadLog::instance();
+  const std::string log_path = std::string(BASE_PATH) + "/mapd_insert_wal_test";
+  const std::string crash_path = log_path + "_crash";
+  ScopeGuard reset = [enable_insert_wal = g_enable_insert_wal,
+                      checkpoint_interval_ms = g_insert_wal_checkpoint_interval_ms,
+                      &insert_wal,
+                      crash_path] {
+    insert_wal.stop();
+    g_enable_insert_wal = enable_insert_wal;
+    g_insert_wal_checkpoint_interval_ms = checkpoint_interval_ms;
+    boost::filesystem::remove_all(crash_path);
+    run_ddl_statement("DROP TABLE IF EXISTS insert_wal_test;");
+  };
+  g_enable_insert_wal = true;
+  g_insert_wal_checkpoint_interval_ms = 3600 * 1000;
+  run_ddl_statement("DROP TABLE IF EXISTS insert_wal_test;");
+  run_ddl_statement(
+      "CREATE TABLE insert_wal_test(i INTEGER, t TEXT ENCODING NONE, ia INTEGER[], "
+      "SHARD KEY (i)) WITH (shard_count = 2);");
+  const auto& cat = QR::get()->getSession()->getCatalog();
+  const auto td = cat.getMetadataForTable("insert_wal_test");
+  CHECK(td);
+
+  // Logs ten single row inserts, one record each, keeps a copy of the log in
+  // crash_path and checkpoints the rows on stop. Returns the epochs of the shards
+  // before the inserts.
+  const auto log_inserts = [&] {
+    const auto table_epochs = cat.getTableEpochs(cat.getDatabaseId(), td->tableId);
+    insert_wal.start(log_path);
+    for (int i = 0; i < 10; ++i) {
+      run_multiple_agg("INSERT INTO insert_wal_test VALUES(" + std::to_string(i) +
+                           ", 'str', {" + std::to_string(i) + ", 1});",
+                       ExecutorDeviceType::CPU);
+    }
+    copy_insert_wal(log_path, crash_path);
+    insert_wal.stop();
+    return table_epochs;
+  };
+  // Starting the log replays the records it finds.
+  const auto replay = [&] {
+    insert_wal.start(crash_path);
+    insert_wal.stop();
+  };
+  const auto check_rows = [](const int64_t count, const int64_t sum) {
+    ASSERT_EQ(count,
+              v<int64_t>(run_simple_agg("SELECT COUNT(*) FROM insert_wal_test;",
+                                        ExecutorDeviceType::CPU)));
+    ASSERT_EQ(sum,
+              v<int64_t>(run_simple_agg("SELECT SUM(i) FROM insert_wal_test;",
+                                        ExecutorDeviceType::CPU)));
+    ASSERT_EQ(sum,
+              v<int64_t>(run_simple_agg("SELECT SUM(ia[1]) FROM insert_wal_test;",
+                                        ExecutorDeviceType::CPU)));
+  };
+
+  // The crash loses the inserts to both shards since the last checkpoint.
+  auto table_epochs = log_inserts();
+  cat.setTableEpochs(cat.getDatabaseId(), table_epochs);
+  check_rows(0, 0);
+  replay();
+  check_rows(10, 45);
+
+  // Records at or below the checkpointed epoch of their shard are not inserted again.
+  log_inserts();
+  check_rows(20, 90);
+  replay();
+  check_rows(20, 90);
+
+  // A torn write leaves a truncated record at the tail, which is dropped.
+  table_epochs = log_inserts();
+  const auto truncated_segment = get_last_insert_wal_segment(crash_path);
+  boost::filesystem::resize_file(truncated_segment,
+                                 boost::filesystem::file_size(truncated_segment) - 1);
+  cat.setTableEpochs(cat.getDatabaseId(), table_epochs);
+  check_rows(20, 90);
+  replay();
+  check_rows(29, 126);
+
+  // So is a record at the tail which fails its checksum.
+  table_epochs = log_inserts();
+  {
+    std::fstream segment(get_last_insert_wal_segment(crash_path).string(),
+                         std::ios::in | std::ios::out | std::ios::binary);
+    segment.seekg(-1, std::ios::end);
+    const char last_byte = segment.get();
+    segment.seekp(-1, std::ios::end);
+    segment.put(~last_byte);
+  }
+  cat.setTableEpochs(cat.getDatabaseId(), table_epochs);
+  check_rows(29, 126);
+  replay();
+  check_rows(38, 162);
+}
+
+TEST(Insert, WriteAheadLogTruncate) {
+  auto& insert_wal = Fragmenter_Namespace::InsertWriteAheadLog::instance();
+  const std::string log_path = std::string(BASE_PATH) + "/mapd_insert_wal_test";
+  const std::string crash_path = log_path + "_crash";
+  ScopeGuard reset = [enable_insert_wal = g_enable_insert_wal,
+                      checkpoint_interval_ms = g_insert_wal_checkpoint_interval_ms,
+                      &insert_wal,
+                      crash_path] {
+    insert_wal.stop();
+    g_enable_insert_wal = enable_insert_wal;
+    g_insert_wal_checkpoint_interval_ms = checkpoint_interval_ms;
+    boost::filesystem::remove_all(crash_path);
+    run_ddl_statement("DROP TABLE IF EXISTS insert_wal_test;");
+  };
+  g_enable_insert_wal = true;
+  g_insert_wal_checkpoint_interval_ms = 3600 * 1000;
+  run_ddl_statement("DROP TABLE IF EXISTS insert_wal_test;");
+  run_ddl_statement(
+      "CREATE TABLE insert_wal_test(i INTEGER, t TEXT ENCODING DICT(32), "
+      "SHARD KEY (i)) WITH (shard_count = 2);");
+  const auto& cat = QR::get()->getSession()->getCatalog();
+  const auto td = cat.getMetadataForTable("insert_wal_test");
+  CHECK(td);
+  const auto insert_rows = [](const int first, const int last) {
+    for (int i = first; i <= last; ++i) {
+      run_multiple_agg("INSERT INTO insert_wal_test VALUES(" + std::to_string(i) +
+                           ", 'str" + std::to_string(i) + "');",
+                       ExecutorDeviceType::CPU);
+    }
+  };
+
+  insert_wal.start(log_path);
+  insert_rows(1, 10);
+  // The truncation restarts the epochs of the table and its dictionary, so the records
+  // logged before it must not be replayed.
+  run_ddl_statement("TRUNCATE TABLE insert_wal_test;");
+  const auto table_epochs = cat.getTableEpochs(cat.getDatabaseId(), td->tableId);
+  insert_rows(11, 13);
+  copy_insert_wal(log_path, crash_path);
+  insert_wal.stop();
+
+  // The crash loses the inserts since the truncation.
+  cat.setTableEpochs(cat.getDatabaseId(), table_epochs);
+  ASSERT_EQ(0,
+            v<int64_t>(run_simple_agg("SELECT COUNT(*) FROM insert_wal_test;",
+                                      ExecutorDeviceType::CPU)));
+  insert_wal.start(crash_path);
+  insert_wal.stop();
+  ASSERT_EQ(3,
+            v<int64_t>(run_simple_agg("SELECT COUNT(*) FROM insert_wal_test;",
+                                      ExecutorDeviceType::CPU)));
+  ASSERT_EQ(36,
+            v<int64_t>(run_simple_agg("SELECT SUM(i) FROM insert_wal_test;",
+                                      ExecutorDeviceType::CPU)));
+  ASSERT_EQ(3,
+            v<int64_t>(run_simple_agg(
+                "SELECT COUNT(*) FROM insert_wal_test WHERE (i = 11 AND t = 'str11') OR "
+                "(i = 12 AND t = 'str12') OR (i = 13 AND t = 'str13');",
+                ExecutorDeviceType::CPU)));
+}
+
 TEST(KeyForString, KeyForString) {
   for (auto dt : {ExecutorDeviceType::CPU, ExecutorDeviceType::GPU}) {
     SKIP_NO_GPU();
@@ -1953,6 +2237,364 @@ TEST(Select, FilterAndGroupBy) {
   }
 }
 
+TEST(Select, MorselDrivenGroupBy) {
+  ScopeGuard reset = [morsel_execution = g_enable_cpu_morsel_execution,
+                      morsel_size = g_cpu_morsel_size] {
+    g_enable_cpu_morsel_execution = morsel_execution;
+    g_cpu_morsel_size = morsel_size;
+  };
+  g_enable_cpu_morsel_execution = true;
+  // Use tiny morsels so every fragment is split across several workers.
+  for (size_t morsel_size : {size_t(1), size_t(3), size_t(1'000)}) {
+    g_cpu_morsel_size = morsel_size;
+    const auto dt = ExecutorDeviceType::CPU;
+    c("SELECT x, y, COUNT(*) FROM test GROUP BY x, y ORDER BY x, y;", dt);
+    c("SELECT str, MIN(y), MAX(z) FROM test GROUP BY str ORDER BY str;", dt);
+    c("SELECT x, SUM(dd), AVG(y) FROM test WHERE y > 41 GROUP BY x ORDER BY x;", dt);
+    c("SELECT COUNT(*) FROM test_inner GROUP BY x ORDER BY x;", dt);
+    c("SELECT APPROX_COUNT_DISTINCT(x) FROM test;",
+      "SELECT COUNT(DISTINCT x) FROM test;",
+      dt);
+  }
+}
+
+TEST(Select, SharedScans) {
+  ScopeGuard reset = [shared_scans = g_enable_shared_scans,
+                      block_size = g_shared_scan_block_size] {
+    g_enable_shared_scans = shared_scans;
+    g_shared_scan_block_size = block_size;
+  };
+  g_shared_scan_block_size = 4;
+  auto& manager = SharedScanManager::instance();
+  {
+    // The second kernel joins while the first one runs its first block, so the first
+    // kernel's thread runs the remaining blocks for both and wraps around to block 0.
+    const SharedScanManager::Key key{-1, -1, 0, 10};
+    const auto block_count = SharedScanManager::getBlockCount(key.num_rows);
+    ASSERT_EQ(block_count, size_t(3));
+    const auto joined_kernels = manager.getJoinedKernelCount();
+    std::vector<std::pair<int64_t, int64_t>> leader_blocks;
+    std::vector<size_t> joiner_blocks;
+    std::vector<std::thread::id> joiner_threads;
+    std::promise<std::thread::id> leader_thread;
+    SharedScanManager::BlockFunction lead = [&](const int64_t begin,
+                                                const int64_t end,
+                                                const size_t block_idx) {
+      if (block_idx == 0) {
+        leader_thread.set_value(std::this_thread::get_id());
+        while (manager.getJoinedKernelCount() == joined_kernels) {
+          std::this_thread::yield();
+        }
+      }
+      leader_blocks.emplace_back(begin, end);
+      return true;
+    };
+    SharedScanManager::BlockFunction join =
+        [&](const int64_t, const int64_t, const size_t block_idx) {
+          joiner_blocks.push_back(block_idx);
+          joiner_threads.push_back(std::this_thread::get_id());
+          return true;
+        };
+    auto leader = std::async(std::launch::async, [&] { manager.scan(key, lead); });
+    const auto leader_thread_id = leader_thread.get_future().get();
+    manager.scan(key, join);
+    leader.get();
+    const std::vector<std::pair<int64_t, int64_t>> expected_leader_blocks{
+        {0, 4}, {4, 8}, {8, 10}};
+    EXPECT_EQ(leader_blocks, expected_leader_blocks);
+    EXPECT_EQ(joiner_blocks, std::vector<size_t>({1, 2, 0}));
+    for (const auto thread_id : joiner_threads) {
+      EXPECT_EQ(thread_id, leader_thread_id);
+    }
+    EXPECT_EQ(manager.getJoinedKernelCount(), joined_kernels + 1);
+  }
+
+  g_enable_shared_scans = true;
+  // Single-row blocks split every fragment of the test table into several blocks.
+  g_shared_scan_block_size = 1;
+  const auto dt = ExecutorDeviceType::CPU;
+  const auto scans = manager.getScanCount();
+  c("SELECT COUNT(*), SUM(x), MIN(y), MAX(z), AVG(dd) FROM test;", dt);
+  c("SELECT COUNT(*) FROM test WHERE x > 7;", dt);
+  c("SELECT x, COUNT(*), SUM(y) FROM test GROUP BY x ORDER BY x;", dt);
+  c("SELECT str, MIN(y), MAX(z) FROM test GROUP BY str ORDER BY str;", dt);
+  c("SELECT APPROX_COUNT_DISTINCT(x) FROM test;",
+    "SELECT COUNT(DISTINCT x) FROM test;",
+    dt);
+  EXPECT_GT(manager.getScanCount(), scans);
+}
+
+TEST(Select, BatchedIntermediateResults) {
+  ScopeGuard reset = [batched_results = g_enable_batched_intermediate_results,
+                      morsel_size = g_cpu_morsel_size] {
+    g_enable_batched_intermediate_results = batched_results;
+    g_cpu_morsel_size = morsel_size;
+  };
+  g_enable_batched_intermediate_results = true;
+  // Small batches split every intermediate result into several fragments.
+  for (size_t morsel_size : {size_t(1), size_t(4), size_t(1'000)}) {
+    g_cpu_morsel_size = morsel_size;
+    for (auto dt : {ExecutorDeviceType::CPU, ExecutorDeviceType::GPU}) {
+      SKIP_NO_GPU();
+      c("SELECT COUNT(*) FROM (SELECT x, SUM(y) AS s FROM test GROUP BY x) WHERE s > 0;",
+        dt);
+      c("SELECT n, COUNT(*) FROM (SELECT str, COUNT(*) AS n FROM test GROUP BY str) "
+        "GROUP BY n ORDER BY n;",
+        dt);
+      c("SELECT MIN(m), MAX(m), SUM(m) FROM (SELECT y, MAX(z) AS m FROM test GROUP BY "
+        "y) WHERE y > 41;",
+        dt);
+      c("SELECT SUM(d) FROM (SELECT x, AVG(d) AS d FROM test GROUP BY x, y);", dt);
+    }
+  }
+}
+
+TEST(Select, PagedPerfectHashGroupBy) {
+  ScopeGuard reset = [paged_perfect_hash = g_enable_paged_perfect_hash] {
+    g_enable_paged_perfect_hash = paged_perfect_hash;
+  };
+  const std::string drop_query{"DROP TABLE IF EXISTS paged_group_by_test;"};
+  run_ddl_statement(drop_query);
+  g_sqlite_comparator.query(drop_query);
+  run_ddl_statement(
+      "CREATE TABLE paged_group_by_test (x INT, y INT) WITH (fragment_size=2);");
+  g_sqlite_comparator.query("CREATE TABLE paged_group_by_test (x INT, y INT);");
+  // Few keys spread over a range of many pages, some of them shared between fragments.
+  for (const std::string values : {"0, 1",
+                                   "5, 2",
+                                   "70000, 3",
+                                   "999999, 1",
+                                   "70000, 2",
+                                   "500000, 3",
+                                   "5, 1",
+                                   "999999, 3"}) {
+    const std::string insert_query{"INSERT INTO paged_group_by_test VALUES(" + values +
+                                   ");"};
+    run_multiple_agg(insert_query, ExecutorDeviceType::CPU);
+    g_sqlite_comparator.query(insert_query);
+  }
+  const auto dt = ExecutorDeviceType::CPU;
+  for (bool paged_perfect_hash : {false, true}) {
+    g_enable_paged_perfect_hash = paged_perfect_hash;
+    c("SELECT x, COUNT(*) FROM paged_group_by_test GROUP BY x ORDER BY x;", dt);
+    c("SELECT x, SUM(y), MIN(y), MAX(y) FROM paged_group_by_test GROUP BY x ORDER BY "
+      "x;",
+      dt);
+    c("SELECT x, y, COUNT(*) FROM paged_group_by_test GROUP BY x, y ORDER BY x, y;",
+      dt);
+    c("SELECT x, COUNT(*) AS n FROM paged_group_by_test GROUP BY x ORDER BY n DESC, x "
+      "LIMIT 2;",
+      dt);
+  }
+  run_ddl_statement(drop_query);
+  g_sqlite_comparator.query(drop_query);
+}
+
+TEST(Select, VectorizedFilter) {
+  ScopeGuard reset = [vectorized_filter = g_enable_vectorized_filter] {
+    g_enable_vectorized_filter = vectorized_filter;
+  };
+  g_enable_vectorized_filter = true;
+  const auto dt = ExecutorDeviceType::CPU;
+  auto uses_selection_vector = [dt](const std::string& query) {
+    const auto explain_result =
+        QR::get()
+            ->runSelectQuery(query,
+                             dt,
+                             /*hoist_literals=*/true,
+                             /*allow_loop_joins=*/false,
+                             /*just_explain=*/true)
+            ->getRows();
+    const auto crt_row = explain_result->getNextRow(true, true);
+    CHECK_EQ(size_t(1), crt_row.size());
+    const auto explain_str = boost::get<std::string>(v<NullableString>(crt_row[0]));
+    return explain_str.find("@filter_selection_fill(") != std::string::npos;
+  };
+  EXPECT_TRUE(uses_selection_vector("SELECT COUNT(*) FROM test WHERE x > 7;"));
+  EXPECT_TRUE(uses_selection_vector(
+      "SELECT x, SUM(y) FROM test WHERE z > 101 AND x <> 8 GROUP BY x;"));
+  EXPECT_FALSE(uses_selection_vector("SELECT COUNT(*) FROM test WHERE x + y > 7;"));
+  // The terms are passed as hoisted literals, so only the first of the queries which
+  // differ in their literals compiles code.
+  auto& cache_misses =
+      metrics::Registry::instance().counter("omnisci_code_cache_misses_total", "");
+  c("SELECT COUNT(*) FROM test WHERE y > 40 AND z < 103;", dt);
+  const auto cache_misses_before = cache_misses.value();
+  c("SELECT COUNT(*) FROM test WHERE y > 42 AND z < 102;", dt);
+  c("SELECT COUNT(*) FROM test WHERE y > 43 AND z < 101;", dt);
+  EXPECT_EQ(cache_misses.value(), cache_misses_before);
+  c("SELECT COUNT(*) FROM test WHERE x > 7;", dt);
+  c("SELECT COUNT(*) FROM test WHERE 8 <= x AND y <> 42;", dt);
+  c("SELECT COUNT(*) FROM test WHERE w = -7 AND z < 102 AND t >= 1001;", dt);
+  c("SELECT COUNT(*) FROM test WHERE fx = 9 OR y = 43;", dt);
+  c("SELECT COUNT(*) FROM test WHERE ofd > 0;", dt);
+  c("SELECT COUNT(*) FROM test WHERE f > 1.1 AND d < 2.5;", dt);
+  c("SELECT COUNT(*) FROM test WHERE fn < 0 OR dn > 0;", dt);
+  c("SELECT COUNT(*) FROM test WHERE dd > 100;", dt);
+  c("SELECT x, SUM(y), COUNT(*) FROM test WHERE z > 101 AND x <> 8 GROUP BY x ORDER BY "
+    "x;",
+    dt);
+  c("SELECT x, y FROM test WHERE smallint_nulls = 123 ORDER BY x, y;", dt);
+  c("SELECT str FROM test WHERE y = 43 AND fx > 0 ORDER BY str;", dt);
+}
+
+TEST(Select, TieredCompilation) {
+  ScopeGuard reset = [tiered_compilation = g_enable_tiered_compilation] {
+    g_enable_tiered_compilation = tiered_compilation;
+  };
+  g_enable_tiered_compilation = true;
+  const auto dt = ExecutorDeviceType::CPU;
+  auto& registry = metrics::Registry::instance();
+  auto& light_compilations =
+      registry.counter("omnisci_tiered_compilation_light_total", "");
+  auto& replaced = registry.counter("omnisci_tiered_compilation_replaced_total", "");
+  auto& cache_misses = registry.counter("omnisci_code_cache_misses_total", "");
+  auto executor = Executor::getExecutor(Executor::UNITARY_EXECUTOR_ID);
+  const std::vector<std::string> queries{
+      "SELECT x * 5 + 3, COUNT(*) FROM test WHERE y <> 47 GROUP BY x * 5 + 3 ORDER BY "
+      "x * 5 + 3;",
+      "SELECT SUM(z * 7), MAX(t - 5) FROM test WHERE x < 9;",
+      "SELECT str, y FROM test WHERE z > 100 - x ORDER BY str, y LIMIT 5;"};
+  // The first run uses lightly compiled code.
+  executor->waitForOptimizedCPUCode();
+  const auto light_compilations_before = light_compilations.value();
+  const auto replaced_before = replaced.value();
+  for (const auto& query : queries) {
+    c(query, dt);
+  }
+  const auto light_compiled = light_compilations.value() - light_compilations_before;
+  EXPECT_GT(light_compiled, uint64_t(0));
+  // Once the background compilations are done, the optimized code has replaced every
+  // lightly compiled entry in the code cache and later runs hit it.
+  executor->waitForOptimizedCPUCode();
+  EXPECT_EQ(replaced.value() - replaced_before, light_compiled);
+  const auto cache_misses_before = cache_misses.value();
+  for (const auto& query : queries) {
+    c(query, dt);
+  }
+  EXPECT_EQ(cache_misses.value(), cache_misses_before);
+  EXPECT_EQ(light_compilations.value() - light_compilations_before, light_compiled);
+}
+
+TEST(Select, StringKeyGroupBy) {
+  ScopeGuard reset = [string_key_group_by = g_enable_string_key_group_by] {
+    g_enable_string_key_group_by = string_key_group_by;
+  };
+  g_enable_string_key_group_by = true;
+  for (auto dt : {ExecutorDeviceType::CPU, ExecutorDeviceType::GPU}) {
+    SKIP_NO_GPU();
+    c("SELECT real_str, COUNT(*) FROM test WHERE real_str IS NOT NULL GROUP BY real_str "
+      "ORDER BY real_str;",
+      dt);
+    c("SELECT real_str, x, SUM(y) FROM test WHERE real_str IS NOT NULL GROUP BY "
+      "real_str, x ORDER BY real_str, x;",
+      dt);
+    c("SELECT x, MAX(z), real_str FROM test WHERE real_str IS NOT NULL GROUP BY x, "
+      "real_str ORDER BY x, real_str;",
+      dt);
+    c("SELECT COUNT(*) FROM (SELECT real_str, COUNT(*) AS n FROM test GROUP BY "
+      "real_str) T;",
+      dt);
+  }
+}
+
+TEST(Select, SpilledGroupByReduction) {
+  ScopeGuard reset = [enable_spill = g_enable_spill_to_disk,
+                      spill_threshold = g_spill_threshold_bytes] {
+    g_enable_spill_to_disk = enable_spill;
+    g_spill_threshold_bytes = spill_threshold;
+  };
+  // Spill the reduction of the per-kernel baseline hash group by results.
+  g_enable_spill_to_disk = true;
+  g_spill_threshold_bytes = 1;
+  for (auto dt : {ExecutorDeviceType::CPU, ExecutorDeviceType::GPU}) {
+    SKIP_NO_GPU();
+    c("SELECT t, x, COUNT(*), SUM(y), MIN(d) FROM test GROUP BY t, x ORDER BY t, x;",
+      dt);
+    c("SELECT str, x, AVG(z) FROM test GROUP BY str, x ORDER BY str, x;", dt);
+    c("SELECT COUNT(*) FROM (SELECT t, x, COUNT(*) FROM test GROUP BY t, x) T;", dt);
+  }
+}
+
+TEST(Select, AnalyzeTable) {
+  auto& cat = QR::get()->getSession()->getCatalog();
+  const auto test_td = cat.getMetadataForTable("test");
+  const auto test_inner_td = cat.getMetadataForTable("test_inner");
+  CHECK(test_td && test_inner_td);
+  ScopeGuard remove_statistics = [&cat, test_td, test_inner_td] {
+    cat.removeTableStatistics(test_td->tableId);
+    cat.removeTableStatistics(test_inner_td->tableId);
+  };
+  run_ddl_statement("ANALYZE TABLE test;");
+  run_ddl_statement("ANALYZE TABLE test_inner;");
+
+  const auto x_cd = cat.getMetadataForColumn(test_td->tableId, "x");
+  const auto x_stats = cat.getColumnStatistics(test_td->tableId, x_cd->columnId);
+  ASSERT_TRUE(x_stats);
+  EXPECT_EQ(v<int64_t>(run_simple_agg("SELECT COUNT(*) FROM test;",
+                                      ExecutorDeviceType::CPU)),
+            x_stats->getRowCount());
+  EXPECT_EQ(int64_t(0), x_stats->getNullCount());
+  EXPECT_NEAR(v<int64_t>(run_simple_agg("SELECT COUNT(DISTINCT x) FROM test;",
+                                        ExecutorDeviceType::CPU)),
+              x_stats->getDistinctCount(),
+              1);
+  EXPECT_EQ(Catalog_Namespace::ColumnStatistics::kHistogramBucketCount + 1,
+            x_stats->getHistogram().size());
+  // range selectivities come from the histogram
+  const auto x_lt_fraction =
+      static_cast<double>(v<int64_t>(run_simple_agg(
+          "SELECT COUNT(*) FROM test WHERE x < 8;", ExecutorDeviceType::CPU))) /
+      x_stats->getRowCount();
+  ASSERT_TRUE(x_stats->getSelectivity(kLT, 8));
+  EXPECT_NEAR(x_lt_fraction,
+              *x_stats->getSelectivity(kLT, 8),
+              2. / Catalog_Namespace::ColumnStatistics::kHistogramBucketCount);
+  EXPECT_EQ(0., *x_stats->getSelectivity(kLT, x_stats->getHistogram().front()));
+  EXPECT_EQ(1., *x_stats->getSelectivity(kLE, x_stats->getHistogram().back() + 1));
+
+  for (auto dt : {ExecutorDeviceType::CPU, ExecutorDeviceType::GPU}) {
+    SKIP_NO_GPU();
+    c("SELECT COUNT(*) FROM test, test_inner WHERE test.x = test_inner.x;", dt);
+    c("SELECT test.x, COUNT(*) FROM test, test_inner WHERE test.x = test_inner.x GROUP "
+      "BY test.x ORDER BY test.x;",
+      dt);
+    c("SELECT x, y, COUNT(*) FROM test GROUP BY x, y ORDER BY x, y;", dt);
+    c("SELECT x, y, COUNT(*) FROM test WHERE y > 41 GROUP BY x, y ORDER BY x, y;", dt);
+    c("SELECT x, y, COUNT(*) FROM test WHERE x < 8 AND y >= 42 GROUP BY x, y ORDER BY "
+      "x, y;",
+      dt);
+    c("SELECT str, COUNT(*) FROM test GROUP BY str ORDER BY str;", dt);
+  }
+
+  // Inserts keep the statistics of an analyzed table up to date.
+  run_ddl_statement("DROP TABLE IF EXISTS analyze_test;");
+  run_ddl_statement(
+      "CREATE TABLE analyze_test (k INT, s TEXT, n TEXT ENCODING NONE);");
+  ScopeGuard drop_table = [] { run_ddl_statement("DROP TABLE IF EXISTS analyze_test;"); };
+  run_multiple_agg("INSERT INTO analyze_test VALUES (1, 'a', '');",
+                   ExecutorDeviceType::CPU);
+  run_ddl_statement("ANALYZE TABLE analyze_test;");
+  run_multiple_agg("INSERT INTO analyze_test VALUES (2, NULL, 'b');",
+                   ExecutorDeviceType::CPU);
+  const auto td = cat.getMetadataForTable("analyze_test");
+  const auto s_cd = cat.getMetadataForColumn(td->tableId, "s");
+  const auto s_stats = cat.getColumnStatistics(td->tableId, s_cd->columnId);
+  ASSERT_TRUE(s_stats);
+  EXPECT_EQ(int64_t(2), s_stats->getRowCount());
+  EXPECT_EQ(int64_t(1), s_stats->getNullCount());
+  EXPECT_EQ(size_t(1), s_stats->getDistinctCount());
+  EXPECT_TRUE(s_stats->getHistogram().empty());
+  EXPECT_FALSE(s_stats->getSelectivity(kLT, 0));
+  // empty none encoded strings are values, not nulls
+  const auto n_cd = cat.getMetadataForColumn(td->tableId, "n");
+  const auto n_stats = cat.getColumnStatistics(td->tableId, n_cd->columnId);
+  ASSERT_TRUE(n_stats);
+  EXPECT_EQ(int64_t(2), n_stats->getRowCount());
+  EXPECT_EQ(int64_t(0), n_stats->getNullCount());
+  EXPECT_EQ(size_t(2), n_stats->getDistinctCount());
+}
+
 TEST(Select, GroupByBoundariesAndNull) {
   for (auto dt : {ExecutorDeviceType::CPU, ExecutorDeviceType::GPU}) {
     SKIP_NO_GPU();
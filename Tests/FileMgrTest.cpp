@@ -184,6 +184,37 @@ TEST_F(FileMgrTest, putBuffer_append) {
   compareBuffersAndMetadata(&source_buffer, file_buffer);
 }
 
+TEST_F(FileMgrTest, putBuffer_updated_ranges) {
+  TestHelpers::TestBuffer source_buffer{std::vector<int32_t>{1}};
+  std::vector<int32_t> data_v1 = {1, 2, 3, 5, 7};
+  appendData(&source_buffer, data_v1);
+  auto file_mgr = getFileMgr();
+  file_mgr->putBuffer(TEST_CHUNK_KEY, &source_buffer, 24);
+  file_mgr->checkpoint();
+
+  auto source_data = reinterpret_cast<int32_t*>(source_buffer.getMemoryPtr());
+  source_data[1] = 11;
+  source_data[2] = 13;
+  source_data[5] = 17;
+  source_buffer.setUpdated(4, 4);
+  source_buffer.setUpdated(20, 4);
+  source_buffer.setUpdated(8, 4);
+  ASSERT_TRUE(source_buffer.isUpdated());
+  ASSERT_EQ(source_buffer.getUpdatedRanges(),
+            (std::map<size_t, size_t>{{4, 12}, {20, 24}}));
+  AbstractBuffer* file_buffer = file_mgr->putBuffer(TEST_CHUNK_KEY, &source_buffer, 24);
+  ASSERT_TRUE(source_buffer.getUpdatedRanges().empty());
+  ASSERT_FALSE(source_buffer.isDirty());
+  file_mgr->checkpoint();
+  compareBuffers(&source_buffer, file_buffer, 24);
+
+  source_buffer.setUpdated(0, 4);
+  source_buffer.setUpdated();
+  source_buffer.setUpdated(8, 4);
+  ASSERT_TRUE(source_buffer.isUpdated());
+  ASSERT_TRUE(source_buffer.getUpdatedRanges().empty());
+}
+
 TEST_F(FileMgrTest, put_checkpoint_get) {
   TestHelpers::TestBuffer source_buffer{std::vector<int32_t>{1}};
   std::vector<int32_t> data_v1 = {1, 2, 3, 5, 7};
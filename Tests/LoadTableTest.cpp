@@ -20,20 +20,28 @@
 #include <arrow/ipc/writer.h>
 #include <gtest/gtest.h>
 #include <boost/filesystem.hpp>
+#include <fstream>
 
 #ifdef HAVE_AWS_S3
 #include "AwsHelpers.h"
 #include "DataMgr/OmniSciAwsSdk.h"
 #include "Shared/ThriftTypesConvert.h"
 #endif  // HAVE_AWS_S3
+#include "Fragmenter/InsertWriteAheadLog.h"
+#include "ImportExport/Importer.h"
 #include "Shared/ArrowUtil.h"
+#include "Shared/scope.h"
 #include "Tests/DBHandlerTestHelpers.h"
 #include "Tests/TestHelpers.h"
+#include "ThriftHandler/IngestStreamManager.h"
 
 #ifndef BASE_PATH
 #define BASE_PATH "./tmp"
 #endif
 
+extern bool g_enable_insert_wal;
+extern size_t g_insert_wal_checkpoint_interval_ms;
+
 class LoadTableTest : public DBHandlerTestFixture {
  protected:
   void SetUp() override {
@@ -664,6 +672,200 @@ TEST_F(LoadTableTest, ArrowDefaultStr) {
   sqlAndCompareResult("SELECT * FROM load_test", {{i(1), "default str", "nns"}});
 }
 
+TEST_F(LoadTableTest, IngestStreamColumnar) {
+  auto* handler = getDbHandlerAndSessionId().first;
+  auto& session = getDbHandlerAndSessionId().second;
+  TIngestStreamParams params;
+  params.commit_interval_ms = 3600 * 1000;
+  auto stream_id = handler->create_ingest_stream(session, "load_test", params);
+  handler->push_ingest_stream_columnar(
+      session, stream_id, {i1_column, s_column, nns_column});
+  i1_column.data.int_col = {2};
+  handler->push_ingest_stream_columnar(
+      session, stream_id, {i1_column, s_column, nns_column});
+  // the rows are buffered until they fill a fragment or the stream commits
+  sqlAndCompareResult("SELECT COUNT(*) FROM load_test", {{i(0)}});
+  EXPECT_EQ(handler->close_ingest_stream(session, stream_id), 2);
+  sqlAndCompareResult("SELECT * FROM load_test ORDER BY i1",
+                      {{i(1), "s", "nns"}, {i(2), "s", "nns"}});
+}
+
+TEST_F(LoadTableTest, IngestStreamArrowSomeColumns) {
+  auto* handler = getDbHandlerAndSessionId().first;
+  auto& session = getDbHandlerAndSessionId().second;
+  TIngestStreamParams params;
+  params.column_names = {"nns", "i1"};
+  auto stream_id = handler->create_ingest_stream(session, "load_test", params);
+  ArrowStreamBuilder builder(arrow::schema({nns_field, i1_field}));
+  builder.appendString({"nns", "nns"});
+  builder.appendInt32({1, 2});
+  handler->push_ingest_stream_arrow(session, stream_id, builder.finish());
+  EXPECT_EQ(handler->close_ingest_stream(session, stream_id), 2);
+  sqlAndCompareResult("SELECT * FROM load_test ORDER BY i1",
+                      {{i(1), "default str", "nns"}, {i(2), "default str", "nns"}});
+}
+
+TEST_F(LoadTableTest, IngestStreamFileSource) {
+  auto* handler = getDbHandlerAndSessionId().first;
+  auto& session = getDbHandlerAndSessionId().second;
+  const auto source_path =
+      boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("ingest_stream_%%%%_%%%%.csv");
+  {
+    std::ofstream source(source_path.string());
+    source << "i1,s,nns\n1,s,nns\n2,\\N,nns\n";
+  }
+  TIngestStreamParams params;
+  params.source_path = source_path.string();
+  params.source_copy_params.has_header = TImportHeaderRow::HAS_HEADER;
+  auto stream_id = handler->create_ingest_stream(session, "load_test", params);
+  EXPECT_EQ(handler->close_ingest_stream(session, stream_id), 2);
+  boost::filesystem::remove(source_path);
+  sqlAndCompareResult("SELECT * FROM load_test ORDER BY i1",
+                      {{i(1), "s", "nns"}, {i(2), Null, "nns"}});
+}
+
+TEST_F(LoadTableTest, IngestStreamColumnCountMismatch) {
+  auto* handler = getDbHandlerAndSessionId().first;
+  auto& session = getDbHandlerAndSessionId().second;
+  auto stream_id = handler->create_ingest_stream(session, "load_test", {});
+  executeLambdaAndAssertPartialException(
+      [&]() { handler->push_ingest_stream_columnar(session, stream_id, {i1_column}); },
+      "Number of columns pushed (1) does not match number of columns of ingest stream");
+  EXPECT_EQ(handler->close_ingest_stream(session, stream_id), 0);
+  executeLambdaAndAssertPartialException(
+      [&]() { handler->close_ingest_stream(session, stream_id); }, "does not exist");
+}
+
+namespace {
+
+// Inserts every batch, then fails the batches loaded while fail is set, as a load
+// rejecting a row after the preceding ones were inserted does.
+class FailingLoader : public import_export::Loader {
+ public:
+  FailingLoader(Catalog_Namespace::Catalog& catalog, const TableDescriptor* td)
+      : import_export::Loader(catalog, td) {}
+
+  bool loadNoCheckpoint(
+      const std::vector<std::unique_ptr<import_export::TypedImportBuffer>>&
+          import_buffers,
+      const size_t row_count,
+      const Catalog_Namespace::SessionInfo* session_info) override {
+    if (!import_export::Loader::loadNoCheckpoint(
+            import_buffers, row_count, session_info)) {
+      return false;
+    }
+    if (fail) {
+      throw std::runtime_error("Injected load failure");
+    }
+    return true;
+  }
+
+  bool fail{false};
+};
+
+void push_rows(IngestStream& stream,
+               const FailingLoader& loader,
+               const std::vector<int>& values) {
+  ImportBuffers import_buffers;
+  for (const auto cd : loader.get_column_descs()) {
+    import_buffers.emplace_back(
+        std::make_unique<import_export::TypedImportBuffer>(cd, loader.getStringDict(cd)));
+    for (const auto value : values) {
+      const auto str = cd->columnName == "i1" ? std::to_string(value) : cd->columnName;
+      import_buffers.back()->add_value(cd, str, false, import_export::CopyParams{});
+    }
+  }
+  stream.append(import_buffers, values.size());
+}
+
+}  // namespace
+
+TEST_F(LoadTableTest, IngestStreamRollsBackFailedLoad) {
+  auto* handler = getDbHandlerAndSessionId().first;
+  auto& session = getDbHandlerAndSessionId().second;
+  auto& catalog = getCatalog();
+  const auto td = catalog.getMetadataForTable("load_test");
+  ASSERT_TRUE(td);
+  auto loader = std::make_unique<FailingLoader>(catalog, td);
+  auto failing_loader = loader.get();
+  IngestStream stream(0,
+                      handler->get_session_copy_ptr(session),
+                      std::move(loader),
+                      {},
+                      3,
+                      std::chrono::milliseconds(3600 * 1000));
+
+  push_rows(stream, *failing_loader, {1});
+  stream.flush(true);
+  push_rows(stream, *failing_loader, {2});
+  stream.flush(false);
+  // the load of the third and fourth row fails after inserting them
+  push_rows(stream, *failing_loader, {3, 4});
+  failing_loader->fail = true;
+  executeLambdaAndAssertPartialException([&]() { stream.flush(false); },
+                                         "Injected load failure");
+  sqlAndCompareResult("SELECT i1 FROM load_test ORDER BY i1", {{i(1)}});
+
+  // the next commit does not checkpoint the rolled back rows
+  failing_loader->fail = false;
+  push_rows(stream, *failing_loader, {5});
+  stream.flush(true);
+  EXPECT_EQ(stream.getCommittedRowCount(), 2);
+  sqlAndCompareResult("SELECT i1, s, nns FROM load_test ORDER BY i1",
+                      {{i(1), "s", "nns"}, {i(5), "s", "nns"}});
+}
+
+TEST_F(LoadTableTest, RollbackKeepsLoggedInserts) {
+  auto& insert_wal = Fragmenter_Namespace::InsertWriteAheadLog::instance();
+  ScopeGuard reset = [enable_insert_wal = g_enable_insert_wal,
+                      checkpoint_interval_ms = g_insert_wal_checkpoint_interval_ms,
+                      &insert_wal] {
+    insert_wal.stop();
+    g_enable_insert_wal = enable_insert_wal;
+    g_insert_wal_checkpoint_interval_ms = checkpoint_interval_ms;
+  };
+  g_enable_insert_wal = true;
+  // only the explicit checkpoint below may advance the epoch
+  g_insert_wal_checkpoint_interval_ms = 3600 * 1000;
+  insert_wal.start(std::string(BASE_PATH) + "/mapd_insert_wal_test");
+  auto* handler = getDbHandlerAndSessionId().first;
+  auto& session = getDbHandlerAndSessionId().second;
+  auto& catalog = getCatalog();
+  const auto td = catalog.getMetadataForTable("load_test");
+  ASSERT_TRUE(td);
+  const auto epoch = catalog.getTableEpoch(catalog.getDatabaseId(), td->tableId);
+
+  // The insert is acknowledged once it is logged, without a checkpoint.
+  sql("INSERT INTO load_test VALUES(1, 's', 'nns');");
+  EXPECT_EQ(epoch, catalog.getTableEpoch(catalog.getDatabaseId(), td->tableId));
+
+  // A failed load rolls the table back to its checkpointed epoch, which does not
+  // lose the logged row.
+  auto loader = std::make_unique<FailingLoader>(catalog, td);
+  auto failing_loader = loader.get();
+  IngestStream stream(0,
+                      handler->get_session_copy_ptr(session),
+                      std::move(loader),
+                      {},
+                      3,
+                      std::chrono::milliseconds(3600 * 1000));
+  push_rows(stream, *failing_loader, {2});
+  failing_loader->fail = true;
+  executeLambdaAndAssertPartialException([&]() { stream.flush(false); },
+                                         "Injected load failure");
+  sqlAndCompareResult("SELECT i1, s, nns FROM load_test ORDER BY i1",
+                      {{i(1), "s", "nns"}});
+
+  // The checkpoint of the log, which removes its record, persists the row.
+  insert_wal.checkpoint();
+  EXPECT_LT(epoch, catalog.getTableEpoch(catalog.getDatabaseId(), td->tableId));
+  catalog.setTableEpochs(catalog.getDatabaseId(),
+                         catalog.getTableEpochs(catalog.getDatabaseId(), td->tableId));
+  sqlAndCompareResult("SELECT i1, s, nns FROM load_test ORDER BY i1",
+                      {{i(1), "s", "nns"}});
+}
+
 class ImportGeoTableTest : public DBHandlerTestFixture {
  protected:
   void SetUp() override {
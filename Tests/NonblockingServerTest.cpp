@@ -0,0 +1,187 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file NonblockingServerTest.cpp
+ * @brief Test suite for the overload handling of the nonblocking binary protocol server.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thrift/TProcessor.h>
+#include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/server/TServer.h>
+#include <thrift/transport/TBufferTransports.h>
+#include <thrift/transport/TSocket.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+
+#include "Logger/Logger.h"
+#include "TestHelpers.h"
+#include "ThriftHandler/NonblockingServer.h"
+
+using namespace apache::thrift;
+using namespace apache::thrift::protocol;
+using namespace apache::thrift::server;
+using namespace apache::thrift::transport;
+
+namespace {
+
+// Answers every call with an empty reply once the requests are released.
+class BlockingProcessor : public TProcessor {
+ public:
+  BlockingProcessor() : released_(release_.get_future().share()) {}
+
+  bool process(std::shared_ptr<TProtocol> in,
+               std::shared_ptr<TProtocol> out,
+               void* connection_context) override {
+    ++num_started_requests_;
+    released_.wait();
+    std::string name;
+    TMessageType type;
+    int32_t seqid;
+    in->readMessageBegin(name, type, seqid);
+    in->skip(T_STRUCT);
+    in->readMessageEnd();
+    in->getTransport()->readEnd();
+    out->writeMessageBegin(name, T_REPLY, seqid);
+    out->writeStructBegin("reply");
+    out->writeFieldStop();
+    out->writeStructEnd();
+    out->writeMessageEnd();
+    out->getTransport()->writeEnd();
+    out->getTransport()->flush();
+    return true;
+  }
+
+  size_t getNumStartedRequests() const { return num_started_requests_; }
+
+  void release() { release_.set_value(); }
+
+ private:
+  std::promise<void> release_;
+  std::shared_future<void> released_;
+  std::atomic<size_t> num_started_requests_{0};
+};
+
+class ServeEventHandler : public TServerEventHandler {
+ public:
+  void preServe() override { serving_.set_value(); }
+
+  std::future<void> getServing() { return serving_.get_future(); }
+
+ private:
+  std::promise<void> serving_;
+};
+
+class Client {
+ public:
+  explicit Client(const int port) {
+    auto socket = std::make_shared<TSocket>("localhost", port);
+    socket->setRecvTimeout(10000);
+    transport_ = std::make_shared<TFramedTransport>(socket);
+    protocol_ = std::make_shared<TBinaryProtocol>(transport_);
+    transport_->open();
+  }
+
+  void sendCall() {
+    protocol_->writeMessageBegin("call", T_CALL, 0);
+    protocol_->writeStructBegin("args");
+    protocol_->writeFieldStop();
+    protocol_->writeStructEnd();
+    protocol_->writeMessageEnd();
+    transport_->writeEnd();
+    transport_->flush();
+  }
+
+  void receiveReply() {
+    std::string name;
+    TMessageType type;
+    int32_t seqid;
+    protocol_->readMessageBegin(name, type, seqid);
+    EXPECT_EQ(type, T_REPLY);
+    protocol_->skip(T_STRUCT);
+    protocol_->readMessageEnd();
+    transport_->readEnd();
+  }
+
+ private:
+  std::shared_ptr<TTransport> transport_;
+  std::shared_ptr<TProtocol> protocol_;
+};
+
+}  // namespace
+
+TEST(NonblockingServer, ClosesConnectionsWhenOverloaded) {
+  auto processor = std::make_shared<BlockingProcessor>();
+  // Two workers execute requests, but only one request may be active at a time.
+  auto server = create_nonblocking_server(
+      processor, std::make_shared<TBinaryProtocolFactory>(), 0, 1, 2, 1);
+  auto event_handler = std::make_shared<ServeEventHandler>();
+  auto serving = event_handler->getServing();
+  server->setServerEventHandler(event_handler);
+  std::thread server_thread([&server] { server->serve(); });
+  serving.wait();
+  const auto port = server->getListenPort();
+
+  Client first_client(port);
+  Client second_client(port);
+  first_client.sendCall();
+  second_client.sendCall();
+  while (processor->getNumStartedRequests() < 2) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  // both workers are busy, so the connection of a third client is closed on accept
+  Client overload_client(port);
+  EXPECT_THROW(
+      {
+        overload_client.sendCall();
+        overload_client.receiveReply();
+      },
+      TTransportException);
+  EXPECT_EQ(server->getNumTotalConnectionsDropped(), uint64_t(1));
+
+  processor->release();
+  first_client.receiveReply();
+  second_client.receiveReply();
+
+  // the server accepts connections again once the requests completed
+  Client next_client(port);
+  next_client.sendCall();
+  next_client.receiveReply();
+  EXPECT_EQ(server->getNumTotalConnectionsDropped(), uint64_t(1));
+
+  server->stop();
+  server_thread.join();
+}
+
+int main(int argc, char* argv[]) {
+  TestHelpers::init_logger_stderr_only(argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+
+  int err{0};
+  try {
+    err = RUN_ALL_TESTS();
+  } catch (const std::exception& e) {
+    LOG(ERROR) << e.what();
+  }
+  return err;
+}
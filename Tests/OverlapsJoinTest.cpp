@@ -18,8 +18,10 @@
 
 #include <fmt/core.h>
 #include <gtest/gtest.h>
+#include <cmath>
 #include <functional>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 #include "QueryEngine/ArrowResultSet.h"
@@ -31,6 +33,9 @@
 #define BASE_PATH "./tmp"
 #endif
 
+extern bool g_enable_polygon_edge_index;
+extern size_t g_polygon_edge_index_min_vertices;
+
 using QR = QueryRunner::QueryRunner;
 using namespace TestHelpers;
 
@@ -485,6 +490,72 @@ TEST_F(OverlapsTest, JoinPolyCentroidContains) {
   });
 }
 
+TEST_F(OverlapsTest, JoinPolyPointContainsEdgeIndex) {
+  const auto enable_polygon_edge_index_state = g_enable_polygon_edge_index;
+  const auto polygon_edge_index_min_vertices_state = g_polygon_edge_index_min_vertices;
+  ScopeGuard reset_polygon_edge_index_state = [&enable_polygon_edge_index_state,
+                                               &polygon_edge_index_min_vertices_state] {
+    g_enable_polygon_edge_index = enable_polygon_edge_index_state;
+    g_polygon_edge_index_min_vertices = polygon_edge_index_min_vertices_state;
+  };
+  g_polygon_edge_index_min_vertices = 0;
+
+  QR::get()->runDDLStatement("DROP TABLE IF EXISTS edge_index_polys;");
+  QR::get()->runDDLStatement("DROP TABLE IF EXISTS edge_index_pts;");
+  QR::get()->runDDLStatement(
+      "CREATE TABLE edge_index_polys (id INT, poly GEOMETRY(POLYGON, 4326), poly_nc "
+      "GEOMETRY(POLYGON, 4326) ENCODING NONE, mpoly GEOMETRY(MULTIPOLYGON, 4326));");
+  QR::get()->runDDLStatement(
+      "CREATE TABLE edge_index_pts (id INT, pt GEOMETRY(POINT, 4326));");
+  // a star with a square hole and a circle, with enough edges to use several bands
+  auto ring = [](const double cx, const double cy, const int n, const bool star) {
+    std::ostringstream oss;
+    for (int i = 0; i <= n; ++i) {
+      const double angle = 2 * M_PI * (i % n) / n;
+      const double r = star && i % 2 ? 4 : 9;
+      oss << (i ? "," : "") << cx + r * std::cos(angle) << " "
+          << cy + r * std::sin(angle);
+    }
+    return "(" + oss.str() + ")";
+  };
+  const auto star = ring(10, 10, 128, true) + ",(8 8,8 12,12 12,12 8,8 8)";
+  const auto circle = ring(20, 12, 96, false);
+  for (const auto& [id, poly] : {std::make_pair(0, star), std::make_pair(1, circle)}) {
+    QR::get()->runSQL("INSERT INTO edge_index_polys VALUES (" + std::to_string(id) +
+                          ", 'POLYGON(" + poly + ")', 'POLYGON(" + poly +
+                          ")', 'MULTIPOLYGON((" + star + "),(" + circle + "))');",
+                      ExecutorDeviceType::CPU);
+  }
+  int id = 0;
+  for (int i = 0; i < 16; ++i) {
+    for (int j = 0; j < 12; ++j) {
+      QR::get()->runSQL("INSERT INTO edge_index_pts VALUES (" + std::to_string(id++) +
+                            ", 'POINT(" + std::to_string(i * 2) + " " +
+                            std::to_string(j * 2) + ")');",
+                        ExecutorDeviceType::CPU);
+    }
+  }
+
+  executeAllScenarios([](const ExecutionContext ctx) -> void {
+    for (const auto col : {"poly", "poly_nc", "mpoly"}) {
+      const auto sql = fmt::format(
+          "SELECT count(*) FROM edge_index_pts AS b JOIN edge_index_polys AS a ON "
+          "ST_Contains(a.{}, b.pt);",
+          col);
+      // the index is only built with the hash table while it is enabled, so the indexed
+      // query runs first, before its hash table is cached
+      g_enable_polygon_edge_index = true;
+      const auto indexed_count = v<int64_t>(execSQL(sql, ctx.device_type));
+      EXPECT_GT(indexed_count, 0);
+      g_enable_polygon_edge_index = false;
+      EXPECT_EQ(v<int64_t>(execSQL(sql, ctx.device_type)), indexed_count) << sql;
+    }
+  });
+
+  QR::get()->runDDLStatement("DROP TABLE IF EXISTS edge_index_polys;");
+  QR::get()->runDDLStatement("DROP TABLE IF EXISTS edge_index_pts;");
+}
+
 TEST_F(OverlapsTest, PolyPolyDoesNotIntersect) {
   executeAllScenarios([](const ExecutionContext ctx) -> void {
     ASSERT_EQ(static_cast<int64_t>(0),
@@ -0,0 +1,189 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file QueryDispatchQueueTest.cpp
+ * @brief Test suite for priority, fair share and memory aware query dispatching
+ */
+
+#include <gtest/gtest.h>
+
+#include "QueryEngine/QueryDispatchQueue.h"
+#include "TestHelpers.h"
+
+namespace {
+using Priority = QueryDispatchQueue::Priority;
+
+class QueryDispatchQueueTest : public ::testing::Test {
+ protected:
+  void SetUp() override { blocker_released_ = blocker_promise_.get_future().share(); }
+
+  std::shared_ptr<QueryDispatchQueue::Task> createBlockerTask() {
+    auto blocker_started = std::make_shared<std::promise<void>>();
+    blocker_started_ = blocker_started->get_future();
+    return std::make_shared<QueryDispatchQueue::Task>(
+        [blocker_started, released = blocker_released_](const size_t) {
+          blocker_started->set_value();
+          released.wait();
+        });
+  }
+
+  std::shared_ptr<QueryDispatchQueue::Task> createRecordingTask(const std::string& name) {
+    return std::make_shared<QueryDispatchQueue::Task>([this, name](const size_t) {
+      std::lock_guard<std::mutex> lock(order_mutex_);
+      execution_order_.emplace_back(name);
+    });
+  }
+
+  using NamedTaskInfos = std::vector<std::pair<std::string, QueryDispatchQueue::TaskInfo>>;
+
+  void submitAndWait(QueryDispatchQueue& dispatch_queue, const NamedTaskInfos& tasks) {
+    auto blocker = createBlockerTask();
+    dispatch_queue.submit(blocker, false);
+    blocker_started_.wait();
+    std::vector<std::shared_ptr<QueryDispatchQueue::Task>> submitted_tasks;
+    for (const auto& [name, task_info] : tasks) {
+      submitted_tasks.emplace_back(createRecordingTask(name));
+      dispatch_queue.submit(submitted_tasks.back(), false, task_info);
+    }
+    blocker_promise_.set_value();
+    blocker->get_future().get();
+    for (auto& task : submitted_tasks) {
+      task->get_future().get();
+    }
+  }
+
+  std::promise<void> blocker_promise_;
+  std::shared_future<void> blocker_released_;
+  std::future<void> blocker_started_;
+  std::mutex order_mutex_;
+  std::vector<std::string> execution_order_;
+};
+
+TEST_F(QueryDispatchQueueTest, HighPriorityGetsLargerShare) {
+  QueryDispatchQueue dispatch_queue(1);
+  NamedTaskInfos tasks;
+  for (size_t i = 0; i < 4; i++) {
+    tasks.push_back({"low", {Priority::LOW, "", 0}});
+  }
+  for (size_t i = 0; i < 4; i++) {
+    tasks.push_back({"high", {Priority::HIGH, "", 0}});
+  }
+  submitAndWait(dispatch_queue, tasks);
+
+  ASSERT_EQ(execution_order_.size(), size_t(8));
+  EXPECT_EQ(execution_order_.front(), "high");
+  EXPECT_EQ(std::count(execution_order_.begin(), execution_order_.begin() + 5, "high"),
+            4);
+}
+
+TEST_F(QueryDispatchQueueTest, RoundRobinAcrossFairShareKeys) {
+  QueryDispatchQueue dispatch_queue(1);
+  submitAndWait(dispatch_queue,
+                {{"a1", {Priority::NORMAL, "user_a", 0}},
+                 {"a2", {Priority::NORMAL, "user_a", 0}},
+                 {"a3", {Priority::NORMAL, "user_a", 0}},
+                 {"b1", {Priority::NORMAL, "user_b", 0}}});
+
+  std::vector<std::string> expected_order{"a1", "b1", "a2", "a3"};
+  EXPECT_EQ(execution_order_, expected_order);
+}
+
+TEST_F(QueryDispatchQueueTest, DefersQueriesWhichDoNotFitInMemory) {
+  QueryDispatchQueue dispatch_queue(2);
+  dispatch_queue.setAvailableMemoryCallback([]() -> size_t { return 100; });
+
+  std::promise<void> large_task_release;
+  auto large_task_released = large_task_release.get_future().share();
+  std::promise<void> large_task_started;
+  auto large_task = std::make_shared<QueryDispatchQueue::Task>(
+      [&large_task_started, large_task_released](const size_t) {
+        large_task_started.set_value();
+        large_task_released.wait();
+      });
+  dispatch_queue.submit(large_task, false, {Priority::NORMAL, "user_a", 80});
+  large_task_started.get_future().wait();
+
+  auto medium_task = createRecordingTask("medium");
+  dispatch_queue.submit(medium_task, false, {Priority::NORMAL, "user_b", 50});
+  auto small_task = createRecordingTask("small");
+  dispatch_queue.submit(small_task, false, {Priority::NORMAL, "user_c", 10});
+  small_task->get_future().get();
+
+  {
+    std::lock_guard<std::mutex> lock(order_mutex_);
+    EXPECT_EQ(execution_order_, std::vector<std::string>{"small"});
+  }
+  const auto stats = dispatch_queue.getQueueStats();
+  const auto& normal_stats = stats[static_cast<size_t>(Priority::NORMAL)];
+  EXPECT_EQ(normal_stats.queued_count, size_t(1));
+  EXPECT_EQ(normal_stats.memory_deferred_count, size_t(1));
+
+  large_task_release.set_value();
+  large_task->get_future().get();
+  medium_task->get_future().get();
+  std::vector<std::string> expected_order{"small", "medium"};
+  EXPECT_EQ(execution_order_, expected_order);
+}
+
+TEST_F(QueryDispatchQueueTest, QueueStats) {
+  QueryDispatchQueue dispatch_queue(1);
+  submitAndWait(dispatch_queue,
+                {{"high", {Priority::HIGH, "", 0}}, {"low", {Priority::LOW, "", 0}}});
+
+  const auto stats = dispatch_queue.getQueueStats();
+  ASSERT_EQ(stats.size(), QueryDispatchQueue::NUM_PRIORITIES);
+  for (const auto& priority_stats : stats) {
+    EXPECT_EQ(priority_stats.queued_count, size_t(0));
+    EXPECT_GE(priority_stats.max_wait_time_ms, 0);
+  }
+  EXPECT_EQ(stats[static_cast<size_t>(Priority::HIGH)].dispatched_count, size_t(1));
+  EXPECT_EQ(stats[static_cast<size_t>(Priority::NORMAL)].dispatched_count, size_t(1));
+  EXPECT_EQ(stats[static_cast<size_t>(Priority::LOW)].dispatched_count, size_t(1));
+
+  const auto global_stats = QueryDispatchQueue::getGlobalQueueStats();
+  ASSERT_EQ(global_stats.size(), QueryDispatchQueue::NUM_PRIORITIES);
+  EXPECT_GE(global_stats[static_cast<size_t>(Priority::HIGH)].dispatched_count,
+            size_t(1));
+}
+
+TEST_F(QueryDispatchQueueTest, UserPriority) {
+  QueryDispatchQueue dispatch_queue(1);
+  EXPECT_EQ(dispatch_queue.getUserPriority("analyst"), Priority::NORMAL);
+  dispatch_queue.setUserPriority("analyst", Priority::LOW);
+  EXPECT_EQ(dispatch_queue.getUserPriority("analyst"), Priority::LOW);
+}
+
+TEST_F(QueryDispatchQueueTest, MemoryEstimates) {
+  QueryDispatchQueue dispatch_queue(1);
+  EXPECT_EQ(dispatch_queue.getMemoryEstimate(42), size_t(0));
+  dispatch_queue.recordMemoryEstimate(42, 1024);
+  EXPECT_EQ(dispatch_queue.getMemoryEstimate(42), size_t(1024));
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  TestHelpers::init_logger_stderr_only(argc, argv);
+  testing::InitGoogleTest(&argc, argv);
+
+  int err{0};
+  try {
+    err = RUN_ALL_TESTS();
+  } catch (const std::exception& e) {
+    LOG(ERROR) << e.what();
+  }
+  return err;
+}
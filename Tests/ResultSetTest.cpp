@@ -29,6 +29,7 @@
 #include "QueryEngine/ResultSetReductionJIT.h"
 #include "QueryEngine/RuntimeFunctions.h"
 #include "QueryRunner/QueryRunner.h"
+#include "Shared/scope.h"
 #include "StringDictionary/StringDictionary.h"
 #include "Tests/TestHelpers.h"
 
@@ -1847,6 +1848,60 @@ TEST(Reduce, BaselineHashColumnar) {
   test_reduce(target_infos, query_mem_desc, generator1, generator2, 1, true);
 }
 
+TEST(Reduce, BaselineHashSpill) {
+  ScopeGuard reset = [enable_spill = g_enable_spill_to_disk,
+                      spill_threshold = g_spill_threshold_bytes] {
+    g_enable_spill_to_disk = enable_spill;
+    g_spill_threshold_bytes = spill_threshold;
+  };
+  g_enable_spill_to_disk = true;
+  g_spill_threshold_bytes = 1;
+  const auto target_infos = generate_test_target_infos();
+  const auto query_mem_desc = baseline_hash_two_col_desc(target_infos, 8);
+  EvenNumberGenerator generator1;
+  ReverseOddOrEvenNumberGenerator generator2(2 * query_mem_desc.getEntryCount() - 1);
+  test_reduce(target_infos, query_mem_desc, generator1, generator2, 1, true);
+}
+
+TEST(Reduce, BaselineHashSpillReleasesInputs) {
+  ScopeGuard reset = [enable_spill = g_enable_spill_to_disk,
+                      spill_threshold = g_spill_threshold_bytes] {
+    g_enable_spill_to_disk = enable_spill;
+    g_spill_threshold_bytes = spill_threshold;
+  };
+  g_enable_spill_to_disk = true;
+  g_spill_threshold_bytes = 1;
+  const auto target_infos = generate_test_target_infos();
+  const auto query_mem_desc = baseline_hash_two_col_desc(target_infos, 8);
+  const auto row_set_mem_owner =
+      std::make_shared<RowSetMemoryOwner>(Executor::getArenaBlockSize());
+  row_set_mem_owner->addStringDict(g_sd, 1, g_sd->storageEntryCount());
+  EvenNumberGenerator generator1;
+  ReverseOddOrEvenNumberGenerator generator2(2 * query_mem_desc.getEntryCount() - 1);
+  std::vector<std::unique_ptr<ResultSet>> result_sets;
+  for (auto generator : std::vector<NumberGenerator*>{&generator1, &generator2}) {
+    result_sets.push_back(std::make_unique<ResultSet>(target_infos,
+                                                      ExecutorDeviceType::CPU,
+                                                      query_mem_desc,
+                                                      row_set_mem_owner,
+                                                      nullptr,
+                                                      0,
+                                                      0));
+    const auto storage = result_sets.back()->allocateStorage();
+    fill_storage_buffer(
+        storage->getUnderlyingBuffer(), target_infos, query_mem_desc, *generator, 1);
+  }
+  ResultSetManager rs_manager;
+  std::vector<ResultSet*> storage_set{result_sets[0].get(), result_sets[1].get()};
+  const auto result_rs = rs_manager.reduce(storage_set);
+  ASSERT_TRUE(result_rs->getStorage());
+  EXPECT_GT(result_rs->rowCount(), size_t(0));
+  // the inputs were partitioned to disk and released before the partitions were reduced
+  for (const auto& result_set : result_sets) {
+    EXPECT_EQ(result_set->getStorage(), nullptr);
+  }
+}
+
 #ifndef HAVE_TSAN
 // The large buffers tests allocate too much memory to instrument under TSAN
 TEST(ReduceLargeBuffers, PerfectHashOne_Overflow32) {
@@ -2556,6 +2611,24 @@ TEST(ReduceRandomGroups, BaselineHash_Large_0075) {
       target_infos, query_mem_desc, gen1, gen2, prct1, prct2, silent);
 }
 
+TEST(ReduceRandomGroups, BaselineHash_Large_Spill_5050) {
+  ScopeGuard reset = [enable_spill = g_enable_spill_to_disk,
+                      spill_threshold = g_spill_threshold_bytes] {
+    g_enable_spill_to_disk = enable_spill;
+    g_spill_threshold_bytes = spill_threshold;
+  };
+  g_enable_spill_to_disk = true;
+  g_spill_threshold_bytes = 4096;
+  const auto target_infos = generate_random_groups_target_infos();
+  const auto query_mem_desc = baseline_hash_two_col_desc_large(target_infos, 8);
+  EvenNumberGenerator gen1;
+  EvenNumberGenerator gen2;
+  const int prct1 = 50, prct2 = 50;
+  const bool silent = true;
+  test_reduce_random_groups(
+      target_infos, query_mem_desc, gen1, gen2, prct1, prct2, silent);
+}
+
 /*  FLOW #3: Perfect_Hash_Column_Based testcases */
 TEST(ReduceRandomGroups, PerfectHashOneColColumnar_Small_5050) {
   const auto target_infos = generate_random_groups_target_infos();
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Shared/Metrics.h"
+#include "Tests/TestHelpers.h"
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+TEST(Metrics, CounterAcrossThreads) {
+  metrics::Counter counter;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < 8; ++i) {
+    threads.emplace_back([&counter] {
+      for (size_t j = 0; j < 1000; ++j) {
+        counter.add();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  counter.add(5);
+  ASSERT_EQ(counter.value(), uint64_t(8005));
+}
+
+TEST(Metrics, HistogramBuckets) {
+  using metrics::Histogram;
+  for (uint64_t value = 0; value < 4096; ++value) {
+    const auto bucket = Histogram::bucketIndex(value);
+    ASSERT_LE(value, Histogram::bucketUpperBound(bucket)) << value;
+    if (bucket) {
+      ASSERT_GT(value, Histogram::bucketUpperBound(bucket - 1)) << value;
+    }
+  }
+  ASSERT_EQ(Histogram::bucketIndex(uint64_t(1) << Histogram::kMaxValueBits),
+            Histogram::kNumBuckets - 1);
+  ASSERT_EQ(Histogram::bucketIndex(~uint64_t(0)), Histogram::kNumBuckets - 1);
+  ASSERT_EQ(Histogram::bucketUpperBound(Histogram::kNumBuckets - 1),
+            (uint64_t(1) << Histogram::kMaxValueBits) - 1);
+}
+
+TEST(Metrics, PrometheusText) {
+  auto& registry = metrics::Registry::instance();
+  auto& counter = registry.counter("test_hits_total", "Test hits.", "level=\"cpu\"");
+  ASSERT_EQ(&counter,
+            &registry.counter("test_hits_total", "Test hits.", "level=\"cpu\""));
+  counter.add(3);
+  auto& histogram = registry.histogram("test_latency_microseconds", "Test latency.");
+  histogram.record(1);
+  histogram.record(10);
+  histogram.record(10);
+  const auto text = registry.toPrometheusText();
+  for (const auto expected : {"# TYPE test_hits_total counter\n",
+                              "test_hits_total{level=\"cpu\"} 3\n",
+                              "# TYPE test_latency_microseconds histogram\n",
+                              "test_latency_microseconds_bucket{le=\"1\"} 1\n",
+                              "test_latency_microseconds_bucket{le=\"11\"} 3\n",
+                              "test_latency_microseconds_bucket{le=\"+Inf\"} 3\n",
+                              "test_latency_microseconds_sum 21\n",
+                              "test_latency_microseconds_count 3\n"}) {
+    ASSERT_NE(text.find(expected), std::string::npos) << expected << "\n" << text;
+  }
+}
+
+int main(int argc, char** argv) {
+  TestHelpers::init_logger_stderr_only(argc, argv);
+  testing::InitGoogleTest(&argc, argv);
+
+  int err{0};
+  try {
+    err = RUN_ALL_TESTS();
+  } catch (const std::exception& e) {
+    LOG(ERROR) << e.what();
+  }
+  return err;
+}
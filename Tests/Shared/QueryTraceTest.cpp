@@ -0,0 +1,134 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Logger/Logger.h"
+#include "Tests/TestHelpers.h"
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// far above the ids of real queries
+constexpr logger::QueryId kQueryId{std::numeric_limits<logger::QueryId>::max()};
+
+std::vector<std::string> get_event_names(const std::string& trace) {
+  rapidjson::Document doc;
+  doc.Parse(trace.c_str());
+  CHECK(!doc.HasParseError()) << trace;
+  std::vector<std::string> names;
+  for (const auto& event : doc["traceEvents"].GetArray()) {
+    names.emplace_back(event["name"].GetString());
+  }
+  return names;
+}
+
+}  // namespace
+
+TEST(QueryTrace, Json) {
+  logger::start_query_trace(kQueryId);
+  {
+    auto qid_scope_guard = logger::set_thread_local_query_id(kQueryId);
+    auto outer = TRACE_SCOPE("outer");
+    { auto inner = TRACE_SCOPE("inner"); }
+  }
+  const auto trace = logger::stop_query_trace(kQueryId);
+
+  rapidjson::Document doc;
+  doc.Parse(trace.c_str());
+  ASSERT_FALSE(doc.HasParseError()) << trace;
+  ASSERT_STREQ(doc["displayTimeUnit"].GetString(), "ms");
+  const auto& events = doc["traceEvents"];
+  ASSERT_EQ(events.Size(), 2u);
+  // events are recorded when their scope ends
+  ASSERT_STREQ(events[0]["name"].GetString(), "inner");
+  ASSERT_STREQ(events[1]["name"].GetString(), "outer");
+  for (const auto& event : events.GetArray()) {
+    ASSERT_STREQ(event["cat"].GetString(), "omnisci");
+    ASSERT_STREQ(event["ph"].GetString(), "X");
+    ASSERT_EQ(event["pid"].GetInt(), 1);
+    ASSERT_EQ(event["tid"].GetUint64(), logger::thread_id());
+    ASSERT_GE(event["ts"].GetInt64(), 0);
+    ASSERT_GE(event["dur"].GetInt64(), 0);
+  }
+  const auto& inner = events[0];
+  const auto& outer = events[1];
+  ASSERT_LE(outer["ts"].GetInt64(), inner["ts"].GetInt64());
+  ASSERT_LE(inner["ts"].GetInt64() + inner["dur"].GetInt64(),
+            outer["ts"].GetInt64() + outer["dur"].GetInt64());
+}
+
+TEST(QueryTrace, StartStop) {
+  // nothing is collected for a query which is not traced
+  {
+    auto qid_scope_guard = logger::set_thread_local_query_id(kQueryId);
+    auto scope = TRACE_SCOPE("untraced");
+  }
+  ASSERT_EQ(logger::stop_query_trace(kQueryId), "");
+
+  logger::start_query_trace(kQueryId);
+  {
+    auto qid_scope_guard = logger::set_thread_local_query_id(kQueryId);
+    auto scope = TRACE_SCOPE("traced");
+  }
+  // starting the trace again keeps its events
+  logger::start_query_trace(kQueryId);
+  // scopes of other queries and of threads without a query are not collected
+  {
+    auto qid_scope_guard = logger::set_thread_local_query_id(kQueryId - 1);
+    auto scope = TRACE_SCOPE("other query");
+  }
+  std::thread([] { auto scope = TRACE_SCOPE("no query"); }).join();
+  ASSERT_EQ(get_event_names(logger::stop_query_trace(kQueryId)),
+            std::vector<std::string>{"traced"});
+  ASSERT_EQ(logger::stop_query_trace(kQueryId), "");
+
+  // a scope still open when the trace stops is dropped
+  logger::start_query_trace(kQueryId);
+  {
+    auto qid_scope_guard = logger::set_thread_local_query_id(kQueryId);
+    auto scope = TRACE_SCOPE("open");
+    ASSERT_TRUE(get_event_names(logger::stop_query_trace(kQueryId)).empty());
+  }
+  ASSERT_EQ(logger::stop_query_trace(kQueryId), "");
+}
+
+TEST(QueryTrace, DebugTimer) {
+  logger::start_query_trace(kQueryId);
+  {
+    auto qid_scope_guard = logger::set_thread_local_query_id(kQueryId);
+    auto timer = DEBUG_TIMER("timer");
+  }
+  ASSERT_EQ(get_event_names(logger::stop_query_trace(kQueryId)),
+            std::vector<std::string>{"timer"});
+}
+
+int main(int argc, char** argv) {
+  TestHelpers::init_logger_stderr_only(argc, argv);
+  testing::InitGoogleTest(&argc, argv);
+
+  int err{0};
+  try {
+    err = RUN_ALL_TESTS();
+  } catch (const std::exception& e) {
+    LOG(ERROR) << e.what();
+  }
+  return err;
+}
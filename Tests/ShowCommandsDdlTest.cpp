@@ -3025,6 +3025,16 @@ TEST_F(SystemTablesTest, SystemTablesJoin) {
   // clang-format on
 }
 
+TEST_F(SystemTablesTest, QueryQueueSummarySystemTable) {
+  loginInformationSchema();
+  sqlAndCompareResult(
+      "SELECT node, priority, weight, queued_query_count FROM query_queue_summary "
+      "ORDER BY weight DESC;",
+      {{"Server", "HIGH", i(4), i(0)},
+       {"Server", "NORMAL", i(2), i(0)},
+       {"Server", "LOW", i(1), i(0)}});
+}
+
 struct StorageDetailsResult {
   std::string node{"Server"};
   int64_t database_id{0};
@@ -21,6 +21,7 @@
 #include "QueryEngine/ResultSet.h"
 #include "QueryEngine/TableFunctions/TableFunctionManager.h"
 #include "QueryRunner/QueryRunner.h"
+#include "Shared/scope.h"
 
 #ifndef BASE_PATH
 #define BASE_PATH "./tmp"
@@ -30,6 +31,7 @@ using QR = QueryRunner::QueryRunner;
 
 extern bool g_enable_table_functions;
 extern bool g_enable_dev_table_functions;
+extern size_t g_parallel_table_function_threshold;
 namespace {
 
 inline void run_ddl_statement(const std::string& stmt) {
@@ -1789,6 +1791,34 @@ TEST_F(TableFunctions, FilterTransposeRuleMisc) {
   }
 }
 
+TEST_F(TableFunctions, ParallelMorsels) {
+  const auto parallel_table_function_threshold = g_parallel_table_function_threshold;
+  ScopeGuard reset = [parallel_table_function_threshold] {
+    g_parallel_table_function_threshold = parallel_table_function_threshold;
+  };
+  for (const size_t threshold : {size_t(0), parallel_table_function_threshold}) {
+    g_parallel_table_function_threshold = threshold;
+    {
+      const auto rows = run_multiple_agg(
+          "SELECT * FROM TABLE(ct_parallel_scale(cursor(SELECT x FROM tf_test), 3));",
+          ExecutorDeviceType::CPU);
+      ASSERT_EQ(rows->rowCount(), size_t(5));
+      for (int64_t i = 0; i < 5; i++) {
+        auto crt_row = rows->getNextRow(false, false);
+        ASSERT_EQ(TestHelpers::v<int64_t>(crt_row[0]), i * 3);
+      }
+    }
+    {
+      const auto rows = run_multiple_agg(
+          "SELECT * FROM TABLE(ct_parallel_sum(cursor(SELECT x FROM tf_test)));",
+          ExecutorDeviceType::CPU);
+      ASSERT_EQ(rows->rowCount(), size_t(1));
+      auto crt_row = rows->getNextRow(false, false);
+      ASSERT_EQ(TestHelpers::v<int64_t>(crt_row[0]), int64_t(0 + 1 + 2 + 3 + 4));
+    }
+  }
+}
+
 int main(int argc, char** argv) {
   TestHelpers::init_logger_stderr_only(argc, argv);
   testing::InitGoogleTest(&argc, argv);
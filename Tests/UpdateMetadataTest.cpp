@@ -1754,6 +1754,26 @@ TEST_F(OpportunisticMetadataUpdateTest, NullValues) {
   assertExpectedChunkMetadata(5U, true, 2, 4);
 }
 
+TEST_F(OpportunisticMetadataUpdateTest, ColumnToColumnMultipleFragments) {
+  run_ddl_statement(
+      "create table test_table (i integer, i2 integer) with (fragment_size = 3);");
+  for (int i = 1; i <= 5; i++) {
+    query("insert into test_table values (" + std::to_string(i) + ", " +
+          std::to_string(i) + ");");
+  }
+
+  query("update test_table set i = i2 * 10, i2 = null where i > 2;");
+
+  auto metadata_vec = get_metadata_vec("test_table", "i");
+  ASSERT_EQ(2U, metadata_vec.size());
+  assertExpectedChunkMetadata(metadata_vec[0].second, 3U, false, 1, 30);
+  assertExpectedChunkMetadata(metadata_vec[1].second, 2U, false, 40, 50);
+
+  metadata_vec = get_metadata_vec("test_table", "i2");
+  ASSERT_EQ(2U, metadata_vec.size());
+  assertExpectedChunkMetadata(metadata_vec[0].second, 3U, true, 1, 2);
+}
+
 TEST_F(OpportunisticMetadataUpdateTest, DeletedFragment) {
   setupTableWithMultipleFragments();
   query("delete from test_table where i < 4;");
@@ -34,6 +34,7 @@
 #include "QueryRunner/QueryRunner.h"
 #include "Shared/UpdelRoll.h"
 #include "Shared/measure.h"
+#include "Shared/scope.h"
 #include "TestHelpers.h"
 
 #ifndef BASE_PATH
@@ -44,6 +45,8 @@ using namespace Catalog_Namespace;
 
 using QR = QueryRunner::QueryRunner;
 
+extern bool g_enable_snapshot_reads;
+
 namespace {
 struct UpdelTestConfig {
   static bool showMeasuredTime;
@@ -958,6 +961,91 @@ TEST_F(UpdateStorageTest, All_fixed_encoded_integer_passenger_count_x1_rollback)
       "trips", "passenger_count", UpdelTestConfig::fixNumRows, 1, 4 * 2, 4 * 1.0, false));
 }
 
+TEST_F(UpdateStorageTest, All_fixed_encoded_integer_passenger_count_snapshot_read) {
+  UpdelRoll updelRoll;
+  std::vector<uint64_t> fragOffsets;
+  std::vector<ScalarTargetValue> rhsValues;
+  update_prepare_offsets_values<double>(
+      UpdelTestConfig::fixNumRows, 1, 4 * 2, fragOffsets, rhsValues);
+  auto catalog = QR::get()->getCatalog();
+  const auto td = catalog->getMetadataForTable("trips");
+  CHECK(td);
+  const auto cd = catalog->getMetadataForColumn(td->tableId, "passenger_count");
+  CHECK(cd);
+  td->fragmenter->updateColumn(catalog.get(),
+                               td,
+                               cd,
+                               0,
+                               fragOffsets,
+                               rhsValues,
+                               SQLTypeInfo(),
+                               Data_Namespace::MemoryLevel::CPU_LEVEL,
+                               updelRoll);
+  // queries only see the update once it is committed
+  EXPECT_TRUE(compare_agg("trips", "passenger_count", UpdelTestConfig::fixNumRows, 4.));
+  updelRoll.commitUpdate();
+  EXPECT_TRUE(compare_agg("trips", "passenger_count", UpdelTestConfig::fixNumRows, 8.));
+}
+
+TEST_F(UpdateStorageTest, All_fixed_encoded_integer_passenger_count_checkpoint_staged) {
+  UpdelRoll updelRoll;
+  std::vector<uint64_t> fragOffsets;
+  std::vector<ScalarTargetValue> rhsValues;
+  update_prepare_offsets_values<double>(
+      UpdelTestConfig::fixNumRows, 1, 4 * 2, fragOffsets, rhsValues);
+  auto catalog = QR::get()->getCatalog();
+  const auto td = catalog->getMetadataForTable("trips");
+  CHECK(td);
+  const auto cd = catalog->getMetadataForColumn(td->tableId, "passenger_count");
+  CHECK(cd);
+  td->fragmenter->updateColumn(catalog.get(),
+                               td,
+                               cd,
+                               0,
+                               fragOffsets,
+                               rhsValues,
+                               SQLTypeInfo(),
+                               Data_Namespace::MemoryLevel::CPU_LEVEL,
+                               updelRoll);
+  // a checkpoint of the table while the update is staged must not lose it
+  catalog->checkpoint(td->tableId);
+  updelRoll.commitUpdate();
+  const ChunkKey table_key{catalog->getCurrentDB().dbId, td->tableId};
+  catalog->getDataMgr().deleteChunksWithPrefix(table_key,
+                                               Data_Namespace::MemoryLevel::CPU_LEVEL);
+  EXPECT_TRUE(compare_agg("trips", "passenger_count", UpdelTestConfig::fixNumRows, 8.));
+}
+
+TEST_F(UpdateStorageTest, All_fixed_encoded_integer_passenger_count_no_snapshot_read) {
+  ScopeGuard reset = [snapshot_reads = g_enable_snapshot_reads] {
+    g_enable_snapshot_reads = snapshot_reads;
+  };
+  g_enable_snapshot_reads = false;
+  UpdelRoll updelRoll;
+  std::vector<uint64_t> fragOffsets;
+  std::vector<ScalarTargetValue> rhsValues;
+  update_prepare_offsets_values<double>(
+      UpdelTestConfig::fixNumRows, 1, 4 * 2, fragOffsets, rhsValues);
+  auto catalog = QR::get()->getCatalog();
+  const auto td = catalog->getMetadataForTable("trips");
+  CHECK(td);
+  const auto cd = catalog->getMetadataForColumn(td->tableId, "passenger_count");
+  CHECK(cd);
+  td->fragmenter->updateColumn(catalog.get(),
+                               td,
+                               cd,
+                               0,
+                               fragOffsets,
+                               rhsValues,
+                               SQLTypeInfo(),
+                               Data_Namespace::MemoryLevel::CPU_LEVEL,
+                               updelRoll);
+  // without snapshot reads, the updated values are written to the chunk right away
+  EXPECT_TRUE(compare_agg("trips", "passenger_count", UpdelTestConfig::fixNumRows, 8.));
+  updelRoll.commitUpdate();
+  EXPECT_TRUE(compare_agg("trips", "passenger_count", UpdelTestConfig::fixNumRows, 8.));
+}
+
 TEST_F(UpdateStorageTest, Half_fixed_encoded_integer_passenger_count_x2) {
   EXPECT_TRUE(update_a_numeric_column(
       "trips", "passenger_count", UpdelTestConfig::fixNumRows, 2, 4 * 2, 4. * 1.5));
@@ -38,6 +38,7 @@ const std::string CommandLineOptions::nodeIds_token = {"node_id"};
 extern std::string cluster_command_line_arg;
 
 bool g_enable_thrift_logs{false};
+bool g_enable_http_metrics{true};
 
 extern bool g_use_table_device_offset;
 extern float g_fraction_code_cache_to_evict;
@@ -57,6 +58,7 @@ extern size_t g_streaming_topn_max;
 extern size_t g_estimator_failure_max_groupby_size;
 extern bool g_columnar_large_projections;
 extern size_t g_columnar_large_projections_threshold;
+extern bool g_enable_string_key_group_by;
 extern bool g_enable_system_tables;
 extern bool g_allow_system_dashboard_update;
 #ifdef ENABLE_MEMKIND
@@ -246,6 +248,13 @@ void CommandLineOptions::fillOptions() {
           ->default_value(g_enable_thrift_logs)
           ->implicit_value(true),
       "Enable writing messages directly from thrift to stdout/stderr.");
+  help_desc.add_options()(
+      "enable-http-metrics",
+      po::value<bool>(&g_enable_http_metrics)
+          ->default_value(g_enable_http_metrics)
+          ->implicit_value(true),
+      "Serve performance metrics in the Prometheus text format on GET /metrics of the "
+      "HTTP port.");
   help_desc.add_options()("enable-watchdog",
                           po::value<bool>(&enable_watchdog)
                               ->default_value(enable_watchdog)
@@ -320,6 +329,32 @@ void CommandLineOptions::fillOptions() {
           ->default_value(g_null_div_by_zero)
           ->implicit_value(true),
       "Return null on division by zero instead of throwing an exception.");
+  help_desc.add_options()(
+      "enable-nonblocking-server",
+      po::value<bool>(&enable_nonblocking_server)
+          ->default_value(enable_nonblocking_server)
+          ->implicit_value(true),
+      "Serve the binary protocol port from an event driven server with a bounded pool "
+      "of worker threads instead of a thread per connection. Clients must use the "
+      "framed transport. Not supported with SSL.");
+  help_desc.add_options()("nonblocking-server-io-threads",
+                          po::value<size_t>(&nonblocking_server_io_threads)
+                              ->default_value(nonblocking_server_io_threads),
+                          "Number of threads handling the connections of the "
+                          "nonblocking server.");
+  help_desc.add_options()(
+      "nonblocking-server-worker-threads",
+      po::value<size_t>(&nonblocking_server_worker_threads)
+          ->default_value(nonblocking_server_worker_threads),
+      "Number of threads executing the requests of the nonblocking server (0 means "
+      "the number of hardware threads).");
+  help_desc.add_options()(
+      "nonblocking-server-max-pending-requests",
+      po::value<size_t>(&nonblocking_server_max_pending_requests)
+          ->default_value(nonblocking_server_max_pending_requests),
+      "Maximum number of requests the nonblocking server executes or queues for its "
+      "workers. Beyond that, new connections are closed on accept until the load "
+      "drops (0 means unbounded).");
   help_desc.add_options()(
       "num-reader-threads",
       po::value<size_t>(&num_reader_threads)->default_value(num_reader_threads),
@@ -338,6 +373,18 @@ void CommandLineOptions::fillOptions() {
                           po::value<double>(&g_overlaps_target_entries_per_bin)
                               ->default_value(g_overlaps_target_entries_per_bin),
                           "The target number of hash entries per bin for overlaps join");
+  help_desc.add_options()(
+      "enable-polygon-edge-index",
+      po::value<bool>(&g_enable_polygon_edge_index)
+          ->default_value(g_enable_polygon_edge_index)
+          ->implicit_value(true),
+      "Use an edge index of the inner geometries for the point containment checks of an "
+      "overlaps hash join on CPU.");
+  help_desc.add_options()(
+      "polygon-edge-index-min-vertices",
+      po::value<size_t>(&g_polygon_edge_index_min_vertices)
+          ->default_value(g_polygon_edge_index_min_vertices),
+      "Minimum number of vertices of an inner geometry for building its edge index.");
   if (!dist_v5_) {
     help_desc.add_options()("port,p",
                             po::value<int>(&system_parameters.omnisci_server_port)
@@ -530,6 +577,13 @@ void CommandLineOptions::fillAdvancedOptions() {
                                    ->default_value(g_optimize_row_initialization)
                                    ->implicit_value(true),
                                "Optimize row initialization.");
+  developer_desc.add_options()(
+      "enable-paged-perfect-hash",
+      po::value<bool>(&g_enable_paged_perfect_hash)
+          ->default_value(g_enable_paged_perfect_hash)
+          ->implicit_value(true),
+      "Initialize large row-wise perfect hash group by buffers on CPU page by page on "
+      "first touch, and skip untouched pages in the reduction.");
   developer_desc.add_options()("enable-legacy-syntax",
                                po::value<bool>(&enable_legacy_syntax)
                                    ->default_value(enable_legacy_syntax)
@@ -556,6 +610,18 @@ void CommandLineOptions::fillAdvancedOptions() {
                                po::value<int>(&system_parameters.num_executors)
                                    ->default_value(system_parameters.num_executors),
                                "Number of executors to run in parallel.");
+  developer_desc.add_options()(
+      "high-priority-query-users",
+      po::value<std::string>(&system_parameters.high_priority_query_users)
+          ->default_value(system_parameters.high_priority_query_users),
+      "Comma separated list of users whose queries are dispatched to executors with "
+      "high priority.");
+  developer_desc.add_options()(
+      "low-priority-query-users",
+      po::value<std::string>(&system_parameters.low_priority_query_users)
+          ->default_value(system_parameters.low_priority_query_users),
+      "Comma separated list of users whose queries are dispatched to executors with "
+      "low priority.");
   developer_desc.add_options()(
       "gpu-shared-mem-threshold",
       po::value<size_t>(&g_gpu_smem_threshold)->default_value(g_gpu_smem_threshold),
@@ -609,6 +675,19 @@ void CommandLineOptions::fillAdvancedOptions() {
                                    ->implicit_value(true),
                                "Enable dev (test or alpha) table functions. Also "
                                "requires --enable-table-functions to be turned on");
+  developer_desc.add_options()(
+      "enable-parallel-table-functions",
+      po::value<bool>(&g_enable_parallel_table_functions)
+          ->default_value(g_enable_parallel_table_functions)
+          ->implicit_value(true),
+      "Run table functions annotated as parallel on morsels of their input in "
+      "parallel on CPU.");
+  developer_desc.add_options()(
+      "parallel-table-function-threshold",
+      po::value<size_t>(&g_parallel_table_function_threshold)
+          ->default_value(g_parallel_table_function_threshold),
+      "Minimum number of input rows for running a parallel table function on morsels "
+      "of its input.");
   developer_desc.add_options()(
       "jit-debug-ir",
       po::value<bool>(&jit_debug)->default_value(jit_debug)->implicit_value(true),
@@ -633,6 +712,59 @@ void CommandLineOptions::fillAdvancedOptions() {
       "cpu-sub-task-size",
       po::value<size_t>(&g_cpu_sub_task_size)->default_value(g_cpu_sub_task_size),
       "Set CPU sub-task size in rows.");
+  developer_desc.add_options()(
+      "enable-cpu-morsel-execution",
+      po::value<bool>(&g_enable_cpu_morsel_execution)
+          ->default_value(g_enable_cpu_morsel_execution)
+          ->implicit_value(true),
+      "Split CPU fragments into morsels processed from a queue shared by all kernels of "
+      "a query step, so idle threads can take over work from other fragments.");
+  developer_desc.add_options()(
+      "cpu-morsel-size",
+      po::value<size_t>(&g_cpu_morsel_size)->default_value(g_cpu_morsel_size),
+      "Set CPU morsel size in rows.");
+  developer_desc.add_options()(
+      "enable-shared-scans",
+      po::value<bool>(&g_enable_shared_scans)
+          ->default_value(g_enable_shared_scans)
+          ->implicit_value(true),
+      "Let CPU aggregate kernels of queries running concurrently on several executors "
+      "share one pass over a fragment, block by block.");
+  developer_desc.add_options()(
+      "shared-scan-block-size",
+      po::value<size_t>(&g_shared_scan_block_size)
+          ->default_value(g_shared_scan_block_size),
+      "Set the size in rows of the blocks a shared scan runs all its kernels over.");
+  developer_desc.add_options()(
+      "enable-batched-intermediate-results",
+      po::value<bool>(&g_enable_batched_intermediate_results)
+          ->default_value(g_enable_batched_intermediate_results)
+          ->implicit_value(true),
+      "Split the intermediate result consumed by a single input query step into "
+      "batches of cpu-morsel-size entries, each columnarized by the kernel consuming it "
+      "instead of converting the whole result up front. Steps still run one after the "
+      "other: a step starts once the result it consumes is complete.");
+  developer_desc.add_options()(
+      "enable-spill-to-disk",
+      po::value<bool>(&g_enable_spill_to_disk)
+          ->default_value(g_enable_spill_to_disk)
+          ->implicit_value(true),
+      "Spill baseline hash group by reductions which exceed the spill threshold to "
+      "temporary files.");
+  developer_desc.add_options()(
+      "spill-threshold-bytes",
+      po::value<size_t>(&g_spill_threshold_bytes)->default_value(g_spill_threshold_bytes),
+      "Size in bytes above which reductions spill to disk. By default, half of the host "
+      "memory which is not reserved by the CPU buffer pool.");
+  developer_desc.add_options()(
+      "spill-directory",
+      po::value<std::string>(&g_spill_directory)->default_value(g_spill_directory),
+      "Directory for spill files. Defaults to the system temporary directory.");
+  developer_desc.add_options()(
+      "query-trace-dir",
+      po::value<std::string>(&g_query_trace_dir)->default_value(g_query_trace_dir),
+      "Directory to write Chrome trace JSON files of traced queries, i.e. queries run "
+      "by sessions with query tracing enabled or with a query_trace hint.");
   developer_desc.add_options()(
       "skip-intermediate-count",
       po::value<bool>(&g_skip_intermediate_count)
@@ -804,6 +936,25 @@ void CommandLineOptions::fillAdvancedOptions() {
           ->implicit_value(true),
       "Enable the filter function protection feature for the SQL JIT compiler. "
       "Normally should be on but techs might want to disable for troubleshooting.");
+  developer_desc.add_options()(
+      "enable-vectorized-filter",
+      po::value<bool>(&g_enable_vectorized_filter)
+          ->default_value(g_enable_vectorized_filter)
+          ->implicit_value(true),
+      "Evaluate comparisons of columns with literals on blocks of rows into a selection "
+      "vector on CPU, so the generated code only processes the selected rows.");
+  developer_desc.add_options()(
+      "enable-tiered-compilation",
+      po::value<bool>(&g_enable_tiered_compilation)
+          ->default_value(g_enable_tiered_compilation)
+          ->implicit_value(true),
+      "Run queries on small inputs with lightly compiled CPU code on a code cache miss, "
+      "while the optimized code is compiled in the background.");
+  developer_desc.add_options()(
+      "tiered-compilation-max-rows",
+      po::value<size_t>(&g_tiered_compilation_max_rows)
+          ->default_value(g_tiered_compilation_max_rows),
+      "Set the maximum number of input rows for which tiered compilation is used.");
   developer_desc.add_options()(
       "enable-idp-temporary-users",
       po::value<bool>(&g_enable_idp_temporary_users)
@@ -828,6 +979,52 @@ void CommandLineOptions::fillAdvancedOptions() {
                                    ->default_value(g_enable_auto_metadata_update)
                                    ->implicit_value(true),
                                "Enable automatic metadata update.");
+  developer_desc.add_options()(
+      "enable-snapshot-reads",
+      po::value<bool>(&g_enable_snapshot_reads)
+          ->default_value(g_enable_snapshot_reads)
+          ->implicit_value(true),
+      "Stage fixed width UPDATE/DELETE changes outside of the chunk buffers, so "
+      "concurrent queries read the last committed data and are only blocked while the "
+      "changes are committed.");
+  developer_desc.add_options()(
+      "enable-insert-wal",
+      po::value<bool>(&g_enable_insert_wal)
+          ->default_value(g_enable_insert_wal)
+          ->implicit_value(true),
+      "Make INSERT, insert_data and load_table batches durable through a write-ahead "
+      "log shared by concurrent inserts instead of checkpointing the table each time.");
+  developer_desc.add_options()(
+      "insert-wal-checkpoint-interval-ms",
+      po::value<size_t>(&g_insert_wal_checkpoint_interval_ms)
+          ->default_value(g_insert_wal_checkpoint_interval_ms),
+      "Set the interval at which the tables logged in the insert write-ahead log are "
+      "checkpointed.");
+  developer_desc.add_options()(
+      "enable-table-compaction",
+      po::value<bool>(&g_enable_table_compaction)
+          ->default_value(g_enable_table_compaction)
+          ->implicit_value(true),
+      "Periodically merge the under-filled fragments of the tables created with the "
+      "COMPACTION_FILL_PERCENT option in a background thread.");
+  developer_desc.add_options()(
+      "table-compaction-interval-ms",
+      po::value<size_t>(&g_table_compaction_interval_ms)
+          ->default_value(g_table_compaction_interval_ms),
+      "Set the interval at which the background table compaction looks for "
+      "under-filled fragments.");
+  developer_desc.add_options()(
+      "table-compaction-max-mb-per-sec",
+      po::value<size_t>(&g_table_compaction_max_mb_per_sec)
+          ->default_value(g_table_compaction_max_mb_per_sec),
+      "Limit the rate at which the background table compaction rewrites chunk data, "
+      "0 for no limit.");
+  developer_desc.add_options()(
+      "ingest-stream-commit-interval-ms",
+      po::value<size_t>(&g_ingest_stream_commit_interval_ms)
+          ->default_value(g_ingest_stream_commit_interval_ms),
+      "Set the default interval at which the rows pushed into an ingest stream are "
+      "committed.");
   developer_desc.add_options()(
       "parallel-top-min",
       po::value<size_t>(&g_parallel_top_min)->default_value(g_parallel_top_min),
@@ -880,6 +1077,13 @@ void CommandLineOptions::fillAdvancedOptions() {
           ->default_value(g_columnar_large_projections_threshold),
       "Threshold (in minimum number of rows) to prefer columnar output for projections. "
       "Requires --columnar-large-projections to be set.");
+  developer_desc.add_options()(
+      "enable-string-key-group-by",
+      po::value<bool>(&g_enable_string_key_group_by)
+          ->default_value(g_enable_string_key_group_by)
+          ->implicit_value(true),
+      "Group by none encoded strings by hashing the strings themselves instead of "
+      "translating them to a transient dictionary. Runs on CPU only.");
 
   help_desc.add_options()(
       "allow-query-step-cpu-retry",
@@ -1194,6 +1398,21 @@ boost::optional<int> CommandLineOptions::parse_command_line(
       return 1;
     }
 
+    if (enable_nonblocking_server) {
+#ifndef HAVE_THRIFT_NONBLOCKING_SERVER
+      std::cerr << "Nonblocking server is not supported by this build." << std::endl;
+      return 1;
+#endif
+      if (!system_parameters.ssl_cert_file.empty()) {
+        std::cerr << "Nonblocking server is not supported with SSL." << std::endl;
+        return 1;
+      }
+      if (nonblocking_server_io_threads == 0) {
+        std::cerr << "Nonblocking server needs at least one IO thread." << std::endl;
+        return 1;
+      }
+    }
+
     g_enable_watchdog = enable_watchdog;
     g_enable_dynamic_watchdog = enable_dynamic_watchdog;
     g_dynamic_watchdog_time_limit = dynamic_watchdog_time_limit;
@@ -44,6 +44,14 @@ class CommandLineOptions {
     fillAdvancedOptions();
   }
   int http_port = 6278;
+  /**
+   * Serve the binary protocol from an event driven server with a bounded worker pool
+   * instead of a thread per connection. Clients must use the framed transport.
+   */
+  bool enable_nonblocking_server = false;
+  size_t nonblocking_server_io_threads = 1;
+  size_t nonblocking_server_worker_threads = 0;  // 0 means one per hardware thread
+  size_t nonblocking_server_max_pending_requests = 0;  // 0 means unbounded
   size_t reserved_gpu_mem = 384 * 1024 * 1024;
   std::string base_path;
   File_Namespace::DiskCacheConfig disk_cache_config;
@@ -167,11 +175,14 @@ extern float g_filter_push_down_high_frac;
 extern size_t g_filter_push_down_passing_row_ubound;
 extern bool g_enable_columnar_output;
 extern bool g_optimize_row_initialization;
+extern bool g_enable_paged_perfect_hash;
 extern bool g_enable_overlaps_hashjoin;
 extern bool g_enable_hashjoin_many_to_many;
 extern bool g_enable_distance_rangejoin;
 extern size_t g_overlaps_max_table_size_bytes;
 extern double g_overlaps_target_entries_per_bin;
+extern bool g_enable_polygon_edge_index;
+extern size_t g_polygon_edge_index_min_vertices;
 extern bool g_strip_join_covered_quals;
 extern size_t g_constrained_by_in_threshold;
 extern size_t g_big_group_threshold;
@@ -180,6 +191,8 @@ extern bool g_enable_parallel_window_partition_compute;
 extern bool g_enable_parallel_window_partition_sort;
 extern bool g_enable_table_functions;
 extern bool g_enable_dev_table_functions;
+extern bool g_enable_parallel_table_functions;
+extern size_t g_parallel_table_function_threshold;
 extern size_t g_max_memory_allocation_size;
 extern double g_bump_allocator_step_reduction;
 extern bool g_enable_direct_columnarization;
@@ -211,9 +224,28 @@ extern bool g_enable_interop;
 extern bool g_enable_union;
 extern bool g_enable_cpu_sub_tasks;
 extern size_t g_cpu_sub_task_size;
+extern bool g_enable_cpu_morsel_execution;
+extern size_t g_cpu_morsel_size;
+extern bool g_enable_shared_scans;
+extern size_t g_shared_scan_block_size;
+extern bool g_enable_batched_intermediate_results;
+extern bool g_enable_spill_to_disk;
+extern size_t g_spill_threshold_bytes;
+extern std::string g_spill_directory;
+extern std::string g_query_trace_dir;
 extern bool g_enable_filter_function;
+extern bool g_enable_vectorized_filter;
+extern bool g_enable_tiered_compilation;
+extern size_t g_tiered_compilation_max_rows;
 extern size_t g_max_import_threads;
 extern bool g_enable_auto_metadata_update;
+extern bool g_enable_snapshot_reads;
+extern bool g_enable_insert_wal;
+extern size_t g_insert_wal_checkpoint_interval_ms;
+extern bool g_enable_table_compaction;
+extern size_t g_table_compaction_interval_ms;
+extern size_t g_table_compaction_max_mb_per_sec;
+extern size_t g_ingest_stream_commit_interval_ms;
 extern bool g_allow_s3_server_privileges;
 extern float g_vacuum_min_selectivity;
 extern bool g_read_only;
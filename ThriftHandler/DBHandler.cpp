@@ -43,6 +43,7 @@
 #include "DataMgr/ForeignStorage/DummyForeignStorage.h"
 #include "DistributedHandler.h"
 #include "Fragmenter/InsertOrderFragmenter.h"
+#include "Fragmenter/InsertWriteAheadLog.h"
 #include "Geospatial/Compression.h"
 #include "Geospatial/GDAL.h"
 #include "Geospatial/Transforms.h"
@@ -63,6 +64,7 @@
 #include "QueryEngine/JsonAccessors.h"
 #include "QueryEngine/QueryDispatchQueue.h"
 #include "QueryEngine/ResultSetBuilder.h"
+#include "QueryEngine/TableCompactionService.h"
 #include "QueryEngine/TableFunctions/TableFunctionsFactory.h"
 #include "QueryEngine/TableOptimizer.h"
 #include "QueryEngine/ThriftSerializers.h"
@@ -120,6 +122,7 @@ extern bool g_allow_s3_server_privileges;
 
 extern bool g_enable_system_tables;
 bool g_allow_system_dashboard_update{false};
+std::string g_query_trace_dir;  // empty means traces are only kept in the session
 
 using Catalog_Namespace::Catalog;
 using Catalog_Namespace::SysCatalog;
@@ -454,9 +457,26 @@ void DBHandler::initialize(const bool is_new_db) {
     LOG(FATAL) << "Failed to initialize system catalog: " << e.what();
   }
 
+  if (g_enable_insert_wal && !g_read_only && !g_cluster) {
+    try {
+      Fragmenter_Namespace::InsertWriteAheadLog::instance().start(
+          (boost::filesystem::path(base_data_path_) / "mapd_insert_wal").string());
+    } catch (const std::exception& e) {
+      LOG(FATAL) << "Failed to start insert write-ahead log: " << e.what();
+    }
+  }
+
+  if (g_enable_table_compaction && !g_read_only && !g_cluster) {
+    TableCompactionService::instance().start();
+  }
+
+  ingest_stream_manager_ = std::make_unique<IngestStreamManager>();
+
   import_path_ = boost::filesystem::path(base_data_path_) / "mapd_import";
   start_time_ = std::time(nullptr);
 
+  configureDispatchQueue();
+
   if (is_rendering_enabled) {
     try {
       render_handler_.reset(new RenderHandler(this,
@@ -733,6 +753,9 @@ void DBHandler::disconnect_impl(const SessionMap::iterator& session_it,
   sessions_.erase(session_it);
   write_lock.unlock();
 
+  if (ingest_stream_manager_) {
+    ingest_stream_manager_->closeSessionStreams(session_id);
+  }
   if (render_handler_) {
     render_handler_->disconnect(session_id);
   }
@@ -1256,6 +1279,38 @@ void DBHandler::convertData(TQueryResult& _return,
   }
 }
 
+namespace {
+
+// Starts a trace of the query if its session enabled tracing. Otherwise a query_trace
+// hint starts the trace once the query is parsed, see execute_rel_alg. When the
+// returned guard goes out of scope the trace, if any, is kept as the session's last
+// trace and, if --query-trace-dir is set, written to query_<id>.json in that directory.
+ScopeGuard trace_query(std::shared_ptr<Catalog_Namespace::SessionInfo> session_ptr,
+                       const query_state::QueryState& query_state) {
+  const auto query_id = query_state.getId();
+  if (session_ptr->get_query_tracing()) {
+    logger::start_query_trace(query_id);
+  }
+  return [session_ptr, query_id] {
+    auto trace = logger::stop_query_trace(query_id);
+    if (trace.empty()) {
+      return;
+    }
+    if (!g_query_trace_dir.empty()) {
+      const auto trace_path = boost::filesystem::path(g_query_trace_dir) /
+                              ("query_" + std::to_string(query_id) + ".json");
+      std::ofstream trace_file(trace_path.string());
+      trace_file << trace;
+      if (!trace_file) {
+        LOG(WARNING) << "Failed to write query trace " << trace_path;
+      }
+    }
+    session_ptr->set_last_query_trace(std::move(trace));
+  };
+}
+
+}  // namespace
+
 void DBHandler::sql_execute(TQueryResult& _return,
                             const TSessionId& session,
                             const std::string& query_str,
@@ -1272,6 +1327,8 @@ void DBHandler::sql_execute(TQueryResult& _return,
   auto stdlog = STDLOG(session_ptr, query_state);
   stdlog.appendNameValuePairs("client", getConnectionInfo().toString());
   stdlog.appendNameValuePairs("nonce", nonce);
+  auto qid_scope_guard = query_state->setThreadLocalQueryId();
+  auto query_trace = trace_query(session_ptr, *query_state);
   auto timer = DEBUG_TIMER(__func__);
   try {
     ScopeGuard reset_was_deferred_copy_from = [this, &session_ptr] {
@@ -1434,6 +1491,9 @@ void DBHandler::sql_execute_df(TDataFrame& _return,
   CHECK(session_ptr);
   auto query_state = create_query_state(session_ptr, query_str);
   auto stdlog = STDLOG(session_ptr, query_state);
+  auto qid_scope_guard = query_state->setThreadLocalQueryId();
+  auto query_trace = trace_query(session_ptr, *query_state);
+  auto timer = DEBUG_TIMER(__func__);
 
   const auto executor_device_type = session_ptr->get_executor_device_type();
 
@@ -2832,6 +2892,19 @@ void DBHandler::set_execution_mode(const TSessionId& session,
   DBHandler::set_execution_mode_nolock(session_it->second.get(), mode);
 }
 
+void DBHandler::set_query_tracing(const TSessionId& session, const bool enable) {
+  auto session_ptr = get_session_ptr(session);
+  auto stdlog = STDLOG(session_ptr);
+  stdlog.appendNameValuePairs("enable", enable);
+  session_ptr->set_query_tracing(enable);
+}
+
+void DBHandler::get_query_trace(std::string& _return, const TSessionId& session) {
+  auto session_ptr = get_session_ptr(session);
+  auto stdlog = STDLOG(session_ptr);
+  _return = session_ptr->get_last_query_trace();
+}
+
 namespace {
 
 void check_table_not_sharded(const TableDescriptor* td) {
@@ -3178,6 +3251,79 @@ size_t get_column_size(const TColumn& column) {
 
 }  // namespace
 
+size_t DBHandler::fill_import_buffers_columnar(
+    const TSessionId& session,
+    const Catalog& catalog,
+    const std::string& table_name,
+    const import_export::Loader& loader,
+    std::vector<std::unique_ptr<import_export::TypedImportBuffer>>& import_buffers,
+    const std::vector<TColumn>& cols,
+    const std::vector<std::string>& column_names,
+    const bool assign_render_groups) {
+  auto desc_id_to_column_id =
+      column_ids_by_names(loader.get_column_descs(), column_names);
+  size_t num_rows = get_column_size(cols.front());
+  size_t import_idx = 0;  // index into the TColumn vector being loaded
+  size_t col_idx = 0;     // index into column description vector
+  try {
+    size_t skip_physical_cols = 0;
+    for (auto cd : loader.get_column_descs()) {
+      if (skip_physical_cols > 0) {
+        CHECK(cd->isGeoPhyCol);
+        skip_physical_cols--;
+        continue;
+      }
+      auto mapped_idx = desc_id_to_column_id[import_idx];
+      if (mapped_idx != -1) {
+        size_t col_rows = import_buffers[col_idx]->add_values(cd, cols[mapped_idx]);
+        if (col_rows != num_rows) {
+          std::ostringstream oss;
+          oss << "load_table_binary_columnar: Inconsistent number of rows in column "
+              << cd->columnName << " ,  expecting " << num_rows << " rows, column "
+              << col_idx << " has " << col_rows << " rows";
+          THROW_MAPD_EXCEPTION(oss.str());
+        }
+        // Advance to the next column in the table
+        col_idx++;
+        // For geometry columns: process WKT strings and fill physical columns
+        if (cd->columnType.is_geometry()) {
+          fillGeoColumns(session,
+                         catalog,
+                         import_buffers,
+                         cd,
+                         col_idx,
+                         num_rows,
+                         table_name,
+                         assign_render_groups);
+          skip_physical_cols = cd->columnType.get_physical_cols();
+        }
+      } else {
+        col_idx++;
+        if (cd->columnType.is_geometry()) {
+          skip_physical_cols = cd->columnType.get_physical_cols();
+          col_idx += skip_physical_cols;
+        }
+      }
+      // Advance to the next column of values being loaded
+      import_idx++;
+    }
+  } catch (const std::exception& e) {
+    std::ostringstream oss;
+    oss << "load_table_binary_columnar: Input exception thrown: " << e.what()
+        << ". Issue at column : " << (col_idx + 1) << ". Import aborted";
+    THROW_MAPD_EXCEPTION(oss.str());
+  }
+  fillMissingBuffers(session,
+                     catalog,
+                     import_buffers,
+                     loader.get_column_descs(),
+                     desc_id_to_column_id,
+                     num_rows,
+                     table_name,
+                     assign_render_groups);
+  return num_rows;
+}
+
 void DBHandler::load_table_binary_columnar(const TSessionId& session,
                                            const std::string& table_name,
                                            const std::vector<TColumn>& cols,
@@ -3246,67 +3392,15 @@ void DBHandler::load_table_binary_columnar_internal(
                                                  column_names,
                                                  "load_table_binary_columnar");
 
-  auto desc_id_to_column_id =
-      column_ids_by_names(loader->get_column_descs(), column_names);
-  size_t num_rows = get_column_size(cols.front());
-  size_t import_idx = 0;  // index into the TColumn vector being loaded
-  size_t col_idx = 0;     // index into column description vector
-  try {
-    size_t skip_physical_cols = 0;
-    for (auto cd : loader->get_column_descs()) {
-      if (skip_physical_cols > 0) {
-        CHECK(cd->isGeoPhyCol);
-        skip_physical_cols--;
-        continue;
-      }
-      auto mapped_idx = desc_id_to_column_id[import_idx];
-      if (mapped_idx != -1) {
-        size_t col_rows = import_buffers[col_idx]->add_values(cd, cols[mapped_idx]);
-        if (col_rows != num_rows) {
-          std::ostringstream oss;
-          oss << "load_table_binary_columnar: Inconsistent number of rows in column "
-              << cd->columnName << " ,  expecting " << num_rows << " rows, column "
-              << col_idx << " has " << col_rows << " rows";
-          THROW_MAPD_EXCEPTION(oss.str());
-        }
-        // Advance to the next column in the table
-        col_idx++;
-        // For geometry columns: process WKT strings and fill physical columns
-        if (cd->columnType.is_geometry()) {
-          fillGeoColumns(session,
-                         session_ptr->getCatalog(),
-                         import_buffers,
-                         cd,
-                         col_idx,
-                         num_rows,
-                         table_name,
-                         assign_render_groups_mode == AssignRenderGroupsMode::kAssign);
-          skip_physical_cols = cd->columnType.get_physical_cols();
-        }
-      } else {
-        col_idx++;
-        if (cd->columnType.is_geometry()) {
-          skip_physical_cols = cd->columnType.get_physical_cols();
-          col_idx += skip_physical_cols;
-        }
-      }
-      // Advance to the next column of values being loaded
-      import_idx++;
-    }
-  } catch (const std::exception& e) {
-    std::ostringstream oss;
-    oss << "load_table_binary_columnar: Input exception thrown: " << e.what()
-        << ". Issue at column : " << (col_idx + 1) << ". Import aborted";
-    THROW_MAPD_EXCEPTION(oss.str());
-  }
-  fillMissingBuffers(session,
-                     session_ptr->getCatalog(),
-                     import_buffers,
-                     loader->get_column_descs(),
-                     desc_id_to_column_id,
-                     num_rows,
-                     table_name,
-                     assign_render_groups_mode == AssignRenderGroupsMode::kAssign);
+  auto num_rows = fill_import_buffers_columnar(
+      session,
+      session_ptr->getCatalog(),
+      table_name,
+      *loader,
+      import_buffers,
+      cols,
+      column_names,
+      assign_render_groups_mode == AssignRenderGroupsMode::kAssign);
   auto insert_data_lock = lockmgr::InsertDataLockMgr::getWriteLockForTable(
       session_ptr->getCatalog(), table_name);
   if (!loader->load(import_buffers, num_rows, session_ptr.get())) {
@@ -3359,6 +3453,47 @@ RecordBatchVector loadArrowStream(const std::string& stream) {
 
 }  // namespace
 
+size_t DBHandler::fill_import_buffers_arrow(
+    const TSessionId& session,
+    const Catalog& catalog,
+    const std::string& table_name,
+    const import_export::Loader& loader,
+    std::vector<std::unique_ptr<import_export::TypedImportBuffer>>& import_buffers,
+    const arrow::RecordBatch& batch,
+    const std::vector<std::string>& column_names) {
+  auto desc_id_to_column_id =
+      column_ids_by_names(loader.get_column_descs(), column_names);
+  size_t num_rows = 0;
+  size_t col_idx = 0;
+  try {
+    for (auto cd : loader.get_column_descs()) {
+      auto mapped_idx = desc_id_to_column_id[col_idx];
+      if (mapped_idx != -1) {
+        auto& array = *batch.column(mapped_idx);
+        import_export::ArraySliceRange row_slice(0, array.length());
+        num_rows = import_buffers[col_idx]->add_arrow_values(
+            cd, array, true, row_slice, nullptr);
+      }
+      col_idx++;
+    }
+  } catch (const std::exception& e) {
+    LOG(ERROR) << "Input exception thrown: " << e.what()
+               << ". Issue at column : " << (col_idx + 1) << ". Import aborted";
+    // TODO(tmostak): Go row-wise on binary columnar import to be consistent with our
+    // other import paths
+    THROW_MAPD_EXCEPTION(e.what());
+  }
+  fillMissingBuffers(session,
+                     catalog,
+                     import_buffers,
+                     loader.get_column_descs(),
+                     desc_id_to_column_id,
+                     num_rows,
+                     table_name,
+                     false);
+  return num_rows;
+}
+
 void DBHandler::load_table_binary_arrow(const TSessionId& session,
                                         const std::string& table_name,
                                         const std::string& arrow_stream,
@@ -3387,41 +3522,114 @@ void DBHandler::load_table_binary_arrow(const TSessionId& session,
                              column_names,
                              "load_table_binary_arrow");
 
-  auto desc_id_to_column_id =
-      column_ids_by_names(loader->get_column_descs(), column_names);
-  size_t num_rows = 0;
-  size_t col_idx = 0;
-  try {
-    for (auto cd : loader->get_column_descs()) {
-      auto mapped_idx = desc_id_to_column_id[col_idx];
-      if (mapped_idx != -1) {
-        auto& array = *batch->column(mapped_idx);
-        import_export::ArraySliceRange row_slice(0, array.length());
-        num_rows = import_buffers[col_idx]->add_arrow_values(
-            cd, array, true, row_slice, nullptr);
+  auto num_rows = fill_import_buffers_arrow(session,
+                                            session_ptr->getCatalog(),
+                                            table_name,
+                                            *loader,
+                                            import_buffers,
+                                            *batch,
+                                            column_names);
+  auto insert_data_lock = lockmgr::InsertDataLockMgr::getWriteLockForTable(
+      session_ptr->getCatalog(), table_name);
+  if (!loader->load(import_buffers, num_rows, session_ptr.get())) {
+    THROW_MAPD_EXCEPTION(loader->getErrorMessage());
+  }
+}
+
+size_t DBHandler::fill_import_buffers_rows(
+    const TSessionId& session,
+    const Catalog& catalog,
+    const std::string& table_name,
+    const import_export::Loader& loader,
+    std::vector<std::unique_ptr<import_export::TypedImportBuffer>>& import_buffers,
+    const std::vector<TStringRow>& rows,
+    const std::vector<std::string>& column_names,
+    const import_export::CopyParams& copy_params) {
+  auto col_descs = loader.get_column_descs();
+  auto desc_id_to_column_id = column_ids_by_names(col_descs, column_names);
+  size_t rows_completed = 0;
+  for (auto const& row : rows) {
+    size_t import_idx = 0;  // index into the TStringRow being loaded
+    size_t col_idx = 0;     // index into column description vector
+    try {
+      size_t skip_physical_cols = 0;
+      for (auto cd : col_descs) {
+        if (skip_physical_cols > 0) {
+          CHECK(cd->isGeoPhyCol);
+          skip_physical_cols--;
+          continue;
+        }
+        auto mapped_idx = desc_id_to_column_id[import_idx];
+        if (mapped_idx != -1) {
+          import_buffers[col_idx]->add_value(cd,
+                                             row.cols[mapped_idx].str_val,
+                                             row.cols[mapped_idx].is_null,
+                                             copy_params);
+        }
+        col_idx++;
+        if (cd->columnType.is_geometry()) {
+          // physical geo columns will be filled separately lately
+          skip_physical_cols = cd->columnType.get_physical_cols();
+          col_idx += skip_physical_cols;
+        }
+        // Advance to the next field within the row
+        import_idx++;
       }
-      col_idx++;
+      rows_completed++;
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Input exception thrown: " << e.what()
+                 << ". Row discarded, issue at column : " << (col_idx + 1)
+                 << " data :" << row;
+      THROW_MAPD_EXCEPTION(std::string("Exception: ") + e.what());
+    }
+  }
+  // do batch filling of geo columns separately
+  if (rows.size() != 0) {
+    const auto& row = rows[0];
+    size_t col_idx = 0;  // index into column description vector
+    try {
+      size_t import_idx = 0;
+      size_t skip_physical_cols = 0;
+      for (auto cd : col_descs) {
+        if (skip_physical_cols > 0) {
+          skip_physical_cols--;
+          continue;
+        }
+        auto mapped_idx = desc_id_to_column_id[import_idx];
+        col_idx++;
+        if (cd->columnType.is_geometry()) {
+          skip_physical_cols = cd->columnType.get_physical_cols();
+          if (mapped_idx != -1) {
+            fillGeoColumns(session,
+                           catalog,
+                           import_buffers,
+                           cd,
+                           col_idx,
+                           rows_completed,
+                           table_name,
+                           false);
+          } else {
+            col_idx += skip_physical_cols;
+          }
+        }
+        import_idx++;
+      }
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Input exception thrown: " << e.what()
+                 << ". Row discarded, issue at column : " << (col_idx + 1)
+                 << " data :" << row;
+      THROW_MAPD_EXCEPTION(e.what());
     }
-  } catch (const std::exception& e) {
-    LOG(ERROR) << "Input exception thrown: " << e.what()
-               << ". Issue at column : " << (col_idx + 1) << ". Import aborted";
-    // TODO(tmostak): Go row-wise on binary columnar import to be consistent with our
-    // other import paths
-    THROW_MAPD_EXCEPTION(e.what());
   }
   fillMissingBuffers(session,
-                     session_ptr->getCatalog(),
+                     catalog,
                      import_buffers,
-                     loader->get_column_descs(),
+                     col_descs,
                      desc_id_to_column_id,
-                     num_rows,
+                     rows_completed,
                      table_name,
                      false);
-  auto insert_data_lock = lockmgr::InsertDataLockMgr::getWriteLockForTable(
-      session_ptr->getCatalog(), table_name);
-  if (!loader->load(import_buffers, num_rows, session_ptr.get())) {
-    THROW_MAPD_EXCEPTION(loader->getErrorMessage());
-  }
+  return rows_completed;
 }
 
 void DBHandler::load_table(const TSessionId& session,
@@ -3448,91 +3656,15 @@ void DBHandler::load_table(const TSessionId& session,
                                column_names,
                                "load_table");
 
-    auto col_descs = loader->get_column_descs();
-    auto desc_id_to_column_id = column_ids_by_names(col_descs, column_names);
     import_export::CopyParams copy_params;
-    size_t rows_completed = 0;
-    for (auto const& row : rows) {
-      size_t import_idx = 0;  // index into the TStringRow being loaded
-      size_t col_idx = 0;     // index into column description vector
-      try {
-        size_t skip_physical_cols = 0;
-        for (auto cd : col_descs) {
-          if (skip_physical_cols > 0) {
-            CHECK(cd->isGeoPhyCol);
-            skip_physical_cols--;
-            continue;
-          }
-          auto mapped_idx = desc_id_to_column_id[import_idx];
-          if (mapped_idx != -1) {
-            import_buffers[col_idx]->add_value(cd,
-                                               row.cols[mapped_idx].str_val,
-                                               row.cols[mapped_idx].is_null,
-                                               copy_params);
-          }
-          col_idx++;
-          if (cd->columnType.is_geometry()) {
-            // physical geo columns will be filled separately lately
-            skip_physical_cols = cd->columnType.get_physical_cols();
-            col_idx += skip_physical_cols;
-          }
-          // Advance to the next field within the row
-          import_idx++;
-        }
-        rows_completed++;
-      } catch (const std::exception& e) {
-        LOG(ERROR) << "Input exception thrown: " << e.what()
-                   << ". Row discarded, issue at column : " << (col_idx + 1)
-                   << " data :" << row;
-        THROW_MAPD_EXCEPTION(std::string("Exception: ") + e.what());
-      }
-    }
-    // do batch filling of geo columns separately
-    if (rows.size() != 0) {
-      const auto& row = rows[0];
-      size_t col_idx = 0;  // index into column description vector
-      try {
-        size_t import_idx = 0;
-        size_t skip_physical_cols = 0;
-        for (auto cd : col_descs) {
-          if (skip_physical_cols > 0) {
-            skip_physical_cols--;
-            continue;
-          }
-          auto mapped_idx = desc_id_to_column_id[import_idx];
-          col_idx++;
-          if (cd->columnType.is_geometry()) {
-            skip_physical_cols = cd->columnType.get_physical_cols();
-            if (mapped_idx != -1) {
-              fillGeoColumns(session,
-                             session_ptr->getCatalog(),
-                             import_buffers,
-                             cd,
-                             col_idx,
-                             rows_completed,
-                             table_name,
-                             false);
-            } else {
-              col_idx += skip_physical_cols;
-            }
-          }
-          import_idx++;
-        }
-      } catch (const std::exception& e) {
-        LOG(ERROR) << "Input exception thrown: " << e.what()
-                   << ". Row discarded, issue at column : " << (col_idx + 1)
-                   << " data :" << row;
-        THROW_MAPD_EXCEPTION(e.what());
-      }
-    }
-    fillMissingBuffers(session,
-                       session_ptr->getCatalog(),
-                       import_buffers,
-                       col_descs,
-                       desc_id_to_column_id,
-                       rows_completed,
-                       table_name,
-                       false);
+    auto rows_completed = fill_import_buffers_rows(session,
+                                                   session_ptr->getCatalog(),
+                                                   table_name,
+                                                   *loader,
+                                                   import_buffers,
+                                                   rows,
+                                                   column_names,
+                                                   copy_params);
     auto insert_data_lock = lockmgr::InsertDataLockMgr::getWriteLockForTable(
         session_ptr->getCatalog(), table_name);
     if (!loader->load(import_buffers, rows_completed, session_ptr.get())) {
@@ -3544,6 +3676,195 @@ void DBHandler::load_table(const TSessionId& session,
   }
 }
 
+int64_t DBHandler::create_ingest_stream(const TSessionId& session,
+                                        const std::string& table_name,
+                                        const TIngestStreamParams& params) {
+  auto stdlog = STDLOG(get_session_ptr(session), "table_name", table_name);
+  stdlog.appendNameValuePairs("client", getConnectionInfo().toString());
+  auto session_ptr = stdlog.getConstSessionInfo();
+  check_read_only("create_ingest_stream");
+  if (g_cluster || leaf_aggregator_.leafCount() > 0) {
+    THROW_MAPD_EXCEPTION("Ingest streams are not supported in distributed mode.");
+  }
+  try {
+    auto& cat = session_ptr->getCatalog();
+    auto td_with_lock =
+        lockmgr::TableSchemaLockContainer<lockmgr::ReadLock>::acquireTableDescriptor(
+            cat, table_name, true);
+    const auto td = td_with_lock();
+    CHECK(td);
+    check_table_load_privileges(*session_ptr, table_name);
+    auto loader = std::make_unique<import_export::Loader>(cat, td);
+    const auto& col_descs = loader->get_column_descs();
+    check_valid_column_names(col_descs, params.column_names);
+    auto num_columns = params.column_names.size();
+    if (params.column_names.empty()) {
+      num_columns = std::count_if(col_descs.begin(), col_descs.end(), [](auto cd) {
+        return !cd->isGeoPhyCol;
+      });
+    }
+    if (!params.source_path.empty()) {
+      ddl_utils::validate_allowed_file_path(params.source_path,
+                                            ddl_utils::DataTransferType::IMPORT);
+    }
+    auto stream = ingest_stream_manager_->create(session_ptr,
+                                                 std::move(loader),
+                                                 params.column_names,
+                                                 num_columns,
+                                                 params.commit_interval_ms);
+    if (!params.source_path.empty()) {
+      auto copy_params = thrift_to_copyparams(params.source_copy_params);
+      if (copy_params.delimiter == '\0') {
+        copy_params.delimiter = ',';
+      }
+      auto stream_ptr = stream.get();
+      stream->startSource(
+          params.source_path,
+          copy_params,
+          [this, session_ptr, stream_ptr, copy_params](
+              const std::vector<std::vector<std::string>>& rows) {
+            push_ingest_stream_rows(session_ptr, *stream_ptr, rows, copy_params);
+          });
+    }
+    return stream->getId();
+  } catch (const TOmniSciException&) {
+    throw;
+  } catch (const std::exception& e) {
+    THROW_MAPD_EXCEPTION(std::string(e.what()));
+  }
+}
+
+void DBHandler::push_ingest_stream_columnar(const TSessionId& session,
+                                            const int64_t stream_id,
+                                            const std::vector<TColumn>& cols) {
+  auto stdlog = STDLOG(get_session_ptr(session), "stream_id", stream_id);
+  auto session_ptr = stdlog.getConstSessionInfo();
+  try {
+    auto stream = ingest_stream_manager_->get(session, stream_id);
+    push_ingest_stream_batch(
+        *session_ptr, *stream, cols.size(), [&](ImportBuffers& import_buffers) {
+          return fill_import_buffers_columnar(session,
+                                              session_ptr->getCatalog(),
+                                              stream->getTableName(),
+                                              *stream->getLoader(),
+                                              import_buffers,
+                                              cols,
+                                              stream->getColumnNames(),
+                                              false);
+        });
+  } catch (const TOmniSciException&) {
+    throw;
+  } catch (const std::exception& e) {
+    THROW_MAPD_EXCEPTION(std::string(e.what()));
+  }
+}
+
+void DBHandler::push_ingest_stream_arrow(const TSessionId& session,
+                                         const int64_t stream_id,
+                                         const std::string& arrow_stream) {
+  auto stdlog = STDLOG(get_session_ptr(session), "stream_id", stream_id);
+  auto session_ptr = stdlog.getConstSessionInfo();
+  RecordBatchVector batches = loadArrowStream(arrow_stream);
+  if (batches.empty()) {
+    THROW_MAPD_EXCEPTION("Expected at least one Arrow record batch.");
+  }
+  try {
+    auto stream = ingest_stream_manager_->get(session, stream_id);
+    for (const auto& batch : batches) {
+      push_ingest_stream_batch(*session_ptr,
+                               *stream,
+                               static_cast<size_t>(batch->num_columns()),
+                               [&](ImportBuffers& import_buffers) {
+                                 return fill_import_buffers_arrow(
+                                     session,
+                                     session_ptr->getCatalog(),
+                                     stream->getTableName(),
+                                     *stream->getLoader(),
+                                     import_buffers,
+                                     *batch,
+                                     stream->getColumnNames());
+                               });
+    }
+  } catch (const TOmniSciException&) {
+    throw;
+  } catch (const std::exception& e) {
+    THROW_MAPD_EXCEPTION(std::string(e.what()));
+  }
+}
+
+int64_t DBHandler::close_ingest_stream(const TSessionId& session,
+                                       const int64_t stream_id) {
+  auto stdlog = STDLOG(get_session_ptr(session), "stream_id", stream_id);
+  try {
+    return ingest_stream_manager_->close(session, stream_id);
+  } catch (const TOmniSciException&) {
+    throw;
+  } catch (const std::exception& e) {
+    THROW_MAPD_EXCEPTION(std::string(e.what()));
+  }
+}
+
+void DBHandler::push_ingest_stream_batch(
+    const Catalog_Namespace::SessionInfo& session_info,
+    IngestStream& stream,
+    const size_t num_columns,
+    const std::function<size_t(ImportBuffers&)>& fill_import_buffers) {
+  stream.checkError();
+  if (num_columns != stream.getNumColumns()) {
+    throw std::runtime_error("Number of columns pushed (" + std::to_string(num_columns) +
+                             ") does not match number of columns of ingest stream " +
+                             std::to_string(stream.getId()) + " (" +
+                             std::to_string(stream.getNumColumns()) + ")");
+  }
+  bool flush{false};
+  {
+    auto td_with_lock =
+        lockmgr::TableSchemaLockContainer<lockmgr::ReadLock>::acquireTableDescriptor(
+            session_info.getCatalog(), stream.getTableId());
+    stream.checkTable();
+    auto import_buffers =
+        import_export::setup_column_loaders(td_with_lock(), stream.getLoader());
+    const auto num_rows = fill_import_buffers(import_buffers);
+    flush = stream.append(import_buffers, num_rows);
+  }
+  // the rows are inserted once they fill a fragment, without holding up the push
+  // with a checkpoint
+  if (flush) {
+    stream.flush(false);
+  }
+}
+
+void DBHandler::push_ingest_stream_rows(
+    const std::shared_ptr<const Catalog_Namespace::SessionInfo>& session_info,
+    IngestStream& stream,
+    const std::vector<std::vector<std::string>>& rows,
+    const import_export::CopyParams& copy_params) {
+  std::vector<TStringRow> string_rows(rows.size());
+  for (size_t i = 0; i < rows.size(); ++i) {
+    if (rows[i].size() != stream.getNumColumns()) {
+      throw std::runtime_error("Incorrect number of columns in row: expected " +
+                               std::to_string(stream.getNumColumns()) + ", got " +
+                               std::to_string(rows[i].size()));
+    }
+    for (const auto& field : rows[i]) {
+      auto& value = string_rows[i].cols.emplace_back();
+      value.is_null = field == copy_params.null_str;
+      value.str_val = field;
+    }
+  }
+  push_ingest_stream_batch(
+      *session_info, stream, stream.getNumColumns(), [&](ImportBuffers& import_buffers) {
+        return fill_import_buffers_rows(session_info->get_session_id(),
+                                        session_info->getCatalog(),
+                                        stream.getTableName(),
+                                        *stream.getLoader(),
+                                        import_buffers,
+                                        string_rows,
+                                        stream.getColumnNames(),
+                                        copy_params);
+      });
+}
+
 char DBHandler::unescape_char(std::string str) {
   char out = str[0];
   if (str.size() == 2 && str[0] == '\\') {
@@ -5888,6 +6209,12 @@ std::vector<PushedDownFilterInfo> DBHandler::execute_rel_alg(
                              cat,
                              query_ra,
                              query_state_proxy.getQueryState().shared_from_this());
+  const auto global_hints = ra_executor.getGlobalQueryHint();
+  if (!just_validate && global_hints &&
+      global_hints->isHintRegistered(QueryHint::kQueryTrace)) {
+    // the trace_query guard of sql_execute or sql_execute_df ends the trace
+    logger::start_query_trace(query_state_proxy.getQueryState().getId());
+  }
   CompilationOptions co = {executor_device_type,
                            /*hoist_literals=*/true,
                            ExecutorOptLevel::Default,
@@ -5926,6 +6253,12 @@ std::vector<PushedDownFilterInfo> DBHandler::execute_rel_alg(
   const auto rs = _return.getRows();
   if (rs) {
     execution_time_ms -= rs->getQueueTime();
+    if (!validate_or_explain_query && rs->getStorage() && dispatch_queue_) {
+      // remember the output buffer footprint for admission of future runs of this query
+      dispatch_queue_->recordMemoryEstimate(
+          std::hash<std::string>{}(query_ra),
+          rs->getQueryMemDesc().getBufferSizeBytes(ExecutorDeviceType::CPU));
+    }
   }
   _return.setExecutionTime(execution_time_ms);
   VLOG(1) << cat.getDataMgr().getSystemMemoryUsage();
@@ -6348,6 +6681,8 @@ void DBHandler::sql_execute_impl(ExecutionResult& _return,
          executor_device_type,
          first_n,
          at_most_n](const size_t executor_index) {
+          auto qid_scope_guard =
+              query_state_proxy.getQueryState().setThreadLocalQueryId();
           // if we find proper filters we need to "re-execute" the query
           // with a modified query plan (i.e., which has pushdowned filter)
           // otherwise this trial just executes the query and keeps corresponding query
@@ -6426,9 +6761,17 @@ void DBHandler::sql_execute_impl(ExecutionResult& _return,
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
       }
     }
+    QueryDispatchQueue::TaskInfo task_info;
+    if (session_ptr) {
+      task_info.fair_share_key = session_ptr->get_currentUser().userName;
+      task_info.priority = dispatch_queue_->getUserPriority(task_info.fair_share_key);
+    }
+    task_info.estimated_memory_bytes =
+        dispatch_queue_->getMemoryEstimate(std::hash<std::string>{}(query_ra));
     dispatch_queue_->submit(execute_rel_alg_task,
                             pw.getDMLType() == ParserWrapper::DMLType::Update ||
-                                pw.getDMLType() == ParserWrapper::DMLType::Delete);
+                                pw.getDMLType() == ParserWrapper::DMLType::Delete,
+                            task_info);
     auto result_future = execute_rel_alg_task->get_future();
     result_future.get();
     return;
@@ -6924,6 +7267,12 @@ void DBHandler::insert_data(const TSessionId& session,
     auto insert_data_lock = lockmgr::InsertDataLockMgr::getWriteLockForTable(chunkKey);
     auto data_memory_holder = import_export::fill_missing_columns(&cat, insert_data);
     td->fragmenter->insertDataNoCheckpoint(insert_data);
+    auto& insert_wal = Fragmenter_Namespace::InsertWriteAheadLog::instance();
+    if (g_enable_insert_wal &&
+        td->persistenceLevel == Data_Namespace::MemoryLevel::DISK_LEVEL &&
+        insert_wal.isRunning()) {
+      insert_wal.commit(insert_data, cat, td->tableId);
+    }
   } catch (const std::exception& e) {
     THROW_MAPD_EXCEPTION(std::string(e.what()));
   }
@@ -7121,6 +7470,9 @@ void DBHandler::set_table_epochs(const TSessionId& session,
     leaf_aggregator_.setLeafTableEpochs(*session_ptr, db_id, table_epochs_vector);
   } else {
     auto& cat = session_ptr->getCatalog();
+    // the logged rows newer than the epochs are dropped as well
+    Fragmenter_Namespace::InsertWriteAheadLog::instance().discardTable(
+        cat, cat.getLogicalTableId(table_epochs_vector[0].table_id));
     cat.setTableEpochs(db_id, table_epochs_vector);
   }
 }
@@ -7146,6 +7498,12 @@ void DBHandler::get_license_claims(TLicenseInfo& _return,
 void DBHandler::shutdown() {
   emergency_shutdown();
 
+  if (ingest_stream_manager_) {
+    ingest_stream_manager_->stop();
+  }
+  TableCompactionService::instance().stop();
+  Fragmenter_Namespace::InsertWriteAheadLog::instance().stop();
+
   if (render_handler_) {
     render_handler_->shutdown();
   }
@@ -7670,4 +8028,28 @@ void DBHandler::executeDdl(
 
 void DBHandler::resizeDispatchQueue(size_t queue_size) {
   dispatch_queue_ = std::make_unique<QueryDispatchQueue>(queue_size);
+  configureDispatchQueue();
+}
+
+void DBHandler::configureDispatchQueue() {
+  CHECK(dispatch_queue_);
+  auto set_user_priorities = [this](const std::string& user_names,
+                                    const QueryDispatchQueue::Priority priority) {
+    std::vector<std::string> users;
+    boost::split(users, user_names, boost::is_any_of(","));
+    for (auto& user : users) {
+      boost::trim(user);
+      if (!user.empty()) {
+        dispatch_queue_->setUserPriority(user, priority);
+      }
+    }
+  };
+  set_user_priorities(system_parameters_.high_priority_query_users,
+                      QueryDispatchQueue::Priority::HIGH);
+  set_user_priorities(system_parameters_.low_priority_query_users,
+                      QueryDispatchQueue::Priority::LOW);
+  if (data_mgr_) {
+    dispatch_queue_->setAvailableMemoryCallback(
+        [data_mgr = data_mgr_]() { return data_mgr->getAvailableCpuQueryMemory(); });
+  }
 }
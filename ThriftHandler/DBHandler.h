@@ -55,6 +55,7 @@
 #include "Shared/scope.h"
 #include "StringDictionary/StringDictionaryClient.h"
 #include "ThriftHandler/ConnectionInfo.h"
+#include "ThriftHandler/IngestStreamManager.h"
 #include "ThriftHandler/QueryState.h"
 #include "ThriftHandler/RenderHandler.h"
 #include "ThriftHandler/SystemValidator.h"
@@ -134,7 +135,9 @@ class TrackingProcessor : public OmniSciProcessor {
       }
       if (dynamic_cast<transport::THttpTransport*>(transport.get())) {
         TrackingProcessor::client_protocol = ClientProtocol::HTTP;
-      } else if (dynamic_cast<transport::TBufferedTransport*>(transport.get())) {
+      } else if (dynamic_cast<transport::TBufferedTransport*>(transport.get()) ||
+                 dynamic_cast<transport::TMemoryBuffer*>(transport.get())) {
+        // the nonblocking server reads each framed request into a memory buffer
         TrackingProcessor::client_protocol = ClientProtocol::TCP;
       } else {
         TrackingProcessor::client_protocol = ClientProtocol::Other;
@@ -337,6 +340,8 @@ class DBHandler : public OmniSciIf {
 
   void set_execution_mode(const TSessionId& session,
                           const TExecuteMode::type mode) override;
+  void set_query_tracing(const TSessionId& session, const bool enable) override;
+  void get_query_trace(std::string& _return, const TSessionId& session) override;
   void render_vega(TRenderResult& _return,
                    const TSessionId& session,
                    const int64_t widget_id,
@@ -449,6 +454,17 @@ class DBHandler : public OmniSciIf {
                   const std::string& table_name,
                   const std::vector<TStringRow>& rows,
                   const std::vector<std::string>& column_names) override;
+  int64_t create_ingest_stream(const TSessionId& session,
+                               const std::string& table_name,
+                               const TIngestStreamParams& params) override;
+  void push_ingest_stream_columnar(const TSessionId& session,
+                                   const int64_t stream_id,
+                                   const std::vector<TColumn>& cols) override;
+  void push_ingest_stream_arrow(const TSessionId& session,
+                                const int64_t stream_id,
+                                const std::string& arrow_stream) override;
+  int64_t close_ingest_stream(const TSessionId& session,
+                              const int64_t stream_id) override;
   void detect_column_types(TDetectResult& _return,
                            const TSessionId& session,
                            const std::string& file_name,
@@ -632,6 +648,8 @@ class DBHandler : public OmniSciIf {
   // Visible for use in tests.
   void resizeDispatchQueue(size_t queue_size);
 
+  void configureDispatchQueue();
+
  protected:
   // Returns empty std::shared_ptr if !check_license && session.empty().
   std::shared_ptr<Catalog_Namespace::SessionInfo> get_session_ptr(
@@ -911,6 +929,51 @@ class DBHandler : public OmniSciIf {
       const std::string& table_name,
       bool assign_render_groups);
 
+  // Parse the given batch into the import buffers of the loader and fill the columns
+  // missing from it. Return the number of rows parsed.
+  size_t fill_import_buffers_columnar(
+      const TSessionId& session,
+      const Catalog_Namespace::Catalog& catalog,
+      const std::string& table_name,
+      const import_export::Loader& loader,
+      std::vector<std::unique_ptr<import_export::TypedImportBuffer>>& import_buffers,
+      const std::vector<TColumn>& cols,
+      const std::vector<std::string>& column_names,
+      const bool assign_render_groups);
+
+  size_t fill_import_buffers_arrow(
+      const TSessionId& session,
+      const Catalog_Namespace::Catalog& catalog,
+      const std::string& table_name,
+      const import_export::Loader& loader,
+      std::vector<std::unique_ptr<import_export::TypedImportBuffer>>& import_buffers,
+      const arrow::RecordBatch& batch,
+      const std::vector<std::string>& column_names);
+
+  size_t fill_import_buffers_rows(
+      const TSessionId& session,
+      const Catalog_Namespace::Catalog& catalog,
+      const std::string& table_name,
+      const import_export::Loader& loader,
+      std::vector<std::unique_ptr<import_export::TypedImportBuffer>>& import_buffers,
+      const std::vector<TStringRow>& rows,
+      const std::vector<std::string>& column_names,
+      const import_export::CopyParams& copy_params);
+
+  // Parses a batch pushed into an ingest stream through the given function and moves
+  // its rows into the stream.
+  void push_ingest_stream_batch(
+      const Catalog_Namespace::SessionInfo& session_info,
+      IngestStream& stream,
+      const size_t num_columns,
+      const std::function<size_t(ImportBuffers&)>& fill_import_buffers);
+
+  void push_ingest_stream_rows(
+      const std::shared_ptr<const Catalog_Namespace::SessionInfo>& session_info,
+      IngestStream& stream,
+      const std::vector<std::vector<std::string>>& rows,
+      const import_export::CopyParams& copy_params);
+
   query_state::QueryStates query_states_;
   SessionMap sessions_;
 
@@ -1063,6 +1126,7 @@ class DBHandler : public OmniSciIf {
       std::unordered_map<TSessionId, RenderGroupAssignmentTableMap>;
   RenderGroupAnalyzerSessionMap render_group_assignment_map_;
   std::mutex render_group_assignment_mutex_;
+  std::unique_ptr<IngestStreamManager> ingest_stream_manager_;
   mapd_shared_mutex custom_expressions_mutex_;
 
   void import_geo_table_internal(const TSessionId& session,
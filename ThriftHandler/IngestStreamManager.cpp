@@ -0,0 +1,419 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ThriftHandler/IngestStreamManager.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include "Catalog/Catalog.h"
+#include "ImportExport/DelimitedParserUtils.h"
+#include "ImportExport/Importer.h"
+#include "LockMgr/LockMgr.h"
+#include "Logger/Logger.h"
+#include "Shared/scope.h"
+
+size_t g_ingest_stream_commit_interval_ms{1000};
+
+namespace {
+
+// granularity of the commit thread and of the checks for a stopped source
+constexpr std::chrono::milliseconds kPollInterval{100};
+constexpr size_t kSourceReadSize{1 << 20};
+
+bool is_fifo(const std::string& path) {
+  struct stat path_stat;
+  return stat(path.c_str(), &path_stat) == 0 && S_ISFIFO(path_stat.st_mode);
+}
+
+std::vector<std::vector<std::string>> parse_rows(
+    const char* begin,
+    const char* end,
+    const import_export::CopyParams& copy_params) {
+  std::vector<std::vector<std::string>> rows;
+  std::vector<std::string_view> row;
+  std::vector<std::unique_ptr<char[]>> tmp_buffers;
+  bool try_single_thread{false};
+  for (const char* p = begin; p < end; p++) {
+    row.clear();
+    p = import_export::delimited_parser::get_row(
+        p, end, end, copy_params, nullptr, row, tmp_buffers, try_single_thread, true);
+    if (!row.empty()) {
+      rows.emplace_back(row.begin(), row.end());
+    }
+  }
+  return rows;
+}
+
+}  // namespace
+
+IngestStream::IngestStream(
+    const int64_t stream_id,
+    std::shared_ptr<const Catalog_Namespace::SessionInfo> session_info,
+    std::unique_ptr<import_export::Loader> loader,
+    const std::vector<std::string>& column_names,
+    const size_t num_columns,
+    const std::chrono::milliseconds commit_interval)
+    : stream_id_(stream_id)
+    , session_info_(std::move(session_info))
+    , loader_(std::move(loader))
+    , column_names_(column_names)
+    , num_columns_(num_columns)
+    , commit_interval_(commit_interval)
+    , table_name_(loader_->getTableDesc()->tableName)
+    , table_id_(loader_->getTableDesc()->tableId)
+    , num_table_columns_(loader_->getTableDesc()->nColumns)
+    , flush_row_count_(loader_->getTableDesc()->maxFragRows)
+    , last_commit_time_(std::chrono::steady_clock::now()) {
+  // the buffered rows may outlive the table, so their buffers must not refer to the
+  // column descriptors of the catalog
+  for (const auto cd : loader_->get_column_descs()) {
+    column_descs_.emplace_back(*cd);
+    import_buffers_.emplace_back(std::make_unique<import_export::TypedImportBuffer>(
+        &column_descs_.back(), loader_->getStringDict(cd)));
+  }
+}
+
+IngestStream::~IngestStream() {
+  stopSource();
+}
+
+std::string IngestStream::getSessionId() const {
+  return session_info_->get_session_id();
+}
+
+void IngestStream::checkTable() const {
+  const auto td = loader_->getCatalog().getMetadataForTable(table_id_, false);
+  if (!td || td != loader_->getTableDesc() || td->nColumns != num_table_columns_) {
+    throw std::runtime_error("Table " + table_name_ +
+                             " has been dropped or altered since ingest stream " +
+                             std::to_string(stream_id_) + " was opened.");
+  }
+}
+
+bool IngestStream::append(ImportBuffers& import_buffers, const size_t num_rows) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  CHECK_EQ(import_buffers.size(), import_buffers_.size());
+  for (size_t i = 0; i < import_buffers.size(); ++i) {
+    import_buffers_[i]->append(*import_buffers[i]);
+  }
+  buffered_row_count_ += num_rows;
+  return buffered_row_count_ >= flush_row_count_;
+}
+
+void IngestStream::flush(const bool commit) {
+  auto& cat = loader_->getCatalog();
+  const auto td_with_lock =
+      lockmgr::TableSchemaLockContainer<lockmgr::ReadLock>::acquireTableDescriptor(
+          cat, table_id_);
+  checkTable();
+  const auto insert_data_lock =
+      lockmgr::InsertDataLockMgr::getWriteLockForTable(cat, table_name_);
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (buffered_row_count_ > 0) {
+    // A failed load may have inserted part of the rows, which must not be checkpointed
+    // with the next commit.
+    const auto table_epochs = loader_->getTableEpochs();
+    bool loaded{false};
+    std::string error;
+    try {
+      loaded = loader_->loadNoCheckpoint(
+          import_buffers_, buffered_row_count_, session_info_.get());
+      if (!loaded) {
+        error = loader_->getErrorMessage();
+      }
+    } catch (const std::exception& e) {
+      error = e.what();
+    }
+    for (auto& import_buffer : import_buffers_) {
+      import_buffer->clear();
+    }
+    if (!loaded) {
+      // rolls back the rows loaded since the last commit as well
+      loader_->setTableEpochs(table_epochs);
+      const auto rolled_back_row_count = buffered_row_count_ + loaded_row_count_;
+      buffered_row_count_ = 0;
+      loaded_row_count_ = 0;
+      throw std::runtime_error(error + " (" + std::to_string(rolled_back_row_count) +
+                               " uncommitted rows were rolled back)");
+    }
+    loaded_row_count_ += buffered_row_count_;
+    buffered_row_count_ = 0;
+  }
+  const auto now = std::chrono::steady_clock::now();
+  if (commit || now - last_commit_time_ >= commit_interval_) {
+    if (loaded_row_count_ > 0) {
+      // rolls back to the last commit on failure
+      loader_->checkpoint();
+    }
+    committed_row_count_ += loaded_row_count_;
+    loaded_row_count_ = 0;
+    last_commit_time_ = now;
+  }
+}
+
+bool IngestStream::isCommitDue(const std::chrono::steady_clock::time_point now) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return error_.empty() && buffered_row_count_ + loaded_row_count_ > 0 &&
+         now - last_commit_time_ >= commit_interval_;
+}
+
+void IngestStream::startSource(
+    const std::string& source_path,
+    const import_export::CopyParams& copy_params,
+    std::function<void(const std::vector<std::vector<std::string>>&)> push_rows) {
+  CHECK(!source_thread_.joinable());
+  source_path_ = source_path;
+  source_thread_ = std::thread([this, source_path, copy_params, push_rows] {
+    try {
+      readSource(source_path, copy_params, push_rows);
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Ingest stream " << stream_id_ << " failed to read source "
+                 << source_path << ": " << e.what();
+      setError(e.what());
+    }
+  });
+}
+
+void IngestStream::stopSource() {
+  if (!source_thread_.joinable()) {
+    return;
+  }
+  stop_source_ = true;
+  if (is_fifo(source_path_)) {
+    // a reader blocks on opening a named pipe until a writer opens it
+    const auto fd = open(source_path_.c_str(), O_WRONLY | O_NONBLOCK);
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+  source_thread_.join();
+}
+
+void IngestStream::readSource(
+    const std::string& source_path,
+    const import_export::CopyParams& copy_params,
+    std::function<void(const std::vector<std::vector<std::string>>&)> push_rows) {
+  const auto fd = open(source_path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Could not open " + source_path + ": " +
+                             std::strerror(errno));
+  }
+  ScopeGuard close_source = [fd] { close(fd); };
+  bool skip_header = copy_params.has_header == import_export::ImportHeaderRow::kHasHeader;
+  std::vector<char> buffer;
+  while (true) {
+    pollfd source_poll{fd, POLLIN, 0};
+    const auto ready = poll(&source_poll, 1, kPollInterval.count());
+    if (ready < 0 && errno != EINTR) {
+      throw std::runtime_error("Could not poll " + source_path + ": " +
+                               std::strerror(errno));
+    }
+    if (ready <= 0) {
+      if (stop_source_) {
+        break;
+      }
+      continue;
+    }
+    const auto buffer_size = buffer.size();
+    buffer.resize(buffer_size + kSourceReadSize);
+    const auto bytes_read = read(fd, buffer.data() + buffer_size, kSourceReadSize);
+    if (bytes_read < 0) {
+      buffer.resize(buffer_size);
+      if (errno == EINTR || errno == EAGAIN) {
+        continue;
+      }
+      throw std::runtime_error("Could not read " + source_path + ": " +
+                               std::strerror(errno));
+    }
+    buffer.resize(buffer_size + bytes_read);
+    const bool at_end = bytes_read == 0;
+    // only complete lines are parsed until the end of the source
+    auto parse_end = buffer.size();
+    if (!at_end) {
+      const auto last_line_delim =
+          std::find(buffer.rbegin(), buffer.rend(), copy_params.line_delim);
+      if (last_line_delim == buffer.rend()) {
+        continue;
+      }
+      parse_end = buffer.rend() - last_line_delim;
+    }
+    auto rows = parse_rows(buffer.data(), buffer.data() + parse_end, copy_params);
+    buffer.erase(buffer.begin(), buffer.begin() + parse_end);
+    if (skip_header && !rows.empty()) {
+      rows.erase(rows.begin());
+      skip_header = false;
+    }
+    if (!rows.empty()) {
+      push_rows(rows);
+    }
+    if (at_end) {
+      break;
+    }
+  }
+}
+
+void IngestStream::checkError() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!error_.empty()) {
+    throw std::runtime_error("Ingest stream " + std::to_string(stream_id_) +
+                             " failed: " + error_);
+  }
+}
+
+void IngestStream::setError(const std::string& error) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (error_.empty()) {
+    error_ = error;
+  }
+}
+
+IngestStreamManager::IngestStreamManager() {
+  commit_thread_ = std::thread([this] {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_condition_.wait_for(
+        lock, kPollInterval, [this] { return stop_requested_; })) {
+      lock.unlock();
+      commitDueStreams();
+      lock.lock();
+    }
+  });
+}
+
+IngestStreamManager::~IngestStreamManager() {
+  stop();
+}
+
+std::shared_ptr<IngestStream> IngestStreamManager::create(
+    std::shared_ptr<const Catalog_Namespace::SessionInfo> session_info,
+    std::unique_ptr<import_export::Loader> loader,
+    const std::vector<std::string>& column_names,
+    const size_t num_columns,
+    const int64_t commit_interval_ms) {
+  const auto commit_interval = std::chrono::milliseconds(
+      commit_interval_ms > 0 ? commit_interval_ms : g_ingest_stream_commit_interval_ms);
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (stop_requested_) {
+    throw std::runtime_error("Server is shutting down.");
+  }
+  const auto stream_id = next_stream_id_++;
+  auto stream = std::make_shared<IngestStream>(stream_id,
+                                               std::move(session_info),
+                                               std::move(loader),
+                                               column_names,
+                                               num_columns,
+                                               commit_interval);
+  streams_.emplace(stream_id, stream);
+  return stream;
+}
+
+std::shared_ptr<IngestStream> IngestStreamManager::get(const std::string& session_id,
+                                                       const int64_t stream_id) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto it = streams_.find(stream_id);
+  if (it == streams_.end() || it->second->getSessionId() != session_id) {
+    throw std::runtime_error("Ingest stream " + std::to_string(stream_id) +
+                             " does not exist.");
+  }
+  return it->second;
+}
+
+int64_t IngestStreamManager::close(const std::string& session_id,
+                                   const int64_t stream_id) {
+  auto stream = get(session_id, stream_id);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    streams_.erase(stream_id);
+  }
+  stream->stopSource();
+  stream->checkError();
+  stream->flush(true);
+  return stream->getCommittedRowCount();
+}
+
+void IngestStreamManager::closeSessionStreams(const std::string& session_id) {
+  std::vector<std::shared_ptr<IngestStream>> session_streams;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = streams_.begin(); it != streams_.end();) {
+      if (it->second->getSessionId() == session_id) {
+        session_streams.emplace_back(it->second);
+        it = streams_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+  for (auto& stream : session_streams) {
+    try {
+      stream->stopSource();
+      stream->checkError();
+      stream->flush(true);
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Failed to commit ingest stream " << stream->getId()
+                 << " of a disconnected session: " << e.what();
+    }
+  }
+}
+
+void IngestStreamManager::stop() {
+  std::vector<std::string> session_ids;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stop_requested_) {
+      return;
+    }
+    stop_requested_ = true;
+    for (const auto& stream_entry : streams_) {
+      session_ids.emplace_back(stream_entry.second->getSessionId());
+    }
+  }
+  stop_condition_.notify_one();
+  commit_thread_.join();
+  for (const auto& session_id : session_ids) {
+    closeSessionStreams(session_id);
+  }
+}
+
+void IngestStreamManager::commitDueStreams() {
+  std::vector<std::shared_ptr<IngestStream>> streams;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& stream_entry : streams_) {
+      streams.emplace_back(stream_entry.second);
+    }
+  }
+  const auto now = std::chrono::steady_clock::now();
+  for (auto& stream : streams) {
+    if (!stream->isCommitDue(now)) {
+      continue;
+    }
+    try {
+      stream->flush(true);
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Failed to commit ingest stream " << stream->getId() << ": "
+                 << e.what();
+      stream->setError(e.what());
+    }
+  }
+}
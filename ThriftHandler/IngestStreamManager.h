@@ -0,0 +1,175 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    IngestStreamManager.h
+ * @brief   Long lived ingestion streams into a table.
+ *
+ * A client opens a stream on a table and pushes columnar or Arrow micro-batches into
+ * it. The batches are parsed on arrival, but their rows are only inserted into the
+ * table once a fragment's worth of rows has been buffered, and the table is only
+ * checkpointed at the commit interval of the stream. Instead of being fed by a client,
+ * a stream can read delimited rows from a local file or named pipe.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Catalog/ColumnDescriptor.h"
+#include "ImportExport/CopyParams.h"
+
+namespace Catalog_Namespace {
+class SessionInfo;
+}  // namespace Catalog_Namespace
+
+namespace import_export {
+class Loader;
+class TypedImportBuffer;
+}  // namespace import_export
+
+using ImportBuffers = std::vector<std::unique_ptr<import_export::TypedImportBuffer>>;
+
+class IngestStream {
+ public:
+  IngestStream(const int64_t stream_id,
+               std::shared_ptr<const Catalog_Namespace::SessionInfo> session_info,
+               std::unique_ptr<import_export::Loader> loader,
+               const std::vector<std::string>& column_names,
+               const size_t num_columns,
+               const std::chrono::milliseconds commit_interval);
+
+  ~IngestStream();
+
+  int64_t getId() const { return stream_id_; }
+  std::string getSessionId() const;
+  int32_t getTableId() const { return table_id_; }
+  const std::string& getTableName() const { return table_name_; }
+  const std::vector<std::string>& getColumnNames() const { return column_names_; }
+  // number of columns in each batch pushed into the stream
+  size_t getNumColumns() const { return num_columns_; }
+  import_export::Loader* getLoader() const { return loader_.get(); }
+
+  // Throws if the table has been dropped or altered since the stream was opened. Must
+  // be called with the table schema lock held.
+  void checkTable() const;
+
+  // Moves the rows parsed into the given buffers, which are laid out as the import
+  // buffers of the stream loader, into the stream. Returns true once enough rows are
+  // buffered to fill a fragment.
+  bool append(ImportBuffers& import_buffers, const size_t num_rows);
+
+  // Inserts the buffered rows into the table. With commit set, or once the commit
+  // interval has passed, the table is checkpointed as well. Acquires the table locks.
+  void flush(const bool commit);
+
+  bool isCommitDue(const std::chrono::steady_clock::time_point now) const;
+
+  // Reads delimited rows, one per line, from a local file or named pipe on a separate
+  // thread, passing each batch of rows read to the given function.
+  void startSource(
+      const std::string& source_path,
+      const import_export::CopyParams& copy_params,
+      std::function<void(const std::vector<std::vector<std::string>>&)> push_rows);
+  // Stops reading the source once it has no more data available and waits for the
+  // rows read so far to be pushed.
+  void stopSource();
+
+  // Rethrows the error the source or a background commit of the stream failed with.
+  void checkError() const;
+  void setError(const std::string& error);
+
+  int64_t getCommittedRowCount() const { return committed_row_count_; }
+
+ private:
+  void readSource(
+      const std::string& source_path,
+      const import_export::CopyParams& copy_params,
+      std::function<void(const std::vector<std::vector<std::string>>&)> push_rows);
+
+  const int64_t stream_id_;
+  const std::shared_ptr<const Catalog_Namespace::SessionInfo> session_info_;
+  const std::unique_ptr<import_export::Loader> loader_;
+  const std::vector<std::string> column_names_;
+  const size_t num_columns_;
+  const std::chrono::milliseconds commit_interval_;
+  const std::string table_name_;
+  const int32_t table_id_;
+  const int32_t num_table_columns_;
+  const size_t flush_row_count_;
+
+  mutable std::mutex mutex_;
+  std::list<ColumnDescriptor> column_descs_;
+  ImportBuffers import_buffers_;
+  size_t buffered_row_count_{0};
+  size_t loaded_row_count_{0};
+  std::atomic<int64_t> committed_row_count_{0};
+  std::chrono::steady_clock::time_point last_commit_time_;
+  std::string error_;
+
+  std::string source_path_;
+  std::thread source_thread_;
+  std::atomic<bool> stop_source_{false};
+};
+
+class IngestStreamManager {
+ public:
+  IngestStreamManager();
+  ~IngestStreamManager();
+
+  std::shared_ptr<IngestStream> create(
+      std::shared_ptr<const Catalog_Namespace::SessionInfo> session_info,
+      std::unique_ptr<import_export::Loader> loader,
+      const std::vector<std::string>& column_names,
+      const size_t num_columns,
+      const int64_t commit_interval_ms);
+
+  // Returns the stream with the given id, which must have been opened by the session.
+  std::shared_ptr<IngestStream> get(const std::string& session_id,
+                                    const int64_t stream_id) const;
+
+  // Stops the source of the stream, commits its buffered rows and removes it. Returns
+  // the number of rows committed through the stream.
+  int64_t close(const std::string& session_id, const int64_t stream_id);
+
+  // Closes the streams of a session which has disconnected.
+  void closeSessionStreams(const std::string& session_id);
+
+  // Closes all streams and stops the commit thread.
+  void stop();
+
+ private:
+  void commitDueStreams();
+
+  mutable std::mutex mutex_;
+  std::map<int64_t, std::shared_ptr<IngestStream>> streams_;
+  int64_t next_stream_id_{1};
+
+  bool stop_requested_{false};
+  std::condition_variable stop_condition_;
+  std::thread commit_thread_;
+};
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    NonblockingServer.h
+ * @brief   Event driven Thrift server for the binary protocol port.
+ *
+ * A few IO threads multiplex all client connections and hand complete requests to a
+ * pool of worker threads, so idle connections do not hold a thread each. Clients must
+ * use the framed transport.
+ */
+
+#pragma once
+
+#ifdef HAVE_THRIFT_NONBLOCKING_SERVER
+
+#ifdef HAVE_THRIFT_THREADFACTORY
+#include <thrift/concurrency/ThreadFactory.h>
+#else
+#include <thrift/concurrency/PlatformThreadFactory.h>
+#endif
+#include <thrift/concurrency/ThreadManager.h>
+#include <thrift/server/TNonblockingServer.h>
+#include <thrift/transport/TNonblockingServerSocket.h>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+// Creates a nonblocking server listening on the given port. The queue of the worker
+// pool is unbounded. Instead, once more than max_active_requests requests are executed
+// or waiting for a worker, the server closes new connections on accept until the load
+// drops again. A max_active_requests of 0 means no limit.
+inline std::shared_ptr<apache::thrift::server::TNonblockingServer>
+create_nonblocking_server(
+    std::shared_ptr<apache::thrift::TProcessor> processor,
+    std::shared_ptr<apache::thrift::protocol::TProtocolFactory> protocol_factory,
+    const int port,
+    const size_t num_io_threads,
+    const size_t num_worker_threads,
+    const size_t max_active_requests) {
+  using namespace apache::thrift;
+  auto socket = std::make_shared<transport::TNonblockingServerSocket>(port);
+  auto thread_manager =
+      concurrency::ThreadManager::newSimpleThreadManager(num_worker_threads);
+#ifdef HAVE_THRIFT_THREADFACTORY
+  thread_manager->threadFactory(std::make_shared<concurrency::ThreadFactory>());
+#else
+  thread_manager->threadFactory(std::make_shared<concurrency::PlatformThreadFactory>());
+#endif
+  thread_manager->start();
+
+  auto server = std::make_shared<server::TNonblockingServer>(
+      processor, protocol_factory, socket, thread_manager);
+  server->setNumIOThreads(num_io_threads);
+  if (max_active_requests) {
+    server->setMaxActiveProcessors(max_active_requests);
+    server->setOverloadAction(server::T_OVERLOAD_CLOSE_ON_ACCEPT);
+  }
+#ifdef HAVE_THRIFT_MESSAGE_LIMIT
+  server->setMaxFrameSize(std::numeric_limits<int32_t>::max());
+#endif
+  return server;
+}
+
+#endif  // HAVE_THRIFT_NONBLOCKING_SERVER
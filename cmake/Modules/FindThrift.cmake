@@ -55,6 +55,27 @@ find_library(Thrift_LIBRARY
 
 get_filename_component(Thrift_LIBRARY_DIR ${Thrift_LIBRARY} DIRECTORY)
 
+# The nonblocking server lives in a separate library built on libevent.
+find_library(Thrift_NB_LIBRARY
+  NAMES thriftnb
+  HINTS
+  ${Thrift_LIBRARY_DIR}
+  PATHS
+  /usr/lib
+  /usr/local/lib
+  /usr/local/homebrew/lib
+  /opt/local/lib)
+
+find_library(Libevent_LIBRARY
+  NAMES event
+  HINTS
+  ${Thrift_LIBRARY_DIR}
+  PATHS
+  /usr/lib
+  /usr/local/lib
+  /usr/local/homebrew/lib
+  /opt/local/lib)
+
 find_program(Thrift_EXECUTABLE
   NAMES thrift
   HINTS
@@ -89,6 +110,10 @@ if(Thrift_USE_STATIC_LIBS)
   set(Thrift_LIBRARIES ${Thrift_LIBRARIES} ${OPENSSL_LIBRARIES})
 endif()
 
+if(Thrift_NB_LIBRARY AND Libevent_LIBRARY)
+  set(Thrift_NB_LIBRARIES ${Thrift_NB_LIBRARY} ${Libevent_LIBRARY})
+endif()
+
 set(Thrift_LIBRARY_DIRS ${Thrift_LIBRARY_DIR})
 set(Thrift_INCLUDE_DIRS ${Thrift_LIBRARY_DIR}/../include)
 
@@ -889,6 +889,25 @@ SqlDdl SqlOptimizeTable(Span s) :
     }
 }
 
+/*
+ * Collect the statistics of a table using the following syntax:
+ *
+ * ANALYZE TABLE <tableName>
+ *
+ */
+SqlDdl SqlAnalyzeTable(Span s) :
+{
+    final SqlIdentifier tableName;
+}
+{
+    <ANALYZE>
+    <TABLE>
+    tableName = CompoundIdentifier()
+    {
+        return new SqlAnalyzeTable(s.end(this), tableName.toString());
+    }
+}
+
 
 /*
  * Create a view using the following syntax:
@@ -0,0 +1,41 @@
+package com.mapd.parser.extension.ddl;
+
+import com.google.gson.annotations.Expose;
+
+import org.apache.calcite.sql.SqlDdl;
+import org.apache.calcite.sql.SqlKind;
+import org.apache.calcite.sql.SqlNode;
+import org.apache.calcite.sql.SqlOperator;
+import org.apache.calcite.sql.SqlSpecialOperator;
+import org.apache.calcite.sql.parser.SqlParserPos;
+
+import java.util.List;
+
+/**
+ * Class that encapsulates all information associated with a ANALYZE TABLE DDL command.
+ */
+public class SqlAnalyzeTable extends SqlDdl implements JsonSerializableDdl {
+  private static final SqlOperator OPERATOR =
+          new SqlSpecialOperator("ANALYZE_TABLE", SqlKind.OTHER_DDL);
+
+  @Expose
+  private String command;
+  @Expose
+  private String tableName;
+
+  public SqlAnalyzeTable(final SqlParserPos pos, final String tableName) {
+    super(OPERATOR, pos);
+    this.command = OPERATOR.getName();
+    this.tableName = tableName;
+  }
+
+  @Override
+  public List<SqlNode> getOperandList() {
+    return null;
+  }
+
+  @Override
+  public String toString() {
+    return toJsonString();
+  }
+}
@@ -23,6 +23,7 @@ public class OmniSciHintStrategyTable {
     supportedHints.add("overlaps_no_cache");
     supportedHints.add("overlaps_keys_per_bin");
     supportedHints.add("hash_join");
+    supportedHints.add("query_trace");
 
     for (String hint_name : supportedHints) {
       // add local / global hints, e.., cpu_mode / g_cpu_mode
@@ -545,6 +545,7 @@ public class OmniSciDatabaseMetaDataTest {
         add("memory_details");
         add("memory_summary");
         add("permissions");
+        add("query_queue_summary");
         add("role_assignments");
         add("roles");
         add("storage_details");
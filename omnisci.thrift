@@ -235,6 +235,13 @@ struct TImportStatus {
   4: i64 rows_rejected;
 }
 
+struct TIngestStreamParams {
+  1: list<string> column_names;
+  2: i64 commit_interval_ms=0;
+  3: string source_path;
+  4: TCopyParams source_copy_params;
+}
+
 struct TFrontendView {
   1: string view_name;
   2: string view_state;
@@ -627,6 +634,8 @@ service OmniSci {
   TRowDescriptor sql_validate(1: TSessionId session, 2: string query) throws (1: TOmniSciException e)
   list<completion_hints.TCompletionHint> get_completion_hints(1: TSessionId session, 2: string sql, 3: i32 cursor) throws (1: TOmniSciException e)
   void set_execution_mode(1: TSessionId session, 2: TExecuteMode mode) throws (1: TOmniSciException e)
+  void set_query_tracing(1: TSessionId session, 2: bool enable) throws (1: TOmniSciException e)
+  string get_query_trace(1: TSessionId session) throws (1: TOmniSciException e)
   TRenderResult render_vega(1: TSessionId session, 2: i64 widget_id, 3: string vega_json, 4: i32 compression_level, 5: string nonce) throws (1: TOmniSciException e)
   TPixelTableRowResult get_result_row_for_pixel(1: TSessionId session, 2: i64 widget_id, 3: TPixel pixel, 4: map<string, list<string>> table_col_names, 5: bool column_format, 6: i32 pixelRadius, 7: string nonce) throws (1: TOmniSciException e)
 
@@ -657,6 +666,10 @@ service OmniSci {
   void load_table_binary_columnar_polys(1: TSessionId session, 2: string table_name, 3: list<TColumn> cols, 4: list<string> column_names = {}, 5: bool assign_render_groups = true) throws (1: TOmniSciException e)
   void load_table_binary_arrow(1: TSessionId session, 2: string table_name, 3: binary arrow_stream, 4: bool use_column_names = false) throws (1: TOmniSciException e)
   void load_table(1: TSessionId session, 2: string table_name, 3: list<TStringRow> rows, 4: list<string> column_names = {}) throws (1: TOmniSciException e)
+  i64 create_ingest_stream(1: TSessionId session, 2: string table_name, 3: TIngestStreamParams params) throws (1: TOmniSciException e)
+  void push_ingest_stream_columnar(1: TSessionId session, 2: i64 stream_id, 3: list<TColumn> cols) throws (1: TOmniSciException e)
+  void push_ingest_stream_arrow(1: TSessionId session, 2: i64 stream_id, 3: binary arrow_stream) throws (1: TOmniSciException e)
+  i64 close_ingest_stream(1: TSessionId session, 2: i64 stream_id) throws (1: TOmniSciException e)
   TDetectResult detect_column_types(1: TSessionId session, 2: string file_name, 3: TCopyParams copy_params) throws (1: TOmniSciException e)
   void create_table(1: TSessionId session, 2: string table_name, 3: TRowDescriptor row_desc, 4: TFileType file_type=TFileType.DELIMITED, 5: TCreateParams create_params) throws (1: TOmniSciException e)
   void import_table(1: TSessionId session, 2: string table_name, 3: string file_name, 4: TCopyParams copy_params) throws (1: TOmniSciException e)